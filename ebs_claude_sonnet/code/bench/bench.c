@@ -0,0 +1,324 @@
+/**
+ * @file bench.c
+ * @brief Electronic Braking System - Microbenchmark Harness Implementation
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Each repetition is one timed batch; ns/op of a repetition is the batch
+ * time divided by the batch size. Percentiles use the nearest-rank method
+ * over the sorted repetitions. On Linux the L1D read-miss counter is
+ * enabled around the timed batches only; where the PMU is not exposed
+ * (virtual machines, perf_event_paranoid) the column reads "-".
+ *
+ * Safety Level: QM (test equipment)
+ */
+
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+#include "bench.h"
+
+/* Counter control requests (perf ioctls; placeholders elsewhere) */
+#ifdef __linux__
+#define BENCH_COUNTER_ENABLE        PERF_EVENT_IOC_ENABLE
+#define BENCH_COUNTER_DISABLE       PERF_EVENT_IOC_DISABLE
+#define BENCH_COUNTER_RESET         PERF_EVENT_IOC_RESET
+#else
+#define BENCH_COUNTER_ENABLE        0UL
+#define BENCH_COUNTER_DISABLE       1UL
+#define BENCH_COUNTER_RESET         2UL
+#endif
+
+/* Static Variables */
+static double g_bench_samples[BENCH_MAX_REPS];
+static int g_bench_l1d_fd = -2;             /* -2: not opened yet, -1: unavailable */
+
+/* Static Function Prototypes */
+static int Bench_CompareDouble(const void* a, const void* b);
+static double Bench_Percentile(const double* sorted, uint32_t count, uint32_t percent);
+static void Bench_WriteJsonString(FILE* out, const char* text);
+static void Bench_CounterOpen(void);
+static void Bench_CounterControl(unsigned long request);
+static double Bench_CounterRead(void);
+
+/**
+ * @brief Monotonic time in nanoseconds
+ * @return uint64_t Time
+ */
+uint64_t Bench_NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Run one case
+ * @param bench_case Case to run
+ * @param config Repetition counts
+ * @param result Result
+ * @return ebs_result_t EBS_INVALID_PARAM on a bad case or config
+ */
+ebs_result_t Bench_Run(const bench_case_t* bench_case, const bench_config_t* config,
+                       bench_result_t* result)
+{
+    if (bench_case == NULL || config == NULL || result == NULL || bench_case->run == NULL ||
+        bench_case->ops_per_rep == 0U || config->reps == 0U || config->reps > BENCH_MAX_REPS) {
+        return EBS_INVALID_PARAM;
+    }
+
+    for (uint32_t rep = 0; rep < config->warmup_reps; rep++) {
+        if (bench_case->prepare != NULL) {
+            bench_case->prepare(bench_case->ctx);
+        }
+        bench_case->run(bench_case->ctx, bench_case->ops_per_rep);
+    }
+
+    Bench_CounterOpen();
+    Bench_CounterControl(BENCH_COUNTER_RESET);
+
+    double sum = 0.0;
+    for (uint32_t rep = 0; rep < config->reps; rep++) {
+        if (bench_case->prepare != NULL) {
+            bench_case->prepare(bench_case->ctx);
+        }
+
+        Bench_CounterControl(BENCH_COUNTER_ENABLE);
+        uint64_t start = Bench_NowNs();
+        bench_case->run(bench_case->ctx, bench_case->ops_per_rep);
+        uint64_t elapsed = Bench_NowNs() - start;
+        Bench_CounterControl(BENCH_COUNTER_DISABLE);
+
+        g_bench_samples[rep] = (double)elapsed / (double)bench_case->ops_per_rep;
+        sum += g_bench_samples[rep];
+    }
+
+    double misses = Bench_CounterRead();
+    double mean = sum / (double)config->reps;
+    double variance = 0.0;
+    for (uint32_t rep = 0; rep < config->reps; rep++) {
+        double d = g_bench_samples[rep] - mean;
+        variance += d * d;
+    }
+
+    qsort(g_bench_samples, config->reps, sizeof(g_bench_samples[0]), Bench_CompareDouble);
+
+    memset(result, 0, sizeof(*result));
+    result->name = bench_case->name;
+    result->reps = config->reps;
+    result->ops_per_rep = bench_case->ops_per_rep;
+    result->bytes_per_op = bench_case->bytes_per_op;
+    result->mean_ns = mean;
+    result->stddev_ns = sqrt(variance / (double)config->reps);
+    result->min_ns = g_bench_samples[0];
+    result->p50_ns = Bench_Percentile(g_bench_samples, config->reps, 50U);
+    result->p90_ns = Bench_Percentile(g_bench_samples, config->reps, 90U);
+    result->p99_ns = Bench_Percentile(g_bench_samples, config->reps, 99U);
+    result->max_ns = g_bench_samples[config->reps - 1U];
+    result->l1d_misses_per_op = (misses < 0.0) ? -1.0
+        : misses / ((double)config->reps * (double)bench_case->ops_per_rep);
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Print the table header for Bench_PrintResult
+ * @param out Stream
+ */
+void Bench_PrintHeader(FILE* out)
+{
+    fprintf(out, "  %-28s %10s %10s %10s %10s %10s %10s %10s %8s\n", "case [ns/op]", "mean",
+            "stddev", "min", "p50", "p90", "p99", "MB/s", "L1D/op");
+}
+
+/**
+ * @brief Print one result row
+ * @param out Stream
+ * @param result Result
+ */
+void Bench_PrintResult(FILE* out, const bench_result_t* result)
+{
+    char throughput[16] = "-";
+    char misses[16] = "-";
+
+    if (result->bytes_per_op > 0U && result->p50_ns > 0.0) {
+        snprintf(throughput, sizeof(throughput), "%.1f",
+                 (double)result->bytes_per_op * 1000.0 / result->p50_ns);
+    }
+
+    if (result->l1d_misses_per_op >= 0.0) {
+        snprintf(misses, sizeof(misses), "%.2f", result->l1d_misses_per_op);
+    }
+
+    fprintf(out, "  %-28s %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10s %8s\n", result->name,
+            result->mean_ns, result->stddev_ns, result->min_ns, result->p50_ns, result->p90_ns,
+            result->p99_ns, throughput, misses);
+}
+
+/**
+ * @brief Write all results as one JSON document
+ * @param out Stream
+ * @param suite Suite name
+ * @param config Repetition counts used
+ * @param results Results
+ * @param count Number of results
+ */
+void Bench_WriteJson(FILE* out, const char* suite, const bench_config_t* config,
+                     const bench_result_t* results, uint32_t count)
+{
+    char timestamp[32] = "";
+    time_t now = time(NULL);
+    const struct tm* utc = gmtime(&now);
+
+    if (utc != NULL) {
+        (void)strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", utc);
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"schema\": %u,\n", (unsigned)BENCH_JSON_SCHEMA);
+    fprintf(out, "  \"suite\": ");
+    Bench_WriteJsonString(out, suite);
+    fprintf(out, ",\n");
+    fprintf(out, "  \"version\": \"%u.%u.%u\",\n", (unsigned)EBS_VERSION_MAJOR,
+            (unsigned)EBS_VERSION_MINOR, (unsigned)EBS_VERSION_PATCH);
+    fprintf(out, "  \"timestamp\": \"%s\",\n", timestamp);
+#ifdef __VERSION__
+    fprintf(out, "  \"compiler\": ");
+    Bench_WriteJsonString(out, __VERSION__);
+    fprintf(out, ",\n");
+#endif
+    fprintf(out, "  \"warmup_reps\": %u,\n", (unsigned)config->warmup_reps);
+    fprintf(out, "  \"reps\": %u,\n", (unsigned)config->reps);
+    fprintf(out, "  \"unit\": \"ns/op\",\n");
+    fprintf(out, "  \"results\": [");
+
+    for (uint32_t i = 0; i < count; i++) {
+        const bench_result_t* r = &results[i];
+
+        fprintf(out, "%s\n    { \"name\": ", (i == 0U) ? "" : ",");
+        Bench_WriteJsonString(out, r->name);
+        fprintf(out, ", \"ops_per_rep\": %u, \"bytes_per_op\": %u,\n", (unsigned)r->ops_per_rep,
+                (unsigned)r->bytes_per_op);
+        fprintf(out, "      \"mean\": %.3f, \"stddev\": %.3f, \"min\": %.3f, \"p50\": %.3f,"
+                     " \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f",
+                r->mean_ns, r->stddev_ns, r->min_ns, r->p50_ns, r->p90_ns, r->p99_ns, r->max_ns);
+        if (r->l1d_misses_per_op >= 0.0) {
+            fprintf(out, ",\n      \"l1d_misses\": %.4f }", r->l1d_misses_per_op);
+        } else {
+            fprintf(out, ",\n      \"l1d_misses\": null }");
+        }
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief qsort comparator for doubles
+ */
+static int Bench_CompareDouble(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Nearest-rank percentile of a sorted array
+ */
+static double Bench_Percentile(const double* sorted, uint32_t count, uint32_t percent)
+{
+    uint32_t rank = (count * percent + 99U) / 100U;
+
+    return sorted[(rank > 0U) ? (rank - 1U) : 0U];
+}
+
+/**
+ * @brief Write a JSON string literal (quotes and backslashes escaped)
+ */
+static void Bench_WriteJsonString(FILE* out, const char* text)
+{
+    fputc('"', out);
+    for (const char* c = text; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', out);
+            fputc(*c, out);
+        } else if ((unsigned char)*c >= 0x20U) {
+            fputc(*c, out);
+        }
+    }
+    fputc('"', out);
+}
+
+/**
+ * @brief Open the L1D read-miss counter once per process (disabled)
+ */
+static void Bench_CounterOpen(void)
+{
+    if (g_bench_l1d_fd != -2) {
+        return;
+    }
+    g_bench_l1d_fd = -1;
+
+#ifdef __linux__
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.size = sizeof(attr);
+    attr.config = (uint64_t)PERF_COUNT_HW_CACHE_L1D |
+                  ((uint64_t)PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  ((uint64_t)PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1U;
+    attr.exclude_kernel = 1U;
+    attr.exclude_hv = 1U;
+
+    long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0UL);
+    if (fd >= 0) {
+        g_bench_l1d_fd = (int)fd;
+    }
+#endif
+}
+
+/**
+ * @brief Enable, disable or reset the counter (no-op when unavailable)
+ */
+static void Bench_CounterControl(unsigned long request)
+{
+#ifdef __linux__
+    if (g_bench_l1d_fd >= 0) {
+        (void)ioctl(g_bench_l1d_fd, request, 0);
+    }
+#else
+    (void)request;
+#endif
+}
+
+/**
+ * @brief Counter value since the last reset
+ * @return double Count, or -1.0 when unavailable
+ */
+static double Bench_CounterRead(void)
+{
+#ifdef __linux__
+    uint64_t count = 0U;
+
+    if (g_bench_l1d_fd >= 0 &&
+        read(g_bench_l1d_fd, &count, sizeof(count)) == (ssize_t)sizeof(count)) {
+        return (double)count;
+    }
+#endif
+    return -1.0;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file bench.h
+ * @brief Electronic Braking System - Microbenchmark Harness
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Host-side harness for per-operation cost. A case runs a batch of
+ * operations per repetition; the batch is timed as a whole so clock
+ * overhead is amortized, and the spread across repetitions is reported
+ * as percentiles of ns/op, with the L1D miss rate where the host
+ * exposes hardware counters. Results can be written as JSON for tracking
+ * regressions across releases.
+ *
+ * Safety Level: QM (test equipment)
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include "ebs_types.h"
+#include "ebs_config.h"
+
+/* Harness Constants */
+#define BENCH_MAX_REPS              20000U  /* Repetitions kept per case */
+#define BENCH_JSON_SCHEMA           1U      /* Bumped on incompatible JSON changes */
+
+/* Untimed hook before every repetition (e.g. reset a table) */
+typedef void (*bench_prepare_t)(void* ctx);
+
+/* Timed body: perform @p ops operations */
+typedef void (*bench_run_t)(void* ctx, uint32_t ops);
+
+/* Benchmark case */
+typedef struct {
+    const char* name;                       /* Stable identifier (JSON key) */
+    const char* description;
+    bench_prepare_t prepare;                /* NULL: none */
+    bench_run_t run;
+    void* ctx;
+    uint32_t ops_per_rep;                   /* Operations timed per repetition */
+    uint32_t bytes_per_op;                  /* Payload size for throughput (0: none) */
+} bench_case_t;
+
+/* Repetition counts */
+typedef struct {
+    uint32_t warmup_reps;                   /* Untimed, run first */
+    uint32_t reps;                          /* Timed (<= BENCH_MAX_REPS) */
+} bench_config_t;
+
+/* Per-case result in ns per operation */
+typedef struct {
+    const char* name;
+    uint32_t reps;
+    uint32_t ops_per_rep;
+    uint32_t bytes_per_op;
+    double mean_ns;
+    double stddev_ns;
+    double min_ns;
+    double p50_ns;
+    double p90_ns;
+    double p99_ns;
+    double max_ns;
+    double l1d_misses_per_op;               /* L1D read misses per op (< 0: no counter) */
+} bench_result_t;
+
+/* Harness Function Prototypes */
+
+/**
+ * @brief Monotonic time in nanoseconds
+ * @return uint64_t Time
+ */
+uint64_t Bench_NowNs(void);
+
+/**
+ * @brief Run one case
+ * @param bench_case Case to run
+ * @param config Repetition counts
+ * @param result Result
+ * @return ebs_result_t EBS_INVALID_PARAM on a bad case or config
+ */
+ebs_result_t Bench_Run(const bench_case_t* bench_case, const bench_config_t* config,
+                       bench_result_t* result);
+
+/**
+ * @brief Print the table header for Bench_PrintResult
+ * @param out Stream
+ */
+void Bench_PrintHeader(FILE* out);
+
+/**
+ * @brief Print one result row
+ * @param out Stream
+ * @param result Result
+ */
+void Bench_PrintResult(FILE* out, const bench_result_t* result);
+
+/**
+ * @brief Write all results as one JSON document
+ * @param out Stream
+ * @param suite Suite name
+ * @param config Repetition counts used
+ * @param results Results
+ * @param count Number of results
+ */
+void Bench_WriteJson(FILE* out, const char* suite, const bench_config_t* config,
+                     const bench_result_t* results, uint32_t count);
+
+#endif /* BENCH_H */
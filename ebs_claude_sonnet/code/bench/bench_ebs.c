@@ -0,0 +1,558 @@
+/**
+ * @file bench_ebs.c
+ * @brief Electronic Braking System - Module Microbenchmark Suite
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Host-side ns/op of the per-cycle EBS entry points on the production
+ * modules: ABS control on steady, locking and recovering wheels, the bare
+ * ABS step at cruise with the idle fast path off and on, sensor
+ * acquisition, actuator update, a DTC storm, CRC-32 and a full main-loop
+ * tick. The tick runs the production main loop iteration
+ * (EBS_Scheduler_RunCycle) with the safety manager, lockstep, watchdog and
+ * program-flow monitor; ESC, TCS and communication have no host build and
+ * are stand-ins. A layout report follows the table: size
+ * of the ABS state and the number of its cache lines a step writes, which
+ * stands in for the miss counters on hosts that do not expose them.
+ *
+ * Usage: bench_ebs [--quick] [--reps n] [--warmup n] [--filter text] [--json file]
+ *
+ * Safety Level: QM (test equipment)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "bench.h"
+#include "ebs_abs.h"
+#if (EBS_ENABLE_ESC == 1U)
+#include "ebs_esc.h"
+#endif
+#if (EBS_ENABLE_TCS == 1U)
+#include "ebs_tcs.h"
+#endif
+#include "ebs_sensors.h"
+#include "ebs_actuators.h"
+#include "ebs_communication.h"
+#include "ebs_diagnostics.h"
+#include "ebs_safety.h"
+#include "ebs_watchdog.h"
+#include "ebs_memory.h"
+#include "ebs_lockstep.h"
+#include "ebs_flow_monitor.h"
+#include "ebs_crc.h"
+#include "ebs_scheduler.h"
+
+/* Benchmark Configuration */
+#define BENCH_DEFAULT_REPS          2000U
+#define BENCH_DEFAULT_WARMUP        200U
+#define BENCH_QUICK_REPS            200U
+#define BENCH_QUICK_WARMUP          20U
+#define BENCH_CYCLES_PER_REP        100U    /* Control cycles timed per repetition */
+#define BENCH_DTC_STORM_LENGTH      256U    /* SetDTC calls per storm */
+#define BENCH_PROFILE_LENGTH        200U    /* Frames per wheel speed profile (cycled) */
+#define BENCH_CRC_FRAME_BYTES       64U     /* CAN FD payload */
+#define BENCH_CRC_BLOCK_BYTES       4096U   /* Calibration block */
+#define BENCH_VEHICLE_SPEED_KMH     80.0f
+#define BENCH_LOCK_SLIP             0.35f   /* Slip of a locking wheel */
+#define BENCH_RECOVERY_FRAMES       40U     /* Spin-up back to vehicle speed */
+#define BENCH_MAX_CASES             16U
+#define BENCH_LAYOUT_STEPS          2000U   /* Steps replayed per layout profile */
+
+/* Wheel speed profile replayed into the sensor frame */
+typedef struct {
+    float speed[BENCH_PROFILE_LENGTH][WHEEL_COUNT];     /* km/h */
+    uint32_t index;
+} bench_profile_t;
+
+/* EBS_ABS_Step on a private state instance */
+typedef struct {
+    ebs_abs_system_state_t state;
+    ebs_abs_calibration_t calibration;
+    bench_profile_t* profile;
+    bool idle_fast_path;
+} bench_abs_step_t;
+
+/* CRC case context */
+typedef struct {
+    const uint8_t* data;
+    uint32_t length;
+} bench_crc_t;
+
+/* Static Variables */
+static EBS_ALIGNED(EBS_CACHE_LINE_SIZE) ebs_abs_system_state_t g_bench_layout_state;
+static EBS_ALIGNED(EBS_CACHE_LINE_SIZE) ebs_abs_system_state_t g_bench_layout_before;
+static bench_profile_t g_bench_steady;
+static bench_profile_t g_bench_locking;
+static bench_profile_t g_bench_recovering;
+static bench_profile_t g_bench_tick_profile;
+static bench_abs_step_t g_bench_step_full = { .profile = &g_bench_steady, .idle_fast_path = false };
+static bench_abs_step_t g_bench_step_gated = { .profile = &g_bench_steady, .idle_fast_path = true };
+static uint8_t g_bench_crc_buffer[BENCH_CRC_BLOCK_BYTES];
+static bench_crc_t g_bench_crc_frame = { g_bench_crc_buffer, BENCH_CRC_FRAME_BYTES };
+static bench_crc_t g_bench_crc_block = { g_bench_crc_buffer, BENCH_CRC_BLOCK_BYTES };
+static volatile uint32_t g_bench_sink;
+
+/* Every diagnostic code, more than the DTC table holds */
+static const ebs_dtc_code_t g_bench_dtc_codes[] = {
+    DTC_WHEEL_SPEED_SENSOR_FL, DTC_WHEEL_SPEED_SENSOR_FR, DTC_WHEEL_SPEED_SENSOR_RL,
+    DTC_WHEEL_SPEED_SENSOR_RR, DTC_PRESSURE_SENSOR_MC, DTC_PRESSURE_SENSOR_FL,
+    DTC_PRESSURE_SENSOR_FR, DTC_PRESSURE_SENSOR_RL, DTC_PRESSURE_SENSOR_RR, DTC_IMU_SENSOR,
+    DTC_STEERING_ANGLE_SENSOR, DTC_HYDRAULIC_PUMP, DTC_INLET_VALVE_FL, DTC_INLET_VALVE_FR,
+    DTC_INLET_VALVE_RL, DTC_INLET_VALVE_RR, DTC_OUTLET_VALVE_FL, DTC_OUTLET_VALVE_FR,
+    DTC_OUTLET_VALVE_RL, DTC_OUTLET_VALVE_RR, DTC_SYSTEM_VOLTAGE_LOW, DTC_SYSTEM_VOLTAGE_HIGH,
+    DTC_SYSTEM_TEMPERATURE_HIGH, DTC_CAN_BUS_OFF, DTC_CAN_ERROR_PASSIVE,
+    DTC_SENSOR_SELF_TEST_FAILED, DTC_ACTUATOR_SELF_TEST_FAILED,
+    DTC_COMMUNICATION_SELF_TEST_FAILED, DTC_SAFETY_SELF_TEST_FAILED,
+    DTC_ALGORITHM_SELF_TEST_FAILED, DTC_SAFETY_CRITICAL_FAULT, DTC_WATCHDOG_TIMEOUT,
+    DTC_MEMORY_CORRUPTION, DTC_DUAL_CHANNEL_MISMATCH, DTC_PROGRAM_FLOW_ERROR
+};
+#define BENCH_DTC_CODE_COUNT    (sizeof(g_bench_dtc_codes) / sizeof(g_bench_dtc_codes[0]))
+
+/* Static Function Prototypes */
+static ebs_result_t Bench_InitStack(void);
+static void Bench_BuildProfiles(void);
+static void Bench_ApplyFrame(bench_profile_t* profile);
+static void Bench_AbsControl(void* ctx, uint32_t ops);
+static void Bench_AbsStep(void* ctx, uint32_t ops);
+static void Bench_SensorsReadAll(void* ctx, uint32_t ops);
+static void Bench_ActuatorsUpdate(void* ctx, uint32_t ops);
+static void Bench_DtcStormPrepare(void* ctx);
+static void Bench_DtcStorm(void* ctx, uint32_t ops);
+static void Bench_Crc(void* ctx, uint32_t ops);
+static void Bench_MainLoopTickPrepare(void* ctx);
+static void Bench_MainLoopTick(void* ctx, uint32_t ops);
+static ebs_result_t Bench_TickReadSensors(void);
+static void Bench_ReportAbsLayout(void);
+static double Bench_AbsLinesWritten(bench_profile_t* profile);
+
+/* Stand-ins for modules without a host build */
+#if (EBS_ENABLE_ESC == 1U)
+ebs_result_t EBS_ESC_Control(void) { return EBS_OK; }
+#endif
+#if (EBS_ENABLE_TCS == 1U)
+ebs_result_t EBS_TCS_Control(void) { return EBS_OK; }
+#endif
+ebs_result_t EBS_Communication_Process(void) { return EBS_OK; }
+
+int main(int argc, char** argv)
+{
+    bench_config_t config = { BENCH_DEFAULT_WARMUP, BENCH_DEFAULT_REPS };
+    const char* json_path = NULL;
+    const char* filter = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            config.reps = BENCH_QUICK_REPS;
+            config.warmup_reps = BENCH_QUICK_WARMUP;
+        } else if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc) {
+            config.reps = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            config.warmup_reps = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--quick] [--reps n] [--warmup n] [--filter text] "
+                            "[--json file]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (config.reps == 0U || config.reps > BENCH_MAX_REPS) {
+        fprintf(stderr, "reps must be 1..%u\n", (unsigned)BENCH_MAX_REPS);
+        return 2;
+    }
+
+    if (Bench_InitStack() != EBS_OK) {
+        printf("EBS initialization failed\n");
+        return 1;
+    }
+    Bench_BuildProfiles();
+
+    const bench_case_t cases[] = {
+        { "abs_control_steady", "EBS_ABS_Control, four wheels rolling at vehicle speed",
+          NULL, Bench_AbsControl, &g_bench_steady, BENCH_CYCLES_PER_REP, 0U },
+        { "abs_control_locking", "EBS_ABS_Control, front wheels held at lock slip",
+          NULL, Bench_AbsControl, &g_bench_locking, BENCH_CYCLES_PER_REP, 0U },
+        { "abs_control_recovering", "EBS_ABS_Control, front wheels cycling lock and spin-up",
+          NULL, Bench_AbsControl, &g_bench_recovering, BENCH_CYCLES_PER_REP, 0U },
+        { "abs_step_cruise_full", "EBS_ABS_Step at cruise, idle fast path off",
+          NULL, Bench_AbsStep, &g_bench_step_full, BENCH_CYCLES_PER_REP, 0U },
+        { "abs_step_cruise_gated", "EBS_ABS_Step at cruise, idle fast path on",
+          NULL, Bench_AbsStep, &g_bench_step_gated, BENCH_CYCLES_PER_REP, 0U },
+        { "sensors_read_all", "EBS_Sensors_ReadAll",
+          NULL, Bench_SensorsReadAll, NULL, BENCH_CYCLES_PER_REP, 0U },
+        { "actuators_update", "EBS_Actuators_Update",
+          NULL, Bench_ActuatorsUpdate, NULL, BENCH_CYCLES_PER_REP, 0U },
+        { "diagnostics_set_dtc_storm", "EBS_Diagnostics_SetDTC, every code from an empty table",
+          Bench_DtcStormPrepare, Bench_DtcStorm, NULL, BENCH_DTC_STORM_LENGTH, 0U },
+        { "crc32_64B", "EBS_Crc32_Compute over a CAN FD payload",
+          NULL, Bench_Crc, &g_bench_crc_frame, BENCH_CYCLES_PER_REP, BENCH_CRC_FRAME_BYTES },
+        { "crc32_4KB", "EBS_Crc32_Compute over a calibration block",
+          NULL, Bench_Crc, &g_bench_crc_block, 4U, BENCH_CRC_BLOCK_BYTES },
+        { "main_loop_tick", "One 1 ms main-loop iteration incl. safety monitoring",
+          Bench_MainLoopTickPrepare, Bench_MainLoopTick, &g_bench_tick_profile,
+          BENCH_CYCLES_PER_REP, 0U },
+    };
+    uint32_t case_count = (uint32_t)(sizeof(cases) / sizeof(cases[0]));
+    static bench_result_t results[BENCH_MAX_CASES];
+    uint32_t result_count = 0U;
+
+    printf("EBS microbenchmarks (%u warmup + %u reps)\n", (unsigned)config.warmup_reps,
+           (unsigned)config.reps);
+    Bench_PrintHeader(stdout);
+
+    for (uint32_t i = 0; i < case_count && result_count < BENCH_MAX_CASES; i++) {
+        if (filter != NULL && strstr(cases[i].name, filter) == NULL) {
+            continue;
+        }
+        if (Bench_Run(&cases[i], &config, &results[result_count]) != EBS_OK) {
+            printf("  %s: invalid case\n", cases[i].name);
+            return 1;
+        }
+        Bench_PrintResult(stdout, &results[result_count]);
+        result_count++;
+    }
+
+    /* A tick that dropped out of normal operation timed the safe-state path */
+    if (EBS_GetSystemState() != EBS_STATE_NORMAL) {
+        printf("  main loop left normal operation (state %u)\n", (unsigned)EBS_GetSystemState());
+        return 1;
+    }
+
+    if (filter == NULL || strstr("abs_layout", filter) != NULL) {
+        Bench_ReportAbsLayout();
+    }
+
+    if (json_path != NULL) {
+        FILE* out = fopen(json_path, "w");
+        if (out == NULL) {
+            perror(json_path);
+            return 1;
+        }
+        Bench_WriteJson(out, "ebs", &config, results, result_count);
+        fclose(out);
+        printf("  JSON written to %s\n", json_path);
+    }
+
+    printf("  (checksum %u)\n", (unsigned)g_bench_sink);
+
+    return 0;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief Replica of EBS_SystemInit for the modules with a host build
+ */
+static ebs_result_t Bench_InitStack(void)
+{
+    static const ebs_scheduler_tasks_t tasks = { Bench_TickReadSensors, NULL, NULL, NULL };
+
+    if (EBS_Memory_Init() != EBS_OK || EBS_Watchdog_Init() != EBS_OK ||
+        EBS_Safety_Init() != EBS_OK || EBS_Flow_Init() != EBS_OK ||
+        EBS_Sensors_Init() != EBS_OK || EBS_Actuators_Init() != EBS_OK ||
+        EBS_ABS_Init() != EBS_OK || EBS_Diagnostics_Init() != EBS_OK) {
+        return EBS_ERROR;
+    }
+    EBS_Scheduler_SetTasks(&tasks);
+    Bench_MainLoopTickPrepare(NULL);
+
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U)
+    /* Latency statistics are not of interest here */
+    if (EBS_Lockstep_Init(LOCKSTEP_COMPARE_EXACT, NULL) != EBS_OK) {
+        return EBS_ERROR;
+    }
+#endif
+
+    EBS_Memory_Seal();
+
+    if (EBS_ABS_InitState(&g_bench_step_full.state) != EBS_OK ||
+        EBS_ABS_InitState(&g_bench_step_gated.state) != EBS_OK) {
+        return EBS_ERROR;
+    }
+    g_bench_step_full.calibration = *EBS_ABS_GetDefaultCalibration();
+    g_bench_step_full.calibration.idle_fast_path = g_bench_step_full.idle_fast_path;
+    g_bench_step_gated.calibration = *EBS_ABS_GetDefaultCalibration();
+    g_bench_step_gated.calibration.idle_fast_path = g_bench_step_gated.idle_fast_path;
+    if (EBS_ABS_SetCalibration(&g_bench_step_full.state, &g_bench_step_full.calibration) != EBS_OK ||
+        EBS_ABS_SetCalibration(&g_bench_step_gated.state, &g_bench_step_gated.calibration) != EBS_OK) {
+        return EBS_ERROR;
+    }
+
+    for (uint32_t i = 0; i < BENCH_CRC_BLOCK_BYTES; i++) {
+        g_bench_crc_buffer[i] = (uint8_t)((i * 131U) ^ (i >> 3));
+    }
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Wheel speed profiles (front wheels do the locking)
+ *
+ * Steady: all wheels at vehicle speed. Locking: front wheels held at
+ * BENCH_LOCK_SLIP, so ABS stays active. Recovering: front wheels drop to
+ * BENCH_LOCK_SLIP and spin back up over BENCH_RECOVERY_FRAMES, so the
+ * controller cycles through reduction, hold and increase.
+ */
+static void Bench_BuildProfiles(void)
+{
+    const float v = BENCH_VEHICLE_SPEED_KMH;
+    const float locked = v * (1.0f - BENCH_LOCK_SLIP);
+    const uint32_t half = BENCH_PROFILE_LENGTH / 2U;
+
+    for (uint32_t frame = 0; frame < BENCH_PROFILE_LENGTH; frame++) {
+        /* Small deterministic ripple keeps the filters busy */
+        float ripple = 0.2f * sinf((float)frame * 0.7f);
+        float front;
+
+        if (frame < half) {
+            front = locked;
+        } else if (frame < half + BENCH_RECOVERY_FRAMES) {
+            front = locked + (v - locked) * (float)(frame - half) / (float)BENCH_RECOVERY_FRAMES;
+        } else {
+            front = v;
+        }
+
+        for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+            bool is_front = (wheel == (uint32_t)WHEEL_FRONT_LEFT) ||
+                            (wheel == (uint32_t)WHEEL_FRONT_RIGHT);
+
+            g_bench_steady.speed[frame][wheel] = v + ripple;
+            g_bench_locking.speed[frame][wheel] = (is_front ? locked : v) + ripple;
+            g_bench_recovering.speed[frame][wheel] = (is_front ? front : v) + ripple;
+            g_bench_tick_profile.speed[frame][wheel] = (is_front ? front : v) + ripple;
+        }
+    }
+}
+
+/**
+ * @brief Publish the next profile frame as this cycle's wheel speeds
+ */
+static void Bench_ApplyFrame(bench_profile_t* profile)
+{
+    ebs_wheel_speed_data_t* wheel_data = EBS_Sensors_GetWheelSpeedData();
+    const float* speed = profile->speed[profile->index];
+
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        wheel_data->speed[wheel].value = speed[wheel];
+        wheel_data->speed[wheel].valid = true;
+    }
+
+    profile->index = (profile->index + 1U) % BENCH_PROFILE_LENGTH;
+}
+
+/**
+ * @brief ABS control cycles on a wheel speed profile
+ */
+static void Bench_AbsControl(void* ctx, uint32_t ops)
+{
+    bench_profile_t* profile = (bench_profile_t*)ctx;
+
+    for (uint32_t i = 0; i < ops; i++) {
+        Bench_ApplyFrame(profile);
+        g_bench_sink += (uint32_t)EBS_ABS_Control();
+    }
+}
+
+/**
+ * @brief Pure ABS steps on a profile (no sensor, actuator or lockstep traffic)
+ */
+static void Bench_AbsStep(void* ctx, uint32_t ops)
+{
+    bench_abs_step_t* step = (bench_abs_step_t*)ctx;
+    bench_profile_t* profile = step->profile;
+    ebs_abs_inputs_t in;
+    ebs_control_commands_t commands;
+
+    in.wheel_valid_mask = (1UL << WHEEL_COUNT) - 1UL;
+    in.longitudinal_accel = 0.0f;
+    in.accel_valid = true;
+
+    for (uint32_t i = 0; i < ops; i++) {
+        memcpy(in.wheel_speed, profile->speed[profile->index], sizeof(in.wheel_speed));
+        in.timestamp = i;
+        profile->index = (profile->index + 1U) % BENCH_PROFILE_LENGTH;
+
+        EBS_ABS_Step(&step->state, &in, &commands);
+        g_bench_sink += commands.abs_active[WHEEL_FRONT_LEFT] ? 1U : 0U;
+    }
+}
+
+/**
+ * @brief Print the ABS state layout and the cache lines one step writes
+ */
+static void Bench_ReportAbsLayout(void)
+{
+    const size_t line = EBS_CACHE_LINE_SIZE;
+
+    printf("ABS state layout (%u-byte lines)\n", (unsigned)line);
+    printf("  state %u bytes, %u lines\n", (unsigned)sizeof(ebs_abs_system_state_t),
+           (unsigned)((sizeof(ebs_abs_system_state_t) + line - 1U) / line));
+    printf("  hot block %u bytes from line %u, cold block line %u\n",
+           (unsigned)(offsetof(ebs_abs_system_state_t, wheel_timing) -
+                      offsetof(ebs_abs_system_state_t, wheel_state)),
+           (unsigned)(offsetof(ebs_abs_system_state_t, wheel_state) / line),
+           (unsigned)(offsetof(ebs_abs_system_state_t, wheel_timing) / line));
+    printf("  lines written per step: cruise %.2f, locking %.2f, recovering %.2f\n",
+           Bench_AbsLinesWritten(&g_bench_steady), Bench_AbsLinesWritten(&g_bench_locking),
+           Bench_AbsLinesWritten(&g_bench_recovering));
+}
+
+/**
+ * @brief Mean number of state cache lines that differ after a step
+ *
+ * Diffs a copy of the state taken before each step, so a line rewritten
+ * with its old contents does not count. Deterministic, unlike the
+ * hardware counters, and comparable across hosts.
+ */
+static double Bench_AbsLinesWritten(bench_profile_t* profile)
+{
+    const size_t line = EBS_CACHE_LINE_SIZE;
+    const uint8_t* now = (const uint8_t*)&g_bench_layout_state;
+    const uint8_t* before = (const uint8_t*)&g_bench_layout_before;
+    ebs_abs_inputs_t in;
+    ebs_control_commands_t commands;
+    uint32_t written = 0U;
+
+    if (EBS_ABS_InitState(&g_bench_layout_state) != EBS_OK) {
+        return 0.0;
+    }
+
+    in.wheel_valid_mask = (1UL << WHEEL_COUNT) - 1UL;
+    in.longitudinal_accel = 0.0f;
+    in.accel_valid = true;
+    profile->index = 0U;
+
+    /* One profile period settles the filters before counting */
+    for (uint32_t i = 0; i < BENCH_PROFILE_LENGTH + BENCH_LAYOUT_STEPS; i++) {
+        memcpy(in.wheel_speed, profile->speed[profile->index], sizeof(in.wheel_speed));
+        in.timestamp = i;
+        profile->index = (profile->index + 1U) % BENCH_PROFILE_LENGTH;
+
+        g_bench_layout_before = g_bench_layout_state;
+        EBS_ABS_Step(&g_bench_layout_state, &in, &commands);
+
+        if (i >= BENCH_PROFILE_LENGTH) {
+            for (size_t offset = 0; offset < sizeof(g_bench_layout_state); offset += line) {
+                size_t length = EBS_MIN(line, sizeof(g_bench_layout_state) - offset);
+                if (memcmp(now + offset, before + offset, length) != 0) {
+                    written++;
+                }
+            }
+        }
+    }
+
+    return (double)written / (double)BENCH_LAYOUT_STEPS;
+}
+
+/**
+ * @brief Sensor acquisition cycles
+ */
+static void Bench_SensorsReadAll(void* ctx, uint32_t ops)
+{
+    (void)ctx;
+
+    for (uint32_t i = 0; i < ops; i++) {
+        g_bench_sink += (uint32_t)EBS_Sensors_ReadAll();
+    }
+}
+
+/**
+ * @brief Actuator update cycles
+ */
+static void Bench_ActuatorsUpdate(void* ctx, uint32_t ops)
+{
+    (void)ctx;
+
+    for (uint32_t i = 0; i < ops; i++) {
+        g_bench_sink += (uint32_t)EBS_Actuators_Update();
+    }
+}
+
+/**
+ * @brief Empty DTC table before every storm
+ */
+static void Bench_DtcStormPrepare(void* ctx)
+{
+    (void)ctx;
+    (void)EBS_Diagnostics_Init();
+}
+
+/**
+ * @brief Burst of DTCs: new entries, repeats and a full table
+ */
+static void Bench_DtcStorm(void* ctx, uint32_t ops)
+{
+    (void)ctx;
+
+    for (uint32_t i = 0; i < ops; i++) {
+        g_bench_sink += (uint32_t)EBS_Diagnostics_SetDTC(g_bench_dtc_codes[i % BENCH_DTC_CODE_COUNT]);
+    }
+}
+
+/**
+ * @brief CRC-32 over a fixed buffer
+ */
+static void Bench_Crc(void* ctx, uint32_t ops)
+{
+    const bench_crc_t* crc = (const bench_crc_t*)ctx;
+
+    for (uint32_t i = 0; i < ops; i++) {
+        g_bench_sink += EBS_Crc32_Compute(crc->data, crc->length);
+    }
+}
+
+/**
+ * @brief Restart supervision and the scheduler in normal operation
+ *
+ * The other cases call ABS and the actuators outside a main loop cycle,
+ * which the watchdog and the flow monitor would rightly report.
+ */
+static void Bench_MainLoopTickPrepare(void* ctx)
+{
+    (void)ctx;
+    /* System tick first: the safety manager takes its cycle time reference from it */
+    (void)EBS_Scheduler_Init();
+    (void)EBS_Watchdog_Init();
+    (void)EBS_Flow_Init();
+    (void)EBS_Safety_Init();
+    EBS_Scheduler_Start(true);
+}
+
+/**
+ * @brief Iterations of the main loop in normal operation
+ */
+static void Bench_MainLoopTick(void* ctx, uint32_t ops)
+{
+    (void)ctx;
+
+    for (uint32_t i = 0; i < ops; i++) {
+        EBS_Scheduler_RunCycle();
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U) && (EBS_SAFETY_SECONDARY_CORE == 0U)
+        (void)EBS_Lockstep_SecondaryService();
+#endif
+    }
+}
+
+/**
+ * @brief Sensor acquisition of a main loop tick
+ *
+ * Wheel speeds come from the recovering profile instead of the simulated
+ * pulse counter so that ABS does real work every cycle.
+ */
+static ebs_result_t Bench_TickReadSensors(void)
+{
+    ebs_result_t result = EBS_Sensors_ReadAll();
+
+    Bench_ApplyFrame(&g_bench_tick_profile);
+
+    return result;
+}
@@ -0,0 +1,279 @@
+/**
+ * @file bench_lockstep.c
+ * @brief Electronic Braking System - Software Lockstep Benchmark
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Host-side benchmark of the lockstep channel. The primary thread runs
+ * the ABS step on a synthetic stop at a fixed period and hands every
+ * step to a secondary thread (pinned to another CPU when available). It
+ * reports the primary-side lockstep overhead and the cross-core latency,
+ * and corrupts the primary output at chosen cycles to check that every
+ * injected fault is flagged by the next EBS_Lockstep_Check.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "ebs_lockstep.h"
+#include "ebs_sensors.h"
+#include "ebs_actuators.h"
+#include "ebs_diagnostics.h"
+#include "ebs_safety.h"
+
+/* Benchmark Configuration */
+#define BENCH_CYCLES            20000U
+#define BENCH_PERIOD_NS         100000U     /* Primary cycle (compressed from 1 ms) */
+#define BENCH_BRAKE_CYCLE       2000U       /* Brake onset */
+#define BENCH_LOCK_CYCLE        2500U       /* Front left starts to lock */
+#define BENCH_DT_S              (EBS_CYCLE_TIME_MS / 1000.0f)
+
+/* Cycles whose primary output is corrupted before submission */
+static const uint32_t g_bench_inject_cycles[] = { 3000U, 3001U, 7777U, 12000U, 19998U };
+#define BENCH_INJECT_COUNT  (sizeof(g_bench_inject_cycles) / sizeof(g_bench_inject_cycles[0]))
+
+/* Static Variables */
+static ebs_abs_system_state_t g_bench_primary;
+static ebs_abs_inputs_t g_bench_inputs;
+static ebs_control_commands_t g_bench_commands;
+static volatile int g_bench_stop = 0;
+
+/* Static Function Prototypes */
+static uint64_t Bench_NowNs(void);
+static void Bench_Pin(uint32_t cpu);
+static void* Bench_Secondary(void* arg);
+static void Bench_Inputs(uint32_t cycle, ebs_abs_inputs_t* in);
+static int32_t Bench_InjectIndex(uint32_t cycle);
+
+/* Sensor/actuator/diagnostic stubs: the step itself has no side effects */
+ebs_wheel_speed_data_t* EBS_Sensors_GetWheelSpeedData(void) { return NULL; }
+ebs_imu_data_t* EBS_Sensors_GetIMUData(void) { return NULL; }
+ebs_result_t EBS_Actuators_SetPressure(ebs_wheel_position_t wheel, float pressure)
+{
+    (void)wheel;
+    (void)pressure;
+    return EBS_OK;
+}
+ebs_result_t EBS_Diagnostics_SetDTC(ebs_dtc_code_t dtc) { (void)dtc; return EBS_OK; }
+ebs_result_t EBS_Diagnostics_LogEvent(ebs_diag_event_t event, uint32_t data)
+{
+    (void)event;
+    (void)data;
+    return EBS_OK;
+}
+bool EBS_Safety_DualChannelCompare(float channel_a, float channel_b, float tolerance)
+{
+    float diff = channel_a - channel_b;
+    return (diff <= tolerance) && (diff >= -tolerance);
+}
+uint32_t EBS_GetSystemTick(void) { return 0U; }
+
+/**
+ * @brief Lockstep time base (ns, wraps)
+ */
+uint32_t EBS_GetTimeNs(void)
+{
+    return (uint32_t)Bench_NowNs();
+}
+
+int main(void)
+{
+    pthread_t secondary;
+    uint64_t step_ns = 0U;
+    uint64_t overhead_ns = 0U;
+    uint64_t overhead_max_ns = 0U;
+    uint32_t detected = 0U;
+    uint32_t detect_late_max = 0U;
+    uint32_t false_alarms = 0U;
+    uint32_t busy = 0U;
+    uint32_t timeouts = 0U;
+    bool inject_detected[BENCH_INJECT_COUNT] = { false };
+
+    if (EBS_ABS_InitState(&g_bench_primary) != EBS_OK ||
+        EBS_Lockstep_Init(LOCKSTEP_COMPARE_EXACT, EBS_GetTimeNs) != EBS_OK) {
+        printf("Lockstep init failed\n");
+        return 1;
+    }
+
+    if (pthread_create(&secondary, NULL, Bench_Secondary, NULL) != 0) {
+        printf("Secondary thread creation failed\n");
+        return 1;
+    }
+    Bench_Pin(0U);
+
+    uint64_t next = Bench_NowNs();
+
+    for (uint32_t cycle = 0; cycle < BENCH_CYCLES; cycle++) {
+        /* Sleep to the cycle start so a shared CPU can run the secondary */
+        struct timespec wake = { (time_t)(next / 1000000000ULL), (long)(next % 1000000000ULL) };
+        (void)clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL);
+        next += BENCH_PERIOD_NS;
+
+        /* Safety monitoring runs first: compare the previous step */
+        uint64_t t0 = Bench_NowNs();
+        ebs_result_t check = EBS_Lockstep_Check();
+        uint64_t t1 = Bench_NowNs();
+
+        if (check == EBS_FAULT) {
+            /* Attribute to the oldest undetected injection still in history */
+            bool attributed = false;
+            for (uint32_t i = 0; i < BENCH_INJECT_COUNT && !attributed; i++) {
+                uint32_t inject = g_bench_inject_cycles[i];
+                if (!inject_detected[i] && inject < cycle &&
+                    (cycle - inject) <= LOCKSTEP_HISTORY_DEPTH) {
+                    inject_detected[i] = true;
+                    detect_late_max = EBS_MAX(detect_late_max, cycle - inject);
+                    detected++;
+                    attributed = true;
+                }
+            }
+            if (!attributed) {
+                false_alarms++;
+            }
+        } else if (check == EBS_BUSY) {
+            busy++;
+        } else if (check == EBS_TIMEOUT) {
+            timeouts++;
+        }
+
+        Bench_Inputs(cycle, &g_bench_inputs);
+
+        /* Mirrors EBS_ABS_Control: snapshot, step, submit */
+        uint64_t t2 = Bench_NowNs();
+        ebs_lockstep_request_t* request = EBS_Lockstep_BeginFrame();
+        request->state = g_bench_primary;
+        request->inputs = g_bench_inputs;
+        uint64_t t3 = Bench_NowNs();
+
+        EBS_ABS_Step(&g_bench_primary, &g_bench_inputs, &g_bench_commands);
+        uint64_t t4 = Bench_NowNs();
+
+        if (Bench_InjectIndex(cycle) >= 0) {
+            /* Single bit flip in the primary pressure command */
+            uint32_t bits;
+            memcpy(&bits, &g_bench_commands.brake_pressure_cmd[cycle % WHEEL_COUNT], sizeof(bits));
+            bits ^= 1UL << (cycle % 23U);
+            memcpy(&g_bench_commands.brake_pressure_cmd[cycle % WHEEL_COUNT], &bits, sizeof(bits));
+        }
+
+        uint64_t t5 = Bench_NowNs();
+        EBS_Lockstep_SubmitFrame(&g_bench_commands);
+        uint64_t t6 = Bench_NowNs();
+
+        uint64_t overhead = (t1 - t0) + (t3 - t2) + (t6 - t5);
+        overhead_ns += overhead;
+        overhead_max_ns = EBS_MAX(overhead_max_ns, overhead);
+        step_ns += t4 - t3;
+    }
+
+    g_bench_stop = 1;
+    (void)pthread_join(secondary, NULL);
+
+    const ebs_lockstep_statistics_t* stats = EBS_Lockstep_GetStatistics();
+    double latency_mean = (stats->comparisons > 0U) ?
+                          (double)stats->latency_sum_ns / (double)stats->comparisons : 0.0;
+
+    printf("Software lockstep (ABS step replay, %u cycles at %u us)\n",
+           (unsigned)BENCH_CYCLES, (unsigned)(BENCH_PERIOD_NS / 1000U));
+    printf("  request size:            %u bytes\n", (unsigned)sizeof(ebs_lockstep_request_t));
+    printf("  ABS step (primary):      %.1f ns\n", (double)step_ns / BENCH_CYCLES);
+    printf("  lockstep overhead:       %.1f ns mean, %llu ns max\n",
+           (double)overhead_ns / BENCH_CYCLES, (unsigned long long)overhead_max_ns);
+    printf("  replay latency:          %u / %.0f / %u ns (min/mean/max)\n",
+           (unsigned)stats->latency_min_ns, latency_mean, (unsigned)stats->latency_max_ns);
+    printf("  round trip max:          %u ns\n", (unsigned)stats->round_trip_max_ns);
+    printf("  submitted/replayed:      %u / %u (overwritten %u)\n",
+           (unsigned)stats->frames_submitted, (unsigned)stats->frames_replayed,
+           (unsigned)stats->frames_overwritten);
+    printf("  comparisons/mismatches:  %u / %u\n",
+           (unsigned)stats->comparisons, (unsigned)stats->mismatches);
+    printf("  busy/timeout/stale:      %u / %u / %u\n",
+           (unsigned)busy, (unsigned)timeouts, (unsigned)stats->stale_results);
+    printf("  injected faults:         %u detected of %u, %u false alarms, "
+           "max detection lag %u cycle(s)\n",
+           (unsigned)detected, (unsigned)BENCH_INJECT_COUNT,
+           (unsigned)false_alarms, (unsigned)detect_late_max);
+
+    return 0;
+}
+
+/**
+ * @brief Monotonic time in nanoseconds
+ */
+static uint64_t Bench_NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Pin the calling thread to a CPU (best effort, skipped on one CPU)
+ */
+static void Bench_Pin(uint32_t cpu)
+{
+    cpu_set_t set;
+    if (sched_getaffinity(0, sizeof(set), &set) != 0 || CPU_COUNT(&set) < 2) {
+        return;
+    }
+    CPU_ZERO(&set);
+    CPU_SET(cpu % (uint32_t)CPU_SETSIZE, &set);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/**
+ * @brief Secondary core: replay steps as they arrive
+ */
+static void* Bench_Secondary(void* arg)
+{
+    (void)arg;
+    Bench_Pin(1U);
+
+    while (g_bench_stop == 0) {
+        if (!EBS_Lockstep_SecondaryService()) {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Synthetic stop: cruise, brake at 8 m/s², front left locks
+ */
+static void Bench_Inputs(uint32_t cycle, ebs_abs_inputs_t* in)
+{
+    static float lock_speed = 100.0f;
+    float braking_s = (cycle > BENCH_BRAKE_CYCLE) ?
+                      (BENCH_DT_S * (float)(cycle - BENCH_BRAKE_CYCLE)) : 0.0f;
+    float v = EBS_MAX(100.0f - 8.0f * 3.6f * braking_s, 0.0f);
+
+    lock_speed = (cycle >= BENCH_LOCK_CYCLE) ?
+                 EBS_MAX(lock_speed - 48.0f * 3.6f * BENCH_DT_S, 0.0f) : v;
+
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        in->wheel_speed[wheel] = (wheel == WHEEL_FRONT_LEFT) ? lock_speed : v;
+    }
+    in->wheel_valid_mask = (1UL << WHEEL_COUNT) - 1U;
+    in->longitudinal_accel = (cycle > BENCH_BRAKE_CYCLE && v > 0.0f) ? -8.0f : 0.0f;
+    in->accel_valid = true;
+    in->timestamp = cycle;
+}
+
+/**
+ * @brief Injection index if the primary output of @p cycle is corrupted, else -1
+ */
+static int32_t Bench_InjectIndex(uint32_t cycle)
+{
+    for (uint32_t i = 0; i < BENCH_INJECT_COUNT; i++) {
+        if (g_bench_inject_cycles[i] == cycle) {
+            return (int32_t)i;
+        }
+    }
+    return -1;
+}
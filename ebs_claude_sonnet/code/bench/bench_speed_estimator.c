@@ -0,0 +1,235 @@
+/**
+ * @file bench_speed_estimator.c
+ * @brief Electronic Braking System - Reference Speed Estimator Benchmark
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Host-side benchmark of EBS_SpeedEst_Step. Reports the step cost and
+ * replays synthetic stops to compare slip detection latency against the
+ * previous wheel-only reference (max/mean blend with 0.1 EMA).
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <time.h>
+#include <math.h>
+#include "ebs_speed_estimator.h"
+
+/* Benchmark Configuration */
+#define BENCH_STEPS             2000000U
+#define BENCH_WARMUP_STEPS      10000U
+#define BENCH_DT_S              (EBS_CYCLE_TIME_MS / 1000.0f)
+#define BENCH_CRUISE_STEPS      2000U       /* Constant speed before braking */
+#define BENCH_STOP_STEPS        6000U       /* Replay window */
+#define BENCH_SLIP_THRESHOLD    0.15f       /* Matches ABS_SLIP_THRESHOLD_DEFAULT */
+#define BENCH_IMU_BIAS          0.2f        /* Accelerometer bias (m/s²) */
+
+/* Replayed stop: cruise, then all wheels brake at the vehicle rate and */
+/* locking wheels diverge at lock_rate from lock_start (after braking)  */
+typedef struct {
+    const char* name;
+    float initial_speed;                    /* km/h */
+    float decel;                            /* Vehicle deceleration (m/s²) */
+    uint32_t lock_mask;                     /* Wheels that lock */
+    uint32_t lock_start;                    /* Steps from brake onset to lock-up */
+    float lock_rate;                        /* Extra wheel deceleration (m/s²) */
+} bench_stop_t;
+
+/* Detection result for one reference */
+typedef struct {
+    int32_t detect_step;                    /* -1 if never detected */
+    double error_rms;                       /* Reference error vs truth (km/h) */
+} bench_detect_t;
+
+/* Static Function Prototypes */
+static double Bench_NowUs(void);
+static float Bench_Noise(uint32_t* seed, float amplitude);
+static float Bench_LegacyReference(float* filtered, const float* wheel_speeds);
+static void Bench_ReplayStop(const bench_stop_t* stop);
+
+int main(void)
+{
+    static const bench_stop_t stops[] = {
+        { "single wheel lock", 100.0f, 8.0f, 0x01U, 500U, 40.0f },
+        { "front axle lock",   100.0f, 8.0f, 0x03U, 500U, 40.0f },
+        { "four wheel lock",   100.0f, 8.0f, 0x0FU, 500U, 40.0f },
+        { "low-mu slow lock",   60.0f, 3.0f, 0x0FU, 500U, 10.0f },
+    };
+    ebs_speed_estimator_t est;
+    float wheel_speeds[WHEEL_COUNT] = {80.0f, 80.0f, 80.0f, 80.0f};
+    uint32_t seed = 1U;
+    volatile float sink = 0.0f;
+
+    if (EBS_SpeedEst_Init(&est, BENCH_DT_S) != EBS_OK) {
+        printf("Speed estimator init failed\n");
+        return 1;
+    }
+
+    for (uint32_t step = 0; step < BENCH_WARMUP_STEPS; step++) {
+        sink += EBS_SpeedEst_Step(&est, 0.0f, true, wheel_speeds, 0x0FU);
+    }
+
+    /* Inputs are precomputed per batch so only the step itself is timed */
+    enum { BATCH = 1000 };
+    static float accel[BATCH];
+    static float speeds[BATCH][WHEEL_COUNT];
+    double elapsed_us = 0.0;
+
+    for (uint32_t batch = 0; batch < BENCH_STEPS / BATCH; batch++) {
+        for (uint32_t i = 0; i < BATCH; i++) {
+            accel[i] = Bench_Noise(&seed, 0.5f);
+            for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+                speeds[i][wheel] = 80.0f + Bench_Noise(&seed, 0.3f);
+            }
+        }
+
+        double start = Bench_NowUs();
+        for (uint32_t i = 0; i < BATCH; i++) {
+            sink += EBS_SpeedEst_Step(&est, accel[i], true, speeds[i], 0x0FU);
+        }
+        elapsed_us += Bench_NowUs() - start;
+    }
+
+    printf("Reference speed estimator (2-state Kalman, %u wheels)\n", (unsigned)WHEEL_COUNT);
+    printf("  steps:        %u\n", (unsigned)BENCH_STEPS);
+    printf("  ns per step:  %.1f\n", (elapsed_us * 1000.0) / (double)BENCH_STEPS);
+    printf("\n");
+    printf("Slip detection latency on replayed stops (threshold %.2f)\n",
+           (double)BENCH_SLIP_THRESHOLD);
+    printf("  %-20s %12s %12s %14s %14s\n", "scenario", "legacy [ms]", "kalman [ms]",
+           "legacy rms", "kalman rms");
+
+    for (uint32_t i = 0; i < sizeof(stops) / sizeof(stops[0]); i++) {
+        Bench_ReplayStop(&stops[i]);
+    }
+
+    printf("  (checksum %f)\n", (double)sink);
+
+    return 0;
+}
+
+/**
+ * @brief Monotonic time in microseconds
+ */
+static double Bench_NowUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1.0e6 + (double)ts.tv_nsec / 1.0e3;
+}
+
+/**
+ * @brief Uniform noise in [-amplitude, amplitude] (xorshift32)
+ */
+static float Bench_Noise(uint32_t* seed, float amplitude)
+{
+    uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+    return amplitude * (((float)(x & 0xFFFFU) / 32767.5f) - 1.0f);
+}
+
+/**
+ * @brief Reference speed as computed before the estimator was introduced
+ */
+static float Bench_LegacyReference(float* filtered, const float* wheel_speeds)
+{
+    float max_speed = 0.0f;
+    float speed_sum = 0.0f;
+
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        max_speed = EBS_MAX(max_speed, wheel_speeds[wheel]);
+        speed_sum += wheel_speeds[wheel];
+    }
+
+    float raw = (max_speed + speed_sum / (float)WHEEL_COUNT) / 2.0f;
+    *filtered = 0.1f * raw + 0.9f * (*filtered);
+
+    return *filtered;
+}
+
+/**
+ * @brief Replay one stop through both references and print the latency
+ *
+ * Latency is measured from the step at which the true slip of the first
+ * locking wheel crosses the threshold to the step at which the slip
+ * computed against each reference does.
+ */
+static void Bench_ReplayStop(const bench_stop_t* stop)
+{
+    ebs_speed_estimator_t est;
+    float legacy = stop->initial_speed;
+    float wheel_speeds[WHEEL_COUNT];
+    float lock_speed = stop->initial_speed / 3.6f;
+    uint32_t probe = 0U;
+    uint32_t seed = 12345U;
+    int32_t truth_step = -1;
+    uint32_t samples = 0U;
+    bench_detect_t result[2] = { { -1, 0.0 }, { -1, 0.0 } };
+
+    while ((stop->lock_mask & (1UL << probe)) == 0U) {
+        probe++;
+    }
+
+    (void)EBS_SpeedEst_Init(&est, BENCH_DT_S);
+
+    for (uint32_t step = 0; step < BENCH_STOP_STEPS; step++) {
+        float braking_s = (step > BENCH_CRUISE_STEPS) ?
+                          (BENCH_DT_S * (float)(step - BENCH_CRUISE_STEPS)) : 0.0f;
+        float v = EBS_MAX(stop->initial_speed / 3.6f - stop->decel * braking_s, 0.0f);
+        float accel = (step > BENCH_CRUISE_STEPS && v > 0.0f) ? -stop->decel : 0.0f;
+
+        if (step >= BENCH_CRUISE_STEPS + stop->lock_start) {
+            lock_speed = EBS_MAX(lock_speed - (stop->decel + stop->lock_rate) * BENCH_DT_S, 0.0f);
+        } else {
+            lock_speed = v;
+        }
+
+        for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+            float w = ((stop->lock_mask & (1UL << wheel)) != 0U) ? lock_speed : (v * 0.97f);
+            wheel_speeds[wheel] = EBS_MAX(w * 3.6f + Bench_Noise(&seed, 0.2f), 0.0f);
+        }
+
+        float refs[2];
+        refs[0] = Bench_LegacyReference(&legacy, wheel_speeds);
+        refs[1] = EBS_SpeedEst_Step(&est, accel + BENCH_IMU_BIAS + Bench_Noise(&seed, 0.3f), true,
+                                    wheel_speeds, 0x0FU);
+
+        if (v < (5.0f / 3.6f)) {
+            break;  /* Below ABS activation speed */
+        }
+        samples++;
+
+        if (truth_step < 0 && (v - lock_speed) / v > BENCH_SLIP_THRESHOLD) {
+            truth_step = (int32_t)step;
+        }
+
+        for (uint32_t r = 0; r < 2U; r++) {
+            float err = refs[r] - v * 3.6f;
+            result[r].error_rms += (double)(err * err);
+
+            float slip = (refs[r] > 1.0f) ? (refs[r] - wheel_speeds[probe]) / refs[r] : 0.0f;
+            if (result[r].detect_step < 0 && slip > BENCH_SLIP_THRESHOLD) {
+                result[r].detect_step = (int32_t)step;
+            }
+        }
+    }
+
+    char latency[2][16];
+    for (uint32_t r = 0; r < 2U; r++) {
+        result[r].error_rms = sqrt(result[r].error_rms / (double)EBS_MAX(samples, 1U));
+        if (result[r].detect_step < 0 || truth_step < 0) {
+            snprintf(latency[r], sizeof(latency[r]), "missed");
+        } else {
+            snprintf(latency[r], sizeof(latency[r]), "%d",
+                     (int)(result[r].detect_step - truth_step) * (int)EBS_CYCLE_TIME_MS);
+        }
+    }
+
+    printf("  %-20s %12s %12s %9.2f km/h %9.2f km/h\n", stop->name, latency[0], latency[1],
+           result[0].error_rms, result[1].error_rms);
+}
@@ -16,6 +16,8 @@
 
 #include "ebs_types.h"
 #include "ebs_config.h"
+#include "ebs_speed_estimator.h"
+#include "ebs_filter.h"
 
 /* ABS Function Prototypes */
 
@@ -37,6 +39,14 @@ bool EBS_ABS_SelfTest(void);
  */
 ebs_result_t EBS_ABS_Control(void);
 
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+/**
+ * @brief Expand the logged ABS cycle records into the statistics (100ms diagnostics task)
+ * @return ebs_result_t Process result
+ */
+ebs_result_t EBS_ABS_ProcessStatistics(void);
+#endif
+
 /**
  * @brief Get ABS state for specific wheel
  * @param wheel Wheel position
@@ -50,12 +60,20 @@ ebs_abs_state_t EBS_ABS_GetState(ebs_wheel_position_t wheel);
  */
 bool EBS_ABS_IsActive(void);
 
+/**
+ * @brief Get the reference speed of the last ABS step
+ * @return float Vehicle speed in km/h
+ */
+float EBS_ABS_GetVehicleSpeed(void);
+
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
 /**
  * @brief Get ABS activation count for wheel
  * @param wheel Wheel position
- * @return uint32_t Activation count
+ * @return uint32_t Activation count as of the last EBS_ABS_ProcessStatistics
  */
 uint32_t EBS_ABS_GetActivationCount(ebs_wheel_position_t wheel);
+#endif
 
 /**
  * @brief Calculate wheel slip ratio
@@ -65,13 +83,6 @@ uint32_t EBS_ABS_GetActivationCount(ebs_wheel_position_t wheel);
  */
 float EBS_ABS_CalculateSlipRatio(float wheel_speed, float vehicle_speed);
 
-/**
- * @brief Calculate vehicle reference speed
- * @param wheel_speeds Array of wheel speeds
- * @return float Estimated vehicle speed in km/h
- */
-float EBS_ABS_CalculateVehicleSpeed(const float* wheel_speeds);
-
 /**
  * @brief ABS pressure modulation control
  * @param wheel Wheel position
@@ -127,6 +138,9 @@ bool EBS_ABS_HealthCheck(void);
 #define ABS_MIN_VEHICLE_SPEED           5.0f    /* Minimum speed for ABS activation (km/h) */
 #define ABS_MAX_CYCLE_FREQUENCY         20.0f   /* Maximum ABS cycle frequency (Hz) */
 #define ABS_MIN_CYCLE_FREQUENCY         4.0f    /* Minimum ABS cycle frequency (Hz) */
+#define ABS_WHEEL_ACCEL_FILTER_ALPHA    0.2f    /* Wheel acceleration smoothing */
+#define ABS_SLIP_HISTOGRAM_BINS         10U     /* 0.05 wide; the last bin takes slip >= 0.45 */
+#define ABS_STATS_LOG_LENGTH            256U    /* Cycle records (power of two, > one diagnostics period) */
 
 /* ABS Calibration Structure */
 typedef struct {
@@ -136,6 +150,7 @@ typedef struct {
     float pressure_increase_rate[WHEEL_COUNT];  /* Pressure increase rate per wheel */
     float min_activation_speed;             /* Minimum speed for activation */
     bool enable_per_wheel[WHEEL_COUNT];     /* Enable flag per wheel */
+    bool idle_fast_path;                    /* Skip the wheel pipeline while no wheel can activate */
 } ebs_abs_calibration_t;
 
 /* ABS Statistics Structure */
@@ -146,32 +161,136 @@ typedef struct {
     float avg_cycle_frequency;              /* Average cycle frequency */
     uint32_t fault_count;                   /* Number of faults */
     uint32_t last_activation_time;          /* Timestamp of last activation */
+    uint32_t min_active_duration_ms;        /* Shortest completed intervention (0: none yet) */
+    uint32_t max_active_duration_ms;        /* Longest completed intervention */
+    uint32_t active_run_ms;                 /* Intervention in progress */
+    uint32_t slip_histogram[ABS_SLIP_HISTOGRAM_BINS]; /* Updated steps per slip band */
 } ebs_abs_statistics_t;
 
-/* ABS Internal State Structure */
+/* ABS Internal State Structure (12 bytes, written every step) */
 typedef struct {
-    ebs_abs_state_t state;                  /* Current ABS state */
-    ebs_abs_phase_t phase;                  /* Current ABS phase */
     float slip_ratio;                       /* Current slip ratio */
     float pressure_command;                 /* Current pressure command */
-    uint32_t activation_time;               /* Activation timestamp */
-    uint32_t phase_time;                    /* Phase timestamp */
-    float previous_wheel_speed;             /* Previous wheel speed */
-    float wheel_acceleration;               /* Calculated wheel acceleration */
+    uint8_t state;                          /* Current ABS state (ebs_abs_state_t) */
+    uint8_t phase;                          /* Current ABS phase (ebs_abs_phase_t) */
     bool fault_detected;                    /* Fault flag */
 } ebs_abs_wheel_state_t;
 
-/* ABS System State Structure */
+/* ABS transition timestamps (written on state and phase changes only) */
 typedef struct {
-    ebs_abs_wheel_state_t wheel_state[WHEEL_COUNT]; /* Per-wheel state */
+    uint32_t activation_time;               /* Activation timestamp */
+    uint32_t phase_time;                    /* Phase timestamp */
+} ebs_abs_wheel_timing_t;
+
+/* Statistics inputs of one step (24 bytes), expanded by EBS_ABS_ApplyRecord */
+typedef struct {
+    float slip_ratio[WHEEL_COUNT];          /* Slip of the updated wheels (others 0) */
+    uint32_t timestamp;                     /* Frame tick */
+    uint8_t update_mask;                    /* Wheels whose statistics update ran */
+    uint8_t active_mask;                    /* Updated wheels in ABS_STATE_ACTIVE */
+    uint8_t fault_mask;                     /* Updated wheels with a fault */
+    uint8_t entry_mask;                     /* Wheels that entered ABS_STATE_ACTIVE */
+} ebs_abs_cycle_record_t;
+
+/* Statistics expanded from cycle records (owned by the aggregating task) */
+typedef struct {
+    ebs_abs_statistics_t wheel[WHEEL_COUNT]; /* Per-wheel statistics */
+    uint32_t system_activation_count;       /* Total system activations */
+    uint32_t dropped_records;               /* Steps lost to a full statistics log */
+} ebs_abs_aggregate_t;
+
+/*
+ * ABS System State Structure
+ *
+ * Hot block (two cache lines): all state the step writes every cycle,
+ * including the speed estimator and the per-wheel state of the wheel
+ * acceleration filter. Filter coefficients, transition timestamps and the
+ * calibration pointer follow on a cold line. Statistics are not part of the state:
+ * the step only marks which wheels had their statistics updated or
+ * entered ABS, and the 100 ms diagnostics task expands the cycle records
+ * into an ebs_abs_aggregate_t (see EBS_ABS_RecordCycle). Calibration is a
+ * read-only block referenced by pointer, shared with lockstep replicas of
+ * the state.
+ */
+typedef struct {
+    /* Hot */
+    EBS_ALIGNED(EBS_CACHE_LINE_SIZE) ebs_abs_wheel_state_t wheel_state[WHEEL_COUNT]; /* Per-wheel state */
+    ebs_filter_derivative_state_t wheel_accel[WHEEL_COUNT]; /* Wheel acceleration (m/s²) per wheel */
+    ebs_speed_estimator_t speed_estimator;  /* Reference speed (IMU + wheels) */
     float vehicle_speed;                    /* Estimated vehicle speed */
+    uint32_t idle_step_count;               /* Steps that took the idle fast path */
+    uint8_t actuation_mask;                 /* Wheels whose pressure was commanded this step */
+    uint8_t activation_events;              /* Wheels that entered ABS this step */
+    uint8_t stats_mask;                     /* Wheels whose statistics update ran this step */
+    uint8_t entry_mask;                     /* Wheels that entered ABS_STATE_ACTIVE this step */
+    uint8_t wheel_enable_mask;              /* calibration->enable_per_wheel as bits */
     bool system_enabled;                    /* System enable flag */
     bool any_wheel_active;                  /* Any wheel ABS active */
-    uint32_t system_activation_count;       /* Total system activations */
-    ebs_abs_calibration_t calibration;     /* Calibration parameters */
-    ebs_abs_statistics_t statistics[WHEEL_COUNT]; /* Per-wheel statistics */
+    
+    /* Cold */
+    EBS_ALIGNED(EBS_CACHE_LINE_SIZE) ebs_abs_wheel_timing_t wheel_timing[WHEEL_COUNT]; /* Transition timestamps */
+    ebs_filter_derivative_coeff_t wheel_accel_coeff; /* Wheel acceleration filter coefficients */
+    const ebs_abs_calibration_t* calibration;   /* Calibration parameters (read-only) */
 } ebs_abs_system_state_t;
 
+/* ABS Sensor Frame (latched once per cycle) */
+typedef struct {
+    float wheel_speed[WHEEL_COUNT];         /* Wheel speeds (km/h) */
+    uint32_t wheel_valid_mask;              /* Bit per valid wheel speed */
+    float longitudinal_accel;               /* m/s², forward positive */
+    bool accel_valid;                       /* Longitudinal acceleration usable */
+    uint32_t timestamp;                     /* System tick of the frame */
+} ebs_abs_inputs_t;
+
+/* Reentrant ABS Step */
+
+/**
+ * @brief Initialize an ABS state instance to power-up values
+ * @param sys State instance
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_ABS_InitState(ebs_abs_system_state_t* sys);
+
+/**
+ * @brief Production calibration (read-only, cache-line aligned)
+ * @return const ebs_abs_calibration_t* Default calibration block
+ */
+const ebs_abs_calibration_t* EBS_ABS_GetDefaultCalibration(void);
+
+/**
+ * @brief Use a calibration block for a state instance
+ * @param sys State instance
+ * @param cal Calibration (referenced, must outlive the instance; set again after changing
+ *            enable_per_wheel, which the step reads from a cached mask)
+ * @return ebs_result_t EBS_INVALID_PARAM if a parameter is out of range
+ */
+ebs_result_t EBS_ABS_SetCalibration(ebs_abs_system_state_t* sys, const ebs_abs_calibration_t* cal);
+
+/**
+ * @brief Cycle record of the last step
+ * @param sys State instance after EBS_ABS_Step
+ * @param timestamp Tick of the step's sensor frame
+ * @param record Record to fill
+ */
+void EBS_ABS_RecordCycle(const ebs_abs_system_state_t* sys, uint32_t timestamp,
+                         ebs_abs_cycle_record_t* record);
+
+/**
+ * @brief Expand a cycle record into statistics
+ * @param aggregate Statistics of one state instance
+ * @param record Record of one step, applied in step order
+ */
+void EBS_ABS_ApplyRecord(ebs_abs_aggregate_t* aggregate, const ebs_abs_cycle_record_t* record);
+
+/**
+ * @brief One ABS control step on a state instance (no global side effects)
+ * @param sys State instance
+ * @param in Sensor frame
+ * @param commands Resulting control commands
+ */
+void EBS_ABS_Step(ebs_abs_system_state_t* sys, const ebs_abs_inputs_t* in,
+                  ebs_control_commands_t* commands);
+
 /* ABS Macros */
 #define ABS_IS_WHEEL_VALID(wheel) ((wheel) < WHEEL_COUNT)
 #define ABS_IS_SLIP_EXCESSIVE(slip) ((slip) > EBS_ABS_SLIP_THRESHOLD)
@@ -9,10 +9,153 @@
 #include "ebs_types.h"
 #include "ebs_config.h"
 
+/* Actuator Constants */
+#define VALVE_RESPONSE_TIME_MS              EBS_VALVE_RESPONSE_TIME_MS
+#define VALVE_POSITION_RESPONSE_RATE        100.0f      /* 1/s, first-order spool response */
+#define VALVE_POSITION_ERROR_THRESHOLD      0.2f        /* Feedback/command deviation for a fault */
+#define VALVE_FAULT_DEBOUNCE_MS             20U         /* Deviation time before the DTC and safe state */
+#define VALVE_MAX_FLOW_RATE_L_PER_MIN       2.0f
+#define PUMP_MAX_SPEED_RPM                  6000.0f
+#define PUMP_MAX_CURRENT_A                  30.0f
+#define PUMP_MAX_PRESSURE_BAR               EBS_MAX_BRAKE_PRESSURE
+#define PUMP_SPEED_RESPONSE_RATE            20.0f       /* 1/s */
+#define MAX_PRESSURE_CHANGE_PER_CYCLE       1.0f        /* Normalized command per cycle */
+#define HYDRAULIC_MIN_PRESSURE_BAR          0.0f
+#define HYDRAULIC_MAX_PRESSURE_BAR          EBS_MAX_BRAKE_PRESSURE
+#define HYDRAULIC_RESPONSE_TIME_MS          EBS_VALVE_RESPONSE_TIME_MS
+#define HYDRAULIC_BUILDUP_RATE_BAR_PER_S    1500.0f
+#define HYDRAULIC_RELEASE_RATE_BAR_PER_S    2500.0f
+#define HYDRAULIC_PRESSURE_ERROR_THRESHOLD  EBS_MAX_BRAKE_PRESSURE
+#define HYDRAULIC_WHEEL_TIME_CONSTANT_MS    20.0f       /* Wheel cylinder lag behind the inlet valve */
+#define HYDRAULIC_PLAUSIBILITY_LIMIT        0.25f       /* Sensor/model deviation (normalized pressure) */
+#define HYDRAULIC_PLAUSIBILITY_DEBOUNCE_MS  50U         /* Deviation time before the DTC */
+#define ACTUATOR_STATS_LOG_LENGTH           256U        /* Cycle records (power of two, > one diagnostics period) */
+#define ACTUATOR_FAULT_MODULATOR            0x01U       /* Unit fault bits of a cycle record */
+#define ACTUATOR_FAULT_PUMP                 0x02U
+
+/* Hydraulic valves: one inlet and one outlet per wheel */
+typedef enum {
+    VALVE_INLET_FL = 0,
+    VALVE_INLET_FR,
+    VALVE_INLET_RL,
+    VALVE_INLET_RR,
+    VALVE_OUTLET_FL,
+    VALVE_OUTLET_FR,
+    VALVE_OUTLET_RL,
+    VALVE_OUTLET_RR,
+    VALVE_COUNT
+} ebs_valve_id_t;
+
+/* total_faults ranges over 0 .. VALVE_COUNT + 2 */
+#define ACTUATOR_FAULT_HISTOGRAM_BINS       ((uint32_t)VALVE_COUNT + 3U)
+
+typedef enum {
+    VALVE_TYPE_INLET = 0,                   /* Isolates the wheel from the master cylinder */
+    VALVE_TYPE_OUTLET                       /* Dumps wheel pressure to the accumulator */
+} ebs_valve_type_t;
+
+/* Valve coil driver (PWM stage and spool position feedback on target, simulator in SIL) */
+typedef struct {
+    void (*drive)(ebs_valve_id_t valve, float duty_cycle);  /* Duty cycle in % */
+    float (*position)(ebs_valve_id_t valve);                /* Spool position 0.0 .. 1.0 */
+} ebs_valve_driver_t;
+
+typedef enum {
+    PUMP_STATE_STOPPED = 0,
+    PUMP_STATE_RUNNING
+} ebs_pump_state_t;
+
+typedef struct {
+    ebs_valve_type_t type;
+    float max_flow_rate;                    /* l/min */
+    uint32_t response_time_ms;
+    float position_command;                 /* 0.0 closed .. 1.0 open */
+    float applied_command;                  /* Command driven in the previous update */
+    float current_position;                 /* Spool position feedback */
+    float pwm_duty_cycle;                   /* % */
+    uint32_t fault_ms;                      /* Consecutive feedback deviation time */
+    uint32_t command_timestamp;
+    bool enabled;
+    bool fault_detected;
+} ebs_valve_t;
+
+typedef struct {
+    float max_speed;                        /* rpm */
+    float max_current;                      /* A */
+    float max_pressure;                     /* bar */
+    ebs_pump_state_t state;
+    float speed_command;                    /* 0.0 .. 1.0 */
+    float current_speed;                    /* 0.0 .. 1.0 */
+    float current_draw;                     /* A */
+    float pwm_duty_cycle;                   /* % */
+    uint32_t command_timestamp;
+    bool enabled;
+    bool fault_detected;
+} ebs_pump_motor_t;
+
+typedef struct {
+    float min_pressure;                     /* bar */
+    float max_pressure;                     /* bar */
+    uint32_t response_time_ms;
+    float current_pressure;                 /* bar */
+    float target_pressure;                  /* bar */
+    float pressure_buildup_rate;            /* bar/s */
+    float pressure_release_rate;            /* bar/s */
+    bool enabled;
+    bool fault_detected;
+} ebs_hydraulic_modulator_t;
+
+/* Fault bits of one update (8 bytes), expanded by EBS_Actuators_ProcessDiagnostics */
+typedef struct {
+    uint32_t timestamp;                     /* Tick of the update */
+    uint8_t valve_fault_mask;               /* Bit per ebs_valve_id_t */
+    uint8_t unit_fault_mask;                /* ACTUATOR_FAULT_MODULATOR, ACTUATOR_FAULT_PUMP */
+} ebs_actuator_cycle_record_t;
+
+typedef struct {
+    bool hydraulic_modulator_fault;
+    bool pump_motor_fault;
+    uint32_t valve_faults;
+    uint32_t total_faults;
+    uint32_t last_update_time;
+    uint32_t update_cycles;                 /* Updates aggregated */
+    uint32_t fault_cycles;                  /* Updates with any fault */
+    uint32_t max_total_faults;              /* Most simultaneous faults */
+    uint32_t valve_fault_cycles[VALVE_COUNT]; /* Updates with the valve faulted */
+    uint32_t fault_histogram[ACTUATOR_FAULT_HISTOGRAM_BINS]; /* Updates per total_faults */
+    uint32_t dropped_records;               /* Updates lost to a full log */
+} ebs_actuator_diagnostics_t;
+
+typedef struct {
+    ebs_hydraulic_modulator_t hydraulic_modulator;
+    ebs_pump_motor_t pump_motor;
+    ebs_valve_t valves[VALVE_COUNT];
+    float pressure_commands[WHEEL_COUNT];   /* 0.0 .. 1.0 */
+    uint32_t command_timestamps[WHEEL_COUNT];
+    uint32_t command_mask;                  /* Wheels commanded since the last update */
+    float wheel_pressure_model[WHEEL_COUNT]; /* Expected wheel pressure (normalized) */
+    uint32_t pressure_error_ms[WHEEL_COUNT]; /* Consecutive sensor/model deviation time */
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+    ebs_actuator_diagnostics_t diagnostics;
+#endif
+    bool system_enabled;
+    uint32_t last_update_time;
+    uint32_t update_count;
+} ebs_actuator_manager_t;
+
+void EBS_Actuators_SetValveDriver(const ebs_valve_driver_t* driver);
 ebs_result_t EBS_Actuators_Init(void);
 bool EBS_Actuators_SelfTest(void);
 ebs_result_t EBS_Actuators_Update(void);
 ebs_result_t EBS_Actuators_SetPressure(ebs_wheel_position_t wheel, float pressure);
+float EBS_Actuators_GetPressure(ebs_wheel_position_t wheel);
+ebs_result_t EBS_Actuators_SetPumpSpeed(float speed);
+float EBS_Actuators_GetPumpSpeed(void);
+bool EBS_Actuators_IsOperational(void);
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+const ebs_actuator_diagnostics_t* EBS_Actuators_GetDiagnostics(void);
+ebs_result_t EBS_Actuators_ProcessDiagnostics(void);
+#endif
 void EBS_Actuators_Shutdown(void);
 void EBS_Actuators_EmergencyStop(void);
 
@@ -0,0 +1,119 @@
+/**
+ * @file ebs_adc_scan.h
+ * @brief Electronic Braking System - ADC Scan Group Module
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Burst acquisition of a group of ADC channels into one contiguous buffer,
+ * with optional oversampling/decimation and a single-pass calibration and
+ * range check over the whole group
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#ifndef EBS_ADC_SCAN_H
+#define EBS_ADC_SCAN_H
+
+#include "ebs_types.h"
+#include "ebs_config.h"
+
+/* ADC Scan Constants */
+#define ADC_SCAN_MAX_CHANNELS           8U      /* Maximum channels per scan group */
+#define ADC_SCAN_MAX_OVERSAMPLE_SHIFT   4U      /* Up to 16x oversampling */
+#define ADC_SCAN_MAX_SAMPLES            (ADC_SCAN_MAX_CHANNELS << ADC_SCAN_MAX_OVERSAMPLE_SHIFT)
+#define ADC_SCAN_FULL_SCALE             4095U   /* 12-bit converter */
+
+/* Scan Group State */
+typedef enum {
+    ADC_SCAN_STATE_IDLE = 0,
+    ADC_SCAN_STATE_BUSY,
+    ADC_SCAN_STATE_COMPLETE,
+    ADC_SCAN_STATE_FAULT
+} ebs_adc_scan_state_t;
+
+/**
+ * @brief Conversion engine for a scan group
+ *
+ * Fills @p buffer with @p rounds consecutive sweeps over @p channel_count
+ * channels, sample-interleaved (sweep-major). On target this wraps the
+ * ADC sequencer and DMA; in SIL it is a simulator.
+ */
+typedef ebs_result_t (*ebs_adc_scan_source_t)(const uint8_t* channels,
+                                              uint32_t channel_count,
+                                              uint32_t rounds,
+                                              uint16_t* buffer);
+
+/* Per-channel calibration, laid out as parallel arrays for the batch pass */
+typedef struct {
+    float offset[ADC_SCAN_MAX_CHANNELS];    /* Offset in raw counts */
+    float scale[ADC_SCAN_MAX_CHANNELS];     /* Engineering units per count */
+    float min_value[ADC_SCAN_MAX_CHANNELS]; /* Valid range lower bound */
+    float max_value[ADC_SCAN_MAX_CHANNELS]; /* Valid range upper bound */
+} ebs_adc_scan_calibration_t;
+
+/* Scan Group */
+typedef struct {
+    uint8_t channels[ADC_SCAN_MAX_CHANNELS];    /* Hardware channel numbers */
+    uint32_t channel_count;                     /* Channels in group */
+    uint32_t oversample_shift;                  /* log2 of oversampling ratio */
+    ebs_adc_scan_source_t source;               /* Conversion engine */
+    ebs_adc_scan_state_t state;                 /* Acquisition state */
+    uint16_t buffer[ADC_SCAN_MAX_SAMPLES];      /* DMA target, sweep-major */
+    uint16_t raw[ADC_SCAN_MAX_CHANNELS];        /* Decimated raw counts */
+    float value[ADC_SCAN_MAX_CHANNELS];         /* Calibrated values */
+    uint32_t valid_mask;                        /* Bit n set if channel n valid */
+    uint32_t completion_time;                   /* Tick of last completion */
+    uint32_t scan_count;                        /* Completed scans */
+    uint32_t overrun_count;                     /* Triggers while busy */
+} ebs_adc_scan_group_t;
+
+/* ADC Scan Function Prototypes */
+
+/**
+ * @brief Initialize a scan group
+ * @param group Scan group to initialize
+ * @param channels Hardware channel list
+ * @param channel_count Number of channels
+ * @param oversample_shift log2 of oversampling ratio (0 = no oversampling)
+ * @param source Conversion engine
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_AdcScan_Init(ebs_adc_scan_group_t* group, const uint8_t* channels,
+                              uint32_t channel_count, uint32_t oversample_shift,
+                              ebs_adc_scan_source_t source);
+
+/**
+ * @brief Trigger one burst acquisition of the whole group
+ * @param group Scan group
+ * @return ebs_result_t EBS_BUSY if the previous scan has not been consumed
+ */
+ebs_result_t EBS_AdcScan_Trigger(ebs_adc_scan_group_t* group);
+
+/**
+ * @brief DMA transfer-complete notification (ISR context on target)
+ * @param group Scan group
+ * @param timestamp Completion tick
+ */
+void EBS_AdcScan_OnComplete(ebs_adc_scan_group_t* group, uint32_t timestamp);
+
+/**
+ * @brief Decimate, calibrate and range-check the completed buffer
+ * @param group Scan group
+ * @param cal Per-channel calibration
+ * @return ebs_result_t EBS_BUSY if no completed scan is available
+ */
+ebs_result_t EBS_AdcScan_Process(ebs_adc_scan_group_t* group,
+                                 const ebs_adc_scan_calibration_t* cal);
+
+/**
+ * @brief Simulated conversion engine (mid-scale on every channel)
+ */
+ebs_result_t EBS_AdcScan_SimulatedSource(const uint8_t* channels, uint32_t channel_count,
+                                         uint32_t rounds, uint16_t* buffer);
+
+/* ADC Scan Macros */
+#define ADC_SCAN_IS_CHANNEL_VALID(group, ch) EBS_TEST_BIT((group)->valid_mask, (ch))
+
+#endif /* EBS_ADC_SCAN_H */
@@ -13,5 +13,7 @@ ebs_result_t EBS_Communication_Init(void);
 bool EBS_Communication_SelfTest(void);
 ebs_result_t EBS_Communication_Process(void);
 void EBS_Communication_Shutdown(void);
+ebs_result_t EBS_Communication_SendDTCNotification(ebs_dtc_code_t dtc_code, bool confirmed);
+ebs_result_t EBS_Communication_SendShutdownNotification(void);
 
 #endif /* EBS_COMMUNICATION_H */
\ No newline at end of file
@@ -25,16 +25,41 @@
 #define EBS_SYSTEM_TICK_HZ          1000U       /* 1 kHz system tick */
 #define EBS_CAN_BAUDRATE            500000U     /* 500 kbps */
 
-/* Feature Configuration */
+/*
+ * Feature Configuration
+ *
+ * Defaults build the full variant; a variant overrides them on the
+ * compiler command line (see VARIANT in the Makefile). A disabled feature
+ * is compiled out: its task is not scheduled, supervised or expected by
+ * the flow monitor, and its state is not allocated.
+ */
+#ifndef EBS_ENABLE_ABS
 #define EBS_ENABLE_ABS              1U          /* Enable ABS function */
+#endif
+#ifndef EBS_ENABLE_ESC
 #define EBS_ENABLE_ESC              1U          /* Enable ESC function */
+#endif
+#ifndef EBS_ENABLE_TCS
 #define EBS_ENABLE_TCS              1U          /* Enable TCS function */
+#endif
+#ifndef EBS_ENABLE_BRAKE_ASSIST
 #define EBS_ENABLE_BRAKE_ASSIST     1U          /* Enable brake assist */
-#define EBS_ENABLE_DIAGNOSTICS      1U          /* Enable diagnostics */
+#endif
+#ifndef EBS_ENABLE_DIAGNOSTICS
+#define EBS_ENABLE_DIAGNOSTICS      1U          /* Enable diagnostics task and statistics */
+#endif
+#ifndef EBS_ENABLE_CYBERSECURITY
 #define EBS_ENABLE_CYBERSECURITY    1U          /* Enable security features */
+#endif
+
+/* Every variant brakes through the ABS step (lockstep, flow and watchdog assume it) */
+#if (EBS_ENABLE_ABS != 1U)
+#error "EBS_ENABLE_ABS must be 1: ABS is the base function of every variant"
+#endif
 
 /* Safety Configuration */
 #define EBS_SAFETY_DUAL_CHANNEL     1U          /* Enable dual-channel safety */
+#define EBS_SAFETY_SECONDARY_CORE   0U          /* 1: secondary channel on its own core */
 #define EBS_SAFETY_WATCHDOG         1U          /* Enable watchdog monitoring */
 #define EBS_SAFETY_MEMORY_PROTECT   1U          /* Enable memory protection */
 #define EBS_SAFETY_CRC_CHECK        1U          /* Enable CRC checking */
@@ -51,6 +76,12 @@
 #define EBS_STACK_SIZE_ISR          (2U * 1024U)    /* ISR stack size */
 #define EBS_HEAP_SIZE               (64U * 1024U)   /* Heap size */
 
+/* Static Arena Budgets (carved from EBS_HEAP_SIZE at init) */
+#define EBS_ARENA_SIZE_COMM         (16U * 1024U)   /* CAN rings */
+#define EBS_ARENA_SIZE_DIAG         (16U * 1024U)   /* UDS buffers */
+#define EBS_ARENA_SIZE_RECORDER     (24U * 1024U)   /* Flight recorder */
+#define EBS_ARENA_SIZE_SPARE        (8U * 1024U)    /* Unassigned reserve */
+
 /* Task Configuration */
 #define EBS_TASK_PRIORITY_SAFETY    255U        /* Highest priority */
 #define EBS_TASK_PRIORITY_ABS       200U        /* High priority */
@@ -72,6 +103,8 @@
 #define EBS_PRESSURE_SENSORS        6U          /* Number of pressure sensors */
 #define EBS_SENSOR_TIMEOUT_MS       50U         /* Sensor data timeout */
 #define EBS_SENSOR_FILTER_ALPHA     0.1f        /* Low-pass filter coefficient */
+#define EBS_PRESSURE_ADC_FIRST_CH   0U          /* First ADC channel of pressure scan group */
+#define EBS_PRESSURE_OVERSAMPLE_SHIFT 2U        /* Pressure oversampling (4x) */
 
 /* Actuator Configuration */
 #define EBS_HYDRAULIC_VALVES        8U          /* Number of hydraulic valves */
@@ -185,6 +218,12 @@
 #define EBS_MEMORY_BARRIER()        __asm__ volatile ("" ::: "memory")
 #define EBS_COMPILER_BARRIER()      __asm__ volatile ("" ::: "memory")
 
+/* Cross-Core Atomics (single word, acquire/release ordering) */
+#define EBS_ATOMIC_LOAD(ptr)            __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define EBS_ATOMIC_STORE(ptr, val)      __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#define EBS_ATOMIC_EXCHANGE(ptr, val)   __atomic_exchange_n((ptr), (val), __ATOMIC_ACQ_REL)
+#define EBS_CACHE_LINE_SIZE             64U
+
 /* Critical Section Macros */
 #define EBS_ENTER_CRITICAL()        __disable_irq()
 #define EBS_EXIT_CRITICAL()         __enable_irq()
@@ -211,5 +250,6 @@
 void EBS_AssertFailed(const char* file, uint32_t line);
 void EBS_Delay_Ms(uint32_t delay_ms);
 void EBS_Delay_Us(uint32_t delay_us);
+uint32_t EBS_GetTimeNs(void);
 
 #endif /* EBS_CONFIG_H */
@@ -0,0 +1,57 @@
+/**
+ * @file ebs_crc.h
+ * @brief Electronic Braking System - CRC-32 Library
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Table-driven CRC-32 (SAFETY_CRC_POLYNOMIAL, reflected, ISO-HDLC
+ * parameters) for calibration blocks, NVM records and message payloads.
+ * The table is const and lives in flash.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#ifndef EBS_CRC_H
+#define EBS_CRC_H
+
+#include "ebs_types.h"
+#include "ebs_config.h"
+
+/* CRC Constants */
+#define CRC32_POLYNOMIAL_REFLECTED  0xEDB88320U     /* 0x04C11DB7 bit-reversed */
+#define CRC32_INITIAL_VALUE         0xFFFFFFFFU
+#define CRC32_FINAL_XOR             0xFFFFFFFFU
+#define CRC32_CHECK_VALUE           0xCBF43926U     /* CRC of "123456789" */
+
+/* CRC Function Prototypes */
+
+/**
+ * @brief CRC-32 of a buffer
+ * @param data Buffer (may be NULL if @p length is 0)
+ * @param length Buffer length in bytes
+ * @return uint32_t CRC value
+ */
+uint32_t EBS_Crc32_Compute(const uint8_t* data, uint32_t length);
+
+/**
+ * @brief Continue a CRC-32 over another chunk
+ *
+ * Start with CRC32_INITIAL_VALUE and XOR the last result with
+ * CRC32_FINAL_XOR.
+ *
+ * @param crc Running register
+ * @param data Chunk
+ * @param length Chunk length in bytes
+ * @return uint32_t Updated register
+ */
+uint32_t EBS_Crc32_Update(uint32_t crc, const uint8_t* data, uint32_t length);
+
+/**
+ * @brief Check the table against the standard check value
+ * @return bool True if the CRC of "123456789" is CRC32_CHECK_VALUE
+ */
+bool EBS_Crc32_SelfTest(void);
+
+#endif /* EBS_CRC_H */
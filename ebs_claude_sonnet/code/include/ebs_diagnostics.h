@@ -8,11 +8,69 @@
 
 #include "ebs_types.h"
 #include "ebs_config.h"
+#include "ebs_memory.h"
+
+/* Diagnostics Constants */
+#define DIAGNOSTICS_MAX_DTC_COUNT           32U     /* DTC table entries */
+#define DIAGNOSTICS_MAX_EVENT_COUNT         64U     /* Event ring buffer entries */
+#define DIAGNOSTICS_CONFIRMATION_THRESHOLD  3U      /* Occurrences before confirmation */
+#define DIAGNOSTICS_CONFIRMATION_TIME_MS    1000U   /* Pending time before confirmation */
+
+/* DTC table entry */
+typedef struct {
+    ebs_dtc_code_t dtc_code;                /* DTC_NO_FAULT if the entry is free */
+    bool active;
+    bool pending;
+    bool confirmed;
+    uint32_t first_occurrence_timestamp;
+    uint32_t last_occurrence_timestamp;
+    uint32_t cleared_timestamp;
+    uint32_t occurrence_count;
+    uint32_t clear_count;
+} ebs_dtc_entry_t;
+
+/* Event log entry */
+typedef struct {
+    ebs_diag_event_t event_type;
+    uint32_t data;
+    uint32_t timestamp;
+} ebs_diagnostic_event_entry_t;
+
+/* Diagnostics statistics */
+typedef struct {
+    uint32_t total_dtc_count;               /* DTCs ever stored */
+    uint32_t active_dtc_count;
+    uint32_t confirmed_dtc_count;
+    uint32_t event_log_count;
+    uint32_t last_update_time;
+} ebs_diagnostic_statistics_t;
+
+/* Diagnostics manager */
+typedef struct {
+    ebs_dtc_entry_t dtc_table[DIAGNOSTICS_MAX_DTC_COUNT];
+    ebs_diagnostic_event_entry_t event_log[DIAGNOSTICS_MAX_EVENT_COUNT];
+    uint32_t event_log_index;               /* Next slot to write */
+    uint32_t event_log_count;
+    uint32_t total_dtc_count;
+    uint32_t active_dtc_count;
+    ebs_diagnostic_statistics_t statistics;
+    bool system_enabled;
+    uint32_t last_update_time;
+    uint32_t update_count;
+} ebs_diagnostics_manager_t;
 
 ebs_result_t EBS_Diagnostics_Init(void);
+bool EBS_Diagnostics_SelfTest(void);
 ebs_result_t EBS_Diagnostics_Process(void);
 void EBS_Diagnostics_Shutdown(void);
 ebs_result_t EBS_Diagnostics_SetDTC(ebs_dtc_code_t dtc);
+ebs_result_t EBS_Diagnostics_ClearDTC(ebs_dtc_code_t dtc);
+bool EBS_Diagnostics_IsDTCActive(ebs_dtc_code_t dtc);
+uint32_t EBS_Diagnostics_GetActiveDTCCount(void);
 ebs_result_t EBS_Diagnostics_LogEvent(ebs_diag_event_t event, uint32_t data);
+ebs_result_t EBS_Diagnostics_GetMemoryReport(ebs_memory_report_t* report);
+const ebs_diagnostic_statistics_t* EBS_Diagnostics_GetStatistics(void);
+const ebs_dtc_entry_t* EBS_Diagnostics_GetDTCTable(void);
+const ebs_diagnostic_event_entry_t* EBS_Diagnostics_GetEventLog(void);
 
 #endif /* EBS_DIAGNOSTICS_H */
@@ -0,0 +1,223 @@
+/**
+ * @file ebs_filter.h
+ * @brief Electronic Braking System - Signal Filter Library
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Reentrant digital filters with explicit state objects. Every filter has
+ * a bank form that processes all channels (e.g. all wheels) in one call.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#ifndef EBS_FILTER_H
+#define EBS_FILTER_H
+
+#include "ebs_types.h"
+#include "ebs_config.h"
+
+/* Filter Constants */
+#define FILTER_MAX_CHANNELS         8U      /* Channels per bank */
+#define FILTER_MAX_BIQUAD_SECTIONS  4U      /* Sections per cascade */
+#define FILTER_MAX_MEDIAN_WINDOW    9U      /* Moving median window (odd) */
+
+/* Exponential Moving Average (first-order low-pass) bank */
+typedef struct {
+    float alpha;                            /* Weight of new sample (0..1] */
+    uint32_t channels;                      /* Active channels */
+    float y[FILTER_MAX_CHANNELS];           /* Filter output per channel */
+} ebs_filter_ema_t;
+
+/* Biquad section coefficients (a0 normalized to 1) */
+typedef struct {
+    float b0, b1, b2;
+    float a1, a2;
+} ebs_filter_biquad_coeff_t;
+
+/* Biquad cascade bank (transposed direct form II) */
+typedef struct {
+    ebs_filter_biquad_coeff_t coeff[FILTER_MAX_BIQUAD_SECTIONS]; /* Shared coefficients */
+    uint32_t sections;                                           /* Active sections */
+    uint32_t channels;                                           /* Active channels */
+    float z1[FILTER_MAX_BIQUAD_SECTIONS][FILTER_MAX_CHANNELS];   /* State 1 per channel */
+    float z2[FILTER_MAX_BIQUAD_SECTIONS][FILTER_MAX_CHANNELS];   /* State 2 per channel */
+} ebs_filter_biquad_t;
+
+/* Moving median (single channel, spike rejection) */
+typedef struct {
+    float window[FILTER_MAX_MEDIAN_WINDOW]; /* Sample ring */
+    uint32_t length;                        /* Window length (odd) */
+    uint32_t index;                         /* Next write position */
+    uint32_t fill;                          /* Samples held */
+} ebs_filter_median_t;
+
+/* Differentiator followed by EMA smoothing: coefficients shared by all channels */
+typedef struct {
+    float inv_dt;                           /* 1 / sample period */
+    float alpha;                            /* Smoothing weight (1 = none) */
+} ebs_filter_derivative_coeff_t;
+
+/* Differentiator state of one channel */
+typedef struct {
+    float previous;                         /* Previous input */
+    float y;                                /* Filtered derivative */
+} ebs_filter_derivative_state_t;
+
+/* Differentiator bank (up to FILTER_MAX_CHANNELS channels) */
+typedef struct {
+    ebs_filter_derivative_coeff_t coeff;                  /* Shared coefficients */
+    uint32_t channels;                                    /* Active channels */
+    ebs_filter_derivative_state_t state[FILTER_MAX_CHANNELS]; /* State per channel */
+} ebs_filter_derivative_t;
+
+/* Filter Function Prototypes */
+
+/**
+ * @brief Initialize an EMA bank
+ * @param filter EMA bank
+ * @param alpha Weight of new sample (0..1]
+ * @param channels Number of channels
+ * @param initial Initial output of every channel
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Filter_EmaInit(ebs_filter_ema_t* filter, float alpha, uint32_t channels,
+                                float initial);
+
+/**
+ * @brief Update a single-channel EMA
+ * @param filter EMA bank (channel 0 is used)
+ * @param input New sample
+ * @return float Filtered value
+ */
+float EBS_Filter_EmaUpdate(ebs_filter_ema_t* filter, float input);
+
+/**
+ * @brief Update all channels of an EMA bank
+ * @param filter EMA bank
+ * @param input One sample per channel
+ * @param output Filtered values per channel (may be NULL)
+ */
+void EBS_Filter_EmaUpdateBank(ebs_filter_ema_t* filter, const float* input, float* output);
+
+/**
+ * @brief Reset every channel of an EMA bank to a value
+ * @param filter EMA bank
+ * @param value Reset value
+ */
+void EBS_Filter_EmaReset(ebs_filter_ema_t* filter, float value);
+
+/**
+ * @brief Design a second-order Butterworth-style low-pass section
+ * @param coeff Output coefficients
+ * @param cutoff_hz Cutoff frequency
+ * @param sample_hz Sample rate
+ * @param q Quality factor (0.7071 for Butterworth)
+ * @return ebs_result_t Design result
+ */
+ebs_result_t EBS_Filter_BiquadDesignLowPass(ebs_filter_biquad_coeff_t* coeff, float cutoff_hz,
+                                            float sample_hz, float q);
+
+/**
+ * @brief Initialize a biquad cascade bank
+ * @param filter Biquad bank
+ * @param coeff Section coefficients
+ * @param sections Number of sections
+ * @param channels Number of channels
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Filter_BiquadInit(ebs_filter_biquad_t* filter,
+                                   const ebs_filter_biquad_coeff_t* coeff,
+                                   uint32_t sections, uint32_t channels);
+
+/**
+ * @brief Run all channels through the cascade
+ * @param filter Biquad bank
+ * @param input One sample per channel
+ * @param output Filtered values per channel
+ */
+void EBS_Filter_BiquadUpdateBank(ebs_filter_biquad_t* filter, const float* input, float* output);
+
+/**
+ * @brief Clear biquad state
+ * @param filter Biquad bank
+ */
+void EBS_Filter_BiquadReset(ebs_filter_biquad_t* filter);
+
+/**
+ * @brief Initialize a moving median
+ * @param filter Median filter
+ * @param length Window length (odd, <= FILTER_MAX_MEDIAN_WINDOW)
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Filter_MedianInit(ebs_filter_median_t* filter, uint32_t length);
+
+/**
+ * @brief Push a sample and return the median of the window
+ * @param filter Median filter
+ * @param input New sample
+ * @return float Median value
+ */
+float EBS_Filter_MedianUpdate(ebs_filter_median_t* filter, float input);
+
+/**
+ * @brief Compute differentiator coefficients
+ * @param coeff Coefficients
+ * @param dt_s Sample period in seconds
+ * @param alpha Smoothing weight (1 = raw derivative)
+ * @return ebs_result_t Design result
+ */
+ebs_result_t EBS_Filter_DerivativeDesign(ebs_filter_derivative_coeff_t* coeff, float dt_s,
+                                         float alpha);
+
+/**
+ * @brief Update a caller-owned array of differentiator channels
+ * @param coeff Shared coefficients
+ * @param state State per channel (sized by the caller at compile time)
+ * @param input One sample per channel
+ * @param channels Number of channels
+ *
+ * Lets a module keep its channel state next to its other hot data and
+ * the coefficients elsewhere, without the FILTER_MAX_CHANNELS bank.
+ */
+void EBS_Filter_DerivativeStep(const ebs_filter_derivative_coeff_t* coeff,
+                               ebs_filter_derivative_state_t* state, const float* input,
+                               uint32_t channels);
+
+/**
+ * @brief Initialize a filtered differentiator bank
+ * @param filter Differentiator bank
+ * @param dt_s Sample period in seconds
+ * @param alpha Smoothing weight (1 = raw derivative)
+ * @param channels Number of channels
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Filter_DerivativeInit(ebs_filter_derivative_t* filter, float dt_s, float alpha,
+                                       uint32_t channels);
+
+/**
+ * @brief Update one channel of a differentiator bank
+ * @param filter Differentiator bank
+ * @param channel Channel index
+ * @param input New sample
+ * @return float Filtered derivative
+ */
+float EBS_Filter_DerivativeUpdate(ebs_filter_derivative_t* filter, uint32_t channel, float input);
+
+/**
+ * @brief Update all channels of a differentiator bank
+ * @param filter Differentiator bank
+ * @param input One sample per channel
+ * @param output Filtered derivative per channel (may be NULL)
+ */
+void EBS_Filter_DerivativeUpdateBank(ebs_filter_derivative_t* filter, const float* input,
+                                     float* output);
+
+/**
+ * @brief Reset a differentiator bank (previous inputs and outputs to zero)
+ * @param filter Differentiator bank
+ */
+void EBS_Filter_DerivativeReset(ebs_filter_derivative_t* filter);
+
+#endif /* EBS_FILTER_H */
@@ -0,0 +1,113 @@
+/**
+ * @file ebs_flow_monitor.h
+ * @brief Electronic Braking System - Program Flow Signature Monitor
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Every checkpoint of the control cycle folds its compile-time constant
+ * into a running signature (rotate + xor). The fold is order-sensitive,
+ * so a skipped, repeated or reordered checkpoint leaves a different
+ * signature. The safety monitor compares the closed signature of each
+ * control cycle against the value expected for that cycle's schedule.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#ifndef EBS_FLOW_MONITOR_H
+#define EBS_FLOW_MONITOR_H
+
+#include "ebs_types.h"
+#include "ebs_config.h"
+
+/* Checkpoint constants (arbitrary, pairwise distinct bit patterns) */
+#define FLOW_CP_CYCLE_START         0x3C5A96E1UL
+#define FLOW_CP_SENSORS             0x5B1E2D87UL
+#define FLOW_CP_ABS                 0x6D94C3B2UL
+#define FLOW_CP_ESC                 0x71A8E54DUL
+#define FLOW_CP_TCS                 0x8E37B19CUL
+#define FLOW_CP_ACTUATORS           0x94D2675AUL
+#define FLOW_CP_COMMUNICATION       0xA6F10C39UL
+#define FLOW_CP_DIAGNOSTICS         0xB85B4AE3UL
+#define FLOW_CP_CYCLE_END           0xC72E9F14UL
+
+#define FLOW_SIGNATURE_SEED         0x0EB5F10EUL
+#define FLOW_SIGNATURE_ROTATE       7U
+
+/* Rate-group tasks that may or may not run in a control cycle */
+#define FLOW_TASK_ESC               0x01U
+#define FLOW_TASK_TCS               0x02U
+#define FLOW_TASK_COMMUNICATION     0x04U
+#define FLOW_TASK_DIAGNOSTICS       0x08U
+#define FLOW_SCHEDULE_VARIANTS      16U
+
+/* Flow monitor statistics */
+typedef struct {
+    uint32_t cycles_checked;                /* Closed cycles compared */
+    uint32_t signature_errors;              /* Cycles with an unexpected signature */
+    uint32_t last_signature;                /* Last closed signature */
+    uint32_t last_expected;                 /* Expected value for it */
+} ebs_flow_statistics_t;
+
+/* Running signature of the current control cycle */
+extern uint32_t g_flow_signature;
+
+/**
+ * @brief Fold one checkpoint into a signature
+ * @param signature Running signature
+ * @param checkpoint Checkpoint constant
+ * @return uint32_t New signature
+ */
+static EBS_FORCE_INLINE uint32_t EBS_Flow_Fold(uint32_t signature, uint32_t checkpoint)
+{
+    return ((signature << FLOW_SIGNATURE_ROTATE) |
+            (signature >> (32U - FLOW_SIGNATURE_ROTATE))) ^ checkpoint;
+}
+
+/**
+ * @brief Record a checkpoint of the running control cycle
+ * @param checkpoint Checkpoint constant (FLOW_CP_*)
+ */
+static EBS_FORCE_INLINE void EBS_Flow_Checkpoint(uint32_t checkpoint)
+{
+    g_flow_signature = EBS_Flow_Fold(g_flow_signature, checkpoint);
+}
+
+/* Flow Monitor Function Prototypes */
+
+/**
+ * @brief Precompute the expected signature of every schedule variant
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Flow_Init(void);
+
+/**
+ * @brief Start a control cycle (resets the signature, folds FLOW_CP_CYCLE_START)
+ */
+void EBS_Flow_BeginCycle(void);
+
+/**
+ * @brief Close a control cycle (folds FLOW_CP_CYCLE_END, latches the signature)
+ */
+void EBS_Flow_EndCycle(void);
+
+/**
+ * @brief Compare the last closed cycle with its schedule (once per tick)
+ * @return ebs_result_t EBS_OK (also if no cycle closed), EBS_FAULT on mismatch
+ */
+ebs_result_t EBS_Flow_Check(void);
+
+/**
+ * @brief Verify that skipped and reordered checkpoints are detected
+ * @return bool True if self-test passed
+ */
+bool EBS_Flow_SelfTest(void);
+
+/**
+ * @brief Get flow monitor statistics
+ * @return const ebs_flow_statistics_t* Statistics
+ */
+const ebs_flow_statistics_t* EBS_Flow_GetStatistics(void);
+
+#endif /* EBS_FLOW_MONITOR_H */
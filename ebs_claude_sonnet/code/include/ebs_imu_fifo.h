@@ -0,0 +1,115 @@
+/**
+ * @file ebs_imu_fifo.h
+ * @brief Electronic Braking System - IMU FIFO Ingestion and Decimation
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Burst ingestion of high-rate IMU FIFO frames and polyphase FIR
+ * decimation of all six axes down to the control loop rate
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#ifndef EBS_IMU_FIFO_H
+#define EBS_IMU_FIFO_H
+
+#include "ebs_types.h"
+#include "ebs_config.h"
+
+/* IMU FIFO Constants */
+#define IMU_FIFO_ODR_HZ             8000U   /* IMU output data rate */
+#define IMU_FIFO_DECIMATION         (IMU_FIFO_ODR_HZ / EBS_SYSTEM_TICK_HZ)
+#define IMU_FIFO_MAX_BURST          32U     /* Frames drained per tick (max) */
+#define IMU_FIR_TAPS                32U     /* Anti-alias FIR length */
+#define IMU_FIR_CUTOFF_HZ           200.0f  /* Pass band edge */
+#define IMU_AXIS_LANES              8U      /* Axes padded to one SIMD register */
+#define IMU_FIFO_ACCEL_LSB_PER_G    2048.0f /* ±16 g full scale */
+#define IMU_FIFO_GYRO_LSB_PER_DPS   16.4f   /* ±2000 deg/s full scale */
+#define IMU_FIFO_STANDARD_GRAVITY   9.80665f /* m/s² per g */
+
+/* Axis lanes */
+typedef enum {
+    IMU_AXIS_ACCEL_X = 0,                   /* Longitudinal acceleration */
+    IMU_AXIS_ACCEL_Y,                       /* Lateral acceleration */
+    IMU_AXIS_ACCEL_Z,                       /* Vertical acceleration */
+    IMU_AXIS_GYRO_X,                        /* Roll rate */
+    IMU_AXIS_GYRO_Y,                        /* Pitch rate */
+    IMU_AXIS_GYRO_Z,                        /* Yaw rate */
+    IMU_AXIS_COUNT
+} ebs_imu_axis_t;
+
+/* One FIFO frame as delivered by the device */
+typedef struct {
+    int16_t axis[IMU_AXIS_COUNT];
+} ebs_imu_fifo_frame_t;
+
+/**
+ * @brief FIFO read function (SPI burst on target, generator in SIL)
+ * @param frames Destination for up to @p max_frames frames
+ * @param max_frames Capacity of @p frames
+ * @return uint32_t Number of frames read
+ */
+typedef uint32_t (*ebs_imu_fifo_source_t)(ebs_imu_fifo_frame_t* frames, uint32_t max_frames);
+
+/* Decimator state. Delay line is sample-major with the axes packed into */
+/* lanes, so every MAC updates all axes with one vector operation.       */
+typedef struct {
+    float coeff[IMU_FIR_TAPS];                                  /* FIR taps */
+    float scale[IMU_AXIS_LANES];                                /* Counts to units */
+    float offset[IMU_AXIS_LANES];                               /* Offset in counts */
+    float line[IMU_FIR_TAPS - 1U + IMU_FIFO_MAX_BURST][IMU_AXIS_LANES]; /* Delay line */
+    float output[IMU_AXIS_LANES];                               /* Latest decimated sample */
+    uint32_t phase;                                             /* Samples since last output */
+    uint32_t samples_in;                                        /* Total frames ingested */
+    uint32_t samples_out;                                       /* Total decimated outputs */
+    uint32_t underrun_count;                                    /* Ticks with no output */
+    ebs_imu_fifo_source_t source;                               /* FIFO reader */
+} ebs_imu_decimator_t;
+
+/* IMU FIFO Function Prototypes */
+
+/**
+ * @brief Initialize decimator, design the anti-alias filter
+ * @param dec Decimator state
+ * @param accel_scale Accelerometer LSB weight (m/s² per count)
+ * @param gyro_scale Gyroscope LSB weight (deg/s per count)
+ * @param source FIFO reader
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_ImuFifo_Init(ebs_imu_decimator_t* dec, float accel_scale, float gyro_scale,
+                              ebs_imu_fifo_source_t source);
+
+/**
+ * @brief Filter and decimate a block of frames
+ * @param dec Decimator state
+ * @param frames Frames in arrival order
+ * @param count Number of frames (<= IMU_FIFO_MAX_BURST)
+ * @return uint32_t Number of decimated outputs produced
+ */
+uint32_t EBS_ImuFifo_ProcessBlock(ebs_imu_decimator_t* dec, const ebs_imu_fifo_frame_t* frames,
+                                  uint32_t count);
+
+/**
+ * @brief Drain the device FIFO and decimate (called every 1ms)
+ * @param dec Decimator state
+ * @return ebs_result_t EBS_TIMEOUT if no output sample was produced
+ */
+ebs_result_t EBS_ImuFifo_Service(ebs_imu_decimator_t* dec);
+
+/**
+ * @brief Publish the latest decimated sample
+ * @param dec Decimator state
+ * @param imu_data Destination
+ * @param timestamp Sample timestamp
+ */
+void EBS_ImuFifo_GetImuData(const ebs_imu_decimator_t* dec, ebs_imu_data_t* imu_data,
+                            uint32_t timestamp);
+
+/**
+ * @brief Simulated FIFO (1 g vertical, one decimation block per call)
+ */
+uint32_t EBS_ImuFifo_SimulatedSource(ebs_imu_fifo_frame_t* frames, uint32_t max_frames);
+
+#endif /* EBS_IMU_FIFO_H */
@@ -0,0 +1,115 @@
+/**
+ * @file ebs_lockstep.h
+ * @brief Electronic Braking System - Software Lockstep Dual Channel
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * The primary core hands each control step (pre-step state and sensor
+ * frame) to a secondary core through a wait-free triple-buffer mailbox.
+ * The secondary replays the step on its own copy and returns its
+ * ebs_control_commands_t through a second mailbox. The primary compares
+ * on the following cycle and never blocks on the secondary.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#ifndef EBS_LOCKSTEP_H
+#define EBS_LOCKSTEP_H
+
+#include "ebs_types.h"
+#include "ebs_config.h"
+#include "ebs_abs.h"
+
+/* Lockstep Constants */
+#define LOCKSTEP_HISTORY_DEPTH      4U      /* Primary outputs kept for comparison (power of 2) */
+#define LOCKSTEP_MAX_LATE_CYCLES    3U      /* Consecutive cycles without a result before timeout */
+#define LOCKSTEP_SLOT_COUNT         3U      /* Triple buffer */
+
+/* Output comparison */
+typedef enum {
+    LOCKSTEP_COMPARE_EXACT = 0,             /* Bit-exact (identical replica) */
+    LOCKSTEP_COMPARE_TOLERANCE              /* Within SAFETY_DUAL_CHANNEL_TOL */
+} ebs_lockstep_compare_t;
+
+/**
+ * @brief Free-running time base readable from both cores
+ * @return uint32_t Time in nanoseconds (wraps)
+ */
+typedef uint32_t (*ebs_lockstep_clock_t)(void);
+
+/* Primary -> secondary: one control step to replay */
+typedef struct {
+    uint32_t sequence;                      /* Primary step number */
+    uint32_t submit_time;                   /* Publish time (ns) */
+    ebs_abs_system_state_t state;           /* Pre-step state */
+    ebs_abs_inputs_t inputs;                /* Sensor frame */
+} ebs_lockstep_request_t;
+
+/* Secondary -> primary: replayed step result */
+typedef struct {
+    uint32_t sequence;                      /* Step number replayed */
+    uint32_t submit_time;                   /* Copied from request (ns) */
+    uint32_t complete_time;                 /* Secondary publish time (ns) */
+    ebs_control_commands_t commands;        /* Secondary output */
+} ebs_lockstep_response_t;
+
+/* Lockstep statistics */
+typedef struct {
+    uint32_t frames_submitted;              /* Steps handed to the secondary */
+    uint32_t frames_overwritten;            /* Steps replaced before the secondary took them */
+    uint32_t frames_replayed;               /* Steps executed by the secondary */
+    uint32_t comparisons;                   /* Results compared */
+    uint32_t mismatches;                    /* Results that disagreed */
+    uint32_t late_checks;                   /* Checks with no new result */
+    uint32_t stale_results;                 /* Results for steps no longer in history */
+    uint32_t max_consecutive_late;          /* Longest run of late checks */
+    uint32_t latency_min_ns;                /* Submit -> secondary publish */
+    uint32_t latency_max_ns;
+    uint64_t latency_sum_ns;
+    uint32_t round_trip_max_ns;             /* Submit -> compared on primary */
+} ebs_lockstep_statistics_t;
+
+/* Lockstep Function Prototypes */
+
+/**
+ * @brief Initialize both mailboxes and the statistics
+ * @param mode Output comparison mode
+ * @param clock Time base for latency measurement (NULL disables it)
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Lockstep_Init(ebs_lockstep_compare_t mode, ebs_lockstep_clock_t clock);
+
+/**
+ * @brief Get the request slot for this step (primary core)
+ * @return ebs_lockstep_request_t* Slot to fill with state and inputs, NULL if disabled
+ */
+ebs_lockstep_request_t* EBS_Lockstep_BeginFrame(void);
+
+/**
+ * @brief Publish the step begun with EBS_Lockstep_BeginFrame (primary core)
+ * @param primary Output of the primary channel for this step
+ */
+void EBS_Lockstep_SubmitFrame(const ebs_control_commands_t* primary);
+
+/**
+ * @brief Compare the newest secondary result (primary core, once per cycle)
+ * @return ebs_result_t EBS_OK match, EBS_BUSY no new result yet,
+ *         EBS_TIMEOUT secondary silent too long, EBS_FAULT mismatch
+ */
+ebs_result_t EBS_Lockstep_Check(void);
+
+/**
+ * @brief Replay the newest pending step, if any (secondary core loop)
+ * @return bool True if a step was replayed
+ */
+bool EBS_Lockstep_SecondaryService(void);
+
+/**
+ * @brief Get lockstep statistics
+ * @return const ebs_lockstep_statistics_t* Statistics
+ */
+const ebs_lockstep_statistics_t* EBS_Lockstep_GetStatistics(void);
+
+#endif /* EBS_LOCKSTEP_H */
@@ -0,0 +1,156 @@
+/**
+ * @file ebs_memory.h
+ * @brief Electronic Braking System - Static Memory Management
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Per-module bump arenas carved from a static EBS_HEAP_SIZE region, fixed
+ * block pools on top of them, and painted task stacks. Arena allocation
+ * is only permitted until EBS_Memory_Seal() is called on the transition
+ * to EBS_STATE_NORMAL; pools recycle already reserved blocks afterwards.
+ *
+ * The main loop runs on MEMORY_STACK_MAIN and exceptions on
+ * MEMORY_STACK_ISR once EBS_Memory_StartMainTask() is called. The safety
+ * channel runs on MEMORY_STACK_SAFETY, either as the secondary core's
+ * initial stack or through EBS_Memory_CallOnStack() on a single core.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#ifndef EBS_MEMORY_H
+#define EBS_MEMORY_H
+
+#include "ebs_types.h"
+#include "ebs_config.h"
+
+/* Memory Constants */
+#define MEMORY_ALIGNMENT            8U              /* Allocation alignment (bytes) */
+#define MEMORY_STACK_PAINT_VALUE    0xA5A5A5A5UL    /* Unused stack word pattern */
+
+/* Module arenas */
+typedef enum {
+    MEMORY_ARENA_COMMUNICATION = 0,
+    MEMORY_ARENA_DIAGNOSTICS,
+    MEMORY_ARENA_RECORDER,
+    MEMORY_ARENA_SPARE,
+    MEMORY_ARENA_COUNT
+} ebs_memory_arena_id_t;
+
+/* Task stacks */
+typedef enum {
+    MEMORY_STACK_MAIN = 0,
+    MEMORY_STACK_SAFETY,
+    MEMORY_STACK_ISR,
+    MEMORY_STACK_COUNT
+} ebs_memory_stack_id_t;
+
+/* Task entry point */
+typedef void (*ebs_memory_task_t)(void);
+
+/* Bump arena */
+typedef struct {
+    uint8_t* base;                          /* First byte of the arena */
+    uint32_t size;                          /* Arena size (bytes) */
+    uint32_t used;                          /* Bytes handed out */
+    uint32_t failed_count;                  /* Rejected allocations */
+} ebs_memory_arena_t;
+
+/* Fixed block pool (blocks reserved from an arena at init) */
+typedef struct {
+    uint8_t* blocks;                        /* First block */
+    void* free_list;                        /* Singly linked free blocks */
+    uint32_t block_size;                    /* Block size incl. alignment */
+    uint32_t block_count;                   /* Total blocks */
+    uint32_t in_use;                        /* Blocks currently taken */
+    uint32_t high_water;                    /* Maximum blocks taken */
+    uint32_t exhausted_count;               /* Take requests on an empty pool */
+} ebs_memory_pool_t;
+
+/* High-water-mark report */
+typedef struct {
+    uint32_t arena_size[MEMORY_ARENA_COUNT];        /* Arena budget (bytes) */
+    uint32_t arena_used[MEMORY_ARENA_COUNT];        /* Arena high-water (bytes) */
+    uint32_t stack_size[MEMORY_STACK_COUNT];        /* Stack size (bytes) */
+    uint32_t stack_used[MEMORY_STACK_COUNT];        /* Stack high-water (bytes) */
+    uint32_t stack_overflow_mask;                   /* Stacks whose guard word is gone */
+    uint32_t late_alloc_count;                      /* Allocations attempted after seal */
+    bool sealed;                                    /* Allocation window closed */
+} ebs_memory_report_t;
+
+/* Memory Function Prototypes */
+
+/**
+ * @brief Carve arenas from the static heap and paint all task stacks
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Memory_Init(void);
+
+/**
+ * @brief Allocate from a module arena (initialization only)
+ * @param arena Module arena
+ * @param size Requested size in bytes
+ * @return void* Aligned memory, NULL if sealed or the arena is exhausted
+ */
+void* EBS_Memory_Alloc(ebs_memory_arena_id_t arena, uint32_t size);
+
+/**
+ * @brief Close the allocation window (called before EBS_STATE_NORMAL)
+ */
+void EBS_Memory_Seal(void);
+
+/**
+ * @brief Reserve a fixed block pool from a module arena (initialization only)
+ * @param pool Pool to initialize
+ * @param arena Module arena to reserve from
+ * @param block_size Block size in bytes
+ * @param block_count Number of blocks
+ * @return ebs_result_t EBS_BUFFER_FULL if the arena cannot hold the pool
+ */
+ebs_result_t EBS_Memory_PoolInit(ebs_memory_pool_t* pool, ebs_memory_arena_id_t arena,
+                                 uint32_t block_size, uint32_t block_count);
+
+/**
+ * @brief Take a block from a pool (O(1), any state)
+ * @param pool Pool
+ * @return void* Block, NULL if the pool is empty
+ */
+void* EBS_Memory_PoolTake(ebs_memory_pool_t* pool);
+
+/**
+ * @brief Return a block to its pool (O(1), any state)
+ * @param pool Pool
+ * @param block Block previously taken from @p pool
+ */
+void EBS_Memory_PoolGive(ebs_memory_pool_t* pool, void* block);
+
+/**
+ * @brief Get the statically allocated stack for a task
+ * @param stack Stack identifier
+ * @param size Receives the stack size in bytes (may be NULL)
+ * @return void* Lowest address of the stack region
+ */
+void* EBS_Memory_GetStack(ebs_memory_stack_id_t stack, uint32_t* size);
+
+/**
+ * @brief Run the main task on its stack, exceptions on the ISR stack
+ * @param task Main task (does not return)
+ */
+void EBS_Memory_StartMainTask(ebs_memory_task_t task);
+
+/**
+ * @brief Run a function on another task stack and return
+ * @param stack Stack to run on (not the caller's own)
+ * @param task Function to run
+ */
+void EBS_Memory_CallOnStack(ebs_memory_stack_id_t stack, ebs_memory_task_t task);
+
+/**
+ * @brief Scan stacks and collect arena/stack high-water marks
+ * @param report Destination
+ * @return ebs_result_t Report result
+ */
+ebs_result_t EBS_Memory_GetReport(ebs_memory_report_t* report);
+
+#endif /* EBS_MEMORY_H */
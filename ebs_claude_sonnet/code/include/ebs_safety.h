@@ -17,6 +17,17 @@
 #include "ebs_types.h"
 #include "ebs_config.h"
 
+/* Safety Statistics */
+typedef struct {
+    uint32_t total_violations;              /* Monitor violations of all classes */
+    ebs_safety_state_t current_state;
+    uint32_t max_cycle_time;                /* Ticks between monitor calls */
+    uint32_t cycle_overruns;
+    uint32_t memory_corruptions;
+    uint32_t dual_channel_failures;         /* Lockstep mismatches and silent secondary */
+    uint32_t safe_state_requests;           /* EBS_Safety_EnterSafeState calls */
+} ebs_safety_statistics_t;
+
 /* Safety Function Prototypes */
 
 /**
@@ -168,7 +179,7 @@ ebs_result_t EBS_Safety_ClearFault(ebs_safety_fault_t fault);
  * @param stats Pointer to statistics structure
  * @return ebs_result_t Operation result
  */
-ebs_result_t EBS_Safety_GetStatistics(void* stats);
+ebs_result_t EBS_Safety_GetStatistics(ebs_safety_statistics_t* stats);
 
 /* Safety Constants */
 #define SAFETY_CRC_POLYNOMIAL       0x04C11DB7U  /* CRC-32 polynomial */
@@ -176,6 +187,11 @@ ebs_result_t EBS_Safety_GetStatistics(void* stats);
 #define SAFETY_SENSOR_TIMEOUT_MS    100U         /* Sensor data timeout */
 #define SAFETY_MAX_FAULT_COUNT      3U           /* Maximum faults before safe state */
 #define SAFETY_MEMORY_PATTERN       0xA5A5A5A5U  /* Memory test pattern */
+#define SAFETY_MAX_CYCLE_TIME_MS    (2U * EBS_CYCLE_TIME_MS)  /* Ticks between two monitor calls */
+#define SAFETY_MAX_DUAL_CHANNEL_FAILURES 3U      /* Lockstep mismatches before safe state */
+#define SAFETY_STACK_CANARY_VALUE   0xDEADC0DEU  /* Safety manager guard words */
+#define SAFETY_HEAP_GUARD_VALUE     0xC0FFEE11U
+#define SAFETY_FAULT_HISTORY_SIZE   8U           /* Safe state requests kept (oldest first) */
 
 /* Safety Macros */
 #define SAFETY_ASSERT(expr) \
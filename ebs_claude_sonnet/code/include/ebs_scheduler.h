@@ -0,0 +1,64 @@
+/**
+ * @file ebs_scheduler.h
+ * @brief Electronic Braking System - Main Loop Cyclic Executive
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * One iteration of the 1 ms main loop: safety monitoring, the control
+ * loop with its rate groups (ABS every cycle, ESC 5 ms, TCS 10 ms,
+ * communication 10 ms, diagnostics 100 ms) and the watchdog checkpoints
+ * around them. The target main task, the fault campaign and the
+ * microbenchmarks all run this same iteration; only the secondary
+ * channel replay and the wait for the next cycle stay with the caller.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#ifndef EBS_SCHEDULER_H
+#define EBS_SCHEDULER_H
+
+#include "ebs_types.h"
+#include "ebs_config.h"
+
+/* Cyclic calls of the control loop, NULL selects the production module */
+typedef struct {
+    ebs_result_t (*read_sensors)(void);                     /* EBS_Sensors_ReadAll */
+    ebs_result_t (*abs_control)(void);                      /* EBS_ABS_Control */
+    ebs_result_t (*update_actuators)(void);                 /* EBS_Actuators_Update */
+    ebs_result_t (*alive)(ebs_watchdog_type_t entity);      /* EBS_Watchdog_Refresh */
+} ebs_scheduler_tasks_t;
+
+/* Scheduler Function Prototypes */
+
+/**
+ * @brief Select the cyclic calls (host test seam, before EBS_Scheduler_Init)
+ * @param tasks Calls, NULL members keep the production module
+ */
+void EBS_Scheduler_SetTasks(const ebs_scheduler_tasks_t* tasks);
+
+/**
+ * @brief Reset the system state, tick counter and rate-group counters
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Scheduler_Init(void);
+
+/**
+ * @brief Leave initialization after the power-up self-test
+ * @param self_test_passed Self-test verdict (false: safe state)
+ */
+void EBS_Scheduler_Start(bool self_test_passed);
+
+/**
+ * @brief Run one main loop iteration and advance the system tick
+ */
+void EBS_Scheduler_RunCycle(void);
+
+/**
+ * @brief Get current system state
+ * @return ebs_system_state_t Current system state
+ */
+ebs_system_state_t EBS_GetSystemState(void);
+
+#endif /* EBS_SCHEDULER_H */
@@ -8,12 +8,181 @@
 
 #include "ebs_types.h"
 #include "ebs_config.h"
+#include "ebs_adc_scan.h"
+#include "ebs_imu_fifo.h"
 
+/* Sensor Constants */
+#define PRESSURE_SENSOR_COUNT           (1U + (uint32_t)WHEEL_COUNT)   /* Master cylinder + wheels */
+#define WHEEL_SPEED_PULSES_PER_REV      48U
+#define WHEEL_CIRCUMFERENCE_M           EBS_CAL_WHEEL_CIRCUMFERENCE
+#define MAX_WHEEL_SPEED_CHANGE_PER_CYCLE 5.0f                           /* km/h per cycle */
+#define WHEEL_SPEED_LINE_FAULT_DEBOUNCE_MS 10U                          /* Open/shorted line before the DTC */
+#define PRESSURE_SENSOR_MIN_BAR         0.0f
+#define PRESSURE_SENSOR_MAX_BAR         EBS_MAX_BRAKE_PRESSURE
+#define IMU_ACCEL_RANGE_G               16.0f
+#define IMU_ACCEL_RANGE_MS2             (IMU_ACCEL_RANGE_G * IMU_FIFO_STANDARD_GRAVITY)
+#define IMU_ACCEL_MS2_PER_LSB           (IMU_FIFO_STANDARD_GRAVITY / IMU_FIFO_ACCEL_LSB_PER_G)
+#define IMU_GYRO_RANGE_DPS              2000.0f
+#define IMU_SAMPLE_RATE_HZ              IMU_FIFO_ODR_HZ
+#define STEERING_ANGLE_MIN_DEG          (-720.0f)
+#define STEERING_ANGLE_MAX_DEG          720.0f
+#define STEERING_ANGLE_RESOLUTION_DEG   0.1f
+
+/* Sensor groups */
+typedef enum {
+    SENSOR_TYPE_WHEEL_SPEED = 0,
+    SENSOR_TYPE_PRESSURE,
+    SENSOR_TYPE_IMU,
+    SENSOR_TYPE_STEERING_ANGLE
+} ebs_sensor_type_t;
+
+/* Linear calibration with range clamp */
+typedef struct {
+    float offset;                           /* Added to the raw value */
+    float scale;                            /* Applied after the offset */
+    float min_value;
+    float max_value;
+} ebs_sensor_calibration_t;
+
+/* Latest wheel speed capture (timer input capture) */
+typedef struct {
+    uint32_t pulse_count;                   /* Free-running edge counter */
+    uint32_t edge_time_us;                  /* Timer value at the latest edge */
+    uint32_t capture_time_us;               /* Timer value at the read */
+} ebs_wheel_capture_t;
+
+/**
+ * @brief Wheel speed capture read (input capture timer on target, simulator in SIL)
+ * @param wheel Wheel index
+ * @param capture Destination
+ * @return ebs_result_t EBS_FAULT on an open or shorted sensor line
+ */
+typedef ebs_result_t (*ebs_wheel_capture_source_t)(uint32_t wheel, ebs_wheel_capture_t* capture);
+
+/* Raw data sources, NULL selects the simulated default */
+typedef struct {
+    ebs_wheel_capture_source_t wheel_capture;
+    ebs_adc_scan_source_t pressure_adc;     /* Master cylinder and wheel pressure scan */
+    ebs_imu_fifo_source_t imu_fifo;
+} ebs_sensor_sources_t;
+
+/* Edge tracking of a wheel speed sensor */
+typedef enum {
+    WHEEL_CAPTURE_UNSYNCED = 0,             /* No reference edge */
+    WHEEL_CAPTURE_REFERENCE,                /* Reference edge, no interval yet */
+    WHEEL_CAPTURE_TRACKING                  /* Speed from the latest edge interval */
+} ebs_wheel_capture_state_t;
+
+/* Wheel speed sensor */
+typedef struct {
+    uint32_t pulses_per_revolution;
+    float wheel_circumference;              /* m */
+    uint32_t raw_pulse_count;
+    uint32_t previous_pulse_count;          /* Edge count at the reference edge */
+    uint32_t pulse_time_us;                 /* Timer value at the reference edge */
+    ebs_wheel_capture_state_t capture_state;
+    float edge_speed;                       /* km/h over the latest edge interval */
+    uint32_t line_fault_ms;                 /* Consecutive line fault time */
+    ebs_sensor_calibration_t calibration;
+    bool enabled;
+    bool fault_detected;
+} ebs_wheel_speed_sensor_t;
+
+typedef struct {
+    ebs_wheel_speed_sensor_t sensors[WHEEL_COUNT];
+    ebs_wheel_speed_data_t data;
+    uint32_t timestamp;                     /* Last read */
+} ebs_wheel_speed_manager_t;
+
+/* Pressure sensor (channel 0: master cylinder, 1..WHEEL_COUNT: wheels) */
+typedef struct {
+    float min_pressure;                     /* bar */
+    float max_pressure;                     /* bar */
+    uint16_t raw_adc_value;
+    ebs_sensor_calibration_t calibration;
+    bool enabled;
+    bool fault_detected;
+} ebs_pressure_sensor_t;
+
+typedef struct {
+    ebs_pressure_sensor_t sensors[PRESSURE_SENSOR_COUNT];
+    ebs_pressure_data_t data;
+    uint32_t timestamp;                     /* Last read */
+} ebs_pressure_manager_t;
+
+/* Inertial measurement unit */
+typedef struct {
+    float accelerometer_range;              /* g */
+    float gyroscope_range;                  /* deg/s */
+    uint32_t sample_rate_hz;
+    ebs_sensor_calibration_t accel_calibration;
+    ebs_sensor_calibration_t gyro_calibration;
+    bool enabled;
+    bool fault_detected;
+} ebs_imu_sensor_t;
+
+typedef struct {
+    ebs_imu_sensor_t sensor;
+    ebs_imu_data_t data;
+    bool valid;                             /* Last sample in range */
+    uint32_t timestamp;                     /* Last read */
+} ebs_imu_manager_t;
+
+/* Steering angle sensor */
+typedef struct {
+    float angle;                            /* deg */
+    float angular_velocity;                 /* deg/s */
+    bool valid;
+    uint32_t timestamp;
+} ebs_steering_angle_data_t;
+
+typedef struct {
+    float min_angle;                        /* deg */
+    float max_angle;                        /* deg */
+    float resolution;                       /* deg */
+    uint16_t raw_adc_value;
+    ebs_sensor_calibration_t calibration;
+    bool enabled;
+    bool fault_detected;
+} ebs_steering_angle_sensor_t;
+
+typedef struct {
+    ebs_steering_angle_sensor_t sensor;
+    ebs_steering_angle_data_t data;
+} ebs_steering_angle_manager_t;
+
+/* Sensor fault summary */
+typedef struct {
+    uint32_t wheel_speed_faults;
+    uint32_t pressure_sensor_faults;
+    bool imu_fault;
+    bool steering_angle_fault;
+    uint32_t total_faults;
+    uint32_t last_update_time;
+} ebs_sensor_diagnostics_t;
+
+/* Sensor manager */
+typedef struct {
+    ebs_wheel_speed_manager_t wheel_speed;
+    ebs_pressure_manager_t pressure;
+    ebs_imu_manager_t imu;
+    ebs_steering_angle_manager_t steering_angle;
+    ebs_sensor_diagnostics_t diagnostics;
+    bool system_enabled;
+    uint32_t last_update_time;
+    uint32_t update_count;
+} ebs_sensor_manager_t;
+
+void EBS_Sensors_SetSources(const ebs_sensor_sources_t* sources);
 ebs_result_t EBS_Sensors_Init(void);
 bool EBS_Sensors_SelfTest(void);
 ebs_result_t EBS_Sensors_ReadAll(void);
 ebs_wheel_speed_data_t* EBS_Sensors_GetWheelSpeedData(void);
 ebs_pressure_data_t* EBS_Sensors_GetPressureData(void);
 ebs_imu_data_t* EBS_Sensors_GetIMUData(void);
+ebs_steering_angle_data_t* EBS_Sensors_GetSteeringAngleData(void);
+bool EBS_Sensors_IsDataValid(ebs_sensor_type_t sensor_type);
+const ebs_sensor_diagnostics_t* EBS_Sensors_GetDiagnostics(void);
+ebs_result_t EBS_Sensors_SimulatedWheelCapture(uint32_t wheel, ebs_wheel_capture_t* capture);
 
 #endif /* EBS_SENSORS_H */
@@ -0,0 +1,77 @@
+/**
+ * @file ebs_speed_estimator.h
+ * @brief Electronic Braking System - Vehicle Reference Speed Estimator
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Two-state Kalman filter (speed, accelerometer bias) predicted with the
+ * longitudinal acceleration and corrected with every wheel speed that
+ * passes an innovation gate. Slipping or spinning wheels are rejected, so
+ * the reference coasts on the IMU through full lock-up.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#ifndef EBS_SPEED_ESTIMATOR_H
+#define EBS_SPEED_ESTIMATOR_H
+
+#include "ebs_types.h"
+#include "ebs_config.h"
+
+/* Speed Estimator Constants */
+#define SPEED_EST_Q_SPEED           3.0e-8f /* Speed process noise ((m/s)² per step) */
+#define SPEED_EST_Q_COAST           1.0e-4f /* Extra speed noise per step with no wheel accepted */
+#define SPEED_EST_Q_BIAS            1.0e-10f /* Bias random walk ((m/s²)² per step) */
+#define SPEED_EST_Q_NO_IMU          4.0e-2f /* Speed process noise without IMU */
+#define SPEED_EST_R_WHEEL           2.5e-3f /* Wheel speed noise ((m/s)²) */
+#define SPEED_EST_P0_BIAS           0.25f   /* Initial bias variance */
+#define SPEED_EST_GATE_SIGMA        4.0f    /* Innovation gate (standard deviations) */
+#define SPEED_EST_GATE_MIN_MS       0.3f    /* Gate floor (m/s) */
+#define SPEED_EST_MAX_BIAS          2.0f    /* Bias estimate limit (m/s²) */
+
+/* Estimator state. The 2x2 covariance is stored as its three unique terms */
+/* and every matrix operation is written out, so a step has fixed cost.    */
+typedef struct {
+    float dt;                               /* Step period (s) */
+    float speed;                            /* Reference speed (m/s) */
+    float bias;                             /* Accelerometer bias (m/s²) */
+    float p00;                              /* Var(speed) */
+    float p01;                              /* Cov(speed, bias) */
+    float p11;                              /* Var(bias) */
+    uint32_t coast_cycles;                  /* Consecutive steps with no wheel accepted */
+    uint8_t accepted_mask;                  /* Wheels used by the last step */
+    bool initialized;                       /* First valid wheel speed seen */
+} ebs_speed_estimator_t;
+
+/* Speed Estimator Function Prototypes */
+
+/**
+ * @brief Initialize the estimator
+ * @param est Estimator state
+ * @param dt_s Step period in seconds
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_SpeedEst_Init(ebs_speed_estimator_t* est, float dt_s);
+
+/**
+ * @brief Run one predict/correct step
+ * @param est Estimator state
+ * @param accel Longitudinal acceleration (m/s², forward positive)
+ * @param accel_valid Acceleration is usable
+ * @param wheel_speeds Wheel speeds (km/h), WHEEL_COUNT entries
+ * @param valid_mask Bit per wheel whose speed is valid
+ * @return float Reference speed in km/h
+ */
+float EBS_SpeedEst_Step(ebs_speed_estimator_t* est, float accel, bool accel_valid,
+                        const float* wheel_speeds, uint32_t valid_mask);
+
+/**
+ * @brief Get the current reference speed
+ * @param est Estimator state
+ * @return float Reference speed in km/h
+ */
+float EBS_SpeedEst_GetSpeed(const ebs_speed_estimator_t* est);
+
+#endif /* EBS_SPEED_ESTIMATOR_H */
@@ -50,7 +50,8 @@ typedef enum {
     SAFETY_FAULT_MEMORY_CORRUPTION,
     SAFETY_FAULT_CRITICAL,
     SAFETY_FAULT_UNKNOWN_STATE,
-    SAFETY_FAULT_SYSTEM_SHUTDOWN
+    SAFETY_FAULT_SYSTEM_SHUTDOWN,
+    SAFETY_FAULT_PROGRAM_FLOW
 } ebs_safety_fault_t;
 
 /* Wheel Position Definitions */
@@ -190,7 +191,10 @@ typedef enum {
     DTC_SAFETY_CRITICAL_FAULT = 0x5001,
     DTC_WATCHDOG_TIMEOUT = 0x5002,
     DTC_MEMORY_CORRUPTION = 0x5003,
-    DTC_DUAL_CHANNEL_MISMATCH = 0x5004
+    DTC_DUAL_CHANNEL_MISMATCH = 0x5004,
+    DTC_PROGRAM_FLOW_ERROR = 0x5005,
+    
+    DTC_MAX_CODE                           /* End of the valid code range */
 } ebs_dtc_code_t;
 
 /* DTC Status */
@@ -215,7 +219,10 @@ typedef enum {
     DIAG_EVENT_TCS_ACTIVATION = 0x22,
     DIAG_EVENT_SENSOR_FAULT = 0x30,
     DIAG_EVENT_ACTUATOR_FAULT = 0x31,
-    DIAG_EVENT_COMMUNICATION_FAULT = 0x32
+    DIAG_EVENT_COMMUNICATION_FAULT = 0x32,
+    DIAG_EVENT_DTC_SET = 0x40,
+    DIAG_EVENT_DTC_CONFIRMED = 0x41,
+    DIAG_EVENT_DTC_CLEARED = 0x42
 } ebs_diag_event_t;
 
 /* Watchdog Types */
@@ -272,7 +279,9 @@ typedef enum {
     EBS_NOT_INITIALIZED,
     EBS_TIMEOUT,
     EBS_BUSY,
-    EBS_FAULT
+    EBS_FAULT,
+    EBS_BUFFER_FULL,
+    EBS_NOT_FOUND
 } ebs_result_t;
 
 /* Function Prototypes */
@@ -1,6 +1,19 @@
 /**
  * @file ebs_watchdog.h
  * @brief Electronic Braking System - Watchdog Module
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Supervises the entities of ebs_watchdog_type_t in the style of the
+ * AUTOSAR watchdog manager: deadline (maximum refresh gap), alive
+ * (refresh count per reference cycle) and program-flow (checkpoint
+ * transition) supervision. Deadlines and alive windows are timers on a
+ * two-level timing wheel, so a refresh is O(1) and the per-tick check
+ * only visits the current slot regardless of the number of entities.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
  */
 
 #ifndef EBS_WATCHDOG_H
@@ -9,10 +22,112 @@
 #include "ebs_types.h"
 #include "ebs_config.h"
 
+/* Watchdog Constants */
+#define WDG_WHEEL_BITS              6U      /* 64 slots per wheel level */
+#define WDG_WHEEL_SLOTS             (1UL << WDG_WHEEL_BITS)
+#define WDG_MAX_CHECKPOINTS         8U      /* Checkpoints per supervised entity */
+
+/* Entity set bits */
+#define WDG_ENTITY_BIT(e)           (1UL << (uint32_t)(e))
+#define WDG_FEATURE_BIT(enable, e)  (((enable) == 1U) ? WDG_ENTITY_BIT(e) : 0UL)
+
+/* Entities supervised in WDG_MODE_CONTROL (tasks of disabled features excluded) */
+#define WDG_CONTROL_ENTITIES        (WDG_ENTITY_BIT(WATCHDOG_MAIN_TASK) | \
+                                     WDG_ENTITY_BIT(WATCHDOG_SAFETY_TASK) | \
+                                     WDG_ENTITY_BIT(WATCHDOG_ABS_TASK) | \
+                                     WDG_FEATURE_BIT(EBS_ENABLE_ESC, WATCHDOG_ESC_TASK) | \
+                                     WDG_FEATURE_BIT(EBS_ENABLE_TCS, WATCHDOG_TCS_TASK) | \
+                                     WDG_ENTITY_BIT(WATCHDOG_COMMUNICATION_TASK) | \
+                                     WDG_FEATURE_BIT(EBS_ENABLE_DIAGNOSTICS, \
+                                                     WATCHDOG_DIAGNOSTIC_TASK))
+
+/* Supervision status (per entity and global) */
+typedef enum {
+    WDG_STATUS_OK = 0,                      /* All supervisions pass */
+    WDG_STATUS_DEACTIVATED,                 /* Not supervised in the current mode */
+    WDG_STATUS_FAILED,                      /* Alive failures within tolerance */
+    WDG_STATUS_EXPIRED                      /* Supervision lost (latched) */
+} ebs_wdg_status_t;
+
+/* Supervision modes (set of active entities) */
+typedef enum {
+    WDG_MODE_STARTUP = 0,                   /* Initialization and self-test */
+    WDG_MODE_CONTROL,                       /* EBS_STATE_NORMAL task set */
+    WDG_MODE_SAFE,                          /* Degraded/safe state, control tasks stopped */
+    WDG_MODE_COUNT
+} ebs_wdg_mode_t;
+
+/* Main task program-flow checkpoints */
+typedef enum {
+    WDG_CP_MAIN_CYCLE_START = 0,
+    WDG_CP_MAIN_SAFETY_DONE,
+    WDG_CP_MAIN_CONTROL_DONE,
+    WDG_CP_MAIN_CYCLE_END
+} ebs_wdg_main_checkpoint_t;
+
+/* Per-entity supervision counters */
+typedef struct {
+    ebs_wdg_status_t status;                /* Local supervision status */
+    uint32_t refresh_count;                 /* Alive indications since init */
+    uint32_t deadline_misses;               /* Refresh gaps above the deadline */
+    uint32_t alive_failures;                /* Reference cycles outside the margins */
+    uint32_t flow_errors;                   /* Illegal checkpoint transitions */
+    uint32_t last_alive_count;              /* Indications in the last reference cycle */
+} ebs_wdg_entity_status_t;
+
+/* Watchdog Function Prototypes */
+
+/**
+ * @brief Initialize supervision in WDG_MODE_STARTUP
+ * @return ebs_result_t Initialization result
+ */
 ebs_result_t EBS_Watchdog_Init(void);
+
+/**
+ * @brief Alive indication: count it and restart the entity deadline (O(1))
+ * @param watchdog_type Supervised entity
+ * @return ebs_result_t EBS_INVALID_PARAM for an unknown entity
+ */
 ebs_result_t EBS_Watchdog_Refresh(ebs_watchdog_type_t watchdog_type);
 
+/**
+ * @brief Report a program-flow checkpoint of a supervised entity
+ * @param watchdog_type Supervised entity
+ * @param checkpoint Checkpoint identifier (< WDG_MAX_CHECKPOINTS)
+ * @return ebs_result_t EBS_FAULT if the transition is not allowed
+ */
+ebs_result_t EBS_Watchdog_Checkpoint(ebs_watchdog_type_t watchdog_type, uint32_t checkpoint);
+
+/**
+ * @brief Switch the set of supervised entities (no-op if unchanged)
+ * @param mode Supervision mode
+ * @return ebs_result_t Mode switch result
+ */
+ebs_result_t EBS_Watchdog_SetMode(ebs_wdg_mode_t mode);
+
+/**
+ * @brief Advance supervision by one tick (called every EBS_CYCLE_TIME_MS)
+ * @return ebs_wdg_status_t Global supervision status
+ */
+ebs_wdg_status_t EBS_Watchdog_MainFunction(void);
+
+/**
+ * @brief Get the global supervision status
+ * @return ebs_wdg_status_t Worst local status of all active entities
+ */
+ebs_wdg_status_t EBS_Watchdog_GetGlobalStatus(void);
+
+/**
+ * @brief Get supervision counters of one entity
+ * @param watchdog_type Supervised entity
+ * @param status Destination
+ * @return ebs_result_t Query result
+ */
+ebs_result_t EBS_Watchdog_GetEntityStatus(ebs_watchdog_type_t watchdog_type,
+                                          ebs_wdg_entity_status_t* status);
+
 /* HAL Functions */
 ebs_result_t EBS_HAL_Init(void);
+ebs_result_t EBS_HAL_StartSecondaryCore(void (*entry)(void), void* stack_top);
 
-#endif /* EBS_WATCHDOG_H */
\ No newline at end of file
+#endif /* EBS_WATCHDOG_H */
@@ -16,21 +16,67 @@
 #include "ebs_sensors.h"
 #include "ebs_actuators.h"
 #include "ebs_diagnostics.h"
+#include "ebs_lockstep.h"
+#include "ebs_flow_monitor.h"
 #include <math.h>
+#include <stddef.h>
 #include <string.h>
 
 /* Static Variables */
 static ebs_abs_system_state_t g_abs_system;
+static ebs_abs_inputs_t g_abs_inputs;
+static ebs_control_commands_t g_abs_commands;
 static bool g_abs_initialized = false;
 
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+static ebs_abs_aggregate_t g_abs_statistics;
+
+/* Cycle records from the control task to the diagnostics task (single producer/consumer) */
+static struct {
+    ebs_abs_cycle_record_t records[ABS_STATS_LOG_LENGTH];
+    uint32_t head;                          /* Written by the control task only */
+    uint32_t tail;                          /* Written by the diagnostics task only */
+    uint32_t dropped;                       /* Records not logged because the log was full */
+} g_abs_stats_log;
+#endif
+
+/* The step writes the hot block only (wheel states, estimator, flags) */
+EBS_STATIC_ASSERT(offsetof(ebs_abs_system_state_t, wheel_timing) <= 2U * EBS_CACHE_LINE_SIZE,
+                  "ABS hot block exceeds two cache lines");
+
+/* Production calibration (read-only; shared by every state instance using it) */
+static EBS_ALIGNED(EBS_CACHE_LINE_SIZE) const ebs_abs_calibration_t g_abs_default_calibration = {
+    .slip_threshold = { ABS_SLIP_THRESHOLD_DEFAULT, ABS_SLIP_THRESHOLD_DEFAULT,
+                        ABS_SLIP_THRESHOLD_DEFAULT, ABS_SLIP_THRESHOLD_DEFAULT },
+    .slip_target = { ABS_SLIP_TARGET_DEFAULT, ABS_SLIP_TARGET_DEFAULT,
+                     ABS_SLIP_TARGET_DEFAULT, ABS_SLIP_TARGET_DEFAULT },
+    .pressure_reduction_rate = { ABS_PRESSURE_REDUCTION_RATE, ABS_PRESSURE_REDUCTION_RATE,
+                                 ABS_PRESSURE_REDUCTION_RATE, ABS_PRESSURE_REDUCTION_RATE },
+    .pressure_increase_rate = { ABS_PRESSURE_INCREASE_RATE, ABS_PRESSURE_INCREASE_RATE,
+                                ABS_PRESSURE_INCREASE_RATE, ABS_PRESSURE_INCREASE_RATE },
+    .min_activation_speed = ABS_MIN_VEHICLE_SPEED,
+    .enable_per_wheel = { true, true, true, true },
+    .idle_fast_path = true
+};
+
 /* Static Function Prototypes */
-static ebs_result_t ABS_InitializeCalibration(void);
-static ebs_result_t ABS_UpdateWheelState(ebs_wheel_position_t wheel);
-static float ABS_CalculateWheelAcceleration(ebs_wheel_position_t wheel, float current_speed);
-static ebs_result_t ABS_ExecuteStateMachine(ebs_wheel_position_t wheel);
-static float ABS_CalculatePressureCommand(ebs_wheel_position_t wheel);
-static bool ABS_ValidateInputs(void);
-static void ABS_UpdateStatistics(ebs_wheel_position_t wheel);
+static ebs_result_t ABS_UpdateWheelState(ebs_abs_system_state_t* sys, const ebs_abs_inputs_t* in,
+                                         ebs_wheel_position_t wheel);
+static ebs_result_t ABS_ExecuteStateMachine(ebs_abs_system_state_t* sys, ebs_wheel_position_t wheel,
+                                            uint32_t now);
+static float ABS_CalculatePressureCommand(ebs_abs_system_state_t* sys, ebs_wheel_position_t wheel,
+                                          uint32_t now);
+static float ABS_PressureModulation(ebs_abs_system_state_t* sys, ebs_wheel_position_t wheel,
+                                    float slip_ratio, float target_slip, uint32_t now);
+static bool ABS_CollectInputs(ebs_abs_inputs_t* in);
+static uint32_t ABS_ValidateInputs(ebs_abs_system_state_t* sys, const ebs_abs_inputs_t* in);
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+static void ABS_LogCycle(const ebs_abs_system_state_t* sys, uint32_t timestamp);
+#endif
+static uint8_t ABS_WheelEnableMask(const ebs_abs_calibration_t* cal);
+static void ABS_UpdateWheelAcceleration(ebs_abs_system_state_t* sys, const ebs_abs_inputs_t* in);
+static bool ABS_IdleFastPath(ebs_abs_system_state_t* sys, const ebs_abs_inputs_t* in,
+                             uint32_t healthy_mask);
 
 /**
  * @brief Initialize ABS system
@@ -38,33 +84,65 @@ static void ABS_UpdateStatistics(ebs_wheel_position_t wheel);
  */
 ebs_result_t EBS_ABS_Init(void)
 {
-    /* Clear system state */
-    memset(&g_abs_system, 0, sizeof(g_abs_system));
-    
-    /* Initialize calibration parameters */
-    if (ABS_InitializeCalibration() != EBS_OK) {
+    if (EBS_ABS_InitState(&g_abs_system) != EBS_OK) {
         EBS_Diagnostics_SetDTC(DTC_ALGORITHM_SELF_TEST_FAILED);
         return EBS_ERROR;
     }
     
+    memset(&g_abs_inputs, 0, sizeof(g_abs_inputs));
+    memset(&g_abs_commands, 0, sizeof(g_abs_commands));
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+    memset(&g_abs_statistics, 0, sizeof(g_abs_statistics));
+    memset(&g_abs_stats_log, 0, sizeof(g_abs_stats_log));
+#endif
+    
+    g_abs_initialized = true;
+    
+    return EBS_OK;
+}
+
+/**
+ * @brief Initialize an ABS state instance to power-up values
+ * @param sys State instance
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_ABS_InitState(ebs_abs_system_state_t* sys)
+{
+    if (sys == NULL) {
+        return EBS_INVALID_PARAM;
+    }
+    
+    /* Clear system state */
+    memset(sys, 0, sizeof(*sys));
+    
+    /* Production calibration until EBS_ABS_SetCalibration */
+    sys->calibration = &g_abs_default_calibration;
+    sys->wheel_enable_mask = ABS_WheelEnableMask(sys->calibration);
+    
     /* Initialize wheel states */
     for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
-        g_abs_system.wheel_state[wheel].state = ABS_STATE_INACTIVE;
-        g_abs_system.wheel_state[wheel].phase = ABS_PHASE_NORMAL;
-        g_abs_system.wheel_state[wheel].slip_ratio = 0.0f;
-        g_abs_system.wheel_state[wheel].pressure_command = 0.0f;
-        g_abs_system.wheel_state[wheel].previous_wheel_speed = 0.0f;
-        g_abs_system.wheel_state[wheel].wheel_acceleration = 0.0f;
-        g_abs_system.wheel_state[wheel].fault_detected = false;
+        sys->wheel_state[wheel].state = ABS_STATE_INACTIVE;
+        sys->wheel_state[wheel].phase = ABS_PHASE_NORMAL;
+        sys->wheel_state[wheel].slip_ratio = 0.0f;
+        sys->wheel_state[wheel].pressure_command = 0.0f;
+        sys->wheel_state[wheel].fault_detected = false;
     }
     
-    /* Initialize system parameters */
-    g_abs_system.vehicle_speed = 0.0f;
-    g_abs_system.system_enabled = true;
-    g_abs_system.any_wheel_active = false;
-    g_abs_system.system_activation_count = 0;
+    /* Wheel acceleration filter (state zeroed above) */
+    if (EBS_Filter_DerivativeDesign(&sys->wheel_accel_coeff, EBS_CYCLE_TIME_MS / 1000.0f,
+                                    ABS_WHEEL_ACCEL_FILTER_ALPHA) != EBS_OK) {
+        return EBS_ERROR;
+    }
     
-    g_abs_initialized = true;
+    /* Initialize reference speed estimator */
+    if (EBS_SpeedEst_Init(&sys->speed_estimator, EBS_CYCLE_TIME_MS / 1000.0f) != EBS_OK) {
+        return EBS_ERROR;
+    }
+    
+    /* Initialize system parameters */
+    sys->vehicle_speed = 0.0f;
+    sys->system_enabled = true;
+    sys->any_wheel_active = false;
     
     return EBS_OK;
 }
@@ -81,14 +159,14 @@ bool EBS_ABS_SelfTest(void)
     
     /* Test calibration parameters */
     for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
-        if (g_abs_system.calibration.slip_threshold[wheel] <= 0.0f ||
-            g_abs_system.calibration.slip_threshold[wheel] > 1.0f) {
+        if (g_abs_system.calibration->slip_threshold[wheel] <= 0.0f ||
+            g_abs_system.calibration->slip_threshold[wheel] > 1.0f) {
             return false;
         }
         
-        if (g_abs_system.calibration.slip_target[wheel] <= 0.0f ||
-            g_abs_system.calibration.slip_target[wheel] >= 
-            g_abs_system.calibration.slip_threshold[wheel]) {
+        if (g_abs_system.calibration->slip_target[wheel] <= 0.0f ||
+            g_abs_system.calibration->slip_target[wheel] >= 
+            g_abs_system.calibration->slip_threshold[wheel]) {
             return false;
         }
     }
@@ -99,8 +177,16 @@ bool EBS_ABS_SelfTest(void)
         return false;
     }
     
+    /* Reference estimator on a scratch instance - live state is untouched */
+    ebs_speed_estimator_t test_estimator;
     float test_speeds[WHEEL_COUNT] = {50.0f, 50.0f, 50.0f, 50.0f};
-    float test_vehicle_speed = EBS_ABS_CalculateVehicleSpeed(test_speeds);
+    float test_vehicle_speed = 0.0f;
+    if (EBS_SpeedEst_Init(&test_estimator, EBS_CYCLE_TIME_MS / 1000.0f) != EBS_OK) {
+        return false;
+    }
+    for (uint32_t step = 0; step < 2U; step++) {
+        test_vehicle_speed = EBS_SpeedEst_Step(&test_estimator, 0.0f, true, test_speeds, 0x0FU);
+    }
     if (fabs(test_vehicle_speed - 50.0f) > 0.1f) {
         return false;
     }
@@ -114,56 +200,126 @@ bool EBS_ABS_SelfTest(void)
  */
 ebs_result_t EBS_ABS_Control(void)
 {
+    EBS_Flow_Checkpoint(FLOW_CP_ABS);
+    
     if (!g_abs_initialized || !g_abs_system.system_enabled) {
         return EBS_NOT_INITIALIZED;
     }
     
-    /* Validate inputs */
-    if (!ABS_ValidateInputs()) {
+    /* Latch this cycle's sensor frame */
+    if (!ABS_CollectInputs(&g_abs_inputs)) {
         EBS_Diagnostics_SetDTC(DTC_SENSOR_SELF_TEST_FAILED);
         return EBS_ERROR;
     }
     
-    /* Get sensor data */
-    ebs_wheel_speed_data_t* wheel_data = EBS_Sensors_GetWheelSpeedData();
-    if (wheel_data == NULL) {
-        return EBS_ERROR;
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U)
+    /* Hand the pre-step state and frame to the secondary channel */
+    ebs_lockstep_request_t* request = EBS_Lockstep_BeginFrame();
+    if (request != NULL) {
+        request->state = g_abs_system;
+        request->inputs = g_abs_inputs;
     }
+#endif
     
-    /* Calculate vehicle reference speed */
-    float wheel_speeds[WHEEL_COUNT];
-    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
-        wheel_speeds[wheel] = wheel_data->speed[wheel].value;
+    EBS_ABS_Step(&g_abs_system, &g_abs_inputs, &g_abs_commands);
+    
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U)
+    if (request != NULL) {
+        EBS_Lockstep_SubmitFrame(&g_abs_commands);
     }
-    g_abs_system.vehicle_speed = EBS_ABS_CalculateVehicleSpeed(wheel_speeds);
+#endif
     
-    /* Reset system active flag */
-    g_abs_system.any_wheel_active = false;
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+    /* Statistics are expanded from the cycle record by the diagnostics task */
+    ABS_LogCycle(&g_abs_system, g_abs_inputs.timestamp);
+#endif
     
-    /* Process each wheel */
-    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
-        if (g_abs_system.calibration.enable_per_wheel[wheel]) {
+    /* Apply pressure commands and log activations outside the pure step */
+    uint32_t pending = g_abs_system.actuation_mask | g_abs_system.activation_events;
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT && pending != 0U; wheel++) {
+        if ((g_abs_system.actuation_mask & (1UL << wheel)) != 0U) {
+            EBS_Actuators_SetPressure((ebs_wheel_position_t)wheel,
+                                      g_abs_system.wheel_state[wheel].pressure_command);
+        }
+        if ((g_abs_system.activation_events & (1UL << wheel)) != 0U) {
+            EBS_Diagnostics_LogEvent(DIAG_EVENT_ABS_ACTIVATION, wheel);
+        }
+    }
+    
+    return EBS_OK;
+}
+
+/**
+ * @brief One ABS control step on a state instance
+ *
+ * Reads only @p in and @p sys and writes only @p sys and @p commands, so
+ * the same step can be replayed on a replica (e.g. the lockstep channel).
+ *
+ * @param sys State instance
+ * @param in Sensor frame
+ * @param commands Resulting control commands
+ */
+void EBS_ABS_Step(ebs_abs_system_state_t* sys, const ebs_abs_inputs_t* in,
+                  ebs_control_commands_t* commands)
+{
+    if (sys == NULL || in == NULL || commands == NULL) {
+        return;
+    }
+    
+    sys->actuation_mask = 0U;
+    sys->activation_events = 0U;
+    sys->stats_mask = 0U;
+    sys->entry_mask = 0U;
+    
+    /* Per-wheel fault flags; healthy wheels may serve as speed reference */
+    uint32_t healthy_mask = ABS_ValidateInputs(sys, in);
+    
+    /* Calculate vehicle reference speed */
+    sys->vehicle_speed = EBS_SpeedEst_Step(&sys->speed_estimator, in->longitudinal_accel,
+                                           in->accel_valid, in->wheel_speed, healthy_mask);
+    
+    /* Filtered wheel acceleration (m/s²) for all wheels in one pass */
+    ABS_UpdateWheelAcceleration(sys, in);
+    
+    /* Reset system active flag */
+    sys->any_wheel_active = false;
+    
+    /* Idle fast path: same state as the wheel loop when that loop is a no-op */
+    if (sys->calibration->idle_fast_path && ABS_IdleFastPath(sys, in, healthy_mask)) {
+        sys->idle_step_count++;
+    } else {
+        /* Process each wheel */
+        for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+            if ((sys->wheel_enable_mask & (1U << wheel)) == 0U) {
+                continue;
+            }
+            
             /* Update wheel state */
-            if (ABS_UpdateWheelState((ebs_wheel_position_t)wheel) != EBS_OK) {
+            if (ABS_UpdateWheelState(sys, in, (ebs_wheel_position_t)wheel) != EBS_OK) {
                 continue;
             }
             
             /* Execute state machine */
-            if (ABS_ExecuteStateMachine((ebs_wheel_position_t)wheel) != EBS_OK) {
+            if (ABS_ExecuteStateMachine(sys, (ebs_wheel_position_t)wheel, in->timestamp) != EBS_OK) {
                 continue;
             }
             
-            /* Update statistics */
-            ABS_UpdateStatistics((ebs_wheel_position_t)wheel);
+            /* Statistics update (expanded later from the cycle record) */
+            sys->stats_mask |= (uint8_t)(1U << wheel);
             
             /* Check if any wheel is active */
-            if (g_abs_system.wheel_state[wheel].state == ABS_STATE_ACTIVE) {
-                g_abs_system.any_wheel_active = true;
+            if (sys->wheel_state[wheel].state == ABS_STATE_ACTIVE) {
+                sys->any_wheel_active = true;
             }
         }
     }
     
-    return EBS_OK;
+    /* Publish commands */
+    memset(commands, 0, sizeof(*commands));
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        commands->brake_pressure_cmd[wheel] = sys->wheel_state[wheel].pressure_command;
+        commands->abs_active[wheel] = (sys->wheel_state[wheel].state == ABS_STATE_ACTIVE);
+    }
 }
 
 /**
@@ -196,49 +352,6 @@ float EBS_ABS_CalculateSlipRatio(float wheel_speed, float vehicle_speed)
     return slip_ratio;
 }
 
-/**
- * @brief Calculate vehicle reference speed
- * @param wheel_speeds Array of wheel speeds
- * @return float Estimated vehicle speed in km/h
- */
-float EBS_ABS_CalculateVehicleSpeed(const float* wheel_speeds)
-{
-    if (wheel_speeds == NULL) {
-        return 0.0f;
-    }
-    
-    /* Use the highest wheel speed as reference (non-braking wheel) */
-    float max_speed = 0.0f;
-    uint32_t valid_wheels = 0;
-    float speed_sum = 0.0f;
-    
-    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
-        if (wheel_speeds[wheel] >= 0.0f && wheel_speeds[wheel] <= EBS_MAX_WHEEL_SPEED) {
-            if (wheel_speeds[wheel] > max_speed) {
-                max_speed = wheel_speeds[wheel];
-            }
-            speed_sum += wheel_speeds[wheel];
-            valid_wheels++;
-        }
-    }
-    
-    /* If no valid wheels, return 0 */
-    if (valid_wheels == 0) {
-        return 0.0f;
-    }
-    
-    /* Use average of highest speed and mean speed for better accuracy */
-    float mean_speed = speed_sum / valid_wheels;
-    float vehicle_speed = (max_speed + mean_speed) / 2.0f;
-    
-    /* Apply low-pass filter for smoothing */
-    static float filtered_speed = 0.0f;
-    const float filter_alpha = 0.1f;
-    filtered_speed = filter_alpha * vehicle_speed + (1.0f - filter_alpha) * filtered_speed;
-    
-    return filtered_speed;
-}
-
 /**
  * @brief ABS pressure modulation control
  * @param wheel Wheel position
@@ -248,60 +361,8 @@ float EBS_ABS_CalculateVehicleSpeed(const float* wheel_speeds)
  */
 float EBS_ABS_PressureModulation(ebs_wheel_position_t wheel, float slip_ratio, float target_slip)
 {
-    if (!ABS_IS_WHEEL_VALID(wheel)) {
-        return 0.0f;
-    }
-    
-    ebs_abs_wheel_state_t* wheel_state = &g_abs_system.wheel_state[wheel];
-    ebs_abs_calibration_t* cal = &g_abs_system.calibration;
-    
-    float pressure_cmd = wheel_state->pressure_command;
-    
-    switch (wheel_state->phase) {
-        case ABS_PHASE_PRESSURE_REDUCTION:
-            /* Reduce pressure to decrease slip */
-            pressure_cmd *= cal->pressure_reduction_rate[wheel];
-            
-            /* Check for wheel recovery */
-            if (wheel_state->wheel_acceleration > ABS_RECOVERY_THRESHOLD) {
-                wheel_state->phase = ABS_PHASE_PRESSURE_HOLD;
-                wheel_state->phase_time = EBS_GetSystemTick();
-            }
-            break;
-            
-        case ABS_PHASE_PRESSURE_HOLD:
-            /* Hold current pressure */
-            /* Check if slip is acceptable */
-            if (slip_ratio < target_slip) {
-                wheel_state->phase = ABS_PHASE_PRESSURE_INCREASE;
-                wheel_state->phase_time = EBS_GetSystemTick();
-            } else if (slip_ratio > cal->slip_threshold[wheel]) {
-                wheel_state->phase = ABS_PHASE_PRESSURE_REDUCTION;
-                wheel_state->phase_time = EBS_GetSystemTick();
-            }
-            break;
-            
-        case ABS_PHASE_PRESSURE_INCREASE:
-            /* Gradually increase pressure */
-            pressure_cmd *= cal->pressure_increase_rate[wheel];
-            
-            /* Check for slip increase */
-            if (slip_ratio > cal->slip_threshold[wheel]) {
-                wheel_state->phase = ABS_PHASE_PRESSURE_REDUCTION;
-                wheel_state->phase_time = EBS_GetSystemTick();
-            }
-            break;
-            
-        default:
-            /* Normal braking - use master cylinder pressure */
-            pressure_cmd = 1.0f;  /* Full pressure */
-            break;
-    }
-    
-    /* Limit pressure command */
-    pressure_cmd = ABS_LIMIT_PRESSURE_COMMAND(pressure_cmd);
-    
-    return pressure_cmd;
+    return ABS_PressureModulation(&g_abs_system, wheel, slip_ratio, target_slip,
+                                  EBS_GetSystemTick());
 }
 
 /**
@@ -315,7 +376,7 @@ ebs_abs_state_t EBS_ABS_GetState(ebs_wheel_position_t wheel)
         return ABS_STATE_FAULT;
     }
     
-    return g_abs_system.wheel_state[wheel].state;
+    return (ebs_abs_state_t)g_abs_system.wheel_state[wheel].state;
 }
 
 /**
@@ -331,6 +392,20 @@ bool EBS_ABS_IsActive(void)
     return g_abs_system.any_wheel_active;
 }
 
+/**
+ * @brief Get the reference speed of the last ABS step
+ * @return float Vehicle speed in km/h
+ */
+float EBS_ABS_GetVehicleSpeed(void)
+{
+    if (!g_abs_initialized) {
+        return 0.0f;
+    }
+    
+    return g_abs_system.vehicle_speed;
+}
+
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
 /**
  * @brief Get ABS activation count for wheel
  * @param wheel Wheel position
@@ -342,130 +417,235 @@ uint32_t EBS_ABS_GetActivationCount(ebs_wheel_position_t wheel)
         return 0;
     }
     
-    return g_abs_system.statistics[wheel].activation_count;
+    return g_abs_statistics.wheel[wheel].activation_count;
 }
 
-/* Static Function Implementations */
-
 /**
- * @brief Initialize calibration parameters
- * @return ebs_result_t Initialization result
+ * @brief Expand the logged ABS cycle records into the statistics (100ms diagnostics task)
+ * @return ebs_result_t Process result
  */
-static ebs_result_t ABS_InitializeCalibration(void)
+ebs_result_t EBS_ABS_ProcessStatistics(void)
 {
-    ebs_abs_calibration_t* cal = &g_abs_system.calibration;
+    if (!g_abs_initialized) {
+        return EBS_NOT_INITIALIZED;
+    }
     
-    /* Set default calibration values */
-    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
-        cal->slip_threshold[wheel] = ABS_SLIP_THRESHOLD_DEFAULT;
-        cal->slip_target[wheel] = ABS_SLIP_TARGET_DEFAULT;
-        cal->pressure_reduction_rate[wheel] = ABS_PRESSURE_REDUCTION_RATE;
-        cal->pressure_increase_rate[wheel] = ABS_PRESSURE_INCREASE_RATE;
-        cal->enable_per_wheel[wheel] = true;
+    uint32_t tail = g_abs_stats_log.tail;
+    uint32_t head = EBS_ATOMIC_LOAD(&g_abs_stats_log.head);
+    
+    while (tail != head) {
+        EBS_ABS_ApplyRecord(&g_abs_statistics,
+                            &g_abs_stats_log.records[tail & (ABS_STATS_LOG_LENGTH - 1U)]);
+        tail++;
     }
+    EBS_ATOMIC_STORE(&g_abs_stats_log.tail, tail);
     
-    cal->min_activation_speed = ABS_MIN_VEHICLE_SPEED;
+    g_abs_statistics.dropped_records = EBS_ATOMIC_LOAD(&g_abs_stats_log.dropped);
     
     return EBS_OK;
 }
+#endif
 
 /**
- * @brief Update wheel state with current sensor data
- * @param wheel Wheel position
- * @return ebs_result_t Update result
+ * @brief Production calibration (read-only, cache-line aligned)
+ * @return const ebs_abs_calibration_t* Default calibration block
  */
-static ebs_result_t ABS_UpdateWheelState(ebs_wheel_position_t wheel)
+const ebs_abs_calibration_t* EBS_ABS_GetDefaultCalibration(void)
 {
-    if (!ABS_IS_WHEEL_VALID(wheel)) {
+    return &g_abs_default_calibration;
+}
+
+/**
+ * @brief Use a calibration block for a state instance
+ * @param sys State instance
+ * @param cal Calibration (referenced, must outlive the instance; set again after changing
+ *            enable_per_wheel, which the step reads from a cached mask)
+ * @return ebs_result_t EBS_INVALID_PARAM if a parameter is out of range
+ */
+ebs_result_t EBS_ABS_SetCalibration(ebs_abs_system_state_t* sys, const ebs_abs_calibration_t* cal)
+{
+    if (sys == NULL || cal == NULL || cal->min_activation_speed < 0.0f) {
         return EBS_INVALID_PARAM;
     }
     
-    ebs_abs_wheel_state_t* wheel_state = &g_abs_system.wheel_state[wheel];
-    ebs_wheel_speed_data_t* wheel_data = EBS_Sensors_GetWheelSpeedData();
-    
-    if (wheel_data == NULL || !wheel_data->speed[wheel].valid) {
-        wheel_state->fault_detected = true;
-        return EBS_ERROR;
+    /* Same limits as EBS_ABS_SelfTest, plus a modulating pressure cycle */
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        if (cal->slip_threshold[wheel] <= 0.0f || cal->slip_threshold[wheel] > 1.0f ||
+            cal->slip_target[wheel] <= 0.0f || cal->slip_target[wheel] >= cal->slip_threshold[wheel] ||
+            cal->pressure_reduction_rate[wheel] <= 0.0f || cal->pressure_reduction_rate[wheel] > 1.0f ||
+            cal->pressure_increase_rate[wheel] < 1.0f) {
+            return EBS_INVALID_PARAM;
+        }
     }
     
-    /* Get current wheel speed */
-    float current_speed = wheel_data->speed[wheel].value;
+    sys->calibration = cal;
+    sys->wheel_enable_mask = ABS_WheelEnableMask(cal);
     
-    /* Calculate wheel acceleration */
-    wheel_state->wheel_acceleration = ABS_CalculateWheelAcceleration(wheel, current_speed);
+    return EBS_OK;
+}
+
+/**
+ * @brief Cycle record of the last step
+ *
+ * Everything the statistics need is in the state after the step: the
+ * wheels the statistics update ran for (stats_mask) with their slip, ABS
+ * state and fault flag, and the wheels that entered ABS (entry_mask).
+ *
+ * @param sys State instance after EBS_ABS_Step
+ * @param timestamp Tick of the step's sensor frame
+ * @param record Record to fill
+ */
+void EBS_ABS_RecordCycle(const ebs_abs_system_state_t* sys, uint32_t timestamp,
+                         ebs_abs_cycle_record_t* record)
+{
+    if (sys == NULL || record == NULL) {
+        return;
+    }
     
-    /* Calculate slip ratio */
-    wheel_state->slip_ratio = EBS_ABS_CalculateSlipRatio(current_speed, g_abs_system.vehicle_speed);
+    record->timestamp = timestamp;
+    record->update_mask = sys->stats_mask;
+    record->entry_mask = sys->entry_mask;
+    record->active_mask = 0U;
+    record->fault_mask = 0U;
     
-    /* Update previous speed for next cycle */
-    wheel_state->previous_wheel_speed = current_speed;
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        const ebs_abs_wheel_state_t* wheel_state = &sys->wheel_state[wheel];
+        uint8_t bit = (uint8_t)(1U << wheel);
+        
+        if ((sys->stats_mask & bit) == 0U) {
+            record->slip_ratio[wheel] = 0.0f;
+            continue;
+        }
+        
+        record->slip_ratio[wheel] = wheel_state->slip_ratio;
+        if (wheel_state->state == ABS_STATE_ACTIVE) {
+            record->active_mask |= bit;
+        }
+        if (wheel_state->fault_detected) {
+            record->fault_mask |= bit;
+        }
+    }
+}
+
+/**
+ * @brief Expand a cycle record into statistics
+ *
+ * Same activation counts, maximum slip, active time, fault count and last
+ * activation time as updating them in the step, plus the slip histogram
+ * and the shortest and longest intervention. An intervention ends at the
+ * first record in which the wheel is not active.
+ *
+ * @param aggregate Statistics of one state instance
+ * @param record Record of one step, applied in step order
+ */
+void EBS_ABS_ApplyRecord(ebs_abs_aggregate_t* aggregate, const ebs_abs_cycle_record_t* record)
+{
+    if (aggregate == NULL || record == NULL) {
+        return;
+    }
     
-    return EBS_OK;
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        ebs_abs_statistics_t* stats = &aggregate->wheel[wheel];
+        uint8_t bit = (uint8_t)(1U << wheel);
+        
+        if ((record->entry_mask & bit) != 0U) {
+            stats->activation_count++;
+            aggregate->system_activation_count++;
+        }
+        
+        if ((record->active_mask & bit) != 0U) {
+            stats->total_active_time_ms += EBS_CYCLE_TIME_MS;
+            stats->last_activation_time = record->timestamp;
+            stats->active_run_ms += EBS_CYCLE_TIME_MS;
+        } else if (stats->active_run_ms > 0U) {
+            if (stats->min_active_duration_ms == 0U ||
+                stats->active_run_ms < stats->min_active_duration_ms) {
+                stats->min_active_duration_ms = stats->active_run_ms;
+            }
+            stats->max_active_duration_ms = EBS_MAX(stats->max_active_duration_ms,
+                                                    stats->active_run_ms);
+            stats->active_run_ms = 0U;
+        }
+        
+        if ((record->update_mask & bit) != 0U) {
+            float slip = record->slip_ratio[wheel];
+            uint32_t bin = (uint32_t)(slip * (float)(ABS_SLIP_HISTOGRAM_BINS * 2U));
+            
+            stats->max_slip_ratio = EBS_MAX(stats->max_slip_ratio, slip);
+            stats->slip_histogram[EBS_MIN(bin, ABS_SLIP_HISTOGRAM_BINS - 1U)]++;
+        }
+        
+        if ((record->fault_mask & bit) != 0U) {
+            stats->fault_count++;
+        }
+    }
 }
 
+/* Static Function Implementations */
+
 /**
- * @brief Calculate wheel acceleration
+ * @brief Update wheel state with current sensor data
+ * @param sys State instance
+ * @param in Sensor frame
  * @param wheel Wheel position
- * @param current_speed Current wheel speed
- * @return float Wheel acceleration in m/s²
+ * @return ebs_result_t Update result
  */
-static float ABS_CalculateWheelAcceleration(ebs_wheel_position_t wheel, float current_speed)
+static ebs_result_t ABS_UpdateWheelState(ebs_abs_system_state_t* sys, const ebs_abs_inputs_t* in,
+                                         ebs_wheel_position_t wheel)
 {
     if (!ABS_IS_WHEEL_VALID(wheel)) {
-        return 0.0f;
+        return EBS_INVALID_PARAM;
     }
     
-    ebs_abs_wheel_state_t* wheel_state = &g_abs_system.wheel_state[wheel];
-    
-    /* Convert km/h to m/s and calculate acceleration */
-    float current_speed_ms = current_speed / 3.6f;
-    float previous_speed_ms = wheel_state->previous_wheel_speed / 3.6f;
-    float dt = EBS_CYCLE_TIME_MS / 1000.0f;  /* Convert ms to seconds */
+    ebs_abs_wheel_state_t* wheel_state = &sys->wheel_state[wheel];
     
-    if (dt <= 0.0f) {
-        return 0.0f;
+    if ((in->wheel_valid_mask & (1UL << wheel)) == 0U) {
+        wheel_state->fault_detected = true;
+        return EBS_ERROR;
     }
     
-    float acceleration = (current_speed_ms - previous_speed_ms) / dt;
+    /* Get current wheel speed */
+    float current_speed = in->wheel_speed[wheel];
     
-    /* Apply low-pass filter to reduce noise */
-    static float filtered_accel[WHEEL_COUNT] = {0.0f};
-    const float filter_alpha = 0.2f;
-    filtered_accel[wheel] = filter_alpha * acceleration + (1.0f - filter_alpha) * filtered_accel[wheel];
+    /* Calculate slip ratio (acceleration was filtered for all wheels this cycle) */
+    wheel_state->slip_ratio = EBS_ABS_CalculateSlipRatio(current_speed, sys->vehicle_speed);
     
-    return filtered_accel[wheel];
+    return EBS_OK;
 }
 
 /**
  * @brief Execute ABS state machine for wheel
+ * @param sys State instance
  * @param wheel Wheel position
+ * @param now Current tick
  * @return ebs_result_t Execution result
  */
-static ebs_result_t ABS_ExecuteStateMachine(ebs_wheel_position_t wheel)
+static ebs_result_t ABS_ExecuteStateMachine(ebs_abs_system_state_t* sys, ebs_wheel_position_t wheel,
+                                            uint32_t now)
 {
     if (!ABS_IS_WHEEL_VALID(wheel)) {
         return EBS_INVALID_PARAM;
     }
     
-    ebs_abs_wheel_state_t* wheel_state = &g_abs_system.wheel_state[wheel];
-    ebs_abs_calibration_t* cal = &g_abs_system.calibration;
+    ebs_abs_wheel_state_t* wheel_state = &sys->wheel_state[wheel];
+    const ebs_abs_calibration_t* cal = sys->calibration;
     
-    ebs_abs_state_t previous_state = wheel_state->state;
+    ebs_abs_state_t previous_state = (ebs_abs_state_t)wheel_state->state;
     
     switch (wheel_state->state) {
         case ABS_STATE_INACTIVE:
             /* Check for activation conditions */
-            if (g_abs_system.vehicle_speed > cal->min_activation_speed &&
+            if (sys->vehicle_speed > cal->min_activation_speed &&
                 wheel_state->slip_ratio > cal->slip_threshold[wheel] &&
                 !wheel_state->fault_detected) {
                 
                 wheel_state->state = ABS_STATE_ACTIVE;
                 wheel_state->phase = ABS_PHASE_PRESSURE_REDUCTION;
-                wheel_state->activation_time = EBS_GetSystemTick();
-                wheel_state->phase_time = EBS_GetSystemTick();
+                sys->wheel_timing[wheel].activation_time = now;
+                sys->wheel_timing[wheel].phase_time = now;
                 
-                /* Log activation event */
-                EBS_Diagnostics_LogEvent(DIAG_EVENT_ABS_ACTIVATION, wheel);
+                /* Activation event is logged by the caller */
+                sys->activation_events |= (uint8_t)(1U << wheel);
             }
             break;
             
@@ -474,22 +654,22 @@ static ebs_result_t ABS_ExecuteStateMachine(ebs_wheel_position_t wheel)
             if (wheel_state->slip_ratio > cal->slip_threshold[wheel]) {
                 wheel_state->state = ABS_STATE_ACTIVE;
                 wheel_state->phase = ABS_PHASE_PRESSURE_REDUCTION;
-                wheel_state->phase_time = EBS_GetSystemTick();
-            } else if (g_abs_system.vehicle_speed < cal->min_activation_speed) {
+                sys->wheel_timing[wheel].phase_time = now;
+            } else if (sys->vehicle_speed < cal->min_activation_speed) {
                 wheel_state->state = ABS_STATE_INACTIVE;
             }
             break;
             
         case ABS_STATE_ACTIVE:
             /* Calculate pressure command */
-            wheel_state->pressure_command = ABS_CalculatePressureCommand(wheel);
+            wheel_state->pressure_command = ABS_CalculatePressureCommand(sys, wheel, now);
             
-            /* Apply pressure command to actuator */
-            EBS_Actuators_SetPressure(wheel, wheel_state->pressure_command);
+            /* Pressure command is applied to the actuator by the caller */
+            sys->actuation_mask |= (uint8_t)(1U << wheel);
             
             /* Check for deactivation conditions */
             if (wheel_state->slip_ratio < cal->slip_target[wheel] &&
-                wheel_state->wheel_acceleration > -1.0f) {  /* Not decelerating rapidly */
+                sys->wheel_accel[wheel].y > -1.0f) {  /* Not decelerating rapidly */
                 wheel_state->state = ABS_STATE_MONITORING;
                 wheel_state->phase = ABS_PHASE_NORMAL;
             }
@@ -503,7 +683,7 @@ static ebs_result_t ABS_ExecuteStateMachine(ebs_wheel_position_t wheel)
         case ABS_STATE_FAULT:
             /* Fault state - disable ABS for this wheel */
             wheel_state->pressure_command = 1.0f;  /* Full pressure (manual braking) */
-            EBS_Actuators_SetPressure(wheel, wheel_state->pressure_command);
+            sys->actuation_mask |= (uint8_t)(1U << wheel);
             
             /* Check if fault is cleared */
             if (!wheel_state->fault_detected) {
@@ -517,10 +697,9 @@ static ebs_result_t ABS_ExecuteStateMachine(ebs_wheel_position_t wheel)
             break;
     }
     
-    /* Update activation count on state transition */
+    /* Activation counts are expanded from the cycle record */
     if (previous_state != ABS_STATE_ACTIVE && wheel_state->state == ABS_STATE_ACTIVE) {
-        g_abs_system.statistics[wheel].activation_count++;
-        g_abs_system.system_activation_count++;
+        sys->entry_mask |= (uint8_t)(1U << wheel);
     }
     
     return EBS_OK;
@@ -528,83 +707,263 @@ static ebs_result_t ABS_ExecuteStateMachine(ebs_wheel_position_t wheel)
 
 /**
  * @brief Calculate pressure command for wheel
+ * @param sys State instance
  * @param wheel Wheel position
+ * @param now Current tick
  * @return float Pressure command
  */
-static float ABS_CalculatePressureCommand(ebs_wheel_position_t wheel)
+static float ABS_CalculatePressureCommand(ebs_abs_system_state_t* sys, ebs_wheel_position_t wheel,
+                                          uint32_t now)
 {
     if (!ABS_IS_WHEEL_VALID(wheel)) {
         return 1.0f;  /* Full pressure as safe default */
     }
     
-    ebs_abs_wheel_state_t* wheel_state = &g_abs_system.wheel_state[wheel];
-    ebs_abs_calibration_t* cal = &g_abs_system.calibration;
+    ebs_abs_wheel_state_t* wheel_state = &sys->wheel_state[wheel];
+    const ebs_abs_calibration_t* cal = sys->calibration;
     
-    return EBS_ABS_PressureModulation(wheel, wheel_state->slip_ratio, cal->slip_target[wheel]);
+    return ABS_PressureModulation(sys, wheel, wheel_state->slip_ratio, cal->slip_target[wheel], now);
 }
 
 /**
- * @brief Validate ABS inputs
- * @return bool True if inputs are valid
+ * @brief ABS pressure modulation control on a state instance
+ * @param sys State instance
+ * @param wheel Wheel position
+ * @param slip_ratio Current slip ratio
+ * @param target_slip Target slip ratio
+ * @param now Current tick
+ * @return float Pressure command (0.0 to 1.0)
+ */
+static float ABS_PressureModulation(ebs_abs_system_state_t* sys, ebs_wheel_position_t wheel,
+                                    float slip_ratio, float target_slip, uint32_t now)
+{
+    if (!ABS_IS_WHEEL_VALID(wheel)) {
+        return 0.0f;
+    }
+    
+    ebs_abs_wheel_state_t* wheel_state = &sys->wheel_state[wheel];
+    const ebs_abs_calibration_t* cal = sys->calibration;
+    
+    float pressure_cmd = wheel_state->pressure_command;
+    
+    switch (wheel_state->phase) {
+        case ABS_PHASE_PRESSURE_REDUCTION:
+            /* Reduce pressure to decrease slip */
+            pressure_cmd *= cal->pressure_reduction_rate[wheel];
+            
+            /* Check for wheel recovery */
+            if (sys->wheel_accel[wheel].y > ABS_RECOVERY_THRESHOLD) {
+                wheel_state->phase = ABS_PHASE_PRESSURE_HOLD;
+                sys->wheel_timing[wheel].phase_time = now;
+            }
+            break;
+            
+        case ABS_PHASE_PRESSURE_HOLD:
+            /* Hold current pressure */
+            /* Check if slip is acceptable */
+            if (slip_ratio < target_slip) {
+                wheel_state->phase = ABS_PHASE_PRESSURE_INCREASE;
+                sys->wheel_timing[wheel].phase_time = now;
+            } else if (slip_ratio > cal->slip_threshold[wheel]) {
+                wheel_state->phase = ABS_PHASE_PRESSURE_REDUCTION;
+                sys->wheel_timing[wheel].phase_time = now;
+            }
+            break;
+            
+        case ABS_PHASE_PRESSURE_INCREASE:
+            /* Gradually increase pressure */
+            pressure_cmd *= cal->pressure_increase_rate[wheel];
+            
+            /* Check for slip increase */
+            if (slip_ratio > cal->slip_threshold[wheel]) {
+                wheel_state->phase = ABS_PHASE_PRESSURE_REDUCTION;
+                sys->wheel_timing[wheel].phase_time = now;
+            }
+            break;
+            
+        default:
+            /* Normal braking - use master cylinder pressure */
+            pressure_cmd = 1.0f;  /* Full pressure */
+            break;
+    }
+    
+    /* Limit pressure command */
+    pressure_cmd = ABS_LIMIT_PRESSURE_COMMAND(pressure_cmd);
+    
+    return pressure_cmd;
+}
+
+/**
+ * @brief Latch the sensor frame for this cycle
+ * @param in Destination frame
+ * @return bool False if wheel speed data is unavailable
  */
-static bool ABS_ValidateInputs(void)
+static bool ABS_CollectInputs(ebs_abs_inputs_t* in)
 {
     ebs_wheel_speed_data_t* wheel_data = EBS_Sensors_GetWheelSpeedData();
     if (wheel_data == NULL) {
         return false;
     }
     
+    in->wheel_valid_mask = 0U;
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        in->wheel_speed[wheel] = wheel_data->speed[wheel].value;
+        if (wheel_data->speed[wheel].valid) {
+            in->wheel_valid_mask |= 1UL << wheel;
+        }
+    }
+    
+    /* Longitudinal acceleration carries the reference through lock-up */
+    ebs_imu_data_t* imu_data = EBS_Sensors_GetIMUData();
+    in->accel_valid = (imu_data != NULL) && imu_data->longitudinal_accel.valid;
+    in->longitudinal_accel = in->accel_valid ? imu_data->longitudinal_accel.value : 0.0f;
+    
+    in->timestamp = EBS_GetSystemTick();
+    
+    return true;
+}
+
+/**
+ * @brief Validate ABS inputs
+ * @param sys State instance
+ * @param in Sensor frame
+ * @return uint32_t Bit per wheel that is valid and in range
+ */
+static uint32_t ABS_ValidateInputs(ebs_abs_system_state_t* sys, const ebs_abs_inputs_t* in)
+{
+    uint32_t healthy_mask = 0U;
+    
     /* Check wheel speed data validity */
     for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
-        if (!wheel_data->speed[wheel].valid) {
-            g_abs_system.wheel_state[wheel].fault_detected = true;
+        if ((in->wheel_valid_mask & (1UL << wheel)) == 0U) {
+            sys->wheel_state[wheel].fault_detected = true;
         } else {
             /* Range check */
-            float speed = wheel_data->speed[wheel].value;
+            float speed = in->wheel_speed[wheel];
             if (speed < 0.0f || speed > EBS_MAX_WHEEL_SPEED) {
-                g_abs_system.wheel_state[wheel].fault_detected = true;
+                sys->wheel_state[wheel].fault_detected = true;
             } else {
-                g_abs_system.wheel_state[wheel].fault_detected = false;
+                sys->wheel_state[wheel].fault_detected = false;
+                healthy_mask |= 1UL << wheel;
             }
         }
     }
     
-    return true;
+    return healthy_mask;
 }
 
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
 /**
- * @brief Update ABS statistics
- * @param wheel Wheel position
+ * @brief Append the cycle record of the last step to the statistics log
+ * @param sys State instance after EBS_ABS_Step
+ * @param timestamp Tick of the step's sensor frame
  */
-static void ABS_UpdateStatistics(ebs_wheel_position_t wheel)
+static void ABS_LogCycle(const ebs_abs_system_state_t* sys, uint32_t timestamp)
 {
-    if (!ABS_IS_WHEEL_VALID(wheel)) {
+    uint32_t head = g_abs_stats_log.head;
+    
+    /* Full only if the diagnostics task stalled for a whole log length */
+    if (head - EBS_ATOMIC_LOAD(&g_abs_stats_log.tail) >= ABS_STATS_LOG_LENGTH) {
+        EBS_ATOMIC_STORE(&g_abs_stats_log.dropped, g_abs_stats_log.dropped + 1U);
         return;
     }
     
-    ebs_abs_statistics_t* stats = &g_abs_system.statistics[wheel];
-    ebs_abs_wheel_state_t* wheel_state = &g_abs_system.wheel_state[wheel];
+    EBS_ABS_RecordCycle(sys, timestamp, &g_abs_stats_log.records[head & (ABS_STATS_LOG_LENGTH - 1U)]);
+    EBS_ATOMIC_STORE(&g_abs_stats_log.head, head + 1U);
+}
+#endif
+
+/**
+ * @brief Per-wheel enable flags of a calibration as a wheel bit mask
+ * @param cal Calibration
+ * @return uint8_t Bit per enabled wheel
+ */
+static uint8_t ABS_WheelEnableMask(const ebs_abs_calibration_t* cal)
+{
+    uint8_t mask = 0U;
     
-    /* Update maximum slip ratio */
-    if (wheel_state->slip_ratio > stats->max_slip_ratio) {
-        stats->max_slip_ratio = wheel_state->slip_ratio;
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        if (cal->enable_per_wheel[wheel]) {
+            mask |= (uint8_t)(1U << wheel);
+        }
     }
     
-    /* Update active time */
-    if (wheel_state->state == ABS_STATE_ACTIVE) {
-        stats->total_active_time_ms += EBS_CYCLE_TIME_MS;
-        stats->last_activation_time = EBS_GetSystemTick();
-    }
+    return mask;
+}
+
+/**
+ * @brief Filtered wheel acceleration of all wheels (differentiator with EMA smoothing)
+ *
+ * The channel state lives in the hot block, the coefficients on the cold
+ * line.
+ *
+ * @param sys State instance
+ * @param in Sensor frame
+ */
+static void ABS_UpdateWheelAcceleration(ebs_abs_system_state_t* sys, const ebs_abs_inputs_t* in)
+{
+    float wheel_speed_ms[WHEEL_COUNT];
     
-    /* Update fault count */
-    if (wheel_state->fault_detected) {
-        stats->fault_count++;
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        wheel_speed_ms[wheel] = in->wheel_speed[wheel] / 3.6f;
     }
+    
+    EBS_Filter_DerivativeStep(&sys->wheel_accel_coeff, sys->wheel_accel, wheel_speed_ms,
+                              WHEEL_COUNT);
 }
 
-/* External function implementations for missing functions */
-uint32_t EBS_GetSystemTick(void)
+/**
+ * @brief Idle fast path of the wheel loop
+ *
+ * When every enabled wheel is healthy and INACTIVE and none meets the
+ * activation condition of ABS_ExecuteStateMachine, the wheel loop only
+ * refreshes slip and marks the statistics update of every enabled wheel.
+ * This evaluates slip for all wheels in
+ * one branch-free pass (same arithmetic as EBS_ABS_CalculateSlipRatio)
+ * and, if the step is idle, performs just those writes.
+ *
+ * @param sys State instance
+ * @param in Sensor frame
+ * @param healthy_mask Wheels that passed input validation
+ * @return bool False if the full wheel loop must run (nothing written)
+ */
+static bool ABS_IdleFastPath(ebs_abs_system_state_t* sys, const ebs_abs_inputs_t* in,
+                             uint32_t healthy_mask)
 {
-    static uint32_t tick_counter = 0;
-    return ++tick_counter;
+    const ebs_abs_calibration_t* cal = sys->calibration;
+    const uint32_t enable_mask = sys->wheel_enable_mask;
+    const float vehicle_speed = sys->vehicle_speed;
+    const bool speed_sufficient = vehicle_speed > cal->min_activation_speed;
+    float slip[WHEEL_COUNT];
+    uint32_t busy = 0U;
+    
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        float speed = in->wheel_speed[wheel];
+        float raw = (vehicle_speed >= 1.0f && speed >= 0.0f) ?
+                    ((vehicle_speed - speed) / vehicle_speed) : 0.0f;
+        
+        slip[wheel] = EBS_CLAMP(raw, 0.0f, 1.0f);
+        
+        uint32_t can_activate = (speed_sufficient && slip[wheel] > cal->slip_threshold[wheel]) ? 1U : 0U;
+        uint32_t not_idle = (sys->wheel_state[wheel].state != ABS_STATE_INACTIVE) ? 1U : 0U;
+        uint32_t unhealthy = ((healthy_mask >> wheel) & 1U) ^ 1U;
+        uint32_t enabled = (enable_mask >> wheel) & 1U;
+        
+        busy |= (can_activate | not_idle | unhealthy) & enabled;
+    }
+    
+    if (busy != 0U) {
+        return false;
+    }
+    
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        if ((enable_mask & (1U << wheel)) != 0U) {
+            ebs_abs_wheel_state_t* wheel_state = &sys->wheel_state[wheel];
+            
+            wheel_state->slip_ratio = slip[wheel];
+        }
+    }
+    sys->stats_mask = (uint8_t)enable_mask;
+    
+    return true;
 }
@@ -12,27 +12,66 @@
  */
 
 #include "ebs_actuators.h"
+#include "ebs_abs.h"
+#include "ebs_sensors.h"
 #include "ebs_safety.h"
 #include "ebs_diagnostics.h"
+#include "ebs_flow_monitor.h"
 #include <string.h>
 #include <math.h>
 
 /* Static Variables */
 static ebs_actuator_manager_t g_actuator_manager;
 static bool g_actuators_initialized = false;
+static float g_pressure_model_gain;         /* Per-cycle gain of the wheel pressure model */
+
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+/* Cycle records from the control task to the diagnostics task (single producer/consumer) */
+static struct {
+    ebs_actuator_cycle_record_t records[ACTUATOR_STATS_LOG_LENGTH];
+    uint32_t head;                          /* Written by the control task only */
+    uint32_t tail;                          /* Written by the diagnostics task only */
+    uint32_t dropped;                       /* Records not logged because the log was full */
+} g_actuator_stats_log;
+#endif
 
 /* Static Function Prototypes */
+static void Actuators_SimulatedDrive(ebs_valve_id_t valve, float duty_cycle);
+static float Actuators_SimulatedPosition(ebs_valve_id_t valve);
 static ebs_result_t Actuators_InitializeHydraulicModulator(void);
 static ebs_result_t Actuators_InitializePumpMotor(void);
 static ebs_result_t Actuators_InitializeValves(void);
 static ebs_result_t Actuators_UpdateHydraulicModulator(void);
 static ebs_result_t Actuators_UpdatePumpMotor(void);
 static ebs_result_t Actuators_UpdateValves(void);
+static void Actuators_DebounceValveFault(ebs_valve_id_t valve, bool deviation);
+static void Actuators_CheckPressurePlausibility(void);
 static bool Actuators_ValidatePressureCommand(ebs_wheel_position_t wheel, float pressure);
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
 static void Actuators_UpdateDiagnostics(void);
+static void Actuators_ApplyRecord(ebs_actuator_diagnostics_t* diag,
+                                  const ebs_actuator_cycle_record_t* record);
+#endif
 static ebs_result_t Actuators_SetValvePosition(ebs_valve_id_t valve_id, float position);
 static float Actuators_CalculatePWMDutyCycle(float command);
 
+/* Valve coil driver */
+static ebs_valve_driver_t g_valve_driver = { Actuators_SimulatedDrive, Actuators_SimulatedPosition };
+
+/**
+ * @brief Select the valve coil driver (before EBS_Actuators_Init)
+ * @param driver Driver, NULL members keep the simulated default
+ */
+void EBS_Actuators_SetValveDriver(const ebs_valve_driver_t* driver)
+{
+    if (driver == NULL) {
+        return;
+    }
+    
+    g_valve_driver.drive = (driver->drive != NULL) ? driver->drive : Actuators_SimulatedDrive;
+    g_valve_driver.position = (driver->position != NULL) ? driver->position : Actuators_SimulatedPosition;
+}
+
 /**
  * @brief Initialize actuator subsystem
  * @return ebs_result_t Initialization result
@@ -41,6 +80,9 @@ ebs_result_t EBS_Actuators_Init(void)
 {
     /* Clear actuator manager state */
     memset(&g_actuator_manager, 0, sizeof(g_actuator_manager));
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+    memset(&g_actuator_stats_log, 0, sizeof(g_actuator_stats_log));
+#endif
     
     /* Initialize hydraulic modulator */
     if (Actuators_InitializeHydraulicModulator() != EBS_OK) {
@@ -57,6 +99,9 @@ ebs_result_t EBS_Actuators_Init(void)
         return EBS_ERROR;
     }
     
+    /* First-order wheel cylinder lag, discretized at the cycle time */
+    g_pressure_model_gain = 1.0f - expf(-(float)EBS_CYCLE_TIME_MS / HYDRAULIC_WHEEL_TIME_CONSTANT_MS);
+    
     /* Initialize actuator manager state */
     g_actuator_manager.system_enabled = true;
     g_actuator_manager.last_update_time = EBS_GetSystemTick();
@@ -100,7 +145,7 @@ bool EBS_Actuators_SelfTest(void)
     }
     
     /* Test pressure command validation */
-    if (!Actuators_ValidatePressureCommand(WHEEL_FRONT_LEFT, 50.0f)) {
+    if (!Actuators_ValidatePressureCommand(WHEEL_FRONT_LEFT, 0.5f)) {
         test_passed = false;
     }
     
@@ -119,6 +164,8 @@ bool EBS_Actuators_SelfTest(void)
  */
 ebs_result_t EBS_Actuators_Update(void)
 {
+    EBS_Flow_Checkpoint(FLOW_CP_ACTUATORS);
+    
     if (!g_actuators_initialized || !g_actuator_manager.system_enabled) {
         return EBS_NOT_INITIALIZED;
     }
@@ -135,13 +182,28 @@ ebs_result_t EBS_Actuators_Update(void)
         result = EBS_ERROR;
     }
     
+    /* Wheels without a command this cycle fall back to base braking (coils off) */
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        if ((g_actuator_manager.command_mask & (1UL << wheel)) == 0U) {
+            g_actuator_manager.pressure_commands[wheel] = 1.0f;
+            (void)Actuators_SetValvePosition((ebs_valve_id_t)(VALVE_INLET_FL + wheel), 1.0f);
+            (void)Actuators_SetValvePosition((ebs_valve_id_t)(VALVE_OUTLET_FL + wheel), 0.0f);
+        }
+    }
+    g_actuator_manager.command_mask = 0U;
+    
     /* Update valves */
     if (Actuators_UpdateValves() != EBS_OK) {
         result = EBS_ERROR;
     }
     
+    /* Wheel pressure sensors against the hydraulic model */
+    Actuators_CheckPressurePlausibility();
+    
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
     /* Update diagnostics */
     Actuators_UpdateDiagnostics();
+#endif
     
     /* Update manager state */
     g_actuator_manager.last_update_time = EBS_GetSystemTick();
@@ -170,6 +232,7 @@ ebs_result_t EBS_Actuators_SetPressure(ebs_wheel_position_t wheel, float pressur
     /* Store pressure command */
     g_actuator_manager.pressure_commands[wheel] = pressure;
     g_actuator_manager.command_timestamps[wheel] = EBS_GetSystemTick();
+    g_actuator_manager.command_mask |= 1UL << wheel;
     
     /* Convert pressure command to valve positions */
     ebs_valve_id_t inlet_valve = (ebs_valve_id_t)(VALVE_INLET_FL + wheel);
@@ -283,9 +346,10 @@ bool EBS_Actuators_IsOperational(void)
     return true;
 }
 
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
 /**
  * @brief Get actuator diagnostics
- * @return ebs_actuator_diagnostics_t* Pointer to diagnostics
+ * @return ebs_actuator_diagnostics_t* Diagnostics as of the last EBS_Actuators_ProcessDiagnostics
  */
 const ebs_actuator_diagnostics_t* EBS_Actuators_GetDiagnostics(void)
 {
@@ -296,8 +360,96 @@ const ebs_actuator_diagnostics_t* EBS_Actuators_GetDiagnostics(void)
     return &g_actuator_manager.diagnostics;
 }
 
+/**
+ * @brief Expand the logged update records into the diagnostics (100ms diagnostics task)
+ * @return ebs_result_t Process result
+ */
+ebs_result_t EBS_Actuators_ProcessDiagnostics(void)
+{
+    if (!g_actuators_initialized) {
+        return EBS_NOT_INITIALIZED;
+    }
+    
+    ebs_actuator_diagnostics_t* diag = &g_actuator_manager.diagnostics;
+    uint32_t tail = g_actuator_stats_log.tail;
+    uint32_t head = EBS_ATOMIC_LOAD(&g_actuator_stats_log.head);
+    
+    while (tail != head) {
+        Actuators_ApplyRecord(diag,
+                              &g_actuator_stats_log.records[tail & (ACTUATOR_STATS_LOG_LENGTH - 1U)]);
+        tail++;
+    }
+    EBS_ATOMIC_STORE(&g_actuator_stats_log.tail, tail);
+    
+    diag->dropped_records = EBS_ATOMIC_LOAD(&g_actuator_stats_log.dropped);
+    
+    return EBS_OK;
+}
+#endif
+
+/**
+ * @brief Shutdown actuator subsystem
+ */
+void EBS_Actuators_Shutdown(void)
+{
+    EBS_Actuators_EmergencyStop();
+    g_actuators_initialized = false;
+}
+
+/**
+ * @brief De-energize all actuators (base brake fallback)
+ *
+ * Inlet valves are normally open and outlet valves normally closed, so
+ * with the coils off the driver keeps direct hydraulic braking.
+ */
+void EBS_Actuators_EmergencyStop(void)
+{
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        g_actuator_manager.valves[VALVE_INLET_FL + wheel].position_command = 1.0f;
+        g_actuator_manager.valves[VALVE_OUTLET_FL + wheel].position_command = 0.0f;
+    }
+
+    for (uint32_t valve = 0; valve < VALVE_COUNT; valve++) {
+        g_actuator_manager.valves[valve].pwm_duty_cycle = 0.0f;
+    }
+
+    g_actuator_manager.pump_motor.speed_command = 0.0f;
+    g_actuator_manager.pump_motor.pwm_duty_cycle = 0.0f;
+    g_actuator_manager.pump_motor.state = PUMP_STATE_STOPPED;
+    g_actuator_manager.system_enabled = false;
+}
+
 /* Static Function Implementations */
 
+/* Simulated spool positions (inlet valves normally open) */
+static float g_simulated_valve_position[VALVE_COUNT] = {
+    1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f
+};
+
+/**
+ * @brief Simulated coil driver: first-order spool response to the duty cycle
+ * @param valve Valve identifier
+ * @param duty_cycle PWM duty cycle in %
+ */
+static void Actuators_SimulatedDrive(ebs_valve_id_t valve, float duty_cycle)
+{
+    /* In real implementation, this would update the PWM compare register */
+    float position_error = duty_cycle / 100.0f - g_simulated_valve_position[valve];
+    float time_step_s = EBS_CYCLE_TIME_MS / 1000.0f;
+    
+    g_simulated_valve_position[valve] += position_error * VALVE_POSITION_RESPONSE_RATE * time_step_s;
+}
+
+/**
+ * @brief Simulated spool position feedback
+ * @param valve Valve identifier
+ * @return float Spool position (0.0 to 1.0)
+ */
+static float Actuators_SimulatedPosition(ebs_valve_id_t valve)
+{
+    return g_simulated_valve_position[valve];
+}
+
 /**
  * @brief Initialize hydraulic modulator
  * @return ebs_result_t Initialization result
@@ -364,9 +516,11 @@ static ebs_result_t Actuators_InitializeValves(void)
         inlet_valve->response_time_ms = VALVE_RESPONSE_TIME_MS;
         inlet_valve->enabled = true;
         inlet_valve->fault_detected = false;
-        inlet_valve->position_command = 0.0f;
-        inlet_valve->current_position = 0.0f;
+        inlet_valve->position_command = 1.0f;  /* Normally open */
+        inlet_valve->applied_command = 1.0f;
+        inlet_valve->current_position = 1.0f;
         inlet_valve->pwm_duty_cycle = 0.0f;
+        inlet_valve->fault_ms = 0;
         inlet_valve->command_timestamp = EBS_GetSystemTick();
     }
     
@@ -380,9 +534,11 @@ static ebs_result_t Actuators_InitializeValves(void)
         outlet_valve->response_time_ms = VALVE_RESPONSE_TIME_MS;
         outlet_valve->enabled = true;
         outlet_valve->fault_detected = false;
-        outlet_valve->position_command = 0.0f;
+        outlet_valve->position_command = 0.0f;  /* Normally closed */
+        outlet_valve->applied_command = 0.0f;
         outlet_valve->current_position = 0.0f;
         outlet_valve->pwm_duty_cycle = 0.0f;
+        outlet_valve->fault_ms = 0;
         outlet_valve->command_timestamp = EBS_GetSystemTick();
     }
     
@@ -492,32 +648,86 @@ static ebs_result_t Actuators_UpdateValves(void)
             continue;
         }
         
-        /* Simulate valve position response */
-        float position_error = valve_ptr->position_command - valve_ptr->current_position;
-        float time_step_s = EBS_CYCLE_TIME_MS / 1000.0f;
-        float position_change = position_error * VALVE_POSITION_RESPONSE_RATE * time_step_s;
+        /* Spool feedback has settled on the command driven in the previous update */
+        valve_ptr->current_position = g_valve_driver.position((ebs_valve_id_t)valve);
+        float position_error = valve_ptr->applied_command - valve_ptr->current_position;
         
-        valve_ptr->current_position += position_change;
+        /* Drive this update's command */
+        valve_ptr->pwm_duty_cycle = Actuators_CalculatePWMDutyCycle(valve_ptr->position_command);
+        g_valve_driver.drive((ebs_valve_id_t)valve, valve_ptr->pwm_duty_cycle);
+        valve_ptr->applied_command = valve_ptr->position_command;
+        
+        /* Check for faults */
+        valve_ptr->fault_detected = fabs(position_error) > VALVE_POSITION_ERROR_THRESHOLD;
+        Actuators_DebounceValveFault((ebs_valve_id_t)valve, valve_ptr->fault_detected);
+    }
+    
+    return EBS_OK;
+}
+
+/**
+ * @brief Debounce a valve feedback deviation into its DTC and the safe state
+ * @param valve Valve identifier
+ * @param deviation Feedback off the command this update
+ */
+static void Actuators_DebounceValveFault(ebs_valve_id_t valve, bool deviation)
+{
+    ebs_valve_t* valve_ptr = &g_actuator_manager.valves[valve];
+    
+    if (!deviation) {
+        valve_ptr->fault_ms = 0;
+        return;
+    }
+    
+    valve_ptr->fault_ms += EBS_CYCLE_TIME_MS;
+    if (valve_ptr->fault_ms == VALVE_FAULT_DEBOUNCE_MS) {
+        /* A valve off its command no longer modulates the wheel as intended */
+        EBS_Diagnostics_SetDTC((valve_ptr->type == VALVE_TYPE_INLET) ?
+                               (ebs_dtc_code_t)(DTC_INLET_VALVE_FL + valve - VALVE_INLET_FL) :
+                               (ebs_dtc_code_t)(DTC_OUTLET_VALVE_FL + valve - VALVE_OUTLET_FL));
+        EBS_Safety_EnterSafeState(SAFETY_FAULT_ACTUATOR_FAILURE);
+    }
+}
+
+/**
+ * @brief Check the wheel pressure sensors against the hydraulic model
+ *
+ * Inlet and outlet valves are driven as a complementary pair, so the
+ * wheel cylinder follows the master cylinder pressure up to the inlet
+ * opening with a first-order lag. The model runs on valve feedback, not
+ * on the command, so a valve fault does not show up as a sensor fault.
+ */
+static void Actuators_CheckPressurePlausibility(void)
+{
+    const ebs_pressure_data_t* pressure = EBS_Sensors_GetPressureData();
+    
+    if (pressure == NULL) {
+        return;
+    }
+    
+    float master = pressure->master_cylinder.value / HYDRAULIC_MAX_PRESSURE_BAR;
+    
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        float* model = &g_actuator_manager.wheel_pressure_model[wheel];
+        const ebs_sensor_data_t* measured = &pressure->wheel_pressure[wheel];
+        float inlet = g_actuator_manager.valves[VALVE_INLET_FL + wheel].current_position;
         
-        /* Clamp to valid range */
-        if (valve_ptr->current_position < 0.0f) {
-            valve_ptr->current_position = 0.0f;
-        } else if (valve_ptr->current_position > 1.0f) {
-            valve_ptr->current_position = 1.0f;
+        if (!pressure->master_cylinder.valid || !measured->valid) {
+            g_actuator_manager.pressure_error_ms[wheel] = 0;
+            continue;
         }
         
-        /* Update PWM duty cycle */
-        valve_ptr->pwm_duty_cycle = Actuators_CalculatePWMDutyCycle(valve_ptr->current_position);
+        *model += (EBS_MIN(master, inlet) - *model) * g_pressure_model_gain;
         
-        /* Check for faults */
-        if (fabs(position_error) > VALVE_POSITION_ERROR_THRESHOLD) {
-            valve_ptr->fault_detected = true;
+        if (fabsf(measured->value / HYDRAULIC_MAX_PRESSURE_BAR - *model) > HYDRAULIC_PLAUSIBILITY_LIMIT) {
+            g_actuator_manager.pressure_error_ms[wheel] += EBS_CYCLE_TIME_MS;
+            if (g_actuator_manager.pressure_error_ms[wheel] == HYDRAULIC_PLAUSIBILITY_DEBOUNCE_MS) {
+                EBS_Diagnostics_SetDTC((ebs_dtc_code_t)(DTC_PRESSURE_SENSOR_FL + wheel));
+            }
         } else {
-            valve_ptr->fault_detected = false;
+            g_actuator_manager.pressure_error_ms[wheel] = 0;
         }
     }
-    
-    return EBS_OK;
 }
 
 /**
@@ -551,24 +761,62 @@ static bool Actuators_ValidatePressureCommand(ebs_wheel_position_t wheel, float
     return true;
 }
 
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
 /**
- * @brief Update actuator diagnostics
+ * @brief Log this update's fault bits for the diagnostics task
  */
 static void Actuators_UpdateDiagnostics(void)
 {
-    ebs_actuator_diagnostics_t* diag = &g_actuator_manager.diagnostics;
+    uint32_t timestamp = EBS_GetSystemTick();
+    uint32_t head = g_actuator_stats_log.head;
+    
+    /* Full only if the diagnostics task stalled for a whole log length */
+    if (head - EBS_ATOMIC_LOAD(&g_actuator_stats_log.tail) >= ACTUATOR_STATS_LOG_LENGTH) {
+        EBS_ATOMIC_STORE(&g_actuator_stats_log.dropped, g_actuator_stats_log.dropped + 1U);
+        return;
+    }
+    
+    ebs_actuator_cycle_record_t* record =
+        &g_actuator_stats_log.records[head & (ACTUATOR_STATS_LOG_LENGTH - 1U)];
     
+    record->timestamp = timestamp;
+    record->valve_fault_mask = 0U;
+    for (uint32_t valve = 0; valve < VALVE_COUNT; valve++) {
+        if (g_actuator_manager.valves[valve].fault_detected) {
+            record->valve_fault_mask |= (uint8_t)(1U << valve);
+        }
+    }
+    record->unit_fault_mask =
+        (uint8_t)((g_actuator_manager.hydraulic_modulator.fault_detected ? ACTUATOR_FAULT_MODULATOR : 0U) |
+                  (g_actuator_manager.pump_motor.fault_detected ? ACTUATOR_FAULT_PUMP : 0U));
+    
+    EBS_ATOMIC_STORE(&g_actuator_stats_log.head, head + 1U);
+}
+
+/**
+ * @brief Expand one update record into the diagnostics
+ *
+ * The fault flags, counts and update time are those of the latest record,
+ * as the per-update refresh would have left them.
+ *
+ * @param diag Diagnostics
+ * @param record Record of one update, applied in update order
+ */
+static void Actuators_ApplyRecord(ebs_actuator_diagnostics_t* diag,
+                                  const ebs_actuator_cycle_record_t* record)
+{
     /* Check hydraulic modulator fault */
-    diag->hydraulic_modulator_fault = g_actuator_manager.hydraulic_modulator.fault_detected;
+    diag->hydraulic_modulator_fault = (record->unit_fault_mask & ACTUATOR_FAULT_MODULATOR) != 0U;
     
     /* Check pump motor fault */
-    diag->pump_motor_fault = g_actuator_manager.pump_motor.fault_detected;
+    diag->pump_motor_fault = (record->unit_fault_mask & ACTUATOR_FAULT_PUMP) != 0U;
     
     /* Count valve faults */
     diag->valve_faults = 0;
     for (uint32_t valve = 0; valve < VALVE_COUNT; valve++) {
-        if (g_actuator_manager.valves[valve].fault_detected) {
+        if ((record->valve_fault_mask & (1U << valve)) != 0U) {
             diag->valve_faults++;
+            diag->valve_fault_cycles[valve]++;
         }
     }
     
@@ -578,8 +826,17 @@ static void Actuators_UpdateDiagnostics(void)
                         diag->valve_faults;
     
     /* Update last update time */
-    diag->last_update_time = EBS_GetSystemTick();
+    diag->last_update_time = record->timestamp;
+    
+    /* Aggregates over all updates */
+    diag->update_cycles++;
+    if (diag->total_faults > 0U) {
+        diag->fault_cycles++;
+    }
+    diag->max_total_faults = EBS_MAX(diag->max_total_faults, diag->total_faults);
+    diag->fault_histogram[EBS_MIN(diag->total_faults, ACTUATOR_FAULT_HISTOGRAM_BINS - 1U)]++;
 }
+#endif
 
 /**
  * @brief Set valve position
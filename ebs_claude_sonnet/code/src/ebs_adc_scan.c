@@ -0,0 +1,172 @@
+/**
+ * @file ebs_adc_scan.c
+ * @brief Electronic Braking System - ADC Scan Group Implementation
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * All channels of a group are converted in one burst into a contiguous
+ * buffer. Decimation, calibration and range checking then run as flat
+ * loops over parallel arrays so the compiler can vectorize them.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#include "ebs_adc_scan.h"
+#include <string.h>
+
+/**
+ * @brief Initialize a scan group
+ * @param group Scan group to initialize
+ * @param channels Hardware channel list
+ * @param channel_count Number of channels
+ * @param oversample_shift log2 of oversampling ratio (0 = no oversampling)
+ * @param source Conversion engine
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_AdcScan_Init(ebs_adc_scan_group_t* group, const uint8_t* channels,
+                              uint32_t channel_count, uint32_t oversample_shift,
+                              ebs_adc_scan_source_t source)
+{
+    if (group == NULL || channels == NULL || source == NULL) {
+        return EBS_INVALID_PARAM;
+    }
+
+    if (channel_count == 0U || channel_count > ADC_SCAN_MAX_CHANNELS ||
+        oversample_shift > ADC_SCAN_MAX_OVERSAMPLE_SHIFT) {
+        return EBS_INVALID_PARAM;
+    }
+
+    memset(group, 0, sizeof(*group));
+    memcpy(group->channels, channels, channel_count);
+    group->channel_count = channel_count;
+    group->oversample_shift = oversample_shift;
+    group->source = source;
+    group->state = ADC_SCAN_STATE_IDLE;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Trigger one burst acquisition of the whole group
+ * @param group Scan group
+ * @return ebs_result_t EBS_BUSY if the previous scan has not been consumed
+ */
+ebs_result_t EBS_AdcScan_Trigger(ebs_adc_scan_group_t* group)
+{
+    if (group == NULL || group->source == NULL) {
+        return EBS_INVALID_PARAM;
+    }
+
+    if (group->state == ADC_SCAN_STATE_BUSY) {
+        /* Previous burst still in flight - conversion rate too low */
+        group->overrun_count++;
+        return EBS_BUSY;
+    }
+
+    group->state = ADC_SCAN_STATE_BUSY;
+
+    ebs_result_t result = group->source(group->channels, group->channel_count,
+                                        (1UL << group->oversample_shift), group->buffer);
+
+    if (result == EBS_OK) {
+        /* Synchronous engine - transfer already complete */
+        group->state = ADC_SCAN_STATE_COMPLETE;
+    } else if (result != EBS_BUSY) {
+        /* Engine refused the transfer */
+        group->state = ADC_SCAN_STATE_FAULT;
+        return EBS_ERROR;
+    }
+
+    return EBS_OK;
+}
+
+/**
+ * @brief DMA transfer-complete notification (ISR context on target)
+ * @param group Scan group
+ * @param timestamp Completion tick
+ */
+void EBS_AdcScan_OnComplete(ebs_adc_scan_group_t* group, uint32_t timestamp)
+{
+    if (group == NULL) {
+        return;
+    }
+
+    if (group->state == ADC_SCAN_STATE_BUSY) {
+        group->state = ADC_SCAN_STATE_COMPLETE;
+    }
+    group->completion_time = timestamp;
+}
+
+/**
+ * @brief Decimate, calibrate and range-check the completed buffer
+ * @param group Scan group
+ * @param cal Per-channel calibration
+ * @return ebs_result_t EBS_BUSY if no completed scan is available
+ */
+ebs_result_t EBS_AdcScan_Process(ebs_adc_scan_group_t* group,
+                                 const ebs_adc_scan_calibration_t* cal)
+{
+    if (group == NULL || cal == NULL) {
+        return EBS_INVALID_PARAM;
+    }
+
+    if (group->state != ADC_SCAN_STATE_COMPLETE) {
+        return (group->state == ADC_SCAN_STATE_FAULT) ? EBS_FAULT : EBS_BUSY;
+    }
+
+    const uint32_t count = group->channel_count;
+    const uint32_t rounds = 1UL << group->oversample_shift;
+    uint32_t sum[ADC_SCAN_MAX_CHANNELS] = {0U};
+
+    /* Decimation: accumulate each sweep, then shift back to 12-bit counts */
+    for (uint32_t round = 0; round < rounds; round++) {
+        const uint16_t* sweep = &group->buffer[round * count];
+        for (uint32_t ch = 0; ch < count; ch++) {
+            sum[ch] += sweep[ch];
+        }
+    }
+
+    /* Calibration and range check in one pass over the group */
+    uint32_t valid_mask = 0U;
+    for (uint32_t ch = 0; ch < count; ch++) {
+        uint16_t raw = (uint16_t)(sum[ch] >> group->oversample_shift);
+        float value = ((float)raw + cal->offset[ch]) * cal->scale[ch];
+        bool in_range = (value >= cal->min_value[ch]) && (value <= cal->max_value[ch]);
+
+        group->raw[ch] = raw;
+        group->value[ch] = EBS_CLAMP(value, cal->min_value[ch], cal->max_value[ch]);
+        valid_mask |= (in_range ? 1UL : 0UL) << ch;
+    }
+
+    group->valid_mask = valid_mask;
+    group->scan_count++;
+    group->state = ADC_SCAN_STATE_IDLE;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Simulated conversion engine (mid-scale on every channel)
+ * @param channels Hardware channel list
+ * @param channel_count Number of channels
+ * @param rounds Number of sweeps
+ * @param buffer Sample buffer to fill
+ * @return ebs_result_t Always EBS_OK (synchronous)
+ */
+ebs_result_t EBS_AdcScan_SimulatedSource(const uint8_t* channels, uint32_t channel_count,
+                                         uint32_t rounds, uint16_t* buffer)
+{
+    if (channels == NULL || buffer == NULL) {
+        return EBS_INVALID_PARAM;
+    }
+
+    /* In real implementation, the ADC sequencer would be armed here and */
+    /* the DMA controller would raise EBS_AdcScan_OnComplete */
+    for (uint32_t i = 0; i < rounds * channel_count; i++) {
+        buffer[i] = (uint16_t)((ADC_SCAN_FULL_SCALE + 1U) / 2U);
+    }
+
+    return EBS_OK;
+}
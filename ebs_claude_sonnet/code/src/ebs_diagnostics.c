@@ -19,14 +19,16 @@
 /* Static Variables */
 static ebs_diagnostics_manager_t g_diagnostics_manager;
 static bool g_diagnostics_initialized = false;
+static ebs_memory_report_t g_memory_report;
 
 /* Static Function Prototypes */
 static ebs_result_t Diagnostics_InitializeDTCTable(void);
 static ebs_result_t Diagnostics_InitializeEventLog(void);
 static bool Diagnostics_ValidateDTC(ebs_dtc_code_t dtc_code);
 static ebs_result_t Diagnostics_StoreDTC(ebs_dtc_code_t dtc_code);
-static ebs_result_t Diagnostics_StoreEvent(ebs_diagnostic_event_t event_type, uint32_t data);
+static ebs_result_t Diagnostics_StoreEvent(ebs_diag_event_t event_type, uint32_t data);
 static void Diagnostics_UpdateStatistics(void);
+static void Diagnostics_UpdateMemoryReport(void);
 static ebs_result_t Diagnostics_ProcessPendingDTCs(void);
 
 /**
@@ -84,7 +86,7 @@ bool EBS_Diagnostics_SelfTest(void)
     }
     
     /* Test event logging */
-    if (Diagnostics_StoreEvent(DIAG_EVENT_SYSTEM_STARTUP, 0) != EBS_OK) {
+    if (Diagnostics_StoreEvent(DIAG_EVENT_SYSTEM_START, 0) != EBS_OK) {
         test_passed = false;
     }
     
@@ -95,10 +97,10 @@ bool EBS_Diagnostics_SelfTest(void)
 }
 
 /**
- * @brief Update diagnostics (called every cycle)
- * @return ebs_result_t Update result
+ * @brief Process diagnostics (called every EBS_CYCLE_TIME_DIAG_MS)
+ * @return ebs_result_t Process result
  */
-ebs_result_t EBS_Diagnostics_Update(void)
+ebs_result_t EBS_Diagnostics_Process(void)
 {
     if (!g_diagnostics_initialized || !g_diagnostics_manager.system_enabled) {
         return EBS_NOT_INITIALIZED;
@@ -215,7 +217,7 @@ uint32_t EBS_Diagnostics_GetActiveDTCCount(void)
  * @param data Event data
  * @return ebs_result_t Log result
  */
-ebs_result_t EBS_Diagnostics_LogEvent(ebs_diagnostic_event_t event_type, uint32_t data)
+ebs_result_t EBS_Diagnostics_LogEvent(ebs_diag_event_t event_type, uint32_t data)
 {
     if (!g_diagnostics_initialized) {
         return EBS_NOT_INITIALIZED;
@@ -237,6 +239,26 @@ const ebs_diagnostic_statistics_t* EBS_Diagnostics_GetStatistics(void)
     return &g_diagnostics_manager.statistics;
 }
 
+/**
+ * @brief Get the latest arena and stack high-water marks
+ * @param report Destination
+ * @return ebs_result_t Report result
+ */
+ebs_result_t EBS_Diagnostics_GetMemoryReport(ebs_memory_report_t* report)
+{
+    if (!g_diagnostics_initialized) {
+        return EBS_NOT_INITIALIZED;
+    }
+    
+    if (report == NULL) {
+        return EBS_INVALID_PARAM;
+    }
+    
+    *report = g_memory_report;
+    
+    return EBS_OK;
+}
+
 /**
  * @brief Get DTC table
  * @return ebs_dtc_entry_t* Pointer to DTC table
@@ -392,7 +414,7 @@ static ebs_result_t Diagnostics_StoreDTC(ebs_dtc_code_t dtc_code)
  * @param data Event data
  * @return ebs_result_t Store result
  */
-static ebs_result_t Diagnostics_StoreEvent(ebs_diagnostic_event_t event_type, uint32_t data)
+static ebs_result_t Diagnostics_StoreEvent(ebs_diag_event_t event_type, uint32_t data)
 {
     uint32_t current_time = EBS_GetSystemTick();
     uint32_t index = g_diagnostics_manager.event_log_index;
@@ -435,10 +457,27 @@ static void Diagnostics_UpdateStatistics(void)
         }
     }
     
+    /* Refresh memory high-water marks */
+    Diagnostics_UpdateMemoryReport();
+    
     /* Update last update time */
     stats->last_update_time = EBS_GetSystemTick();
 }
 
+/**
+ * @brief Refresh the memory report and flag stack overflow or late allocation
+ */
+static void Diagnostics_UpdateMemoryReport(void)
+{
+    if (EBS_Memory_GetReport(&g_memory_report) != EBS_OK) {
+        return;
+    }
+    
+    if (g_memory_report.stack_overflow_mask != 0U || g_memory_report.late_alloc_count != 0U) {
+        EBS_Diagnostics_SetDTC(DTC_MEMORY_CORRUPTION);
+    }
+}
+
 /**
  * @brief Process pending DTCs
  * @return ebs_result_t Process result
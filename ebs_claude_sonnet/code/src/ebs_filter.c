@@ -0,0 +1,372 @@
+/**
+ * @file ebs_filter.c
+ * @brief Electronic Braking System - Signal Filter Library Implementation
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Filter state lives in caller-owned objects, so every instance can be
+ * reset independently and the library holds no hidden statics. Bank
+ * updates are straight loops over channel arrays for vectorization.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#include "ebs_filter.h"
+#include <string.h>
+#include <math.h>
+
+/**
+ * @brief Initialize an EMA bank
+ * @param filter EMA bank
+ * @param alpha Weight of new sample (0..1]
+ * @param channels Number of channels
+ * @param initial Initial output of every channel
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Filter_EmaInit(ebs_filter_ema_t* filter, float alpha, uint32_t channels,
+                                float initial)
+{
+    if (filter == NULL || alpha <= 0.0f || alpha > 1.0f ||
+        channels == 0U || channels > FILTER_MAX_CHANNELS) {
+        return EBS_INVALID_PARAM;
+    }
+
+    memset(filter, 0, sizeof(*filter));
+    filter->alpha = alpha;
+    filter->channels = channels;
+    EBS_Filter_EmaReset(filter, initial);
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Update a single-channel EMA
+ * @param filter EMA bank (channel 0 is used)
+ * @param input New sample
+ * @return float Filtered value
+ */
+float EBS_Filter_EmaUpdate(ebs_filter_ema_t* filter, float input)
+{
+    if (filter == NULL) {
+        return input;
+    }
+
+    filter->y[0] = filter->alpha * input + (1.0f - filter->alpha) * filter->y[0];
+
+    return filter->y[0];
+}
+
+/**
+ * @brief Update all channels of an EMA bank
+ * @param filter EMA bank
+ * @param input One sample per channel
+ * @param output Filtered values per channel (may be NULL)
+ */
+void EBS_Filter_EmaUpdateBank(ebs_filter_ema_t* filter, const float* input, float* output)
+{
+    if (filter == NULL || input == NULL) {
+        return;
+    }
+
+    const float alpha = filter->alpha;
+
+    for (uint32_t ch = 0; ch < filter->channels; ch++) {
+        filter->y[ch] = alpha * input[ch] + (1.0f - alpha) * filter->y[ch];
+    }
+
+    if (output != NULL) {
+        memcpy(output, filter->y, filter->channels * sizeof(float));
+    }
+}
+
+/**
+ * @brief Reset every channel of an EMA bank to a value
+ * @param filter EMA bank
+ * @param value Reset value
+ */
+void EBS_Filter_EmaReset(ebs_filter_ema_t* filter, float value)
+{
+    if (filter == NULL) {
+        return;
+    }
+
+    for (uint32_t ch = 0; ch < FILTER_MAX_CHANNELS; ch++) {
+        filter->y[ch] = value;
+    }
+}
+
+/**
+ * @brief Design a second-order low-pass section (bilinear transform)
+ * @param coeff Output coefficients
+ * @param cutoff_hz Cutoff frequency
+ * @param sample_hz Sample rate
+ * @param q Quality factor (0.7071 for Butterworth)
+ * @return ebs_result_t Design result
+ */
+ebs_result_t EBS_Filter_BiquadDesignLowPass(ebs_filter_biquad_coeff_t* coeff, float cutoff_hz,
+                                            float sample_hz, float q)
+{
+    if (coeff == NULL || sample_hz <= 0.0f || q <= 0.0f ||
+        cutoff_hz <= 0.0f || cutoff_hz >= (sample_hz / 2.0f)) {
+        return EBS_INVALID_PARAM;
+    }
+
+    const float pi = 3.14159265358979f;
+    float w0 = 2.0f * pi * cutoff_hz / sample_hz;
+    float cos_w0 = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * q);
+    float a0 = 1.0f + alpha;
+
+    coeff->b0 = ((1.0f - cos_w0) / 2.0f) / a0;
+    coeff->b1 = (1.0f - cos_w0) / a0;
+    coeff->b2 = coeff->b0;
+    coeff->a1 = (-2.0f * cos_w0) / a0;
+    coeff->a2 = (1.0f - alpha) / a0;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Initialize a biquad cascade bank
+ * @param filter Biquad bank
+ * @param coeff Section coefficients
+ * @param sections Number of sections
+ * @param channels Number of channels
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Filter_BiquadInit(ebs_filter_biquad_t* filter,
+                                   const ebs_filter_biquad_coeff_t* coeff,
+                                   uint32_t sections, uint32_t channels)
+{
+    if (filter == NULL || coeff == NULL ||
+        sections == 0U || sections > FILTER_MAX_BIQUAD_SECTIONS ||
+        channels == 0U || channels > FILTER_MAX_CHANNELS) {
+        return EBS_INVALID_PARAM;
+    }
+
+    memset(filter, 0, sizeof(*filter));
+    memcpy(filter->coeff, coeff, sections * sizeof(ebs_filter_biquad_coeff_t));
+    filter->sections = sections;
+    filter->channels = channels;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Run all channels through the cascade
+ * @param filter Biquad bank
+ * @param input One sample per channel
+ * @param output Filtered values per channel
+ */
+void EBS_Filter_BiquadUpdateBank(ebs_filter_biquad_t* filter, const float* input, float* output)
+{
+    if (filter == NULL || input == NULL || output == NULL) {
+        return;
+    }
+
+    float x[FILTER_MAX_CHANNELS];
+    memcpy(x, input, filter->channels * sizeof(float));
+
+    /* Section-outer, channel-inner: one vector op per coefficient */
+    for (uint32_t s = 0; s < filter->sections; s++) {
+        const ebs_filter_biquad_coeff_t c = filter->coeff[s];
+        float* z1 = filter->z1[s];
+        float* z2 = filter->z2[s];
+
+        for (uint32_t ch = 0; ch < filter->channels; ch++) {
+            float y = c.b0 * x[ch] + z1[ch];
+            z1[ch] = c.b1 * x[ch] - c.a1 * y + z2[ch];
+            z2[ch] = c.b2 * x[ch] - c.a2 * y;
+            x[ch] = y;
+        }
+    }
+
+    memcpy(output, x, filter->channels * sizeof(float));
+}
+
+/**
+ * @brief Clear biquad state
+ * @param filter Biquad bank
+ */
+void EBS_Filter_BiquadReset(ebs_filter_biquad_t* filter)
+{
+    if (filter == NULL) {
+        return;
+    }
+
+    memset(filter->z1, 0, sizeof(filter->z1));
+    memset(filter->z2, 0, sizeof(filter->z2));
+}
+
+/**
+ * @brief Initialize a moving median
+ * @param filter Median filter
+ * @param length Window length (odd, <= FILTER_MAX_MEDIAN_WINDOW)
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Filter_MedianInit(ebs_filter_median_t* filter, uint32_t length)
+{
+    if (filter == NULL || length == 0U || length > FILTER_MAX_MEDIAN_WINDOW ||
+        (length % 2U) == 0U) {
+        return EBS_INVALID_PARAM;
+    }
+
+    memset(filter, 0, sizeof(*filter));
+    filter->length = length;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Push a sample and return the median of the window
+ * @param filter Median filter
+ * @param input New sample
+ * @return float Median value
+ */
+float EBS_Filter_MedianUpdate(ebs_filter_median_t* filter, float input)
+{
+    if (filter == NULL || filter->length == 0U) {
+        return input;
+    }
+
+    filter->window[filter->index] = input;
+    filter->index = (filter->index + 1U) % filter->length;
+    if (filter->fill < filter->length) {
+        filter->fill++;
+    }
+
+    /* Insertion sort of a small fixed window - bounded cost */
+    float sorted[FILTER_MAX_MEDIAN_WINDOW];
+    for (uint32_t i = 0; i < filter->fill; i++) {
+        float value = filter->window[i];
+        uint32_t j = i;
+        while (j > 0U && sorted[j - 1U] > value) {
+            sorted[j] = sorted[j - 1U];
+            j--;
+        }
+        sorted[j] = value;
+    }
+
+    return sorted[filter->fill / 2U];
+}
+
+/**
+ * @brief Compute differentiator coefficients
+ * @param coeff Coefficients
+ * @param dt_s Sample period in seconds
+ * @param alpha Smoothing weight (1 = raw derivative)
+ * @return ebs_result_t Design result
+ */
+ebs_result_t EBS_Filter_DerivativeDesign(ebs_filter_derivative_coeff_t* coeff, float dt_s,
+                                         float alpha)
+{
+    if (coeff == NULL || dt_s <= 0.0f || alpha <= 0.0f || alpha > 1.0f) {
+        return EBS_INVALID_PARAM;
+    }
+
+    coeff->inv_dt = 1.0f / dt_s;
+    coeff->alpha = alpha;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Update a caller-owned array of differentiator channels
+ * @param coeff Shared coefficients
+ * @param state State per channel (sized by the caller at compile time)
+ * @param input One sample per channel
+ * @param channels Number of channels
+ */
+void EBS_Filter_DerivativeStep(const ebs_filter_derivative_coeff_t* coeff,
+                               ebs_filter_derivative_state_t* state, const float* input,
+                               uint32_t channels)
+{
+    if (coeff == NULL || state == NULL || input == NULL) {
+        return;
+    }
+
+    const float alpha = coeff->alpha;
+    const float inv_dt = coeff->inv_dt;
+
+    for (uint32_t ch = 0; ch < channels; ch++) {
+        float derivative = (input[ch] - state[ch].previous) * inv_dt;
+        state[ch].previous = input[ch];
+        state[ch].y = alpha * derivative + (1.0f - alpha) * state[ch].y;
+    }
+}
+
+/**
+ * @brief Initialize a filtered differentiator bank
+ * @param filter Differentiator bank
+ * @param dt_s Sample period in seconds
+ * @param alpha Smoothing weight (1 = raw derivative)
+ * @param channels Number of channels
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Filter_DerivativeInit(ebs_filter_derivative_t* filter, float dt_s, float alpha,
+                                       uint32_t channels)
+{
+    if (filter == NULL || channels == 0U || channels > FILTER_MAX_CHANNELS) {
+        return EBS_INVALID_PARAM;
+    }
+
+    memset(filter, 0, sizeof(*filter));
+    filter->channels = channels;
+
+    return EBS_Filter_DerivativeDesign(&filter->coeff, dt_s, alpha);
+}
+
+/**
+ * @brief Update one channel of a differentiator bank
+ * @param filter Differentiator bank
+ * @param channel Channel index
+ * @param input New sample
+ * @return float Filtered derivative
+ */
+float EBS_Filter_DerivativeUpdate(ebs_filter_derivative_t* filter, uint32_t channel, float input)
+{
+    if (filter == NULL || channel >= filter->channels) {
+        return 0.0f;
+    }
+
+    EBS_Filter_DerivativeStep(&filter->coeff, &filter->state[channel], &input, 1U);
+
+    return filter->state[channel].y;
+}
+
+/**
+ * @brief Update all channels of a differentiator bank
+ * @param filter Differentiator bank
+ * @param input One sample per channel
+ * @param output Filtered derivative per channel (may be NULL)
+ */
+void EBS_Filter_DerivativeUpdateBank(ebs_filter_derivative_t* filter, const float* input,
+                                     float* output)
+{
+    if (filter == NULL || input == NULL) {
+        return;
+    }
+
+    EBS_Filter_DerivativeStep(&filter->coeff, filter->state, input, filter->channels);
+
+    if (output != NULL) {
+        for (uint32_t ch = 0; ch < filter->channels; ch++) {
+            output[ch] = filter->state[ch].y;
+        }
+    }
+}
+
+/**
+ * @brief Reset a differentiator bank (previous inputs and outputs to zero)
+ * @param filter Differentiator bank
+ */
+void EBS_Filter_DerivativeReset(ebs_filter_derivative_t* filter)
+{
+    if (filter == NULL) {
+        return;
+    }
+
+    memset(filter->state, 0, sizeof(filter->state));
+}
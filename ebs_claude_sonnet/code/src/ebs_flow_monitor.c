@@ -0,0 +1,273 @@
+/**
+ * @file ebs_flow_monitor.c
+ * @brief Electronic Braking System - Program Flow Signature Monitor Implementation
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * The checkpoint order of one control cycle is fixed by
+ * EBS_MainControlLoop: start, sensors, ABS, [ESC], [TCS], actuators,
+ * [communication], [diagnostics], end. Which bracketed tasks run follows
+ * from the cycle index and the EBS_CYCLE_TIME_*_MS rate groups, so the
+ * monitor predicts the schedule with its own phase counters and looks up
+ * the expected signature precomputed at initialization. Tasks of features
+ * compiled out of the variant are never predicted.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#include "ebs_flow_monitor.h"
+#include <string.h>
+
+/* Flow Monitor Macros */
+#define FLOW_PERIOD(ms)     ((ms) / EBS_CYCLE_TIME_MS)
+
+/* Monitor state (one struct so the self-test can save and restore it) */
+typedef struct {
+    uint32_t expected[FLOW_SCHEDULE_VARIANTS];
+    uint32_t closed_signature;              /* Signature latched by EndCycle */
+    uint32_t closed_pending;                /* Cycles closed since the last check */
+    uint32_t phase_esc;                     /* Cycles since the task last ran */
+    uint32_t phase_tcs;
+    uint32_t phase_comm;
+    uint32_t phase_diag;
+    ebs_flow_statistics_t statistics;
+} flow_monitor_t;
+
+/* Global Variables */
+uint32_t g_flow_signature = FLOW_SIGNATURE_SEED;
+
+/* Static Variables */
+static flow_monitor_t g_flow_monitor;
+static bool g_flow_initialized = false;
+
+/* Static Function Prototypes */
+static uint32_t Flow_ExpectedSignature(uint32_t tasks);
+static uint32_t Flow_NextSchedule(void);
+static ebs_result_t Flow_RunCycle(const uint32_t* checkpoints, uint32_t count);
+
+/**
+ * @brief Precompute the expected signature of every schedule variant
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Flow_Init(void)
+{
+    memset(&g_flow_monitor, 0, sizeof(g_flow_monitor));
+
+    for (uint32_t tasks = 0; tasks < FLOW_SCHEDULE_VARIANTS; tasks++) {
+        g_flow_monitor.expected[tasks] = Flow_ExpectedSignature(tasks);
+    }
+
+    g_flow_signature = FLOW_SIGNATURE_SEED;
+    g_flow_initialized = true;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Start a control cycle (resets the signature, folds FLOW_CP_CYCLE_START)
+ */
+void EBS_Flow_BeginCycle(void)
+{
+    g_flow_signature = EBS_Flow_Fold(FLOW_SIGNATURE_SEED, FLOW_CP_CYCLE_START);
+}
+
+/**
+ * @brief Close a control cycle (folds FLOW_CP_CYCLE_END, latches the signature)
+ */
+void EBS_Flow_EndCycle(void)
+{
+    g_flow_monitor.closed_signature = EBS_Flow_Fold(g_flow_signature, FLOW_CP_CYCLE_END);
+    g_flow_monitor.closed_pending++;
+}
+
+/**
+ * @brief Compare the last closed cycle with its schedule (once per tick)
+ * @return ebs_result_t EBS_OK (also if no cycle closed), EBS_FAULT on mismatch
+ */
+ebs_result_t EBS_Flow_Check(void)
+{
+    if (!g_flow_initialized) {
+        return EBS_NOT_INITIALIZED;
+    }
+
+    if (g_flow_monitor.closed_pending == 0U) {
+        /* No control cycle ran since the last check (not in NORMAL state) */
+        return EBS_OK;
+    }
+
+    /* Only the newest closed cycle is compared; keep the phases in step */
+    uint32_t tasks = 0U;
+    while (g_flow_monitor.closed_pending > 0U) {
+        tasks = Flow_NextSchedule();
+        g_flow_monitor.closed_pending--;
+    }
+
+    ebs_flow_statistics_t* stats = &g_flow_monitor.statistics;
+    stats->cycles_checked++;
+    stats->last_signature = g_flow_monitor.closed_signature;
+    stats->last_expected = g_flow_monitor.expected[tasks];
+
+    if (stats->last_signature != stats->last_expected) {
+        stats->signature_errors++;
+        return EBS_FAULT;
+    }
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Verify that skipped and reordered checkpoints are detected
+ *
+ * Runs injected cycles through the real BeginCycle/Checkpoint/EndCycle/
+ * Check path on a saved copy of the monitor, which is restored afterwards.
+ *
+ * @return bool True if self-test passed
+ */
+bool EBS_Flow_SelfTest(void)
+{
+    static const uint32_t nominal[] = {
+        FLOW_CP_SENSORS, FLOW_CP_ABS, FLOW_CP_ACTUATORS
+    };
+    static const uint32_t skipped_abs[] = {
+        FLOW_CP_SENSORS, FLOW_CP_ACTUATORS
+    };
+    static const uint32_t reordered[] = {
+        FLOW_CP_ABS, FLOW_CP_SENSORS, FLOW_CP_ACTUATORS
+    };
+    static const uint32_t repeated_abs[] = {
+        FLOW_CP_SENSORS, FLOW_CP_ABS, FLOW_CP_ABS, FLOW_CP_ACTUATORS
+    };
+
+    if (!g_flow_initialized) {
+        return false;
+    }
+
+    flow_monitor_t saved = g_flow_monitor;
+    uint32_t saved_signature = g_flow_signature;
+    bool test_passed = true;
+
+    /* Test 1: every schedule variant has a distinct signature */
+    for (uint32_t a = 0; a < FLOW_SCHEDULE_VARIANTS; a++) {
+        for (uint32_t b = a + 1U; b < FLOW_SCHEDULE_VARIANTS; b++) {
+            if (g_flow_monitor.expected[a] == g_flow_monitor.expected[b]) {
+                test_passed = false;
+            }
+        }
+    }
+
+    /* Test 2: a nominal base-rate cycle passes */
+    g_flow_monitor.closed_pending = 0U;
+    if (Flow_RunCycle(nominal, sizeof(nominal) / sizeof(nominal[0])) != EBS_OK) {
+        test_passed = false;
+    }
+
+    /* Test 3: skipped, reordered and repeated checkpoints are detected */
+    if (Flow_RunCycle(skipped_abs, sizeof(skipped_abs) / sizeof(skipped_abs[0])) != EBS_FAULT ||
+        Flow_RunCycle(reordered, sizeof(reordered) / sizeof(reordered[0])) != EBS_FAULT ||
+        Flow_RunCycle(repeated_abs, sizeof(repeated_abs) / sizeof(repeated_abs[0])) != EBS_FAULT) {
+        test_passed = false;
+    }
+
+    g_flow_monitor = saved;
+    g_flow_signature = saved_signature;
+
+    return test_passed;
+}
+
+/**
+ * @brief Get flow monitor statistics
+ * @return const ebs_flow_statistics_t* Statistics
+ */
+const ebs_flow_statistics_t* EBS_Flow_GetStatistics(void)
+{
+    return &g_flow_monitor.statistics;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief Signature of a correct control cycle running the given rate tasks
+ * @param tasks FLOW_TASK_* mask
+ * @return uint32_t Expected closed signature
+ */
+static uint32_t Flow_ExpectedSignature(uint32_t tasks)
+{
+    uint32_t signature = EBS_Flow_Fold(FLOW_SIGNATURE_SEED, FLOW_CP_CYCLE_START);
+
+    signature = EBS_Flow_Fold(signature, FLOW_CP_SENSORS);
+    signature = EBS_Flow_Fold(signature, FLOW_CP_ABS);
+    if ((tasks & FLOW_TASK_ESC) != 0U) {
+        signature = EBS_Flow_Fold(signature, FLOW_CP_ESC);
+    }
+    if ((tasks & FLOW_TASK_TCS) != 0U) {
+        signature = EBS_Flow_Fold(signature, FLOW_CP_TCS);
+    }
+    signature = EBS_Flow_Fold(signature, FLOW_CP_ACTUATORS);
+    if ((tasks & FLOW_TASK_COMMUNICATION) != 0U) {
+        signature = EBS_Flow_Fold(signature, FLOW_CP_COMMUNICATION);
+    }
+    if ((tasks & FLOW_TASK_DIAGNOSTICS) != 0U) {
+        signature = EBS_Flow_Fold(signature, FLOW_CP_DIAGNOSTICS);
+    }
+
+    return EBS_Flow_Fold(signature, FLOW_CP_CYCLE_END);
+}
+
+/**
+ * @brief Advance the rate-group phases by one control cycle
+ * @return uint32_t FLOW_TASK_* mask of the tasks due in that cycle
+ */
+static uint32_t Flow_NextSchedule(void)
+{
+    uint32_t tasks = 0U;
+
+#if (EBS_ENABLE_ESC == 1U)
+    if (++g_flow_monitor.phase_esc >= FLOW_PERIOD(EBS_CYCLE_TIME_ESC_MS)) {
+        g_flow_monitor.phase_esc = 0U;
+        tasks |= FLOW_TASK_ESC;
+    }
+#endif
+#if (EBS_ENABLE_TCS == 1U)
+    if (++g_flow_monitor.phase_tcs >= FLOW_PERIOD(EBS_CYCLE_TIME_TCS_MS)) {
+        g_flow_monitor.phase_tcs = 0U;
+        tasks |= FLOW_TASK_TCS;
+    }
+#endif
+    if (++g_flow_monitor.phase_comm >= FLOW_PERIOD(EBS_CYCLE_TIME_COMM_MS)) {
+        g_flow_monitor.phase_comm = 0U;
+        tasks |= FLOW_TASK_COMMUNICATION;
+    }
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+    if (++g_flow_monitor.phase_diag >= FLOW_PERIOD(EBS_CYCLE_TIME_DIAG_MS)) {
+        g_flow_monitor.phase_diag = 0U;
+        tasks |= FLOW_TASK_DIAGNOSTICS;
+    }
+#endif
+
+    return tasks;
+}
+
+/**
+ * @brief Run one injected base-rate cycle through the monitor (self-test)
+ * @param checkpoints Checkpoints between start and end
+ * @param count Number of checkpoints
+ * @return ebs_result_t Result of EBS_Flow_Check for the cycle
+ */
+static ebs_result_t Flow_RunCycle(const uint32_t* checkpoints, uint32_t count)
+{
+    /* Keep every rate task idle for this cycle */
+    g_flow_monitor.phase_esc = 0U;
+    g_flow_monitor.phase_tcs = 0U;
+    g_flow_monitor.phase_comm = 0U;
+    g_flow_monitor.phase_diag = 0U;
+
+    EBS_Flow_BeginCycle();
+    for (uint32_t i = 0; i < count; i++) {
+        EBS_Flow_Checkpoint(checkpoints[i]);
+    }
+    EBS_Flow_EndCycle();
+
+    return EBS_Flow_Check();
+}
@@ -0,0 +1,226 @@
+/**
+ * @file ebs_imu_fifo.c
+ * @brief Electronic Braking System - IMU FIFO Ingestion and Decimation
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * The IMU runs at IMU_FIFO_ODR_HZ and is drained once per control tick.
+ * A windowed-sinc FIR is evaluated only at the decimation instants
+ * (polyphase form), and every MAC operates on all axis lanes at once.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#include "ebs_imu_fifo.h"
+#include <string.h>
+#include <math.h>
+
+/* Static Function Prototypes */
+static void ImuFifo_DesignFilter(float* coeff, uint32_t taps, float cutoff_norm);
+
+/**
+ * @brief Initialize decimator, design the anti-alias filter
+ * @param dec Decimator state
+ * @param accel_scale Accelerometer LSB weight (m/s² per count)
+ * @param gyro_scale Gyroscope LSB weight (deg/s per count)
+ * @param source FIFO reader
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_ImuFifo_Init(ebs_imu_decimator_t* dec, float accel_scale, float gyro_scale,
+                              ebs_imu_fifo_source_t source)
+{
+    if (dec == NULL || source == NULL) {
+        return EBS_INVALID_PARAM;
+    }
+
+    if (IMU_FIFO_DECIMATION == 0U || accel_scale <= 0.0f || gyro_scale <= 0.0f) {
+        return EBS_INVALID_PARAM;
+    }
+
+    memset(dec, 0, sizeof(*dec));
+
+    ImuFifo_DesignFilter(dec->coeff, IMU_FIR_TAPS, IMU_FIR_CUTOFF_HZ / (float)IMU_FIFO_ODR_HZ);
+
+    /* Padding lanes keep scale 0 so they stay at zero */
+    for (uint32_t lane = IMU_AXIS_ACCEL_X; lane <= IMU_AXIS_ACCEL_Z; lane++) {
+        dec->scale[lane] = accel_scale;
+    }
+    for (uint32_t lane = IMU_AXIS_GYRO_X; lane <= IMU_AXIS_GYRO_Z; lane++) {
+        dec->scale[lane] = gyro_scale;
+    }
+
+    dec->source = source;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Filter and decimate a block of frames
+ * @param dec Decimator state
+ * @param frames Frames in arrival order
+ * @param count Number of frames (<= IMU_FIFO_MAX_BURST)
+ * @return uint32_t Number of decimated outputs produced
+ */
+uint32_t EBS_ImuFifo_ProcessBlock(ebs_imu_decimator_t* dec, const ebs_imu_fifo_frame_t* frames,
+                                  uint32_t count)
+{
+    if (dec == NULL || frames == NULL) {
+        return 0U;
+    }
+
+    if (count > IMU_FIFO_MAX_BURST) {
+        count = IMU_FIFO_MAX_BURST;
+    }
+
+    const uint32_t history = IMU_FIR_TAPS - 1U;
+    uint32_t outputs = 0U;
+
+    /* Convert and calibrate the burst into the delay line, all lanes at once */
+    for (uint32_t i = 0; i < count; i++) {
+        float* row = dec->line[history + i];
+        float raw[IMU_AXIS_LANES] = {0.0f};
+
+        for (uint32_t axis = 0; axis < IMU_AXIS_COUNT; axis++) {
+            raw[axis] = (float)frames[i].axis[axis];
+        }
+        for (uint32_t lane = 0; lane < IMU_AXIS_LANES; lane++) {
+            row[lane] = (raw[lane] + dec->offset[lane]) * dec->scale[lane];
+        }
+    }
+
+    /* Evaluate the FIR only at decimation instants */
+    for (uint32_t i = 0; i < count; i++) {
+        if (++dec->phase < IMU_FIFO_DECIMATION) {
+            continue;
+        }
+        dec->phase = 0U;
+
+        float acc[IMU_AXIS_LANES] = {0.0f};
+        const uint32_t newest = history + i;
+
+        for (uint32_t tap = 0; tap < IMU_FIR_TAPS; tap++) {
+            const float h = dec->coeff[tap];
+            const float* row = dec->line[newest - tap];
+            for (uint32_t lane = 0; lane < IMU_AXIS_LANES; lane++) {
+                acc[lane] += h * row[lane];
+            }
+        }
+
+        memcpy(dec->output, acc, sizeof(acc));
+        outputs++;
+    }
+
+    /* Keep the last TAPS-1 samples as history for the next block */
+    memmove(dec->line[0], dec->line[count], history * sizeof(dec->line[0]));
+
+    dec->samples_in += count;
+    dec->samples_out += outputs;
+
+    return outputs;
+}
+
+/**
+ * @brief Drain the device FIFO and decimate (called every 1ms)
+ * @param dec Decimator state
+ * @return ebs_result_t EBS_TIMEOUT if no output sample was produced
+ */
+ebs_result_t EBS_ImuFifo_Service(ebs_imu_decimator_t* dec)
+{
+    if (dec == NULL || dec->source == NULL) {
+        return EBS_INVALID_PARAM;
+    }
+
+    ebs_imu_fifo_frame_t frames[IMU_FIFO_MAX_BURST];
+    uint32_t count = dec->source(frames, IMU_FIFO_MAX_BURST);
+
+    if (EBS_ImuFifo_ProcessBlock(dec, frames, count) == 0U) {
+        /* FIFO delivered less than one decimation block this tick */
+        dec->underrun_count++;
+        return EBS_TIMEOUT;
+    }
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Publish the latest decimated sample
+ * @param dec Decimator state
+ * @param imu_data Destination
+ * @param timestamp Sample timestamp
+ */
+void EBS_ImuFifo_GetImuData(const ebs_imu_decimator_t* dec, ebs_imu_data_t* imu_data,
+                            uint32_t timestamp)
+{
+    if (dec == NULL || imu_data == NULL) {
+        return;
+    }
+
+    bool valid = (dec->samples_out > 0U);
+
+    imu_data->longitudinal_accel.value = dec->output[IMU_AXIS_ACCEL_X];
+    imu_data->longitudinal_accel.timestamp = timestamp;
+    imu_data->longitudinal_accel.valid = valid;
+
+    imu_data->lateral_accel.value = dec->output[IMU_AXIS_ACCEL_Y];
+    imu_data->lateral_accel.timestamp = timestamp;
+    imu_data->lateral_accel.valid = valid;
+
+    imu_data->yaw_rate.value = dec->output[IMU_AXIS_GYRO_Z];
+    imu_data->yaw_rate.timestamp = timestamp;
+    imu_data->yaw_rate.valid = valid;
+}
+
+/**
+ * @brief Simulated FIFO (1 g vertical, one decimation block per call)
+ * @param frames Destination buffer
+ * @param max_frames Capacity of @p frames
+ * @return uint32_t Number of frames produced
+ */
+uint32_t EBS_ImuFifo_SimulatedSource(ebs_imu_fifo_frame_t* frames, uint32_t max_frames)
+{
+    if (frames == NULL) {
+        return 0U;
+    }
+
+    /* In real implementation, this would be an SPI burst read of the */
+    /* device FIFO level followed by the frame data                   */
+    uint32_t count = EBS_MIN(max_frames, IMU_FIFO_DECIMATION);
+
+    for (uint32_t i = 0; i < count; i++) {
+        memset(&frames[i], 0, sizeof(frames[i]));
+        frames[i].axis[IMU_AXIS_ACCEL_Z] = (int16_t)IMU_FIFO_ACCEL_LSB_PER_G;  /* 1 g */
+    }
+
+    return count;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief Design a Hamming-windowed sinc low-pass with unity DC gain
+ * @param coeff Output coefficients
+ * @param taps Number of taps
+ * @param cutoff_norm Cutoff frequency normalized to the sample rate
+ */
+static void ImuFifo_DesignFilter(float* coeff, uint32_t taps, float cutoff_norm)
+{
+    const float pi = 3.14159265358979f;
+    const float centre = (float)(taps - 1U) / 2.0f;
+    float sum = 0.0f;
+
+    for (uint32_t n = 0; n < taps; n++) {
+        float x = (float)n - centre;
+        float sinc = (fabsf(x) < 1.0e-6f) ? (2.0f * cutoff_norm) :
+                     (sinf(2.0f * pi * cutoff_norm * x) / (pi * x));
+        float window = 0.54f - 0.46f * cosf(2.0f * pi * (float)n / (float)(taps - 1U));
+
+        coeff[n] = sinc * window;
+        sum += coeff[n];
+    }
+
+    for (uint32_t n = 0; n < taps; n++) {
+        coeff[n] /= sum;
+    }
+}
@@ -0,0 +1,338 @@
+/**
+ * @file ebs_lockstep.c
+ * @brief Electronic Braking System - Software Lockstep Implementation
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Each direction is a single-producer/single-consumer triple buffer: the
+ * producer owns one slot, the consumer owns one slot and the third is
+ * handed over by one atomic exchange of the shared index word. Neither
+ * side ever waits; a producer that laps the consumer simply replaces the
+ * unread slot. Primary-owned and secondary-owned data live in separate
+ * cache lines so the two cores only share the two index words.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#include "ebs_lockstep.h"
+#include "ebs_safety.h"
+#include <string.h>
+
+/* Lockstep Macros */
+#define LOCKSTEP_INDEX_MASK     0x3U            /* Slot index bits of a shared word */
+#define LOCKSTEP_FRESH          0x4U            /* Shared slot holds an unread frame */
+#define LOCKSTEP_HISTORY_MASK   (LOCKSTEP_HISTORY_DEPTH - 1U)
+
+#if (LOCKSTEP_HISTORY_DEPTH & LOCKSTEP_HISTORY_MASK) != 0U
+#error "LOCKSTEP_HISTORY_DEPTH must be a power of 2"
+#endif
+
+/* Primary output awaiting comparison */
+typedef struct {
+    uint32_t sequence;
+    bool valid;
+    ebs_control_commands_t commands;
+} lockstep_history_entry_t;
+
+/* Shared mailbox slots and handover words */
+typedef struct {
+    ebs_lockstep_request_t request[LOCKSTEP_SLOT_COUNT];
+    ebs_lockstep_response_t response[LOCKSTEP_SLOT_COUNT];
+    EBS_ALIGNED(EBS_CACHE_LINE_SIZE) uint32_t request_shared;
+    EBS_ALIGNED(EBS_CACHE_LINE_SIZE) uint32_t response_shared;
+} lockstep_mailbox_t;
+
+/* Written by the primary core only */
+typedef struct {
+    uint32_t request_write;                 /* Slot being filled */
+    uint32_t response_read;                 /* Slot last consumed */
+    uint32_t sequence;                      /* Next step number */
+    uint32_t last_compared;                 /* Newest step compared */
+    uint32_t consecutive_late;
+    bool frame_open;                        /* BeginFrame without SubmitFrame */
+    ebs_lockstep_compare_t mode;
+    ebs_lockstep_clock_t clock;
+    lockstep_history_entry_t history[LOCKSTEP_HISTORY_DEPTH];
+    ebs_lockstep_statistics_t statistics;
+} lockstep_primary_t;
+
+/* Written by the secondary core only */
+typedef struct {
+    uint32_t request_read;                  /* Slot being replayed */
+    uint32_t response_write;                /* Slot being filled */
+    uint32_t frames_replayed;
+    ebs_lockstep_clock_t clock;
+} lockstep_secondary_t;
+
+/* Static Variables */
+static EBS_ALIGNED(EBS_CACHE_LINE_SIZE) lockstep_mailbox_t g_lockstep_mailbox;
+static EBS_ALIGNED(EBS_CACHE_LINE_SIZE) lockstep_primary_t g_lockstep_primary;
+static EBS_ALIGNED(EBS_CACHE_LINE_SIZE) lockstep_secondary_t g_lockstep_secondary;
+static bool g_lockstep_initialized = false;
+
+/* Static Function Prototypes */
+static bool Lockstep_CommandsEqual(const ebs_control_commands_t* a,
+                                   const ebs_control_commands_t* b,
+                                   ebs_lockstep_compare_t mode);
+static bool Lockstep_FloatEqual(float a, float b, ebs_lockstep_compare_t mode);
+static uint32_t Lockstep_Now(ebs_lockstep_clock_t clock);
+
+/**
+ * @brief Initialize both mailboxes and the statistics
+ * @param mode Output comparison mode
+ * @param clock Time base for latency measurement (NULL disables it)
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Lockstep_Init(ebs_lockstep_compare_t mode, ebs_lockstep_clock_t clock)
+{
+    if (mode != LOCKSTEP_COMPARE_EXACT && mode != LOCKSTEP_COMPARE_TOLERANCE) {
+        return EBS_INVALID_PARAM;
+    }
+
+    memset(&g_lockstep_mailbox, 0, sizeof(g_lockstep_mailbox));
+    memset(&g_lockstep_primary, 0, sizeof(g_lockstep_primary));
+    memset(&g_lockstep_secondary, 0, sizeof(g_lockstep_secondary));
+
+    /* Slot 0: primary, slot 1: shared, slot 2: secondary (both directions) */
+    g_lockstep_primary.request_write = 0U;
+    g_lockstep_primary.response_read = 2U;
+    g_lockstep_secondary.request_read = 2U;
+    g_lockstep_secondary.response_write = 0U;
+    EBS_ATOMIC_STORE(&g_lockstep_mailbox.request_shared, 1U);
+    EBS_ATOMIC_STORE(&g_lockstep_mailbox.response_shared, 1U);
+
+    g_lockstep_primary.sequence = 1U;
+    g_lockstep_primary.mode = mode;
+    g_lockstep_primary.clock = clock;
+    g_lockstep_secondary.clock = clock;
+    g_lockstep_primary.statistics.latency_min_ns = UINT32_MAX;
+
+    g_lockstep_initialized = true;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Get the request slot for this step (primary core)
+ * @return ebs_lockstep_request_t* Slot to fill with state and inputs, NULL if disabled
+ */
+ebs_lockstep_request_t* EBS_Lockstep_BeginFrame(void)
+{
+    if (!g_lockstep_initialized) {
+        return NULL;
+    }
+
+    g_lockstep_primary.frame_open = true;
+
+    return &g_lockstep_mailbox.request[g_lockstep_primary.request_write];
+}
+
+/**
+ * @brief Publish the step begun with EBS_Lockstep_BeginFrame (primary core)
+ * @param primary Output of the primary channel for this step
+ */
+void EBS_Lockstep_SubmitFrame(const ebs_control_commands_t* primary)
+{
+    if (!g_lockstep_initialized || !g_lockstep_primary.frame_open || primary == NULL) {
+        return;
+    }
+
+    lockstep_primary_t* p = &g_lockstep_primary;
+    ebs_lockstep_request_t* request = &g_lockstep_mailbox.request[p->request_write];
+    lockstep_history_entry_t* entry = &p->history[p->sequence & LOCKSTEP_HISTORY_MASK];
+
+    entry->sequence = p->sequence;
+    entry->commands = *primary;
+    entry->valid = true;
+
+    request->sequence = p->sequence;
+    request->submit_time = Lockstep_Now(p->clock);
+
+    /* Release the slot; whatever was shared and unread becomes ours again */
+    uint32_t previous = EBS_ATOMIC_EXCHANGE(&g_lockstep_mailbox.request_shared,
+                                            p->request_write | LOCKSTEP_FRESH);
+    p->request_write = previous & LOCKSTEP_INDEX_MASK;
+    if ((previous & LOCKSTEP_FRESH) != 0U) {
+        p->statistics.frames_overwritten++;
+    }
+
+    p->sequence++;
+    p->statistics.frames_submitted++;
+    p->frame_open = false;
+}
+
+/**
+ * @brief Compare the newest secondary result (primary core, once per cycle)
+ * @return ebs_result_t EBS_OK match, EBS_BUSY no new result yet,
+ *         EBS_TIMEOUT secondary silent too long, EBS_FAULT mismatch
+ */
+ebs_result_t EBS_Lockstep_Check(void)
+{
+    if (!g_lockstep_initialized) {
+        return EBS_NOT_INITIALIZED;
+    }
+
+    lockstep_primary_t* p = &g_lockstep_primary;
+
+    /* Nothing outstanding: the secondary cannot be late */
+    if ((p->sequence - 1U) == p->last_compared) {
+        p->consecutive_late = 0U;
+        return EBS_OK;
+    }
+
+    bool fresh = (EBS_ATOMIC_LOAD(&g_lockstep_mailbox.response_shared) & LOCKSTEP_FRESH) != 0U;
+    const ebs_lockstep_response_t* response = NULL;
+    const lockstep_history_entry_t* entry = NULL;
+
+    if (fresh) {
+        uint32_t previous = EBS_ATOMIC_EXCHANGE(&g_lockstep_mailbox.response_shared,
+                                                p->response_read);
+        p->response_read = previous & LOCKSTEP_INDEX_MASK;
+        response = &g_lockstep_mailbox.response[p->response_read];
+        entry = &p->history[response->sequence & LOCKSTEP_HISTORY_MASK];
+
+        if (!entry->valid || entry->sequence != response->sequence) {
+            /* Secondary is more than LOCKSTEP_HISTORY_DEPTH steps behind */
+            p->statistics.stale_results++;
+            response = NULL;
+        }
+    }
+
+    if (response == NULL) {
+        p->statistics.late_checks++;
+        p->consecutive_late++;
+        if (p->consecutive_late > p->statistics.max_consecutive_late) {
+            p->statistics.max_consecutive_late = p->consecutive_late;
+        }
+        return (p->consecutive_late > LOCKSTEP_MAX_LATE_CYCLES) ? EBS_TIMEOUT : EBS_BUSY;
+    }
+
+    p->consecutive_late = 0U;
+    p->last_compared = response->sequence;
+    p->statistics.comparisons++;
+
+    if (p->clock != NULL) {
+        uint32_t latency = response->complete_time - response->submit_time;
+        uint32_t round_trip = Lockstep_Now(p->clock) - response->submit_time;
+
+        p->statistics.latency_min_ns = EBS_MIN(p->statistics.latency_min_ns, latency);
+        p->statistics.latency_max_ns = EBS_MAX(p->statistics.latency_max_ns, latency);
+        p->statistics.latency_sum_ns += latency;
+        p->statistics.round_trip_max_ns = EBS_MAX(p->statistics.round_trip_max_ns, round_trip);
+    }
+
+    if (!Lockstep_CommandsEqual(&entry->commands, &response->commands, p->mode)) {
+        p->statistics.mismatches++;
+        return EBS_FAULT;
+    }
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Replay the newest pending step, if any (secondary core loop)
+ * @return bool True if a step was replayed
+ */
+bool EBS_Lockstep_SecondaryService(void)
+{
+    if (!g_lockstep_initialized) {
+        return false;
+    }
+
+    lockstep_secondary_t* s = &g_lockstep_secondary;
+
+    if ((EBS_ATOMIC_LOAD(&g_lockstep_mailbox.request_shared) & LOCKSTEP_FRESH) == 0U) {
+        return false;
+    }
+
+    uint32_t previous = EBS_ATOMIC_EXCHANGE(&g_lockstep_mailbox.request_shared,
+                                            s->request_read);
+    s->request_read = previous & LOCKSTEP_INDEX_MASK;
+
+    /* The acquired slot is ours until the next exchange: step it in place */
+    ebs_lockstep_request_t* request = &g_lockstep_mailbox.request[s->request_read];
+    ebs_lockstep_response_t* response = &g_lockstep_mailbox.response[s->response_write];
+
+    EBS_ABS_Step(&request->state, &request->inputs, &response->commands);
+
+    response->sequence = request->sequence;
+    response->submit_time = request->submit_time;
+    response->complete_time = Lockstep_Now(s->clock);
+
+    previous = EBS_ATOMIC_EXCHANGE(&g_lockstep_mailbox.response_shared,
+                                   s->response_write | LOCKSTEP_FRESH);
+    s->response_write = previous & LOCKSTEP_INDEX_MASK;
+    EBS_ATOMIC_STORE(&s->frames_replayed, s->frames_replayed + 1U);
+
+    return true;
+}
+
+/**
+ * @brief Get lockstep statistics
+ * @return const ebs_lockstep_statistics_t* Statistics
+ */
+const ebs_lockstep_statistics_t* EBS_Lockstep_GetStatistics(void)
+{
+    g_lockstep_primary.statistics.frames_replayed =
+        EBS_ATOMIC_LOAD(&g_lockstep_secondary.frames_replayed);
+
+    return &g_lockstep_primary.statistics;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief Compare two command sets field by field (padding is never compared)
+ * @param a Primary commands
+ * @param b Secondary commands
+ * @param mode Comparison mode
+ * @return bool True if equal
+ */
+static bool Lockstep_CommandsEqual(const ebs_control_commands_t* a,
+                                   const ebs_control_commands_t* b,
+                                   ebs_lockstep_compare_t mode)
+{
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        if (a->abs_active[wheel] != b->abs_active[wheel] ||
+            !Lockstep_FloatEqual(a->brake_pressure_cmd[wheel], b->brake_pressure_cmd[wheel], mode)) {
+            return false;
+        }
+    }
+
+    return (a->esc_active == b->esc_active) &&
+           (a->tcs_active == b->tcs_active) &&
+           Lockstep_FloatEqual(a->engine_torque_reduction, b->engine_torque_reduction, mode);
+}
+
+/**
+ * @brief Compare two floats bit-exactly or within SAFETY_DUAL_CHANNEL_TOL
+ * @param a Primary value
+ * @param b Secondary value
+ * @param mode Comparison mode
+ * @return bool True if equal
+ */
+static bool Lockstep_FloatEqual(float a, float b, ebs_lockstep_compare_t mode)
+{
+    if (mode == LOCKSTEP_COMPARE_TOLERANCE) {
+        return EBS_Safety_DualChannelCompare(a, b, SAFETY_DUAL_CHANNEL_TOL);
+    }
+
+    uint32_t bits_a;
+    uint32_t bits_b;
+    memcpy(&bits_a, &a, sizeof(bits_a));
+    memcpy(&bits_b, &b, sizeof(bits_b));
+
+    return bits_a == bits_b;
+}
+
+/**
+ * @brief Read a core's copy of the time base
+ * @param clock Time base (may be NULL)
+ * @return uint32_t Time in nanoseconds, 0 without a clock
+ */
+static uint32_t Lockstep_Now(ebs_lockstep_clock_t clock)
+{
+    return (clock != NULL) ? clock() : 0U;
+}
@@ -20,23 +20,38 @@
 #include "ebs_types.h"
 #include "ebs_safety.h"
 #include "ebs_abs.h"
+#if (EBS_ENABLE_ESC == 1U)
 #include "ebs_esc.h"
+#endif
+#if (EBS_ENABLE_TCS == 1U)
 #include "ebs_tcs.h"
+#endif
 #include "ebs_sensors.h"
 #include "ebs_actuators.h"
 #include "ebs_communication.h"
 #include "ebs_diagnostics.h"
 #include "ebs_watchdog.h"
+#include "ebs_memory.h"
+#include "ebs_lockstep.h"
+#include "ebs_flow_monitor.h"
+#include "ebs_scheduler.h"
 
-/* Global system state */
-static ebs_system_state_t g_system_state = EBS_STATE_INIT;
-static ebs_safety_state_t g_safety_state = SAFETY_STATE_UNKNOWN;
-static uint32_t g_system_tick_counter = 0;
+/* Cortex-M DWT cycle counter (time base of EBS_GetTimeNs) */
+#define EBS_DEMCR                   (*(volatile uint32_t*)0xE000EDFCUL)
+#define EBS_DEMCR_TRCENA            (1UL << 24)
+#define EBS_DWT_CTRL                (*(volatile uint32_t*)0xE0001000UL)
+#define EBS_DWT_CTRL_CYCCNTENA      (1UL << 0)
+#define EBS_DWT_CYCCNT              (*(volatile uint32_t*)0xE0001004UL)
 
 /* Function prototypes */
 static void EBS_SystemInit(void);
-static void EBS_MainControlLoop(void);
-static void EBS_SafetyMonitoring(void);
+static void EBS_MainTask(void);
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U) && (EBS_SAFETY_SECONDARY_CORE == 0U)
+static void EBS_SafetyChannelTask(void);
+#endif
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U) && (EBS_SAFETY_SECONDARY_CORE == 1U)
+static void EBS_SecondaryCoreMain(void);
+#endif
 static void EBS_SystemShutdown(void);
 static bool EBS_SelfTest(void);
 
@@ -50,53 +65,85 @@ int main(void)
     EBS_SystemInit();
     
     /* Perform self-test */
-    if (!EBS_SelfTest()) {
-        /* Self-test failed - enter safe state */
-        EBS_Safety_EnterSafeState(SAFETY_FAULT_SELF_TEST_FAILED);
-        g_system_state = EBS_STATE_SAFE_MODE;
-    } else {
-        /* Self-test passed - enter normal operation */
-        g_system_state = EBS_STATE_NORMAL;
-    }
+    bool self_test_passed = EBS_SelfTest();
+    
+    /* No arena allocation past initialization */
+    EBS_Memory_Seal();
+    
+    /* NORMAL, or the safe state after a failed self-test */
+    EBS_Scheduler_Start(self_test_passed);
     
-    /* Main control loop */
+    /* Main loop on the painted main stack, interrupts on the ISR stack */
+    EBS_Memory_StartMainTask(EBS_MainTask);
+    
+    /* Should never reach here */
+    EBS_SystemShutdown();
+    return 0;
+}
+
+/**
+ * @brief Main task - cyclic executive, never returns
+ */
+static void EBS_MainTask(void)
+{
     while (1) {
-        /* Refresh watchdog */
-        EBS_Watchdog_Refresh(WATCHDOG_MAIN_TASK);
-        
-        /* Safety monitoring (highest priority) */
-        EBS_SafetyMonitoring();
+        /* Safety monitoring, control loop and watchdog checkpoints */
+        EBS_Scheduler_RunCycle();
         
-        /* Main control loop */
-        if (g_system_state == EBS_STATE_NORMAL) {
-            EBS_MainControlLoop();
-        }
-        
-        /* Increment system tick counter */
-        g_system_tick_counter++;
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U) && (EBS_SAFETY_SECONDARY_CORE == 0U)
+        /* Single core: time-redundant replay in the remaining cycle budget */
+        EBS_Memory_CallOnStack(MEMORY_STACK_SAFETY, EBS_SafetyChannelTask);
+#endif
         
         /* Wait for next cycle (1ms) */
         EBS_Delay_Ms(1);
     }
-    
-    /* Should never reach here */
-    EBS_SystemShutdown();
-    return 0;
 }
 
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U) && (EBS_SAFETY_SECONDARY_CORE == 0U)
+/**
+ * @brief Safety channel replay (runs on the safety stack)
+ */
+static void EBS_SafetyChannelTask(void)
+{
+    (void)EBS_Lockstep_SecondaryService();
+}
+#endif
+
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U) && (EBS_SAFETY_SECONDARY_CORE == 1U)
+/**
+ * @brief Secondary core entry - replays every submitted ABS step, never returns
+ */
+static void EBS_SecondaryCoreMain(void)
+{
+    while (1) {
+        (void)EBS_Lockstep_SecondaryService();
+    }
+}
+#endif
+
 /**
  * @brief Initialize EBS system components
  */
 static void EBS_SystemInit(void)
 {
+    /* Carve module arenas and paint task stacks before anything runs on them */
+    EBS_Memory_Init();
+    
     /* Initialize hardware abstraction layer */
     EBS_HAL_Init();
     
+    /* Free-running cycle counter for EBS_GetTimeNs */
+    EBS_DEMCR |= EBS_DEMCR_TRCENA;
+    EBS_DWT_CYCCNT = 0U;
+    EBS_DWT_CTRL |= EBS_DWT_CTRL_CYCCNTENA;
+    
     /* Initialize watchdog system */
     EBS_Watchdog_Init();
     
     /* Initialize safety monitoring */
     EBS_Safety_Init();
+    EBS_Flow_Init();
     
     /* Initialize sensor interfaces */
     EBS_Sensors_Init();
@@ -109,109 +156,31 @@ static void EBS_SystemInit(void)
     
     /* Initialize control algorithms */
     EBS_ABS_Init();
+#if (EBS_ENABLE_ESC == 1U)
     EBS_ESC_Init();
+#endif
+#if (EBS_ENABLE_TCS == 1U)
     EBS_TCS_Init();
+#endif
+    
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U) && (EBS_SAFETY_SECONDARY_CORE == 0U)
+    /* Secondary channel replays every ABS step from a state snapshot */
+    EBS_Lockstep_Init(LOCKSTEP_COMPARE_EXACT, EBS_GetTimeNs);
+#elif (EBS_SAFETY_DUAL_CHANNEL == 1U)
+    /* The cycle counter is per core, so latency is not measured across cores */
+    EBS_Lockstep_Init(LOCKSTEP_COMPARE_EXACT, NULL);
+    
+    /* Mailboxes are ready: release the secondary core onto the safety stack */
+    uint32_t safety_stack_size = 0U;
+    uint8_t* safety_stack = (uint8_t*)EBS_Memory_GetStack(MEMORY_STACK_SAFETY, &safety_stack_size);
+    EBS_HAL_StartSecondaryCore(EBS_SecondaryCoreMain, &safety_stack[safety_stack_size]);
+#endif
     
     /* Initialize diagnostics */
     EBS_Diagnostics_Init();
     
     /* Set initial system state */
-    g_system_state = EBS_STATE_INIT;
-    g_safety_state = SAFETY_STATE_INIT;
-}
-
-/**
- * @brief Main control loop - executes every 1ms
- */
-static void EBS_MainControlLoop(void)
-{
-    static uint32_t abs_counter = 0;
-    static uint32_t esc_counter = 0;
-    static uint32_t tcs_counter = 0;
-    static uint32_t comm_counter = 0;
-    static uint32_t diag_counter = 0;
-    
-    /* Read sensor data (every cycle - 1ms) */
-    EBS_Sensors_ReadAll();
-    
-    /* ABS control (every cycle - 1ms) */
-    EBS_ABS_Control();
-    
-    /* ESC control (every 5ms) */
-    if (++esc_counter >= 5) {
-        esc_counter = 0;
-        EBS_ESC_Control();
-    }
-    
-    /* TCS control (every 10ms) */
-    if (++tcs_counter >= 10) {
-        tcs_counter = 0;
-        EBS_TCS_Control();
-    }
-    
-    /* Update actuators (every cycle - 1ms) */
-    EBS_Actuators_Update();
-    
-    /* Communication tasks (every 10ms) */
-    if (++comm_counter >= 10) {
-        comm_counter = 0;
-        EBS_Communication_Process();
-    }
-    
-    /* Diagnostic tasks (every 100ms) */
-    if (++diag_counter >= 100) {
-        diag_counter = 0;
-        EBS_Diagnostics_Process();
-    }
-}
-
-/**
- * @brief Safety monitoring - executes every cycle
- */
-static void EBS_SafetyMonitoring(void)
-{
-    /* Check safety state */
-    g_safety_state = EBS_Safety_GetState();
-    
-    /* Handle safety state transitions */
-    switch (g_safety_state) {
-        case SAFETY_STATE_NORMAL:
-            /* Normal operation - no action required */
-            break;
-            
-        case SAFETY_STATE_WARNING:
-            /* Warning state - log event and continue */
-            EBS_Diagnostics_LogEvent(DIAG_EVENT_SAFETY_WARNING, 0);
-            break;
-            
-        case SAFETY_STATE_DEGRADED:
-            /* Degraded state - reduce functionality */
-            g_system_state = EBS_STATE_DEGRADED;
-            EBS_Diagnostics_LogEvent(DIAG_EVENT_SAFETY_DEGRADED, 0);
-            break;
-            
-        case SAFETY_STATE_SAFE:
-            /* Safe state - minimal functionality only */
-            g_system_state = EBS_STATE_SAFE_MODE;
-            EBS_Diagnostics_LogEvent(DIAG_EVENT_SAFETY_SAFE_STATE, 0);
-            break;
-            
-        default:
-            /* Unknown state - enter safe mode */
-            EBS_Safety_EnterSafeState(SAFETY_FAULT_UNKNOWN_STATE);
-            g_system_state = EBS_STATE_SAFE_MODE;
-            break;
-    }
-    
-    /* Monitor system health */
-    EBS_Safety_MonitorSystemHealth();
-    
-    /* Check for critical faults */
-    if (EBS_Safety_HasCriticalFault()) {
-        /* Critical fault detected - immediate safe state */
-        EBS_Safety_EnterSafeState(SAFETY_FAULT_CRITICAL);
-        g_system_state = EBS_STATE_SAFE_MODE;
-    }
+    EBS_Scheduler_Init();
 }
 
 /**
@@ -241,13 +210,20 @@ static bool EBS_SelfTest(void)
     }
     
     /* Test safety systems */
-    if (!EBS_Safety_SelfTest()) {
+    if (!EBS_Safety_SelfTest() || !EBS_Flow_SelfTest()) {
         EBS_Diagnostics_SetDTC(DTC_SAFETY_SELF_TEST_FAILED);
         test_result = false;
     }
     
     /* Test control algorithms */
-    if (!EBS_ABS_SelfTest() || !EBS_ESC_SelfTest() || !EBS_TCS_SelfTest()) {
+    bool algorithms_ok = EBS_ABS_SelfTest();
+#if (EBS_ENABLE_ESC == 1U)
+    algorithms_ok = algorithms_ok && EBS_ESC_SelfTest();
+#endif
+#if (EBS_ENABLE_TCS == 1U)
+    algorithms_ok = algorithms_ok && EBS_TCS_SelfTest();
+#endif
+    if (!algorithms_ok) {
         EBS_Diagnostics_SetDTC(DTC_ALGORITHM_SELF_TEST_FAILED);
         test_result = false;
     }
@@ -270,7 +246,7 @@ static void EBS_SystemShutdown(void)
     EBS_Communication_Shutdown();
     
     /* Log shutdown event */
-    EBS_Diagnostics_LogEvent(DIAG_EVENT_SYSTEM_SHUTDOWN, g_system_tick_counter);
+    EBS_Diagnostics_LogEvent(DIAG_EVENT_SYSTEM_SHUTDOWN, EBS_GetSystemTick());
     
     /* Shutdown diagnostics */
     EBS_Diagnostics_Shutdown();
@@ -280,21 +256,28 @@ static void EBS_SystemShutdown(void)
 }
 
 /**
- * @brief Get current system state
- * @return ebs_system_state_t Current system state
- */
-ebs_system_state_t EBS_GetSystemState(void)
-{
-    return g_system_state;
-}
-
-/**
- * @brief Get system tick counter
- * @return uint32_t Current tick counter value
+ * @brief Get time from the DWT cycle counter (lockstep latency time base)
+ * 
+ * The cycle count is extended to 64 bit so the result wraps cleanly at
+ * 2^32 ns; it must be read at least once per counter wrap (14 s at
+ * 300 MHz) and only from the main core.
+ * 
+ * @return uint32_t Time in nanoseconds (wraps)
  */
-uint32_t EBS_GetSystemTick(void)
+uint32_t EBS_GetTimeNs(void)
 {
-    return g_system_tick_counter;
+    static uint32_t last_cycles = 0U;
+    static uint64_t total_cycles = 0U;
+    
+    uint32_t cycles = EBS_DWT_CYCCNT;
+    total_cycles += (uint32_t)(cycles - last_cycles);
+    last_cycles = cycles;
+    
+    uint64_t seconds = total_cycles / EBS_MCU_FREQUENCY_HZ;
+    uint64_t remainder = total_cycles % EBS_MCU_FREQUENCY_HZ;
+    
+    return (uint32_t)(seconds * 1000000000ULL +
+                      (remainder * 1000000000ULL) / EBS_MCU_FREQUENCY_HZ);
 }
 
 /**
@@ -0,0 +1,383 @@
+/**
+ * @file ebs_memory.c
+ * @brief Electronic Braking System - Static Memory Management Implementation
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * No memory is ever returned to the heap: arenas only grow until the
+ * system is sealed, so the arena high-water mark equals its fill level.
+ * Stacks are filled with MEMORY_STACK_PAINT_VALUE before any task runs
+ * on them; the lowest overwritten word gives the stack high-water mark.
+ * On Cortex-M the stacks are switched in by writing PSP/MSP/SP directly;
+ * host builds (bench, fault campaign) run every task on the host stack.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#include "ebs_memory.h"
+#include <string.h>
+
+#if (EBS_ARENA_SIZE_COMM + EBS_ARENA_SIZE_DIAG + EBS_ARENA_SIZE_RECORDER + \
+     EBS_ARENA_SIZE_SPARE) > EBS_HEAP_SIZE
+#error "Arena budgets exceed EBS_HEAP_SIZE"
+#endif
+
+/* Memory Macros */
+#define MEMORY_ALIGN_UP(n)  (((n) + (MEMORY_ALIGNMENT - 1U)) & ~(MEMORY_ALIGNMENT - 1U))
+
+#if defined(__GNUC__) && defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+#define MEMORY_STACK_SWITCH 1U
+#else
+#define MEMORY_STACK_SWITCH 0U
+#endif
+
+/* Static Variables */
+static uint64_t g_memory_heap[EBS_HEAP_SIZE / sizeof(uint64_t)];
+
+/* AAPCS requires an 8-byte aligned stack pointer */
+static EBS_ALIGNED(MEMORY_ALIGNMENT) uint32_t g_stack_main[EBS_STACK_SIZE_MAIN / sizeof(uint32_t)];
+static EBS_ALIGNED(MEMORY_ALIGNMENT) uint32_t g_stack_safety[EBS_STACK_SIZE_SAFETY / sizeof(uint32_t)];
+static EBS_ALIGNED(MEMORY_ALIGNMENT) uint32_t g_stack_isr[EBS_STACK_SIZE_ISR / sizeof(uint32_t)];
+
+static ebs_memory_arena_t g_memory_arenas[MEMORY_ARENA_COUNT];
+static uint32_t g_memory_late_alloc_count = 0U;
+static bool g_memory_sealed = false;
+static bool g_memory_initialized = false;
+
+static const uint32_t g_arena_sizes[MEMORY_ARENA_COUNT] = {
+    EBS_ARENA_SIZE_COMM,
+    EBS_ARENA_SIZE_DIAG,
+    EBS_ARENA_SIZE_RECORDER,
+    EBS_ARENA_SIZE_SPARE
+};
+
+static uint32_t* const g_stack_bases[MEMORY_STACK_COUNT] = {
+    g_stack_main,
+    g_stack_safety,
+    g_stack_isr
+};
+
+static const uint32_t g_stack_sizes[MEMORY_STACK_COUNT] = {
+    EBS_STACK_SIZE_MAIN,
+    EBS_STACK_SIZE_SAFETY,
+    EBS_STACK_SIZE_ISR
+};
+
+/* Static Function Prototypes */
+static void Memory_PaintStack(uint32_t* base, uint32_t size);
+static uint32_t Memory_ScanStack(const uint32_t* base, uint32_t size);
+
+/**
+ * @brief Carve arenas from the static heap and paint all task stacks
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Memory_Init(void)
+{
+    uint8_t* heap = (uint8_t*)g_memory_heap;
+    uint32_t offset = 0U;
+
+    memset(g_memory_arenas, 0, sizeof(g_memory_arenas));
+
+    for (uint32_t id = 0; id < MEMORY_ARENA_COUNT; id++) {
+        g_memory_arenas[id].base = &heap[offset];
+        g_memory_arenas[id].size = g_arena_sizes[id];
+        offset += g_arena_sizes[id];
+    }
+
+    /* Tasks are not started yet, so every stack can be painted in full */
+    for (uint32_t id = 0; id < MEMORY_STACK_COUNT; id++) {
+        Memory_PaintStack(g_stack_bases[id], g_stack_sizes[id]);
+    }
+
+    g_memory_late_alloc_count = 0U;
+    g_memory_sealed = false;
+    g_memory_initialized = true;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Allocate from a module arena (initialization only)
+ * @param arena Module arena
+ * @param size Requested size in bytes
+ * @return void* Aligned memory, NULL if sealed or the arena is exhausted
+ */
+void* EBS_Memory_Alloc(ebs_memory_arena_id_t arena, uint32_t size)
+{
+    if (!g_memory_initialized || arena >= MEMORY_ARENA_COUNT || size == 0U) {
+        return NULL;
+    }
+
+    ebs_memory_arena_t* a = &g_memory_arenas[arena];
+
+    if (g_memory_sealed) {
+        /* Allocation from the control loop is a design error */
+        g_memory_late_alloc_count++;
+        a->failed_count++;
+        return NULL;
+    }
+
+    uint32_t aligned = MEMORY_ALIGN_UP(size);
+    if (aligned < size || aligned > (a->size - a->used)) {
+        a->failed_count++;
+        return NULL;
+    }
+
+    void* block = &a->base[a->used];
+    a->used += aligned;
+
+    return block;
+}
+
+/**
+ * @brief Close the allocation window (called before EBS_STATE_NORMAL)
+ */
+void EBS_Memory_Seal(void)
+{
+    g_memory_sealed = true;
+}
+
+/**
+ * @brief Reserve a fixed block pool from a module arena (initialization only)
+ * @param pool Pool to initialize
+ * @param arena Module arena to reserve from
+ * @param block_size Block size in bytes
+ * @param block_count Number of blocks
+ * @return ebs_result_t EBS_BUFFER_FULL if the arena cannot hold the pool
+ */
+ebs_result_t EBS_Memory_PoolInit(ebs_memory_pool_t* pool, ebs_memory_arena_id_t arena,
+                                 uint32_t block_size, uint32_t block_count)
+{
+    if (pool == NULL || block_size == 0U || block_count == 0U) {
+        return EBS_INVALID_PARAM;
+    }
+
+    memset(pool, 0, sizeof(*pool));
+
+    /* Each free block holds the free-list link */
+    uint32_t stride = MEMORY_ALIGN_UP(EBS_MAX(block_size, (uint32_t)sizeof(void*)));
+    if (block_count > (UINT32_MAX / stride)) {
+        return EBS_INVALID_PARAM;
+    }
+
+    uint8_t* blocks = (uint8_t*)EBS_Memory_Alloc(arena, stride * block_count);
+    if (blocks == NULL) {
+        return EBS_BUFFER_FULL;
+    }
+
+    for (uint32_t i = 0; i < block_count; i++) {
+        void** link = (void**)(void*)&blocks[i * stride];
+        *link = (i + 1U < block_count) ? (void*)&blocks[(i + 1U) * stride] : NULL;
+    }
+
+    pool->blocks = blocks;
+    pool->free_list = blocks;
+    pool->block_size = stride;
+    pool->block_count = block_count;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Take a block from a pool (O(1), any state)
+ * @param pool Pool
+ * @return void* Block, NULL if the pool is empty
+ */
+void* EBS_Memory_PoolTake(ebs_memory_pool_t* pool)
+{
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    void* block = pool->free_list;
+    if (block == NULL) {
+        pool->exhausted_count++;
+        return NULL;
+    }
+
+    pool->free_list = *(void**)block;
+    pool->in_use++;
+    if (pool->in_use > pool->high_water) {
+        pool->high_water = pool->in_use;
+    }
+
+    return block;
+}
+
+/**
+ * @brief Return a block to its pool (O(1), any state)
+ * @param pool Pool
+ * @param block Block previously taken from @p pool
+ */
+void EBS_Memory_PoolGive(ebs_memory_pool_t* pool, void* block)
+{
+    if (pool == NULL || block == NULL || pool->in_use == 0U) {
+        return;
+    }
+
+    /* Reject pointers that are not a block boundary of this pool */
+    uintptr_t offset = (uintptr_t)block - (uintptr_t)pool->blocks;
+    if ((uintptr_t)block < (uintptr_t)pool->blocks ||
+        offset >= ((uintptr_t)pool->block_size * pool->block_count) ||
+        (offset % pool->block_size) != 0U) {
+        return;
+    }
+
+    *(void**)block = pool->free_list;
+    pool->free_list = block;
+    pool->in_use--;
+}
+
+/**
+ * @brief Get the statically allocated stack for a task
+ * @param stack Stack identifier
+ * @param size Receives the stack size in bytes (may be NULL)
+ * @return void* Lowest address of the stack region
+ */
+void* EBS_Memory_GetStack(ebs_memory_stack_id_t stack, uint32_t* size)
+{
+    if (stack >= MEMORY_STACK_COUNT) {
+        return NULL;
+    }
+
+    if (size != NULL) {
+        *size = g_stack_sizes[stack];
+    }
+
+    return g_stack_bases[stack];
+}
+
+/**
+ * @brief Run the main task on its stack, exceptions on the ISR stack
+ * @param task Main task (does not return)
+ */
+void EBS_Memory_StartMainTask(ebs_memory_task_t task)
+{
+    if (task == NULL) {
+        return;
+    }
+
+#if (MEMORY_STACK_SWITCH == 1U)
+    uint32_t* main_top = &g_stack_main[EBS_STACK_SIZE_MAIN / sizeof(uint32_t)];
+    uint32_t* isr_top = &g_stack_isr[EBS_STACK_SIZE_ISR / sizeof(uint32_t)];
+
+    /* Thread mode moves to PSP first, so MSP can then be re-pointed at the */
+    /* ISR stack; the reset stack is abandoned because the task never returns */
+    __asm__ volatile (
+        "msr psp, %0\n\t"
+        "mrs r0, control\n\t"
+        "orr r0, r0, #2\n\t"
+        "msr control, r0\n\t"
+        "isb\n\t"
+        "msr msp, %1\n\t"
+        "blx %2\n\t"
+        :
+        : "r" (main_top), "r" (isr_top), "r" (task)
+        : "r0", "memory");
+
+    for (;;) {
+    }
+#else
+    task();
+#endif
+}
+
+/**
+ * @brief Run a function on another task stack and return
+ * @param stack Stack to run on (not the caller's own)
+ * @param task Function to run
+ */
+void EBS_Memory_CallOnStack(ebs_memory_stack_id_t stack, ebs_memory_task_t task)
+{
+    if (stack >= MEMORY_STACK_COUNT || task == NULL) {
+        return;
+    }
+
+#if (MEMORY_STACK_SWITCH == 1U)
+    uint32_t* top = &g_stack_bases[stack][g_stack_sizes[stack] / sizeof(uint32_t)];
+
+    /* r4 is callee-saved, so it carries the caller's SP across the call */
+    __asm__ volatile (
+        "mov r4, sp\n\t"
+        "mov sp, %0\n\t"
+        "blx %1\n\t"
+        "mov sp, r4\n\t"
+        :
+        : "r" (top), "r" (task)
+        : "r0", "r1", "r2", "r3", "r4", "r12", "lr", "cc", "memory");
+#else
+    task();
+#endif
+}
+
+/**
+ * @brief Scan stacks and collect arena/stack high-water marks
+ * @param report Destination
+ * @return ebs_result_t Report result
+ */
+ebs_result_t EBS_Memory_GetReport(ebs_memory_report_t* report)
+{
+    if (report == NULL) {
+        return EBS_INVALID_PARAM;
+    }
+
+    if (!g_memory_initialized) {
+        return EBS_NOT_INITIALIZED;
+    }
+
+    memset(report, 0, sizeof(*report));
+
+    for (uint32_t id = 0; id < MEMORY_ARENA_COUNT; id++) {
+        report->arena_size[id] = g_memory_arenas[id].size;
+        report->arena_used[id] = g_memory_arenas[id].used;
+    }
+
+    for (uint32_t id = 0; id < MEMORY_STACK_COUNT; id++) {
+        report->stack_size[id] = g_stack_sizes[id];
+        report->stack_used[id] = Memory_ScanStack(g_stack_bases[id], g_stack_sizes[id]);
+
+        /* Stacks grow down: the lowest word is the overflow guard */
+        if (g_stack_bases[id][0] != MEMORY_STACK_PAINT_VALUE) {
+            report->stack_overflow_mask |= 1UL << id;
+        }
+    }
+
+    report->late_alloc_count = g_memory_late_alloc_count;
+    report->sealed = g_memory_sealed;
+
+    return EBS_OK;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief Fill a stack region with the paint pattern
+ * @param base Lowest address of the stack
+ * @param size Stack size in bytes
+ */
+static void Memory_PaintStack(uint32_t* base, uint32_t size)
+{
+    for (uint32_t i = 0; i < size / sizeof(uint32_t); i++) {
+        base[i] = MEMORY_STACK_PAINT_VALUE;
+    }
+}
+
+/**
+ * @brief Measure the deepest stack use (stack grows toward @p base)
+ * @param base Lowest address of the stack
+ * @param size Stack size in bytes
+ * @return uint32_t Bytes used at the high-water mark
+ */
+static uint32_t Memory_ScanStack(const uint32_t* base, uint32_t size)
+{
+    const uint32_t words = size / sizeof(uint32_t);
+    uint32_t untouched = 0U;
+
+    while (untouched < words && base[untouched] == MEMORY_STACK_PAINT_VALUE) {
+        untouched++;
+    }
+
+    return (words - untouched) * (uint32_t)sizeof(uint32_t);
+}
@@ -4,18 +4,64 @@
  * @version 1.0
  * @date 2025-07-29
  * @author EBS Development Team
- * 
+ *
  * Safety management implementation for ASIL-D compliance
- * 
+ *
+ * Deadline, alive and program-flow supervision live in ebs_watchdog.c and
+ * ebs_flow_monitor.c and are acted on by the main loop (ebs_scheduler.c);
+ * this module owns the safety state, the safe state latch, the cycle
+ * timing and guard word checks and the dual-channel (lockstep) verdict.
+ *
  * Safety Level: ASIL-D
  * Compliance: ISO 26262, MISRA C:2012
  */
 
 #include "ebs_safety.h"
 #include "ebs_diagnostics.h"
-#include "ebs_actuators.h"
-#include "ebs_communication.h"
+#include "ebs_lockstep.h"
+#include "ebs_watchdog.h"
+#include "ebs_crc.h"
 #include <string.h>
+#include <math.h>
+
+/* Safety violation classes found by the cyclic monitor */
+typedef enum {
+    SAFETY_VIOLATION_TIMING = 0,
+    SAFETY_VIOLATION_MEMORY,
+    SAFETY_VIOLATION_DUAL_CHANNEL,
+    SAFETY_VIOLATION_COUNT
+} ebs_safety_violation_t;
+
+/* Safety manager state */
+typedef struct {
+    ebs_safety_state_t current_state;
+    ebs_safety_state_t previous_state;
+    bool system_enabled;
+    bool fault_reaction_active;
+    
+    struct {
+        uint32_t last_cycle_time;           /* Tick of the previous monitor call */
+        uint32_t max_cycle_time;
+        uint32_t cycle_overrun_count;
+    } timing;
+    
+    struct {
+        uint32_t stack_canary;
+        uint32_t heap_guard;
+        bool corruption_detected;
+    } memory;
+    
+    struct {
+        bool primary_active;
+        bool secondary_active;
+        uint32_t comparison_failures;
+        uint32_t last_comparison_time;
+    } dual_channel;
+    
+    uint32_t fault_counters[SAFETY_VIOLATION_COUNT];
+    ebs_safety_fault_t fault_history[SAFETY_FAULT_HISTORY_SIZE];
+    uint32_t fault_history_count;           /* Safe state requests (may exceed the history) */
+} ebs_safety_manager_t;
 
 /* Static Variables */
 static ebs_safety_manager_t g_safety_manager;
@@ -23,14 +69,12 @@ static bool g_safety_initialized = false;
 static uint32_t g_safety_violation_count = 0;
 
 /* Static Function Prototypes */
-static ebs_result_t Safety_InitializeWatchdogs(void);
-static ebs_result_t Safety_CheckSystemIntegrity(void);
 static ebs_result_t Safety_ValidateMemory(void);
-static ebs_result_t Safety_CheckTimingConstraints(void);
+static ebs_result_t Safety_CheckTimingConstraints(uint32_t cycle_time);
 static ebs_result_t Safety_ExecuteDualChannelCheck(void);
 static void Safety_HandleSafetyViolation(ebs_safety_violation_t violation);
+static bool Safety_IsStateValid(ebs_safety_state_t state);
 static bool Safety_IsSystemInSafeState(void);
-static ebs_result_t Safety_PerformGracefulShutdown(void);
 static uint32_t Safety_CalculateChecksum(const void* data, size_t length);
 
 /**
@@ -41,11 +85,11 @@ ebs_result_t EBS_Safety_Init(void)
 {
     /* Clear safety manager state */
     memset(&g_safety_manager, 0, sizeof(g_safety_manager));
+    g_safety_violation_count = 0;
     
     /* Initialize safety state */
     g_safety_manager.current_state = SAFETY_STATE_INIT;
     g_safety_manager.previous_state = SAFETY_STATE_UNKNOWN;
-    g_safety_manager.safety_level = SAFETY_LEVEL_ASIL_D;
     g_safety_manager.system_enabled = false;
     g_safety_manager.fault_reaction_active = false;
     
@@ -65,18 +109,9 @@ ebs_result_t EBS_Safety_Init(void)
     g_safety_manager.dual_channel.comparison_failures = 0;
     g_safety_manager.dual_channel.last_comparison_time = EBS_GetSystemTick();
     
-    /* Initialize watchdogs */
-    if (Safety_InitializeWatchdogs() != EBS_OK) {
-        return EBS_ERROR;
-    }
-    
-    /* Initialize fault counters */
-    for (uint32_t i = 0; i < SAFETY_MAX_FAULT_TYPES; i++) {
-        g_safety_manager.fault_counters[i] = 0;
-    }
-    
     g_safety_initialized = true;
-    g_safety_manager.current_state = SAFETY_STATE_OPERATIONAL;
+    g_safety_manager.system_enabled = true;
+    g_safety_manager.current_state = SAFETY_STATE_NORMAL;
     
     return EBS_OK;
 }
@@ -98,9 +133,8 @@ bool EBS_Safety_SelfTest(void)
         test_passed = false;
     }
     
-    /* Test 2: Watchdog functionality */
-    uint32_t test_watchdog_id = 0;
-    if (EBS_Safety_KickWatchdog(test_watchdog_id) != EBS_OK) {
+    /* Test 2: Watchdog supervision running and not expired */
+    if (EBS_Watchdog_GetGlobalStatus() == WDG_STATUS_EXPIRED) {
         test_passed = false;
     }
     
@@ -112,7 +146,7 @@ bool EBS_Safety_SelfTest(void)
     /* Test 4: Safety state transitions */
     ebs_safety_state_t original_state = g_safety_manager.current_state;
     g_safety_manager.current_state = SAFETY_STATE_DEGRADED;
-    if (!EBS_Safety_IsStateValid(g_safety_manager.current_state)) {
+    if (!Safety_IsStateValid(g_safety_manager.current_state)) {
         test_passed = false;
     }
     g_safety_manager.current_state = original_state;
@@ -124,6 +158,11 @@ bool EBS_Safety_SelfTest(void)
         test_passed = false;
     }
     
+    /* Test 6: CRC table integrity */
+    if (!EBS_Crc32_SelfTest()) {
+        test_passed = false;
+    }
+    
     return test_passed;
 }
 
@@ -131,7 +170,7 @@ bool EBS_Safety_SelfTest(void)
  * @brief Main safety monitoring function (called every cycle)
  * @return ebs_result_t Monitoring result
  */
-ebs_result_t EBS_Safety_Monitor(void)
+ebs_result_t EBS_Safety_MonitorSystemHealth(void)
 {
     if (!g_safety_initialized) {
         return EBS_NOT_INITIALIZED;
@@ -148,17 +187,11 @@ ebs_result_t EBS_Safety_Monitor(void)
     g_safety_manager.timing.last_cycle_time = current_time;
     
     /* Check timing constraints */
-    if (Safety_CheckTimingConstraints() != EBS_OK) {
+    if (Safety_CheckTimingConstraints(cycle_time) != EBS_OK) {
         Safety_HandleSafetyViolation(SAFETY_VIOLATION_TIMING);
         result = EBS_ERROR;
     }
     
-    /* Check system integrity */
-    if (Safety_CheckSystemIntegrity() != EBS_OK) {
-        Safety_HandleSafetyViolation(SAFETY_VIOLATION_INTEGRITY);
-        result = EBS_ERROR;
-    }
-    
     /* Validate memory protection */
     if (Safety_ValidateMemory() != EBS_OK) {
         Safety_HandleSafetyViolation(SAFETY_VIOLATION_MEMORY);
@@ -172,31 +205,14 @@ ebs_result_t EBS_Safety_Monitor(void)
     }
     
     /* Update safety state based on monitoring results */
-    if (result != EBS_OK && g_safety_manager.current_state == SAFETY_STATE_OPERATIONAL) {
+    if (result != EBS_OK && g_safety_manager.current_state == SAFETY_STATE_NORMAL) {
         g_safety_manager.previous_state = g_safety_manager.current_state;
         g_safety_manager.current_state = SAFETY_STATE_DEGRADED;
-        
-        /* Log state transition */
-        EBS_Diagnostics_LogEvent(DIAG_EVENT_SAFETY_STATE_CHANGE, 
-                                (uint32_t)g_safety_manager.current_state);
     }
     
     return result;
 }
 
-/**
- * @brief Check if system is in safe state
- * @return bool True if system is safe
- */
-bool EBS_Safety_IsSystemSafe(void)
-{
-    if (!g_safety_initialized) {
-        return false;
-    }
-    
-    return Safety_IsSystemInSafeState();
-}
-
 /**
  * @brief Get current safety state
  * @return ebs_safety_state_t Current safety state
@@ -211,244 +227,164 @@ ebs_safety_state_t EBS_Safety_GetState(void)
 }
 
 /**
- * @brief Validate safety state
- * @param state Safety state to validate
- * @return bool True if state is valid
+ * @brief Enter safe state with specified fault
+ *
+ * The safe state is latched until the next EBS_Safety_Init; every request
+ * is kept in the fault history, the first one being the reason of entry.
+ * Also usable before initialization (SAFETY_ASSERT).
+ *
+ * @param fault Safety fault that triggered safe state
+ * @return ebs_result_t Operation result
  */
-bool EBS_Safety_IsStateValid(ebs_safety_state_t state)
+ebs_result_t EBS_Safety_EnterSafeState(ebs_safety_fault_t fault)
 {
-    switch (state) {
-        case SAFETY_STATE_INIT:
-        case SAFETY_STATE_OPERATIONAL:
-        case SAFETY_STATE_DEGRADED:
-        case SAFETY_STATE_FAULT:
-        case SAFETY_STATE_SHUTDOWN:
-            return true;
-        default:
-            return false;
+    if (g_safety_manager.fault_history_count < SAFETY_FAULT_HISTORY_SIZE) {
+        g_safety_manager.fault_history[g_safety_manager.fault_history_count] = fault;
     }
-}
-
-/**
- * @brief Kick watchdog timer
- * @param watchdog_id Watchdog identifier
- * @return ebs_result_t Kick result
- */
-ebs_result_t EBS_Safety_KickWatchdog(uint32_t watchdog_id)
-{
-    if (!g_safety_initialized || watchdog_id >= SAFETY_MAX_WATCHDOGS) {
-        return EBS_INVALID_PARAM;
-    }
-    
-    ebs_safety_watchdog_t* watchdog = &g_safety_manager.watchdogs[watchdog_id];
-    
-    if (!watchdog->enabled) {
-        return EBS_ERROR;
-    }
-    
-    uint32_t current_time = EBS_GetSystemTick();
+    g_safety_manager.fault_history_count++;
     
-    /* Check if kick is within expected window */
-    uint32_t time_since_last_kick = current_time - watchdog->last_kick_time;
+    if (g_safety_manager.current_state != SAFETY_STATE_SAFE) {
+        g_safety_manager.previous_state = g_safety_manager.current_state;
+        g_safety_manager.current_state = SAFETY_STATE_SAFE;
+        g_safety_manager.system_enabled = false;
+        g_safety_manager.fault_reaction_active = true;
     
-    if (time_since_last_kick < watchdog->min_kick_interval) {
-        /* Kicked too early - potential runaway condition */
-        watchdog->early_kick_count++;
-        if (watchdog->early_kick_count > SAFETY_MAX_EARLY_KICKS) {
-            Safety_HandleSafetyViolation(SAFETY_VIOLATION_WATCHDOG);
-            return EBS_ERROR;
-        }
-    } else if (time_since_last_kick > watchdog->timeout_ms) {
-        /* Kicked too late - timeout occurred */
-        watchdog->timeout_count++;
-        Safety_HandleSafetyViolation(SAFETY_VIOLATION_WATCHDOG);
-        return EBS_ERROR;
-    } else {
-        /* Valid kick - reset counters */
-        watchdog->early_kick_count = 0;
+        EBS_Diagnostics_LogEvent(DIAG_EVENT_SAFETY_SAFE_STATE, (uint32_t)fault);
     }
     
-    /* Update watchdog state */
-    watchdog->last_kick_time = current_time;
-    watchdog->kick_count++;
-    
     return EBS_OK;
 }
 
 /**
- * @brief Report safety violation
- * @param violation_type Type of safety violation
- * @param severity Severity level
- * @return ebs_result_t Report result
+ * @brief Check if critical fault is present
+ * @return bool True if an operating state is no longer safe to continue in
  */
-ebs_result_t EBS_Safety_ReportViolation(ebs_safety_violation_t violation_type, 
-                                       ebs_safety_severity_t severity)
+bool EBS_Safety_HasCriticalFault(void)
 {
     if (!g_safety_initialized) {
-        return EBS_NOT_INITIALIZED;
-    }
-    
-    /* Increment violation counter */
-    g_safety_violation_count++;
-    
-    /* Update fault counters */
-    if (violation_type < SAFETY_MAX_FAULT_TYPES) {
-        g_safety_manager.fault_counters[violation_type]++;
-    }
-    
-    /* Log the violation */
-    EBS_Diagnostics_SetDTC(DTC_SAFETY_VIOLATION_DETECTED);
-    EBS_Diagnostics_LogEvent(DIAG_EVENT_SAFETY_VIOLATION, (uint32_t)violation_type);
-    
-    /* Handle based on severity */
-    switch (severity) {
-        case SAFETY_SEVERITY_LOW:
-            /* Log and continue */
-            break;
-            
-        case SAFETY_SEVERITY_MEDIUM:
-            /* Enter degraded mode */
-            g_safety_manager.previous_state = g_safety_manager.current_state;
-            g_safety_manager.current_state = SAFETY_STATE_DEGRADED;
-            break;
-            
-        case SAFETY_SEVERITY_HIGH:
-            /* Enter fault state */
-            g_safety_manager.previous_state = g_safety_manager.current_state;
-            g_safety_manager.current_state = SAFETY_STATE_FAULT;
-            g_safety_manager.fault_reaction_active = true;
-            break;
-            
-        case SAFETY_SEVERITY_CRITICAL:
-            /* Immediate shutdown */
-            Safety_PerformGracefulShutdown();
-            break;
-            
-        default:
-            return EBS_INVALID_PARAM;
+        return false;
     }
     
-    /* Handle the violation */
-    Safety_HandleSafetyViolation(violation_type);
-    
-    return EBS_OK;
+    return (g_safety_manager.current_state == SAFETY_STATE_NORMAL ||
+            g_safety_manager.current_state == SAFETY_STATE_DEGRADED) &&
+           !Safety_IsSystemInSafeState();
 }
 
 /**
- * @brief Perform memory protection check
- * @param address Memory address to check
- * @param size Size of memory region
- * @return bool True if memory is protected
+ * @brief Emergency stop function (called from interrupt)
  */
-bool EBS_Safety_CheckMemoryProtection(void* address, size_t size)
+void EBS_Safety_EmergencyStop(void)
 {
-    if (!g_safety_initialized || address == NULL || size == 0) {
-        return false;
-    }
-    
-    /* Check stack canary */
-    if (g_safety_manager.memory.stack_canary != SAFETY_STACK_CANARY_VALUE) {
-        g_safety_manager.memory.corruption_detected = true;
-        Safety_HandleSafetyViolation(SAFETY_VIOLATION_MEMORY);
-        return false;
-    }
+    g_safety_manager.previous_state = g_safety_manager.current_state;
+    g_safety_manager.current_state = SAFETY_STATE_SAFE;
+    g_safety_manager.system_enabled = false;
+    g_safety_manager.fault_reaction_active = true;
+}
+
+/**
+ * @brief Perform dual-channel comparison
+ * @param channel_a Channel A data
+ * @param channel_b Channel B data
+ * @param tolerance Relative tolerance (absolute below magnitude 1)
+ * @return bool True if channels agree within tolerance
+ */
+bool EBS_Safety_DualChannelCompare(float channel_a, float channel_b, float tolerance)
+{
+    float magnitude = EBS_MAX(fabsf(channel_a), fabsf(channel_b));
     
-    /* Check heap guard */
-    if (g_safety_manager.memory.heap_guard != SAFETY_HEAP_GUARD_VALUE) {
-        g_safety_manager.memory.corruption_detected = true;
-        Safety_HandleSafetyViolation(SAFETY_VIOLATION_MEMORY);
+    return fabsf(channel_a - channel_b) <= tolerance * EBS_MAX(magnitude, 1.0f);
+}
+
+/**
+ * @brief Calculate CRC for data integrity
+ * @param data Pointer to data
+ * @param length Length of data
+ * @return uint32_t Calculated CRC value
+ */
+uint32_t EBS_Safety_CalculateCRC(const uint8_t* data, uint32_t length)
+{
+    return EBS_Crc32_Compute(data, length);
+}
+
+/**
+ * @brief Verify CRC for data integrity
+ * @param data Pointer to data
+ * @param length Length of data
+ * @param expected_crc Expected CRC value
+ * @return bool True if CRC matches
+ */
+bool EBS_Safety_VerifyCRC(const uint8_t* data, uint32_t length, uint32_t expected_crc)
+{
+    if (data == NULL) {
         return false;
     }
     
-    /* Additional memory range checks could be implemented here */
-    /* For now, assume memory is protected if canaries are intact */
-    
-    return true;
+    return EBS_Crc32_Compute(data, length) == expected_crc;
 }
 
 /**
- * @brief Get safety statistics
- * @return ebs_safety_statistics_t* Pointer to safety statistics
+ * @brief Memory protection check
+ * @return bool True if the safety manager guard words are intact
  */
-const ebs_safety_statistics_t* EBS_Safety_GetStatistics(void)
+bool EBS_Safety_MemoryProtectionCheck(void)
 {
     if (!g_safety_initialized) {
-        return NULL;
+        return false;
     }
     
-    /* Update statistics */
-    g_safety_manager.statistics.total_violations = g_safety_violation_count;
-    g_safety_manager.statistics.current_state = g_safety_manager.current_state;
-    g_safety_manager.statistics.max_cycle_time = g_safety_manager.timing.max_cycle_time;
-    g_safety_manager.statistics.cycle_overruns = g_safety_manager.timing.cycle_overrun_count;
-    g_safety_manager.statistics.memory_corruptions = g_safety_manager.memory.corruption_detected ? 1 : 0;
-    g_safety_manager.statistics.dual_channel_failures = g_safety_manager.dual_channel.comparison_failures;
-    
-    return &g_safety_manager.statistics;
+    return Safety_ValidateMemory() == EBS_OK;
 }
 
-/* Static Function Implementations */
-
 /**
- * @brief Initialize watchdog timers
- * @return ebs_result_t Initialization result
+ * @brief Get safety fault history
+ * @param fault_buffer Buffer to store fault history
+ * @param buffer_size Size of fault buffer
+ * @return uint32_t Number of faults returned (oldest first)
  */
-static ebs_result_t Safety_InitializeWatchdogs(void)
+uint32_t EBS_Safety_GetFaultHistory(ebs_safety_fault_t* fault_buffer, uint32_t buffer_size)
 {
-    /* Initialize main system watchdog */
-    g_safety_manager.watchdogs[0].enabled = true;
-    g_safety_manager.watchdogs[0].timeout_ms = SAFETY_MAIN_WATCHDOG_TIMEOUT;
-    g_safety_manager.watchdogs[0].min_kick_interval = SAFETY_MIN_KICK_INTERVAL;
-    g_safety_manager.watchdogs[0].last_kick_time = EBS_GetSystemTick();
-    g_safety_manager.watchdogs[0].kick_count = 0;
-    g_safety_manager.watchdogs[0].timeout_count = 0;
-    g_safety_manager.watchdogs[0].early_kick_count = 0;
-    
-    /* Initialize safety monitoring watchdog */
-    g_safety_manager.watchdogs[1].enabled = true;
-    g_safety_manager.watchdogs[1].timeout_ms = SAFETY_MONITOR_WATCHDOG_TIMEOUT;
-    g_safety_manager.watchdogs[1].min_kick_interval = SAFETY_MIN_KICK_INTERVAL;
-    g_safety_manager.watchdogs[1].last_kick_time = EBS_GetSystemTick();
-    g_safety_manager.watchdogs[1].kick_count = 0;
-    g_safety_manager.watchdogs[1].timeout_count = 0;
-    g_safety_manager.watchdogs[1].early_kick_count = 0;
+    if (fault_buffer == NULL) {
+        return 0;
+    }
     
-    return EBS_OK;
+    uint32_t count = EBS_MIN(g_safety_manager.fault_history_count, SAFETY_FAULT_HISTORY_SIZE);
+    count = EBS_MIN(count, buffer_size);
+    
+    for (uint32_t i = 0; i < count; i++) {
+        fault_buffer[i] = g_safety_manager.fault_history[i];
+    }
+    
+    return count;
 }
 
 /**
- * @brief Check system integrity
- * @return ebs_result_t Check result
+ * @brief Get safety statistics
+ * @param stats Pointer to statistics structure
+ * @return ebs_result_t Operation result
  */
-static ebs_result_t Safety_CheckSystemIntegrity(void)
+ebs_result_t EBS_Safety_GetStatistics(ebs_safety_statistics_t* stats)
 {
-    /* Check critical system parameters */
-    if (g_safety_manager.safety_level != SAFETY_LEVEL_ASIL_D) {
-        return EBS_ERROR;
+    if (stats == NULL) {
+        return EBS_INVALID_PARAM;
     }
     
-    /* Check watchdog status */
-    uint32_t current_time = EBS_GetSystemTick();
-    for (uint32_t i = 0; i < SAFETY_MAX_WATCHDOGS; i++) {
-        ebs_safety_watchdog_t* watchdog = &g_safety_manager.watchdogs[i];
-        if (watchdog->enabled) {
-            uint32_t time_since_kick = current_time - watchdog->last_kick_time;
-            if (time_since_kick > watchdog->timeout_ms) {
-                return EBS_ERROR;
-            }
-        }
+    if (!g_safety_initialized) {
+        return EBS_NOT_INITIALIZED;
     }
     
-    /* Check fault counters */
-    for (uint32_t i = 0; i < SAFETY_MAX_FAULT_TYPES; i++) {
-        if (g_safety_manager.fault_counters[i] > SAFETY_MAX_FAULT_COUNT) {
-            return EBS_ERROR;
-        }
-    }
+    stats->total_violations = g_safety_violation_count;
+    stats->current_state = g_safety_manager.current_state;
+    stats->max_cycle_time = g_safety_manager.timing.max_cycle_time;
+    stats->cycle_overruns = g_safety_manager.timing.cycle_overrun_count;
+    stats->memory_corruptions = g_safety_manager.memory.corruption_detected ? 1U : 0U;
+    stats->dual_channel_failures = g_safety_manager.dual_channel.comparison_failures;
+    stats->safe_state_requests = g_safety_manager.fault_history_count;
     
     return EBS_OK;
 }
 
+/* Static Function Implementations */
+
 /**
  * @brief Validate memory integrity
  * @return ebs_result_t Validation result
@@ -467,22 +403,20 @@ static ebs_result_t Safety_ValidateMemory(void)
         return EBS_ERROR;
     }
     
-    /* Additional memory checks could be added here */
+    /* Task stack guards are checked by the memory report (ebs_diagnostics.c) */
     
     return EBS_OK;
 }
 
 /**
  * @brief Check timing constraints
+ * @param cycle_time Ticks since the previous monitor call
  * @return ebs_result_t Check result
  */
-static ebs_result_t Safety_CheckTimingConstraints(void)
+static ebs_result_t Safety_CheckTimingConstraints(uint32_t cycle_time)
 {
-    uint32_t current_time = EBS_GetSystemTick();
-    uint32_t cycle_time = current_time - g_safety_manager.timing.last_cycle_time;
-    
     /* Check for cycle overrun */
-    if (cycle_time > SAFETY_MAX_CYCLE_TIME) {
+    if (cycle_time > SAFETY_MAX_CYCLE_TIME_MS / EBS_CYCLE_TIME_MS) {
         g_safety_manager.timing.cycle_overrun_count++;
         return EBS_ERROR;
     }
@@ -499,21 +433,34 @@ static ebs_result_t Safety_ExecuteDualChannelCheck(void)
     uint32_t current_time = EBS_GetSystemTick();
     
     /* Check if both channels are active */
-    if (!g_safety_manager.dual_channel.primary_active || 
+    if (!g_safety_manager.dual_channel.primary_active ||
         !g_safety_manager.dual_channel.secondary_active) {
         return EBS_ERROR;
     }
     
-    /* Simulate dual channel comparison */
-    /* In a real implementation, this would compare outputs from two independent processing channels */
-    bool comparison_passed = true;  /* Placeholder for actual comparison logic */
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U)
+    /* Compare the secondary's replay of an earlier ABS step with the primary */
+    switch (EBS_Lockstep_Check()) {
+        case EBS_OK:
+            g_safety_manager.dual_channel.last_comparison_time = current_time;
+            break;
     
-    if (!comparison_passed) {
-        g_safety_manager.dual_channel.comparison_failures++;
-        return EBS_ERROR;
-    }
+        case EBS_BUSY:
+            /* Result still in flight - within the allowed lag */
+            break;
+    
+        case EBS_FAULT:
+            g_safety_manager.dual_channel.comparison_failures++;
+            return EBS_ERROR;
     
+        default:
+            /* Secondary channel stopped answering */
+            g_safety_manager.dual_channel.secondary_active = false;
+            return EBS_ERROR;
+    }
+#else
     g_safety_manager.dual_channel.last_comparison_time = current_time;
+#endif
     
     return EBS_OK;
 }
@@ -524,12 +471,15 @@ static ebs_result_t Safety_ExecuteDualChannelCheck(void)
  */
 static void Safety_HandleSafetyViolation(ebs_safety_violation_t violation)
 {
+    g_safety_violation_count++;
+    g_safety_manager.fault_counters[violation]++;
+    
     switch (violation) {
         case SAFETY_VIOLATION_TIMING:
-            /* Handle timing violation */
-            EBS_Diagnostics_SetDTC(DTC_TIMING_VIOLATION);
+            /* Handle timing violation (no DTC of its own) */
+            EBS_Diagnostics_LogEvent(DIAG_EVENT_SAFETY_WARNING, (uint32_t)violation);
             break;
-            
+    
         case SAFETY_VIOLATION_MEMORY:
             /* Handle memory violation */
             EBS_Diagnostics_SetDTC(DTC_MEMORY_CORRUPTION);
@@ -537,35 +487,41 @@ static void Safety_HandleSafetyViolation(ebs_safety_violation_t violation)
             g_safety_manager.memory.stack_canary = SAFETY_STACK_CANARY_VALUE;
             g_safety_manager.memory.heap_guard = SAFETY_HEAP_GUARD_VALUE;
             break;
-            
-        case SAFETY_VIOLATION_WATCHDOG:
-            /* Handle watchdog violation */
-            EBS_Diagnostics_SetDTC(DTC_WATCHDOG_TIMEOUT);
-            break;
-            
+    
         case SAFETY_VIOLATION_DUAL_CHANNEL:
             /* Handle dual channel violation */
-            EBS_Diagnostics_SetDTC(DTC_DUAL_CHANNEL_FAILURE);
-            break;
-            
-        case SAFETY_VIOLATION_INTEGRITY:
-            /* Handle integrity violation */
-            EBS_Diagnostics_SetDTC(DTC_SYSTEM_INTEGRITY_FAILURE);
+            EBS_Diagnostics_SetDTC(DTC_DUAL_CHANNEL_MISMATCH);
             break;
-            
+    
         default:
             /* Unknown violation */
-            EBS_Diagnostics_SetDTC(DTC_UNKNOWN_SAFETY_VIOLATION);
+            EBS_Diagnostics_SetDTC(DTC_SAFETY_CRITICAL_FAULT);
             break;
     }
     
     /* Activate fault reaction if not already active */
     if (!g_safety_manager.fault_reaction_active) {
         g_safety_manager.fault_reaction_active = true;
-        
-        /* Implement fault reaction based on violation severity */
-        /* This could include disabling non-critical functions, */
-        /* switching to backup systems, or initiating shutdown */
+    }
+}
+
+/**
+ * @brief Validate safety state
+ * @param state Safety state to validate
+ * @return bool True if state is valid
+ */
+static bool Safety_IsStateValid(ebs_safety_state_t state)
+{
+    switch (state) {
+        case SAFETY_STATE_INIT:
+        case SAFETY_STATE_NORMAL:
+        case SAFETY_STATE_WARNING:
+        case SAFETY_STATE_DEGRADED:
+        case SAFETY_STATE_SAFE:
+        case SAFETY_STATE_CRITICAL:
+            return true;
+        default:
+            return false;
     }
 }
 
@@ -576,49 +532,29 @@ static void Safety_HandleSafetyViolation(ebs_safety_violation_t violation)
 static bool Safety_IsSystemInSafeState(void)
 {
     /* System is safe if in operational or degraded state */
-    if (g_safety_manager.current_state == SAFETY_STATE_OPERATIONAL ||
+    if (g_safety_manager.current_state == SAFETY_STATE_NORMAL ||
         g_safety_manager.current_state == SAFETY_STATE_DEGRADED) {
-        
+    
         /* Additional safety checks */
         if (g_safety_manager.memory.corruption_detected) {
             return false;
         }
-        
+    
         if (g_safety_manager.dual_channel.comparison_failures > SAFETY_MAX_DUAL_CHANNEL_FAILURES) {
             return false;
         }
-        
-        return true;
-    }
     
-    return false;
-}
-
-/**
- * @brief Perform graceful system shutdown
- * @return ebs_result_t Shutdown result
- */
-static ebs_result_t Safety_PerformGracefulShutdown(void)
-{
-    /* Set shutdown state */
-    g_safety_manager.previous_state = g_safety_manager.current_state;
-    g_safety_manager.current_state = SAFETY_STATE_SHUTDOWN;
-    
-    /* Disable system functions */
-    g_safety_manager.system_enabled = false;
+        /* Repeated violations of one class */
+        for (uint32_t i = 0; i < (uint32_t)SAFETY_VIOLATION_COUNT; i++) {
+            if (g_safety_manager.fault_counters[i] > SAFETY_MAX_FAULT_COUNT) {
+                return false;
+            }
+        }
     
-    /* Set actuators to safe state */
-    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
-        EBS_Actuators_SetPressure((ebs_wheel_position_t)wheel, 1.0f);  /* Full manual braking */
+        return true;
     }
     
-    /* Log shutdown event */
-    EBS_Diagnostics_LogEvent(DIAG_EVENT_SYSTEM_SHUTDOWN, 0);
-    
-    /* Send shutdown notification via CAN */
-    EBS_Communication_SendShutdownNotification();
-    
-    return EBS_OK;
+    return false;
 }
 
 /**
@@ -643,4 +579,4 @@ static uint32_t Safety_CalculateChecksum(const void* data, size_t length)
     }
     
     return checksum;
-}
\ No newline at end of file
+}
@@ -0,0 +1,284 @@
+/**
+ * @file ebs_scheduler.c
+ * @brief Electronic Braking System - Main Loop Cyclic Executive
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Main loop iteration shared by the target main task and the host
+ * builds (fault campaign, microbenchmarks).
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#include "ebs_scheduler.h"
+#include "ebs_safety.h"
+#include "ebs_abs.h"
+#if (EBS_ENABLE_ESC == 1U)
+#include "ebs_esc.h"
+#endif
+#if (EBS_ENABLE_TCS == 1U)
+#include "ebs_tcs.h"
+#endif
+#include "ebs_sensors.h"
+#include "ebs_actuators.h"
+#include "ebs_communication.h"
+#include "ebs_diagnostics.h"
+#include "ebs_watchdog.h"
+#include "ebs_flow_monitor.h"
+#include <stddef.h>
+
+/* Static Variables */
+static ebs_scheduler_tasks_t g_scheduler_tasks = {
+    EBS_Sensors_ReadAll, EBS_ABS_Control, EBS_Actuators_Update, EBS_Watchdog_Refresh
+};
+static ebs_system_state_t g_system_state = EBS_STATE_INIT;
+static ebs_safety_state_t g_safety_state = SAFETY_STATE_UNKNOWN;
+static uint32_t g_system_tick_counter = 0;
+#if (EBS_ENABLE_ESC == 1U)
+static uint32_t g_esc_counter = 0;
+#endif
+#if (EBS_ENABLE_TCS == 1U)
+static uint32_t g_tcs_counter = 0;
+#endif
+static uint32_t g_comm_counter = 0;
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+static uint32_t g_diag_counter = 0;
+#endif
+
+/* Static Function Prototypes */
+static void Scheduler_SafetyMonitoring(void);
+static void Scheduler_MainControlLoop(void);
+
+/**
+ * @brief Select the cyclic calls (host test seam, before EBS_Scheduler_Init)
+ * @param tasks Calls, NULL members keep the production module
+ */
+void EBS_Scheduler_SetTasks(const ebs_scheduler_tasks_t* tasks)
+{
+    if (tasks == NULL) {
+        return;
+    }
+    
+    g_scheduler_tasks.read_sensors = (tasks->read_sensors != NULL) ?
+                                     tasks->read_sensors : EBS_Sensors_ReadAll;
+    g_scheduler_tasks.abs_control = (tasks->abs_control != NULL) ?
+                                    tasks->abs_control : EBS_ABS_Control;
+    g_scheduler_tasks.update_actuators = (tasks->update_actuators != NULL) ?
+                                         tasks->update_actuators : EBS_Actuators_Update;
+    g_scheduler_tasks.alive = (tasks->alive != NULL) ? tasks->alive : EBS_Watchdog_Refresh;
+}
+
+/**
+ * @brief Reset the system state, tick counter and rate-group counters
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Scheduler_Init(void)
+{
+    g_system_state = EBS_STATE_INIT;
+    g_safety_state = SAFETY_STATE_INIT;
+    g_system_tick_counter = 0;
+#if (EBS_ENABLE_ESC == 1U)
+    g_esc_counter = 0;
+#endif
+#if (EBS_ENABLE_TCS == 1U)
+    g_tcs_counter = 0;
+#endif
+    g_comm_counter = 0;
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+    g_diag_counter = 0;
+#endif
+    
+    return EBS_OK;
+}
+
+/**
+ * @brief Leave initialization after the power-up self-test
+ * @param self_test_passed Self-test verdict (false: safe state)
+ */
+void EBS_Scheduler_Start(bool self_test_passed)
+{
+    if (!self_test_passed) {
+        /* Self-test failed - enter safe state */
+        EBS_Safety_EnterSafeState(SAFETY_FAULT_SELF_TEST_FAILED);
+        g_system_state = EBS_STATE_SAFE_MODE;
+    } else {
+        /* Self-test passed - enter normal operation */
+        g_system_state = EBS_STATE_NORMAL;
+    }
+}
+
+/**
+ * @brief Run one main loop iteration and advance the system tick
+ */
+void EBS_Scheduler_RunCycle(void)
+{
+    /* Refresh watchdog */
+    EBS_Watchdog_Checkpoint(WATCHDOG_MAIN_TASK, WDG_CP_MAIN_CYCLE_START);
+    g_scheduler_tasks.alive(WATCHDOG_MAIN_TASK);
+    
+    /* Safety monitoring (highest priority) */
+    Scheduler_SafetyMonitoring();
+    EBS_Watchdog_Checkpoint(WATCHDOG_MAIN_TASK, WDG_CP_MAIN_SAFETY_DONE);
+    
+    /* Main control loop */
+    if (g_system_state == EBS_STATE_NORMAL) {
+        Scheduler_MainControlLoop();
+        EBS_Watchdog_Checkpoint(WATCHDOG_MAIN_TASK, WDG_CP_MAIN_CONTROL_DONE);
+    }
+    
+    /* Control task supervision follows the system state */
+    EBS_Watchdog_SetMode((g_system_state == EBS_STATE_NORMAL) ? WDG_MODE_CONTROL : WDG_MODE_SAFE);
+    EBS_Watchdog_Checkpoint(WATCHDOG_MAIN_TASK, WDG_CP_MAIN_CYCLE_END);
+    
+    /* Increment system tick counter */
+    g_system_tick_counter++;
+}
+
+/**
+ * @brief Get current system state
+ * @return ebs_system_state_t Current system state
+ */
+ebs_system_state_t EBS_GetSystemState(void)
+{
+    return g_system_state;
+}
+
+/**
+ * @brief Get system tick counter
+ * @return uint32_t Current tick counter value
+ */
+uint32_t EBS_GetSystemTick(void)
+{
+    return g_system_tick_counter;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief Main control loop - executes every 1ms
+ */
+static void Scheduler_MainControlLoop(void)
+{
+    /* Program-flow signature of this cycle (checked by safety monitoring) */
+    EBS_Flow_BeginCycle();
+    
+    /* Read sensor data (every cycle - 1ms) */
+    g_scheduler_tasks.read_sensors();
+    EBS_Flow_Checkpoint(FLOW_CP_SENSORS);
+    
+    /* ABS control (every cycle - 1ms) */
+    g_scheduler_tasks.abs_control();
+    g_scheduler_tasks.alive(WATCHDOG_ABS_TASK);
+    
+#if (EBS_ENABLE_ESC == 1U)
+    /* ESC control (every 5ms) */
+    if (++g_esc_counter >= (EBS_CYCLE_TIME_ESC_MS / EBS_CYCLE_TIME_MS)) {
+        g_esc_counter = 0;
+        EBS_ESC_Control();
+        EBS_Flow_Checkpoint(FLOW_CP_ESC);
+        g_scheduler_tasks.alive(WATCHDOG_ESC_TASK);
+    }
+#endif
+
+#if (EBS_ENABLE_TCS == 1U)
+    /* TCS control (every 10ms) */
+    if (++g_tcs_counter >= (EBS_CYCLE_TIME_TCS_MS / EBS_CYCLE_TIME_MS)) {
+        g_tcs_counter = 0;
+        EBS_TCS_Control();
+        EBS_Flow_Checkpoint(FLOW_CP_TCS);
+        g_scheduler_tasks.alive(WATCHDOG_TCS_TASK);
+    }
+#endif
+    
+    /* Update actuators (every cycle - 1ms) */
+    g_scheduler_tasks.update_actuators();
+    
+    /* Communication tasks (every 10ms) */
+    if (++g_comm_counter >= (EBS_CYCLE_TIME_COMM_MS / EBS_CYCLE_TIME_MS)) {
+        g_comm_counter = 0;
+        EBS_Communication_Process();
+        EBS_Flow_Checkpoint(FLOW_CP_COMMUNICATION);
+        g_scheduler_tasks.alive(WATCHDOG_COMMUNICATION_TASK);
+    }
+    
+#if (EBS_ENABLE_DIAGNOSTICS == 1U)
+    /* Diagnostic tasks (every 100ms) */
+    if (++g_diag_counter >= (EBS_CYCLE_TIME_DIAG_MS / EBS_CYCLE_TIME_MS)) {
+        g_diag_counter = 0;
+        EBS_ABS_ProcessStatistics();
+        EBS_Actuators_ProcessDiagnostics();
+        EBS_Diagnostics_Process();
+        EBS_Flow_Checkpoint(FLOW_CP_DIAGNOSTICS);
+        g_scheduler_tasks.alive(WATCHDOG_DIAGNOSTIC_TASK);
+    }
+#endif
+    
+    EBS_Flow_EndCycle();
+}
+
+/**
+ * @brief Safety monitoring - executes every cycle
+ */
+static void Scheduler_SafetyMonitoring(void)
+{
+    /* Deadline, alive and program-flow supervision (one tick) */
+    if (EBS_Watchdog_MainFunction() == WDG_STATUS_EXPIRED &&
+        g_system_state != EBS_STATE_SAFE_MODE) {
+        EBS_Diagnostics_SetDTC(DTC_WATCHDOG_TIMEOUT);
+        EBS_Safety_EnterSafeState(SAFETY_FAULT_WATCHDOG_TIMEOUT);
+        g_system_state = EBS_STATE_SAFE_MODE;
+    }
+    g_scheduler_tasks.alive(WATCHDOG_SAFETY_TASK);
+    
+    /* Previous control cycle must have run sensors -> ABS -> actuators in order */
+    if (EBS_Flow_Check() == EBS_FAULT && g_system_state != EBS_STATE_SAFE_MODE) {
+        EBS_Diagnostics_SetDTC(DTC_PROGRAM_FLOW_ERROR);
+        EBS_Safety_EnterSafeState(SAFETY_FAULT_PROGRAM_FLOW);
+        g_system_state = EBS_STATE_SAFE_MODE;
+    }
+    
+    /* Check safety state */
+    g_safety_state = EBS_Safety_GetState();
+    
+    /* Handle safety state transitions */
+    switch (g_safety_state) {
+        case SAFETY_STATE_NORMAL:
+            /* Normal operation - no action required */
+            break;
+    
+        case SAFETY_STATE_WARNING:
+            /* Warning state - log event and continue */
+            EBS_Diagnostics_LogEvent(DIAG_EVENT_SAFETY_WARNING, 0);
+            break;
+    
+        case SAFETY_STATE_DEGRADED:
+            /* Degraded state - reduce functionality */
+            g_system_state = EBS_STATE_DEGRADED;
+            EBS_Diagnostics_LogEvent(DIAG_EVENT_SAFETY_DEGRADED, 0);
+            break;
+    
+        case SAFETY_STATE_SAFE:
+            /* Safe state - minimal functionality only */
+            g_system_state = EBS_STATE_SAFE_MODE;
+            EBS_Diagnostics_LogEvent(DIAG_EVENT_SAFETY_SAFE_STATE, 0);
+            break;
+    
+        default:
+            /* Unknown state - enter safe mode */
+            EBS_Safety_EnterSafeState(SAFETY_FAULT_UNKNOWN_STATE);
+            g_system_state = EBS_STATE_SAFE_MODE;
+            break;
+    }
+    
+    /* Monitor system health */
+    EBS_Safety_MonitorSystemHealth();
+    
+    /* Check for critical faults */
+    if (EBS_Safety_HasCriticalFault()) {
+        /* Critical fault detected - immediate safe state */
+        EBS_Safety_EnterSafeState(SAFETY_FAULT_CRITICAL);
+        g_system_state = EBS_STATE_SAFE_MODE;
+    }
+}
@@ -14,12 +14,25 @@
 #include "ebs_sensors.h"
 #include "ebs_safety.h"
 #include "ebs_diagnostics.h"
+#include "ebs_adc_scan.h"
+#include "ebs_imu_fifo.h"
+#include "ebs_filter.h"
 #include <string.h>
 #include <math.h>
 
+/* Sensor Constants (simulated capture: constant 75 km/h) */
+#define SENSORS_SIMULATED_EDGE_PERIOD_US 2000U
+
 /* Static Variables */
 static ebs_sensor_manager_t g_sensor_manager;
 static bool g_sensors_initialized = false;
+static ebs_sensor_sources_t g_sensor_sources = {
+    EBS_Sensors_SimulatedWheelCapture, EBS_AdcScan_SimulatedSource, EBS_ImuFifo_SimulatedSource
+};
+static ebs_adc_scan_group_t g_pressure_scan;
+static ebs_adc_scan_calibration_t g_pressure_scan_cal;
+static ebs_imu_decimator_t g_imu_decimator;
+static ebs_filter_derivative_t g_steering_rate_filter;
 
 /* Static Function Prototypes */
 static ebs_result_t Sensors_InitializeWheelSpeed(void);
@@ -30,12 +43,35 @@ static ebs_result_t Sensors_ReadWheelSpeedSensors(void);
 static ebs_result_t Sensors_ReadPressureSensors(void);
 static ebs_result_t Sensors_ReadIMUSensors(void);
 static ebs_result_t Sensors_ReadSteeringAngleSensor(void);
+static bool Sensors_TrackWheelEdges(ebs_wheel_speed_sensor_t* sensor,
+                                    const ebs_wheel_capture_t* capture, float* speed);
+static float Sensors_EdgeSpeed(const ebs_wheel_speed_sensor_t* sensor, uint32_t pulses,
+                               uint32_t interval_us);
+static void Sensors_DebounceLineFault(uint32_t wheel, bool line_fault);
 static bool Sensors_ValidateWheelSpeed(uint32_t wheel, float speed);
-static bool Sensors_ValidatePressure(uint32_t sensor, float pressure);
 static bool Sensors_ValidateIMUData(const ebs_imu_data_t* imu_data);
 static bool Sensors_ValidateSteeringAngle(float angle);
 static void Sensors_UpdateDiagnostics(void);
 static float Sensors_ApplyCalibration(float raw_value, const ebs_sensor_calibration_t* cal);
+static ebs_sensor_data_t* Sensors_PressureChannel(ebs_pressure_data_t* data, uint32_t sensor);
+
+/**
+ * @brief Select the raw data sources (before EBS_Sensors_Init)
+ * @param sources Sources, NULL members keep the simulated default
+ */
+void EBS_Sensors_SetSources(const ebs_sensor_sources_t* sources)
+{
+    if (sources == NULL) {
+        return;
+    }
+    
+    g_sensor_sources.wheel_capture = (sources->wheel_capture != NULL) ?
+                                     sources->wheel_capture : EBS_Sensors_SimulatedWheelCapture;
+    g_sensor_sources.pressure_adc = (sources->pressure_adc != NULL) ?
+                                    sources->pressure_adc : EBS_AdcScan_SimulatedSource;
+    g_sensor_sources.imu_fifo = (sources->imu_fifo != NULL) ?
+                                sources->imu_fifo : EBS_ImuFifo_SimulatedSource;
+}
 
 /**
  * @brief Initialize sensor subsystem
@@ -97,10 +133,8 @@ bool EBS_Sensors_SelfTest(void)
             test_passed = false;
         }
         
-        /* Test sensor communication */
-        sensor->raw_pulse_count = 100;  /* Simulate test pulse count */
-        float test_speed = (sensor->raw_pulse_count * sensor->wheel_circumference * 3.6f) / 
-                          (sensor->pulses_per_revolution * (EBS_CYCLE_TIME_MS / 1000.0f));
+        /* Test edge interval conversion (one edge per cycle) */
+        float test_speed = Sensors_EdgeSpeed(sensor, 1U, EBS_CYCLE_TIME_MS * 1000U);
         
         if (test_speed <= 0.0f || test_speed > EBS_MAX_WHEEL_SPEED) {
             test_passed = false;
@@ -133,10 +167,10 @@ bool EBS_Sensors_SelfTest(void)
 }
 
 /**
- * @brief Update all sensors (called every cycle)
- * @return ebs_result_t Update result
+ * @brief Read all sensors (called every cycle)
+ * @return ebs_result_t Read result
  */
-ebs_result_t EBS_Sensors_Update(void)
+ebs_result_t EBS_Sensors_ReadAll(void)
 {
     if (!g_sensors_initialized || !g_sensor_manager.system_enabled) {
         return EBS_NOT_INITIALIZED;
@@ -248,14 +282,14 @@ bool EBS_Sensors_IsDataValid(ebs_sensor_type_t sensor_type)
             
         case SENSOR_TYPE_PRESSURE:
             for (uint32_t sensor = 0; sensor < PRESSURE_SENSOR_COUNT; sensor++) {
-                if (!g_sensor_manager.pressure.data.pressure[sensor].valid) {
+                if (!Sensors_PressureChannel(&g_sensor_manager.pressure.data, sensor)->valid) {
                     return false;
                 }
             }
             return true;
             
         case SENSOR_TYPE_IMU:
-            return g_sensor_manager.imu.data.valid;
+            return g_sensor_manager.imu.valid;
             
         case SENSOR_TYPE_STEERING_ANGLE:
             return g_sensor_manager.steering_angle.data.valid;
@@ -278,6 +312,29 @@ const ebs_sensor_diagnostics_t* EBS_Sensors_GetDiagnostics(void)
     return &g_sensor_manager.diagnostics;
 }
 
+/**
+ * @brief Simulated wheel speed capture (constant speed, one read per cycle)
+ * @param wheel Wheel index
+ * @param capture Destination
+ * @return ebs_result_t Read result
+ */
+ebs_result_t EBS_Sensors_SimulatedWheelCapture(uint32_t wheel, ebs_wheel_capture_t* capture)
+{
+    static uint32_t simulated_time_us[WHEEL_COUNT] = {0U};
+    
+    if (wheel >= WHEEL_COUNT || capture == NULL) {
+        return EBS_INVALID_PARAM;
+    }
+    
+    /* In real implementation, this would read the input capture timer */
+    simulated_time_us[wheel] += EBS_CYCLE_TIME_MS * 1000U;
+    capture->pulse_count = simulated_time_us[wheel] / SENSORS_SIMULATED_EDGE_PERIOD_US;
+    capture->edge_time_us = capture->pulse_count * SENSORS_SIMULATED_EDGE_PERIOD_US;
+    capture->capture_time_us = simulated_time_us[wheel];
+    
+    return EBS_OK;
+}
+
 /* Static Function Implementations */
 
 /**
@@ -300,6 +357,9 @@ static ebs_result_t Sensors_InitializeWheelSpeed(void)
         sensor->raw_pulse_count = 0;
         sensor->previous_pulse_count = 0;
         sensor->pulse_time_us = 0;
+        sensor->capture_state = WHEEL_CAPTURE_UNSYNCED;
+        sensor->edge_speed = 0.0f;
+        sensor->line_fault_ms = 0;
         
         /* Set calibration parameters */
         sensor->calibration.offset = 0.0f;
@@ -313,7 +373,7 @@ static ebs_result_t Sensors_InitializeWheelSpeed(void)
         ws_mgr->data.speed[wheel].timestamp = EBS_GetSystemTick();
     }
     
-    ws_mgr->data.timestamp = EBS_GetSystemTick();
+    ws_mgr->timestamp = EBS_GetSystemTick();
     
     return EBS_OK;
 }
@@ -325,6 +385,7 @@ static ebs_result_t Sensors_InitializeWheelSpeed(void)
 static ebs_result_t Sensors_InitializePressure(void)
 {
     ebs_pressure_manager_t* press_mgr = &g_sensor_manager.pressure;
+    uint8_t scan_channels[PRESSURE_SENSOR_COUNT];
     
     /* Initialize each pressure sensor */
     for (uint32_t sensor = 0; sensor < PRESSURE_SENSOR_COUNT; sensor++) {
@@ -344,14 +405,24 @@ static ebs_result_t Sensors_InitializePressure(void)
         press_sensor->calibration.max_value = PRESSURE_SENSOR_MAX_BAR;
         
         /* Initialize data */
-        press_mgr->data.pressure[sensor].value = 0.0f;
-        press_mgr->data.pressure[sensor].valid = false;
-        press_mgr->data.pressure[sensor].timestamp = EBS_GetSystemTick();
+        ebs_sensor_data_t* channel = Sensors_PressureChannel(&press_mgr->data, sensor);
+        channel->value = 0.0f;
+        channel->valid = false;
+        channel->timestamp = EBS_GetSystemTick();
+        
+        /* Mirror calibration into the scan group's batch layout */
+        scan_channels[sensor] = (uint8_t)(EBS_PRESSURE_ADC_FIRST_CH + sensor);
+        g_pressure_scan_cal.offset[sensor] = press_sensor->calibration.offset;
+        g_pressure_scan_cal.scale[sensor] = press_sensor->calibration.scale;
+        g_pressure_scan_cal.min_value[sensor] = press_sensor->calibration.min_value;
+        g_pressure_scan_cal.max_value[sensor] = press_sensor->calibration.max_value;
     }
     
-    press_mgr->data.timestamp = EBS_GetSystemTick();
+    press_mgr->timestamp = EBS_GetSystemTick();
     
-    return EBS_OK;
+    /* All pressure channels are sampled together as one scan group */
+    return EBS_AdcScan_Init(&g_pressure_scan, scan_channels, PRESSURE_SENSOR_COUNT,
+                            EBS_PRESSURE_OVERSAMPLE_SHIFT, g_sensor_sources.pressure_adc);
 }
 
 /**
@@ -373,8 +444,8 @@ static ebs_result_t Sensors_InitializeIMU(void)
     /* Set calibration parameters */
     imu_sensor->accel_calibration.offset = 0.0f;
     imu_sensor->accel_calibration.scale = 1.0f;
-    imu_sensor->accel_calibration.min_value = -IMU_ACCEL_RANGE_G;
-    imu_sensor->accel_calibration.max_value = IMU_ACCEL_RANGE_G;
+    imu_sensor->accel_calibration.min_value = -IMU_ACCEL_RANGE_MS2;
+    imu_sensor->accel_calibration.max_value = IMU_ACCEL_RANGE_MS2;
     
     imu_sensor->gyro_calibration.offset = 0.0f;
     imu_sensor->gyro_calibration.scale = 1.0f;
@@ -383,10 +454,14 @@ static ebs_result_t Sensors_InitializeIMU(void)
     
     /* Initialize data */
     memset(&imu_mgr->data, 0, sizeof(imu_mgr->data));
-    imu_mgr->data.valid = false;
-    imu_mgr->data.timestamp = EBS_GetSystemTick();
-    
-    return EBS_OK;
+    imu_mgr->valid = false;
+    imu_mgr->timestamp = EBS_GetSystemTick();
+    
+    /* FIFO frames are calibrated inside the decimator's lane pass, accel to m/s² */
+    return EBS_ImuFifo_Init(&g_imu_decimator,
+                            imu_sensor->accel_calibration.scale * IMU_ACCEL_MS2_PER_LSB,
+                            imu_sensor->gyro_calibration.scale / IMU_FIFO_GYRO_LSB_PER_DPS,
+                            g_sensor_sources.imu_fifo);
 }
 
 /**
@@ -418,7 +493,8 @@ static ebs_result_t Sensors_InitializeSteeringAngle(void)
     sa_mgr->data.valid = false;
     sa_mgr->data.timestamp = EBS_GetSystemTick();
     
-    return EBS_OK;
+    /* Angular velocity is the unsmoothed derivative of the angle */
+    return EBS_Filter_DerivativeInit(&g_steering_rate_filter, EBS_CYCLE_TIME_MS / 1000.0f, 1.0f, 1U);
 }
 
 /**
@@ -438,21 +514,21 @@ static ebs_result_t Sensors_ReadWheelSpeedSensors(void)
             continue;
         }
         
-        /* Simulate reading pulse count from hardware */
-        /* In real implementation, this would read from hardware registers */
-        static uint32_t simulated_pulse_count[WHEEL_COUNT] = {0};
-        simulated_pulse_count[wheel] += 10;  /* Simulate 10 pulses per cycle */
-        sensor->raw_pulse_count = simulated_pulse_count[wheel];
+        ebs_wheel_capture_t capture;
+        bool line_fault = g_sensor_sources.wheel_capture(wheel, &capture) != EBS_OK;
+        float raw_speed = 0.0f;
         
-        /* Calculate speed from pulse count */
-        uint32_t pulse_diff = sensor->raw_pulse_count - sensor->previous_pulse_count;
-        float time_diff_s = EBS_CYCLE_TIME_MS / 1000.0f;
+        Sensors_DebounceLineFault(wheel, line_fault);
         
-        if (time_diff_s > 0.0f && pulse_diff > 0) {
-            /* Speed = (pulses * circumference * 3.6) / (pulses_per_rev * time_in_seconds) */
-            float raw_speed = (pulse_diff * sensor->wheel_circumference * 3.6f) / 
-                             (sensor->pulses_per_revolution * time_diff_s);
-            
+        if (line_fault) {
+            /* Open or shorted line: edges are lost, resynchronize afterwards */
+            sensor->capture_state = WHEEL_CAPTURE_UNSYNCED;
+            ws_mgr->data.speed[wheel].valid = false;
+            sensor->fault_detected = true;
+        } else if (!Sensors_TrackWheelEdges(sensor, &capture, &raw_speed)) {
+            /* No edge interval since synchronization */
+            ws_mgr->data.speed[wheel].valid = false;
+        } else {
             /* Apply calibration */
             float calibrated_speed = Sensors_ApplyCalibration(raw_speed, &sensor->calibration);
             
@@ -465,18 +541,12 @@ static ebs_result_t Sensors_ReadWheelSpeedSensors(void)
                 ws_mgr->data.speed[wheel].valid = false;
                 sensor->fault_detected = true;
             }
-        } else {
-            /* No movement detected */
-            ws_mgr->data.speed[wheel].value = 0.0f;
-            ws_mgr->data.speed[wheel].valid = true;
-            sensor->fault_detected = false;
         }
         
         ws_mgr->data.speed[wheel].timestamp = current_time;
-        sensor->previous_pulse_count = sensor->raw_pulse_count;
     }
     
-    ws_mgr->data.timestamp = current_time;
+    ws_mgr->timestamp = current_time;
     
     return EBS_OK;
 }
@@ -490,37 +560,40 @@ static ebs_result_t Sensors_ReadPressureSensors(void)
     ebs_pressure_manager_t* press_mgr = &g_sensor_manager.pressure;
     uint32_t current_time = EBS_GetSystemTick();
     
+    /* Burst-convert all channels (oversampled) into the scan buffer */
+    if (EBS_AdcScan_Trigger(&g_pressure_scan) != EBS_OK) {
+        return EBS_ERROR;
+    }
+    
+    /* Decimation, calibration and range check as one pass over the group */
+    if (EBS_AdcScan_Process(&g_pressure_scan, &g_pressure_scan_cal) != EBS_OK) {
+        return EBS_ERROR;
+    }
+    
     for (uint32_t sensor = 0; sensor < PRESSURE_SENSOR_COUNT; sensor++) {
         ebs_pressure_sensor_t* press_sensor = &press_mgr->sensors[sensor];
+        ebs_sensor_data_t* channel = Sensors_PressureChannel(&press_mgr->data, sensor);
         
         if (!press_sensor->enabled) {
-            press_mgr->data.pressure[sensor].valid = false;
+            channel->valid = false;
             continue;
         }
         
-        /* Simulate reading ADC value from hardware */
-        /* In real implementation, this would read from ADC */
-        static uint16_t simulated_adc[PRESSURE_SENSOR_COUNT] = {2048, 2048, 2048, 2048};  /* Mid-range values */
-        press_sensor->raw_adc_value = simulated_adc[sensor];
-        
-        /* Convert ADC value to pressure */
-        float raw_pressure = Sensors_ApplyCalibration((float)press_sensor->raw_adc_value, 
-                                                     &press_sensor->calibration);
+        press_sensor->raw_adc_value = g_pressure_scan.raw[sensor];
         
-        /* Validate pressure */
-        if (Sensors_ValidatePressure(sensor, raw_pressure)) {
-            press_mgr->data.pressure[sensor].value = raw_pressure;
-            press_mgr->data.pressure[sensor].valid = true;
+        if (ADC_SCAN_IS_CHANNEL_VALID(&g_pressure_scan, sensor)) {
+            channel->value = g_pressure_scan.value[sensor];
+            channel->valid = true;
             press_sensor->fault_detected = false;
         } else {
-            press_mgr->data.pressure[sensor].valid = false;
+            channel->valid = false;
             press_sensor->fault_detected = true;
         }
         
-        press_mgr->data.pressure[sensor].timestamp = current_time;
+        channel->timestamp = current_time;
     }
     
-    press_mgr->data.timestamp = current_time;
+    press_mgr->timestamp = current_time;
     
     return EBS_OK;
 }
@@ -536,48 +609,30 @@ static ebs_result_t Sensors_ReadIMUSensors(void)
     uint32_t current_time = EBS_GetSystemTick();
     
     if (!imu_sensor->enabled) {
-        imu_mgr->data.valid = false;
+        imu_mgr->valid = false;
         return EBS_OK;
     }
     
-    /* Simulate reading IMU data from hardware */
-    /* In real implementation, this would read from IMU via SPI/I2C */
-    
-    /* Simulate accelerometer data (in g) */
-    imu_mgr->data.acceleration.x = 0.0f;  /* Longitudinal acceleration */
-    imu_mgr->data.acceleration.y = 0.0f;  /* Lateral acceleration */
-    imu_mgr->data.acceleration.z = 1.0f;  /* Vertical acceleration (gravity) */
-    
-    /* Simulate gyroscope data (in deg/s) */
-    imu_mgr->data.angular_velocity.x = 0.0f;  /* Roll rate */
-    imu_mgr->data.angular_velocity.y = 0.0f;  /* Pitch rate */
-    imu_mgr->data.angular_velocity.z = 0.0f;  /* Yaw rate */
-    
-    /* Apply calibration */
-    imu_mgr->data.acceleration.x = Sensors_ApplyCalibration(imu_mgr->data.acceleration.x, 
-                                                           &imu_sensor->accel_calibration);
-    imu_mgr->data.acceleration.y = Sensors_ApplyCalibration(imu_mgr->data.acceleration.y, 
-                                                           &imu_sensor->accel_calibration);
-    imu_mgr->data.acceleration.z = Sensors_ApplyCalibration(imu_mgr->data.acceleration.z, 
-                                                           &imu_sensor->accel_calibration);
+    /* Drain the IMU FIFO (IMU_FIFO_ODR_HZ) and decimate to the 1 kHz loop */
+    if (EBS_ImuFifo_Service(&g_imu_decimator) != EBS_OK) {
+        imu_mgr->valid = false;
+        imu_sensor->fault_detected = true;
+        return EBS_OK;
+    }
     
-    imu_mgr->data.angular_velocity.x = Sensors_ApplyCalibration(imu_mgr->data.angular_velocity.x, 
-                                                               &imu_sensor->gyro_calibration);
-    imu_mgr->data.angular_velocity.y = Sensors_ApplyCalibration(imu_mgr->data.angular_velocity.y, 
-                                                               &imu_sensor->gyro_calibration);
-    imu_mgr->data.angular_velocity.z = Sensors_ApplyCalibration(imu_mgr->data.angular_velocity.z, 
-                                                               &imu_sensor->gyro_calibration);
+    /* Longitudinal/lateral acceleration and yaw rate of the latest sample */
+    EBS_ImuFifo_GetImuData(&g_imu_decimator, &imu_mgr->data, current_time);
     
     /* Validate IMU data */
     if (Sensors_ValidateIMUData(&imu_mgr->data)) {
-        imu_mgr->data.valid = true;
+        imu_mgr->valid = true;
         imu_sensor->fault_detected = false;
     } else {
-        imu_mgr->data.valid = false;
+        imu_mgr->valid = false;
         imu_sensor->fault_detected = true;
     }
     
-    imu_mgr->data.timestamp = current_time;
+    imu_mgr->timestamp = current_time;
     
     return EBS_OK;
 }
@@ -607,13 +662,7 @@ static ebs_result_t Sensors_ReadSteeringAngleSensor(void)
                                               &sa_sensor->calibration);
     
     /* Calculate angular velocity */
-    static float previous_angle = 0.0f;
-    float time_diff_s = EBS_CYCLE_TIME_MS / 1000.0f;
-    float angular_velocity = 0.0f;
-    
-    if (time_diff_s > 0.0f) {
-        angular_velocity = (raw_angle - previous_angle) / time_diff_s;
-    }
+    float angular_velocity = EBS_Filter_DerivativeUpdate(&g_steering_rate_filter, 0U, raw_angle);
     
     /* Validate steering angle */
     if (Sensors_ValidateSteeringAngle(raw_angle)) {
@@ -627,11 +676,91 @@ static ebs_result_t Sensors_ReadSteeringAngleSensor(void)
     }
     
     sa_mgr->data.timestamp = current_time;
-    previous_angle = raw_angle;
     
     return EBS_OK;
 }
 
+/**
+ * @brief Edge-interval wheel speed from the latest capture
+ *
+ * Speed is measured over the time between edges rather than counted per
+ * cycle, so it stays resolved when fewer than one edge arrives per cycle.
+ * Without a new edge the last interval speed is held, bounded by one
+ * edge spacing over the time since the reference edge so that a locking
+ * wheel decays towards zero.
+ *
+ * @param sensor Wheel speed sensor
+ * @param capture Latest capture
+ * @param speed Uncalibrated speed in km/h
+ * @return bool False if no edge interval has been measured yet
+ */
+static bool Sensors_TrackWheelEdges(ebs_wheel_speed_sensor_t* sensor,
+                                    const ebs_wheel_capture_t* capture, float* speed)
+{
+    uint32_t pulses = capture->pulse_count - sensor->previous_pulse_count;
+    
+    sensor->raw_pulse_count = capture->pulse_count;
+    
+    if (sensor->capture_state == WHEEL_CAPTURE_UNSYNCED) {
+        sensor->capture_state = WHEEL_CAPTURE_REFERENCE;
+    } else if (pulses > 0U) {
+        sensor->edge_speed = Sensors_EdgeSpeed(sensor, pulses,
+                                               capture->edge_time_us - sensor->pulse_time_us);
+        sensor->capture_state = WHEEL_CAPTURE_TRACKING;
+    } else if (sensor->capture_state == WHEEL_CAPTURE_TRACKING) {
+        *speed = EBS_MIN(sensor->edge_speed,
+                         Sensors_EdgeSpeed(sensor, 1U, capture->capture_time_us - sensor->pulse_time_us));
+        return true;
+    } else {
+        return false;
+    }
+    
+    sensor->previous_pulse_count = capture->pulse_count;
+    sensor->pulse_time_us = capture->edge_time_us;
+    *speed = sensor->edge_speed;
+    
+    return sensor->capture_state == WHEEL_CAPTURE_TRACKING;
+}
+
+/**
+ * @brief Wheel speed of an edge interval
+ * @param sensor Wheel speed sensor
+ * @param pulses Edges in the interval
+ * @param interval_us Interval length
+ * @return float Speed in km/h
+ */
+static float Sensors_EdgeSpeed(const ebs_wheel_speed_sensor_t* sensor, uint32_t pulses,
+                               uint32_t interval_us)
+{
+    if (interval_us == 0U) {
+        return EBS_MAX_WHEEL_SPEED;
+    }
+    
+    /* Speed = (pulses * circumference * 3.6) / (pulses_per_rev * time_in_seconds) */
+    return ((float)pulses * sensor->wheel_circumference * 3.6f) /
+           ((float)sensor->pulses_per_revolution * ((float)interval_us * 1.0e-6f));
+}
+
+/**
+ * @brief Debounce the line fault of a wheel speed sensor into its DTC
+ * @param wheel Wheel index
+ * @param line_fault Capture reported an open or shorted line this cycle
+ */
+static void Sensors_DebounceLineFault(uint32_t wheel, bool line_fault)
+{
+    ebs_wheel_speed_sensor_t* sensor = &g_sensor_manager.wheel_speed.sensors[wheel];
+    
+    if (!line_fault) {
+        sensor->line_fault_ms = 0;
+        return;
+    }
+    
+    sensor->line_fault_ms += EBS_CYCLE_TIME_MS;
+    if (sensor->line_fault_ms == WHEEL_SPEED_LINE_FAULT_DEBOUNCE_MS) {
+        EBS_Diagnostics_SetDTC((ebs_dtc_code_t)(DTC_WHEEL_SPEED_SENSOR_FL + wheel));
+    }
+}
+
 /**
  * @brief Validate wheel speed reading
  * @param wheel Wheel index
@@ -649,12 +778,12 @@ static bool Sensors_ValidateWheelSpeed(uint32_t wheel, float speed)
         return false;
     }
     
-    /* Rate of change check */
+    /* Rate of change check against the previous valid reading */
     static float previous_speeds[WHEEL_COUNT] = {0.0f};
     float speed_change = fabs(speed - previous_speeds[wheel]);
     float max_change = MAX_WHEEL_SPEED_CHANGE_PER_CYCLE;
     
-    if (speed_change > max_change) {
+    if (g_sensor_manager.wheel_speed.data.speed[wheel].valid && speed_change > max_change) {
         return false;  /* Speed changed too rapidly */
     }
     
@@ -663,26 +792,6 @@ static bool Sensors_ValidateWheelSpeed(uint32_t wheel, float speed)
     return true;
 }
 
-/**
- * @brief Validate pressure reading
- * @param sensor Sensor index
- * @param pressure Pressure value to validate
- * @return bool True if valid
- */
-static bool Sensors_ValidatePressure(uint32_t sensor, float pressure)
-{
-    if (sensor >= PRESSURE_SENSOR_COUNT) {
-        return false;
-    }
-    
-    /* Range check */
-    if (pressure < PRESSURE_SENSOR_MIN_BAR || pressure > PRESSURE_SENSOR_MAX_BAR) {
-        return false;
-    }
-    
-    return true;
-}
-
 /**
  * @brief Validate IMU data
  * @param imu_data IMU data to validate
@@ -695,16 +804,13 @@ static bool Sensors_ValidateIMUData(const ebs_imu_data_t* imu_data)
     }
     
     /* Check acceleration ranges */
-    if (fabs(imu_data->acceleration.x) > IMU_ACCEL_RANGE_G ||
-        fabs(imu_data->acceleration.y) > IMU_ACCEL_RANGE_G ||
-        fabs(imu_data->acceleration.z) > IMU_ACCEL_RANGE_G) {
+    if (fabsf(imu_data->longitudinal_accel.value) > IMU_ACCEL_RANGE_MS2 ||
+        fabsf(imu_data->lateral_accel.value) > IMU_ACCEL_RANGE_MS2) {
         return false;
     }
     
-    /* Check angular velocity ranges */
-    if (fabs(imu_data->angular_velocity.x) > IMU_GYRO_RANGE_DPS ||
-        fabs(imu_data->angular_velocity.y) > IMU_GYRO_RANGE_DPS ||
-        fabs(imu_data->angular_velocity.z) > IMU_GYRO_RANGE_DPS) {
+    /* Check angular velocity range */
+    if (fabsf(imu_data->yaw_rate.value) > IMU_GYRO_RANGE_DPS) {
         return false;
     }
     
@@ -786,4 +892,15 @@ static float Sensors_ApplyCalibration(float raw_value, const ebs_sensor_calibrat
     }
     
     return calibrated_value;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Map a pressure sensor index onto the published pressure data
+ * @param data Pressure data
+ * @param sensor Sensor index (0: master cylinder, 1..WHEEL_COUNT: wheels)
+ * @return ebs_sensor_data_t* Channel data
+ */
+static ebs_sensor_data_t* Sensors_PressureChannel(ebs_pressure_data_t* data, uint32_t sensor)
+{
+    return (sensor == 0U) ? &data->master_cylinder : &data->wheel_pressure[sensor - 1U];
+}
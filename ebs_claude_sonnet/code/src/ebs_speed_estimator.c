@@ -0,0 +1,188 @@
+/**
+ * @file ebs_speed_estimator.c
+ * @brief Electronic Braking System - Vehicle Reference Speed Estimator
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * State x = [speed, bias], prediction speed += (accel - bias) * dt.
+ * Each accepted wheel is applied as a sequential scalar update with
+ * H = [1 0]. Cost is bounded by WHEEL_COUNT updates and no state is
+ * allocated outside the caller-owned estimator object.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#include "ebs_speed_estimator.h"
+#include <string.h>
+
+/* Static Function Prototypes */
+static void SpeedEst_Predict(ebs_speed_estimator_t* est, float accel, bool accel_valid);
+static bool SpeedEst_Correct(ebs_speed_estimator_t* est, float measurement);
+static bool SpeedEst_Seed(ebs_speed_estimator_t* est, const float* wheel_speeds,
+                          uint32_t valid_mask);
+
+/**
+ * @brief Initialize the estimator
+ * @param est Estimator state
+ * @param dt_s Step period in seconds
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_SpeedEst_Init(ebs_speed_estimator_t* est, float dt_s)
+{
+    if (est == NULL || dt_s <= 0.0f) {
+        return EBS_INVALID_PARAM;
+    }
+
+    memset(est, 0, sizeof(*est));
+    est->dt = dt_s;
+    est->p00 = SPEED_EST_R_WHEEL;
+    est->p11 = SPEED_EST_P0_BIAS;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Run one predict/correct step
+ * @param est Estimator state
+ * @param accel Longitudinal acceleration (m/s², forward positive)
+ * @param accel_valid Acceleration is usable
+ * @param wheel_speeds Wheel speeds (km/h), WHEEL_COUNT entries
+ * @param valid_mask Bit per wheel whose speed is valid
+ * @return float Reference speed in km/h
+ */
+float EBS_SpeedEst_Step(ebs_speed_estimator_t* est, float accel, bool accel_valid,
+                        const float* wheel_speeds, uint32_t valid_mask)
+{
+    if (est == NULL || wheel_speeds == NULL) {
+        return 0.0f;
+    }
+
+    if (!est->initialized) {
+        /* Hold at zero until a wheel speed is available to seed from */
+        est->initialized = SpeedEst_Seed(est, wheel_speeds, valid_mask);
+        return EBS_SpeedEst_GetSpeed(est);
+    }
+
+    SpeedEst_Predict(est, accel, accel_valid);
+
+    /* Wheels outside the gate are slipping or spinning - not a reference */
+    uint32_t accepted = 0U;
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        if ((valid_mask & (1UL << wheel)) != 0U &&
+            SpeedEst_Correct(est, wheel_speeds[wheel] / 3.6f)) {
+            accepted |= 1UL << wheel;
+        }
+    }
+
+    est->accepted_mask = (uint8_t)accepted;
+    if (accepted == 0U) {
+        /* Widen the gate while coasting so recovered wheels are reacquired */
+        est->p00 += SPEED_EST_Q_COAST;
+        est->coast_cycles++;
+    } else {
+        est->coast_cycles = 0U;
+    }
+
+    est->speed = EBS_MAX(est->speed, 0.0f);
+    est->bias = EBS_CLAMP(est->bias, -SPEED_EST_MAX_BIAS, SPEED_EST_MAX_BIAS);
+
+    return EBS_SpeedEst_GetSpeed(est);
+}
+
+/**
+ * @brief Get the current reference speed
+ * @param est Estimator state
+ * @return float Reference speed in km/h
+ */
+float EBS_SpeedEst_GetSpeed(const ebs_speed_estimator_t* est)
+{
+    if (est == NULL) {
+        return 0.0f;
+    }
+
+    return est->speed * 3.6f;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief Time update: P = F P F' + Q with F = [1 -dt; 0 1]
+ * @param est Estimator state
+ * @param accel Measured acceleration
+ * @param accel_valid Acceleration is usable
+ */
+static void SpeedEst_Predict(ebs_speed_estimator_t* est, float accel, bool accel_valid)
+{
+    const float dt = est->dt;
+
+    if (accel_valid) {
+        est->speed += (accel - est->bias) * dt;
+
+        est->p00 += dt * (dt * est->p11 - 2.0f * est->p01) + SPEED_EST_Q_SPEED;
+        est->p01 -= dt * est->p11;
+        est->p11 += SPEED_EST_Q_BIAS;
+    } else {
+        /* Without IMU the model degrades to a random walk on speed */
+        est->p00 += SPEED_EST_Q_NO_IMU;
+    }
+}
+
+/**
+ * @brief Gated scalar measurement update with H = [1 0]
+ * @param est Estimator state
+ * @param measurement Wheel speed (m/s)
+ * @return bool True if the measurement passed the gate and was applied
+ */
+static bool SpeedEst_Correct(ebs_speed_estimator_t* est, float measurement)
+{
+    const float innovation = measurement - est->speed;
+    const float s = est->p00 + SPEED_EST_R_WHEEL;
+    const float gate = EBS_MAX(SPEED_EST_GATE_SIGMA * SPEED_EST_GATE_SIGMA * s,
+                               SPEED_EST_GATE_MIN_MS * SPEED_EST_GATE_MIN_MS);
+
+    if ((innovation * innovation) > gate) {
+        return false;
+    }
+
+    const float k0 = est->p00 / s;
+    const float k1 = est->p01 / s;
+
+    est->speed += k0 * innovation;
+    est->bias += k1 * innovation;
+
+    est->p11 -= k1 * est->p01;
+    est->p01 *= (1.0f - k0);
+    est->p00 *= (1.0f - k0);
+
+    return true;
+}
+
+/**
+ * @brief Seed speed from the fastest valid wheel
+ * @param est Estimator state
+ * @param wheel_speeds Wheel speeds (km/h)
+ * @param valid_mask Bit per valid wheel
+ * @return bool True if a valid wheel was found
+ */
+static bool SpeedEst_Seed(ebs_speed_estimator_t* est, const float* wheel_speeds,
+                          uint32_t valid_mask)
+{
+    bool found = false;
+    float max_speed = 0.0f;
+
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        if ((valid_mask & (1UL << wheel)) != 0U) {
+            max_speed = EBS_MAX(max_speed, wheel_speeds[wheel]);
+            found = true;
+        }
+    }
+
+    if (found) {
+        est->speed = max_speed / 3.6f;
+        est->accepted_mask = (uint8_t)valid_mask;
+    }
+
+    return found;
+}
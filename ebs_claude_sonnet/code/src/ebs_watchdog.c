@@ -0,0 +1,492 @@
+/**
+ * @file ebs_watchdog.c
+ * @brief Electronic Braking System - Watchdog Supervision Implementation
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Every active entity owns two timers: its refresh deadline and the end
+ * of its alive reference cycle. Timers live on intrusive lists in a
+ * two-level wheel (1 tick and WDG_WHEEL_SLOTS tick resolution). A tick
+ * fires the current level-0 slot; once per WDG_WHEEL_SLOTS ticks one
+ * level-1 slot is cascaded down. Only expiring timers are ever visited.
+ *
+ * Safety Level: ASIL-D
+ * Compliance: ISO 26262, MISRA C:2012
+ */
+
+#include "ebs_watchdog.h"
+#include <string.h>
+
+/* Watchdog Macros */
+#define WDG_TIMER_COUNT         ((uint32_t)WATCHDOG_COUNT * 2U)
+#define WDG_TIMER_NONE          0xFFU
+#define WDG_SLOT_MASK           (WDG_WHEEL_SLOTS - 1U)
+#define WDG_TIMER_ENTITY(t)     ((ebs_watchdog_type_t)((t) >> 1))
+#define WDG_TIMER_IS_ALIVE(t)   (((t) & 1U) != 0U)
+#define WDG_DEADLINE_TIMER(e)   ((uint8_t)((uint32_t)(e) << 1))
+#define WDG_ALIVE_TIMER(e)      ((uint8_t)(((uint32_t)(e) << 1) | 1U))
+#define WDG_CP_BIT(cp)          (1UL << (uint32_t)(cp))
+#define WDG_CP_NONE             0xFFU
+
+/* Program-flow graph: allowed successors of each checkpoint */
+typedef struct {
+    uint32_t initial_mask;                  /* Checkpoints that may come first */
+    uint32_t successors[WDG_MAX_CHECKPOINTS];
+} wdg_flow_config_t;
+
+/* Static supervision configuration of one entity */
+typedef struct {
+    uint32_t deadline_ticks;                /* Maximum refresh gap (0: none) */
+    uint32_t reference_ticks;               /* Alive reference cycle (0: none) */
+    uint32_t expected_alive;                /* Indications per reference cycle */
+    uint32_t min_margin;                    /* Tolerated shortfall */
+    uint32_t max_margin;                    /* Tolerated excess */
+    uint32_t failed_tolerance;              /* Failed cycles before EXPIRED */
+    const wdg_flow_config_t* flow;          /* Program flow (NULL: none) */
+} wdg_entity_config_t;
+
+/* Wheel timer */
+typedef struct {
+    uint32_t expiry;                        /* Absolute tick */
+    uint8_t next;
+    uint8_t prev;
+    uint8_t* head;                          /* Slot list holding the timer, NULL if idle */
+} wdg_timer_t;
+
+/* Runtime state of one entity */
+typedef struct {
+    ebs_wdg_entity_status_t status;
+    uint32_t alive_count;                   /* Indications in the running cycle */
+    uint32_t failed_cycles;                 /* Consecutive failed reference cycles */
+    uint8_t last_checkpoint;
+} wdg_entity_t;
+
+/* Main task: start -> safety -> [control] -> end -> start */
+static const wdg_flow_config_t g_wdg_main_flow = {
+    WDG_CP_BIT(WDG_CP_MAIN_CYCLE_START),
+    {
+        [WDG_CP_MAIN_CYCLE_START]  = WDG_CP_BIT(WDG_CP_MAIN_SAFETY_DONE),
+        [WDG_CP_MAIN_SAFETY_DONE]  = WDG_CP_BIT(WDG_CP_MAIN_CONTROL_DONE) |
+                                     WDG_CP_BIT(WDG_CP_MAIN_CYCLE_END),
+        [WDG_CP_MAIN_CONTROL_DONE] = WDG_CP_BIT(WDG_CP_MAIN_CYCLE_END),
+        [WDG_CP_MAIN_CYCLE_END]    = WDG_CP_BIT(WDG_CP_MAIN_CYCLE_START)
+    }
+};
+
+/* Deadlines leave one period of jitter above the scheduling rate */
+static const wdg_entity_config_t g_wdg_config[WATCHDOG_COUNT] = {
+    /*                           deadline ref  alive min max tol flow */
+    [WATCHDOG_MAIN_TASK]          = {   5U,  100U, 100U, 5U, 5U, 1U, &g_wdg_main_flow },
+    [WATCHDOG_SAFETY_TASK]        = {   5U,  100U, 100U, 5U, 5U, 1U, NULL },
+    [WATCHDOG_ABS_TASK]           = {   5U,  100U, 100U, 5U, 5U, 1U, NULL },
+    [WATCHDOG_ESC_TASK]           = {  15U,  100U,  20U, 2U, 2U, 1U, NULL },
+    [WATCHDOG_TCS_TASK]           = {  30U,  100U,  10U, 1U, 1U, 1U, NULL },
+    [WATCHDOG_COMMUNICATION_TASK] = {  30U,  100U,  10U, 1U, 1U, 1U, NULL },
+    [WATCHDOG_DIAGNOSTIC_TASK]    = { 250U, 1000U,  10U, 1U, 1U, 0U, NULL },
+    [WATCHDOG_EMERGENCY]          = {   0U,    0U,   0U, 0U, 0U, 0U, NULL },
+    [WATCHDOG_SHUTDOWN]           = {   0U,    0U,   0U, 0U, 0U, 0U, NULL }
+};
+
+/* Active entities per mode */
+static const uint32_t g_wdg_mode_entities[WDG_MODE_COUNT] = {
+    [WDG_MODE_STARTUP] = WDG_ENTITY_BIT(WATCHDOG_MAIN_TASK),
+    [WDG_MODE_CONTROL] = WDG_CONTROL_ENTITIES,
+    [WDG_MODE_SAFE]    = WDG_ENTITY_BIT(WATCHDOG_MAIN_TASK) |
+                         WDG_ENTITY_BIT(WATCHDOG_SAFETY_TASK)
+};
+
+/* Static Variables */
+static uint8_t g_wdg_wheel[2][WDG_WHEEL_SLOTS];
+static wdg_timer_t g_wdg_timers[WDG_TIMER_COUNT];
+static wdg_entity_t g_wdg_entities[WATCHDOG_COUNT];
+static uint32_t g_wdg_now = 0U;
+static uint32_t g_wdg_active_mask = 0U;
+static uint32_t g_wdg_failed_mask = 0U;     /* Active entities FAILED */
+static uint32_t g_wdg_expired_mask = 0U;    /* Active entities EXPIRED */
+static ebs_wdg_mode_t g_wdg_mode = WDG_MODE_STARTUP;
+static bool g_wdg_initialized = false;
+
+/* Static Function Prototypes */
+static void Watchdog_TimerStart(uint8_t timer, uint32_t expiry);
+static void Watchdog_TimerStop(uint8_t timer);
+static void Watchdog_Cascade(void);
+static void Watchdog_Expire(uint8_t timer);
+static void Watchdog_CheckAlive(ebs_watchdog_type_t entity);
+static void Watchdog_SetStatus(ebs_watchdog_type_t entity, ebs_wdg_status_t status);
+static void Watchdog_Activate(ebs_watchdog_type_t entity);
+static void Watchdog_Deactivate(ebs_watchdog_type_t entity);
+
+/**
+ * @brief Initialize supervision in WDG_MODE_STARTUP
+ * @return ebs_result_t Initialization result
+ */
+ebs_result_t EBS_Watchdog_Init(void)
+{
+    memset(g_wdg_wheel, WDG_TIMER_NONE, sizeof(g_wdg_wheel));
+    memset(g_wdg_timers, 0, sizeof(g_wdg_timers));
+    memset(g_wdg_entities, 0, sizeof(g_wdg_entities));
+
+    g_wdg_now = 0U;
+    g_wdg_active_mask = 0U;
+    g_wdg_failed_mask = 0U;
+    g_wdg_expired_mask = 0U;
+
+    for (uint32_t entity = 0; entity < WATCHDOG_COUNT; entity++) {
+        g_wdg_entities[entity].status.status = WDG_STATUS_DEACTIVATED;
+        g_wdg_entities[entity].last_checkpoint = WDG_CP_NONE;
+    }
+
+    g_wdg_initialized = true;
+    g_wdg_mode = WDG_MODE_COUNT;
+
+    return EBS_Watchdog_SetMode(WDG_MODE_STARTUP);
+}
+
+/**
+ * @brief Alive indication: count it and restart the entity deadline (O(1))
+ * @param watchdog_type Supervised entity
+ * @return ebs_result_t EBS_INVALID_PARAM for an unknown entity
+ */
+ebs_result_t EBS_Watchdog_Refresh(ebs_watchdog_type_t watchdog_type)
+{
+    if (watchdog_type >= WATCHDOG_COUNT) {
+        return EBS_INVALID_PARAM;
+    }
+
+    if (!g_wdg_initialized || (g_wdg_active_mask & WDG_ENTITY_BIT(watchdog_type)) == 0U) {
+        /* Refresh outside supervision (e.g. emergency loop) is accepted */
+        return EBS_OK;
+    }
+
+    wdg_entity_t* e = &g_wdg_entities[watchdog_type];
+    const wdg_entity_config_t* cfg = &g_wdg_config[watchdog_type];
+
+    e->status.refresh_count++;
+    e->alive_count++;
+
+    if (cfg->deadline_ticks != 0U) {
+        Watchdog_TimerStart(WDG_DEADLINE_TIMER(watchdog_type), g_wdg_now + cfg->deadline_ticks);
+    }
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Report a program-flow checkpoint of a supervised entity
+ * @param watchdog_type Supervised entity
+ * @param checkpoint Checkpoint identifier (< WDG_MAX_CHECKPOINTS)
+ * @return ebs_result_t EBS_FAULT if the transition is not allowed
+ */
+ebs_result_t EBS_Watchdog_Checkpoint(ebs_watchdog_type_t watchdog_type, uint32_t checkpoint)
+{
+    if (watchdog_type >= WATCHDOG_COUNT || checkpoint >= WDG_MAX_CHECKPOINTS) {
+        return EBS_INVALID_PARAM;
+    }
+
+    const wdg_flow_config_t* flow = g_wdg_config[watchdog_type].flow;
+    if (!g_wdg_initialized || flow == NULL ||
+        (g_wdg_active_mask & WDG_ENTITY_BIT(watchdog_type)) == 0U) {
+        return EBS_OK;
+    }
+
+    wdg_entity_t* e = &g_wdg_entities[watchdog_type];
+    uint32_t allowed = (e->last_checkpoint == WDG_CP_NONE) ?
+                       flow->initial_mask : flow->successors[e->last_checkpoint];
+
+    e->last_checkpoint = (uint8_t)checkpoint;
+
+    if ((allowed & WDG_CP_BIT(checkpoint)) == 0U) {
+        e->status.flow_errors++;
+        Watchdog_SetStatus(watchdog_type, WDG_STATUS_EXPIRED);
+        return EBS_FAULT;
+    }
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Switch the set of supervised entities (no-op if unchanged)
+ * @param mode Supervision mode
+ * @return ebs_result_t Mode switch result
+ */
+ebs_result_t EBS_Watchdog_SetMode(ebs_wdg_mode_t mode)
+{
+    if (mode >= WDG_MODE_COUNT) {
+        return EBS_INVALID_PARAM;
+    }
+
+    if (!g_wdg_initialized) {
+        return EBS_NOT_INITIALIZED;
+    }
+
+    if (mode == g_wdg_mode) {
+        return EBS_OK;
+    }
+
+    uint32_t target = g_wdg_mode_entities[mode];
+
+    for (uint32_t entity = 0; entity < WATCHDOG_COUNT; entity++) {
+        bool active = (g_wdg_active_mask & WDG_ENTITY_BIT(entity)) != 0U;
+        bool wanted = (target & WDG_ENTITY_BIT(entity)) != 0U;
+
+        if (wanted && !active) {
+            Watchdog_Activate((ebs_watchdog_type_t)entity);
+        } else if (!wanted && active) {
+            Watchdog_Deactivate((ebs_watchdog_type_t)entity);
+        } else {
+            /* Supervision continues across the mode switch */
+        }
+    }
+
+    g_wdg_mode = mode;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Advance supervision by one tick (called every EBS_CYCLE_TIME_MS)
+ * @return ebs_wdg_status_t Global supervision status
+ */
+ebs_wdg_status_t EBS_Watchdog_MainFunction(void)
+{
+    if (!g_wdg_initialized) {
+        return WDG_STATUS_DEACTIVATED;
+    }
+
+    g_wdg_now++;
+
+    if ((g_wdg_now & WDG_SLOT_MASK) == 0U) {
+        Watchdog_Cascade();
+    }
+
+    /* Every timer in the current level-0 slot expires now */
+    uint8_t* head = &g_wdg_wheel[0][g_wdg_now & WDG_SLOT_MASK];
+    while (*head != WDG_TIMER_NONE) {
+        uint8_t timer = *head;
+        Watchdog_TimerStop(timer);
+        Watchdog_Expire(timer);
+    }
+
+    return EBS_Watchdog_GetGlobalStatus();
+}
+
+/**
+ * @brief Get the global supervision status
+ * @return ebs_wdg_status_t Worst local status of all active entities
+ */
+ebs_wdg_status_t EBS_Watchdog_GetGlobalStatus(void)
+{
+    if (!g_wdg_initialized) {
+        return WDG_STATUS_DEACTIVATED;
+    }
+
+    if (g_wdg_expired_mask != 0U) {
+        return WDG_STATUS_EXPIRED;
+    }
+
+    return (g_wdg_failed_mask != 0U) ? WDG_STATUS_FAILED : WDG_STATUS_OK;
+}
+
+/**
+ * @brief Get supervision counters of one entity
+ * @param watchdog_type Supervised entity
+ * @param status Destination
+ * @return ebs_result_t Query result
+ */
+ebs_result_t EBS_Watchdog_GetEntityStatus(ebs_watchdog_type_t watchdog_type,
+                                          ebs_wdg_entity_status_t* status)
+{
+    if (watchdog_type >= WATCHDOG_COUNT || status == NULL) {
+        return EBS_INVALID_PARAM;
+    }
+
+    if (!g_wdg_initialized) {
+        return EBS_NOT_INITIALIZED;
+    }
+
+    *status = g_wdg_entities[watchdog_type].status;
+
+    return EBS_OK;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief (Re)arm a timer at an absolute tick (O(1))
+ * @param timer Timer index
+ * @param expiry Absolute expiry tick (> current tick)
+ */
+static void Watchdog_TimerStart(uint8_t timer, uint32_t expiry)
+{
+    wdg_timer_t* t = &g_wdg_timers[timer];
+    uint32_t blocks_ahead = (expiry >> WDG_WHEEL_BITS) - (g_wdg_now >> WDG_WHEEL_BITS);
+    uint8_t* head;
+
+    Watchdog_TimerStop(timer);
+
+    if (blocks_ahead == 0U) {
+        head = &g_wdg_wheel[0][expiry & WDG_SLOT_MASK];
+    } else if (blocks_ahead < WDG_WHEEL_SLOTS) {
+        head = &g_wdg_wheel[1][(expiry >> WDG_WHEEL_BITS) & WDG_SLOT_MASK];
+    } else {
+        /* Beyond the wheel: park in the last slot, re-placed when cascaded */
+        head = &g_wdg_wheel[1][((g_wdg_now >> WDG_WHEEL_BITS) + WDG_SLOT_MASK) & WDG_SLOT_MASK];
+    }
+
+    t->expiry = expiry;
+    t->head = head;
+    t->prev = WDG_TIMER_NONE;
+    t->next = *head;
+    if (*head != WDG_TIMER_NONE) {
+        g_wdg_timers[*head].prev = timer;
+    }
+    *head = timer;
+}
+
+/**
+ * @brief Unlink a timer from its slot (O(1), idle timers are ignored)
+ * @param timer Timer index
+ */
+static void Watchdog_TimerStop(uint8_t timer)
+{
+    wdg_timer_t* t = &g_wdg_timers[timer];
+
+    if (t->head == NULL) {
+        return;
+    }
+
+    if (t->prev != WDG_TIMER_NONE) {
+        g_wdg_timers[t->prev].next = t->next;
+    } else {
+        *t->head = t->next;
+    }
+    if (t->next != WDG_TIMER_NONE) {
+        g_wdg_timers[t->next].prev = t->prev;
+    }
+
+    t->head = NULL;
+    t->next = WDG_TIMER_NONE;
+    t->prev = WDG_TIMER_NONE;
+}
+
+/**
+ * @brief Move the level-1 slot of the new block down to level 0
+ */
+static void Watchdog_Cascade(void)
+{
+    uint8_t* head = &g_wdg_wheel[1][(g_wdg_now >> WDG_WHEEL_BITS) & WDG_SLOT_MASK];
+
+    while (*head != WDG_TIMER_NONE) {
+        uint8_t timer = *head;
+        Watchdog_TimerStart(timer, g_wdg_timers[timer].expiry);
+    }
+}
+
+/**
+ * @brief Handle an expired timer
+ * @param timer Timer index
+ */
+static void Watchdog_Expire(uint8_t timer)
+{
+    ebs_watchdog_type_t entity = WDG_TIMER_ENTITY(timer);
+
+    if (WDG_TIMER_IS_ALIVE(timer)) {
+        Watchdog_CheckAlive(entity);
+        Watchdog_TimerStart(timer, g_wdg_now + g_wdg_config[entity].reference_ticks);
+    } else {
+        /* No refresh within the deadline */
+        g_wdg_entities[entity].status.deadline_misses++;
+        Watchdog_SetStatus(entity, WDG_STATUS_EXPIRED);
+    }
+}
+
+/**
+ * @brief Close an alive reference cycle
+ * @param entity Supervised entity
+ */
+static void Watchdog_CheckAlive(ebs_watchdog_type_t entity)
+{
+    const wdg_entity_config_t* cfg = &g_wdg_config[entity];
+    wdg_entity_t* e = &g_wdg_entities[entity];
+    uint32_t count = e->alive_count;
+
+    e->status.last_alive_count = count;
+    e->alive_count = 0U;
+
+    if ((count + cfg->min_margin) >= cfg->expected_alive &&
+        count <= (cfg->expected_alive + cfg->max_margin)) {
+        e->failed_cycles = 0U;
+        Watchdog_SetStatus(entity, WDG_STATUS_OK);
+        return;
+    }
+
+    e->status.alive_failures++;
+    e->failed_cycles++;
+    Watchdog_SetStatus(entity, (e->failed_cycles > cfg->failed_tolerance) ?
+                               WDG_STATUS_EXPIRED : WDG_STATUS_FAILED);
+}
+
+/**
+ * @brief Update a local status (EXPIRED is latched until reactivation)
+ * @param entity Supervised entity
+ * @param status New local status
+ */
+static void Watchdog_SetStatus(ebs_watchdog_type_t entity, ebs_wdg_status_t status)
+{
+    wdg_entity_t* e = &g_wdg_entities[entity];
+
+    if (e->status.status == WDG_STATUS_EXPIRED) {
+        return;
+    }
+
+    e->status.status = status;
+
+    g_wdg_failed_mask &= ~WDG_ENTITY_BIT(entity);
+    if (status == WDG_STATUS_FAILED) {
+        g_wdg_failed_mask |= WDG_ENTITY_BIT(entity);
+    } else if (status == WDG_STATUS_EXPIRED) {
+        g_wdg_expired_mask |= WDG_ENTITY_BIT(entity);
+    } else {
+        /* OK or DEACTIVATED - no global contribution */
+    }
+}
+
+/**
+ * @brief Start supervising an entity
+ * @param entity Supervised entity
+ */
+static void Watchdog_Activate(ebs_watchdog_type_t entity)
+{
+    const wdg_entity_config_t* cfg = &g_wdg_config[entity];
+    wdg_entity_t* e = &g_wdg_entities[entity];
+
+    e->status.status = WDG_STATUS_OK;
+    e->alive_count = 0U;
+    e->failed_cycles = 0U;
+    e->last_checkpoint = WDG_CP_NONE;
+
+    if (cfg->deadline_ticks != 0U) {
+        Watchdog_TimerStart(WDG_DEADLINE_TIMER(entity), g_wdg_now + cfg->deadline_ticks);
+    }
+    if (cfg->reference_ticks != 0U) {
+        Watchdog_TimerStart(WDG_ALIVE_TIMER(entity), g_wdg_now + cfg->reference_ticks);
+    }
+
+    g_wdg_active_mask |= WDG_ENTITY_BIT(entity);
+}
+
+/**
+ * @brief Stop supervising an entity
+ * @param entity Supervised entity
+ */
+static void Watchdog_Deactivate(ebs_watchdog_type_t entity)
+{
+    Watchdog_TimerStop(WDG_DEADLINE_TIMER(entity));
+    Watchdog_TimerStop(WDG_ALIVE_TIMER(entity));
+
+    g_wdg_entities[entity].status.status = WDG_STATUS_DEACTIVATED;
+    g_wdg_active_mask &= ~WDG_ENTITY_BIT(entity);
+    g_wdg_failed_mask &= ~WDG_ENTITY_BIT(entity);
+    g_wdg_expired_mask &= ~WDG_ENTITY_BIT(entity);
+}
@@ -0,0 +1,518 @@
+/**
+ * @file abs_fast_path_test.c
+ * @brief Electronic Braking System - ABS Idle Fast Path Equivalence Test
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Runs two ABS state instances side by side on the same sensor frames,
+ * one with the idle fast path enabled and one without, and requires the
+ * control commands, the cycle records and every state field except the
+ * fast path counter to be bit-identical after every step. The records of
+ * each instance are expanded into its own statistics once per diagnostics
+ * period, as the 100 ms task does, and the statistics must match too. Scenarios cover standstill, cruise,
+ * lock/recover cycles, sensor dropouts, a disabled wheel, random frames
+ * and a mixed drive cycle; the fraction of steps taken by the fast path
+ * is reported per scenario.
+ *
+ * A final check runs EBS_ABS_Control on the IMU sensor path: raw FIFO
+ * counts are decimated with the production accelerometer scale and read
+ * back through EBS_Sensors_GetIMUData, and the reference speed must coast
+ * down at the commanded deceleration through four-wheel lock-up.
+ *
+ * Usage: abs_fast_path_test [-v]
+ *
+ * Safety Level: QM (test equipment)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "ebs_abs.h"
+#include "ebs_sensors.h"
+#include "ebs_actuators.h"
+#include "ebs_diagnostics.h"
+#include "ebs_safety.h"
+
+/* Test Configuration */
+#define TEST_DT_S               (EBS_CYCLE_TIME_MS / 1000.0f)
+#define TEST_LOCK_PERIOD        150U        /* Steps per front wheel lock/recover cycle */
+#define TEST_LOCK_SLIP          0.4f
+#define TEST_IMU_CRUISE_KMH     80.0f
+#define TEST_IMU_CRUISE_STEPS   1000U
+#define TEST_IMU_BRAKE_STEPS    300U
+#define TEST_IMU_BRAKE_G        0.8f        /* Vehicle deceleration on the accelerometer */
+#define TEST_IMU_LOCK_DECEL     20.0f       /* Locking wheel deceleration (m/s²) */
+#define TEST_IMU_TOLERANCE_KMH  1.5f
+
+/* Frame generator of one scenario */
+typedef void (*test_frame_fn_t)(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in);
+
+/* Scenario */
+typedef struct {
+    const char* name;
+    test_frame_fn_t frame;
+    uint32_t steps;
+    uint32_t disabled_mask;                 /* Wheels with enable_per_wheel cleared */
+} test_scenario_t;
+
+/* Static Function Prototypes */
+static bool Test_RunScenario(const test_scenario_t* scenario, bool verbose);
+static bool Test_StateEqual(const ebs_abs_system_state_t* a, const ebs_abs_system_state_t* b,
+                            const char** field);
+static bool Test_StatisticsEqual(const ebs_abs_aggregate_t* a, const ebs_abs_aggregate_t* b);
+static bool Test_RecordEqual(const ebs_abs_cycle_record_t* a, const ebs_abs_cycle_record_t* b);
+static bool Test_FloatSame(float a, float b);
+static float Test_Noise(uint32_t* seed, float amplitude);
+static void Test_Uniform(ebs_abs_inputs_t* in, float speed, float accel);
+static void Test_FrameStandstill(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in);
+static void Test_FrameCruise(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in);
+static void Test_FrameLockCycles(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in);
+static void Test_FrameDropouts(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in);
+static void Test_FrameRandom(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in);
+static void Test_FrameDriveCycle(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in);
+static bool Test_ImuSensorPath(bool verbose);
+static uint32_t Test_ImuSource(ebs_imu_fifo_frame_t* frames, uint32_t max_frames);
+
+/* Sensor frame seen by EBS_ABS_Control (IMU sensor path check only) */
+static ebs_wheel_speed_data_t g_test_wheel_data;
+static ebs_imu_data_t g_test_imu_data;
+static int16_t g_test_accel_counts;
+
+/* Sensor/actuator/diagnostic stubs: the step itself has no side effects */
+ebs_wheel_speed_data_t* EBS_Sensors_GetWheelSpeedData(void) { return &g_test_wheel_data; }
+ebs_imu_data_t* EBS_Sensors_GetIMUData(void) { return &g_test_imu_data; }
+ebs_result_t EBS_Actuators_SetPressure(ebs_wheel_position_t wheel, float pressure)
+{
+    (void)wheel;
+    (void)pressure;
+    return EBS_OK;
+}
+ebs_result_t EBS_Diagnostics_SetDTC(ebs_dtc_code_t dtc) { (void)dtc; return EBS_OK; }
+ebs_result_t EBS_Diagnostics_LogEvent(ebs_diag_event_t event, uint32_t data)
+{
+    (void)event;
+    (void)data;
+    return EBS_OK;
+}
+bool EBS_Safety_DualChannelCompare(float channel_a, float channel_b, float tolerance)
+{
+    float diff = channel_a - channel_b;
+    return (diff <= tolerance) && (diff >= -tolerance);
+}
+uint32_t EBS_GetSystemTick(void) { return 0U; }
+
+int main(int argc, char** argv)
+{
+    static const test_scenario_t scenarios[] = {
+        { "standstill",     Test_FrameStandstill, 5000U,   0x00U },
+        { "cruise",         Test_FrameCruise,     20000U,  0x00U },
+        { "lock_cycles",    Test_FrameLockCycles, 20000U,  0x00U },
+        { "dropouts",       Test_FrameDropouts,   20000U,  0x00U },
+        { "disabled_wheel", Test_FrameLockCycles, 20000U,  0x08U },
+        { "random",         Test_FrameRandom,     50000U,  0x00U },
+        { "drive_cycle",    Test_FrameDriveCycle, 120000U, 0x00U },
+    };
+    bool verbose = (argc > 1) && (strcmp(argv[1], "-v") == 0);
+    uint32_t failed = 0U;
+
+    printf("ABS idle fast path equivalence\n");
+    printf("  %-16s %8s %10s %8s\n", "scenario", "steps", "fast path", "result");
+
+    for (uint32_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        if (!Test_RunScenario(&scenarios[i], verbose)) {
+            failed++;
+        }
+    }
+
+    if (!Test_ImuSensorPath(verbose)) {
+        failed++;
+    }
+
+    printf("\n%u scenario(s) failed\n", (unsigned)failed);
+
+    return (failed == 0U) ? 0 : 1;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief Step both instances through one scenario and compare after every step
+ */
+static bool Test_RunScenario(const test_scenario_t* scenario, bool verbose)
+{
+    static ebs_abs_system_state_t gated;
+    static ebs_abs_system_state_t full;
+    static ebs_abs_calibration_t gated_cal;
+    static ebs_abs_calibration_t full_cal;
+    static ebs_abs_aggregate_t gated_stats;
+    static ebs_abs_aggregate_t full_stats;
+    static ebs_abs_cycle_record_t gated_log[EBS_CYCLE_TIME_DIAG_MS / EBS_CYCLE_TIME_MS];
+    static ebs_abs_cycle_record_t full_log[EBS_CYCLE_TIME_DIAG_MS / EBS_CYCLE_TIME_MS];
+    const uint32_t period = EBS_CYCLE_TIME_DIAG_MS / EBS_CYCLE_TIME_MS;
+    ebs_abs_inputs_t in;
+    ebs_control_commands_t gated_commands;
+    ebs_control_commands_t full_commands;
+    uint32_t seed = 0x2545F491U;
+    const char* field = NULL;
+    uint32_t mismatch_step = 0U;
+
+    (void)EBS_ABS_InitState(&gated);
+    (void)EBS_ABS_InitState(&full);
+    memset(&gated_stats, 0, sizeof(gated_stats));
+    memset(&full_stats, 0, sizeof(full_stats));
+    gated_cal = *EBS_ABS_GetDefaultCalibration();
+
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        gated_cal.enable_per_wheel[wheel] = (scenario->disabled_mask & (1UL << wheel)) == 0U;
+    }
+    full_cal = gated_cal;
+    full_cal.idle_fast_path = false;
+    (void)EBS_ABS_SetCalibration(&gated, &gated_cal);
+    (void)EBS_ABS_SetCalibration(&full, &full_cal);
+
+    for (uint32_t step = 0; step < scenario->steps && field == NULL; step++) {
+        memset(&in, 0, sizeof(in));
+        scenario->frame(step, &seed, &in);
+        in.timestamp = step;
+
+        EBS_ABS_Step(&gated, &in, &gated_commands);
+        EBS_ABS_Step(&full, &in, &full_commands);
+        EBS_ABS_RecordCycle(&gated, in.timestamp, &gated_log[step % period]);
+        EBS_ABS_RecordCycle(&full, in.timestamp, &full_log[step % period]);
+
+        /* Diagnostics task period */
+        if ((step + 1U) % period == 0U) {
+            for (uint32_t i = 0; i < period; i++) {
+                EBS_ABS_ApplyRecord(&gated_stats, &gated_log[i]);
+                EBS_ABS_ApplyRecord(&full_stats, &full_log[i]);
+            }
+        }
+
+        if (memcmp(&gated_commands, &full_commands, sizeof(gated_commands)) != 0) {
+            field = "commands";
+        } else if (!Test_RecordEqual(&gated_log[step % period], &full_log[step % period])) {
+            field = "cycle record";
+        } else if (!Test_StatisticsEqual(&gated_stats, &full_stats)) {
+            field = "statistics";
+        } else {
+            (void)Test_StateEqual(&gated, &full, &field);
+        }
+        mismatch_step = step;
+    }
+
+    double fast = 100.0 * (double)gated.idle_step_count / (double)scenario->steps;
+
+    if (field != NULL) {
+        printf("  %-16s %8u %9.1f%% %8s  (%s differs at step %u)\n", scenario->name,
+               (unsigned)scenario->steps, fast, "FAIL", field, (unsigned)mismatch_step);
+        return false;
+    }
+
+    printf("  %-16s %8u %9.1f%% %8s\n", scenario->name, (unsigned)scenario->steps, fast, "ok");
+    if (verbose) {
+        printf("    activations %u, vehicle speed %.2f km/h\n",
+               (unsigned)gated_stats.system_activation_count, (double)gated.vehicle_speed);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Brake on the accelerometer through the decimator into EBS_ABS_Control
+ *
+ * After a cruise the wheels lock far faster than the vehicle decelerates,
+ * so the estimator rejects them and coasts on the IMU. The reference then
+ * only matches the commanded deceleration if the acceleration reaches
+ * ABS_CollectInputs in m/s².
+ */
+static bool Test_ImuSensorPath(bool verbose)
+{
+    static ebs_imu_decimator_t dec;
+    const float decel = TEST_IMU_BRAKE_G * IMU_FIFO_STANDARD_GRAVITY;
+    const uint32_t steps = TEST_IMU_CRUISE_STEPS + TEST_IMU_BRAKE_STEPS;
+    float wheel_speed = TEST_IMU_CRUISE_KMH;
+
+    if (EBS_ImuFifo_Init(&dec, IMU_ACCEL_MS2_PER_LSB, 1.0f / IMU_FIFO_GYRO_LSB_PER_DPS,
+                         Test_ImuSource) != EBS_OK ||
+        EBS_ABS_Init() != EBS_OK) {
+        printf("  %-16s %8u %10s %8s  (init failed)\n", "imu_sensor_path", (unsigned)steps, "-",
+               "FAIL");
+        return false;
+    }
+
+    memset(&g_test_imu_data, 0, sizeof(g_test_imu_data));
+    g_test_accel_counts = 0;
+
+    for (uint32_t step = 0; step < steps; step++) {
+        if (step == TEST_IMU_CRUISE_STEPS) {
+            g_test_accel_counts = (int16_t)(-TEST_IMU_BRAKE_G * IMU_FIFO_ACCEL_LSB_PER_G);
+        }
+        if (step >= TEST_IMU_CRUISE_STEPS) {
+            wheel_speed = EBS_MAX(wheel_speed - TEST_IMU_LOCK_DECEL * 3.6f * TEST_DT_S, 0.0f);
+        }
+        for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+            g_test_wheel_data.speed[wheel].value = wheel_speed;
+            g_test_wheel_data.speed[wheel].valid = true;
+        }
+
+        (void)EBS_ImuFifo_Service(&dec);
+        EBS_ImuFifo_GetImuData(&dec, &g_test_imu_data, step);
+
+        if (EBS_ABS_Control() != EBS_OK) {
+            printf("  %-16s %8u %10s %8s  (control failed at step %u)\n", "imu_sensor_path",
+                   (unsigned)steps, "-", "FAIL", (unsigned)step);
+            return false;
+        }
+    }
+
+    float expected = TEST_IMU_CRUISE_KMH - decel * 3.6f * TEST_DT_S * (float)TEST_IMU_BRAKE_STEPS;
+    float actual = EBS_ABS_GetVehicleSpeed();
+
+    if (fabsf(actual - expected) > TEST_IMU_TOLERANCE_KMH) {
+        printf("  %-16s %8u %10s %8s  (reference %.2f km/h, expected %.2f km/h)\n",
+               "imu_sensor_path", (unsigned)steps, "-", "FAIL", (double)actual, (double)expected);
+        return false;
+    }
+
+    printf("  %-16s %8u %10s %8s\n", "imu_sensor_path", (unsigned)steps, "-", "ok");
+    if (verbose) {
+        printf("    reference %.2f km/h, expected %.2f km/h\n", (double)actual, (double)expected);
+    }
+
+    return true;
+}
+
+/**
+ * @brief FIFO reader: constant longitudinal acceleration, 1 g vertical
+ */
+static uint32_t Test_ImuSource(ebs_imu_fifo_frame_t* frames, uint32_t max_frames)
+{
+    uint32_t count = EBS_MIN(max_frames, IMU_FIFO_DECIMATION);
+
+    for (uint32_t i = 0; i < count; i++) {
+        memset(&frames[i], 0, sizeof(frames[i]));
+        frames[i].axis[IMU_AXIS_ACCEL_X] = g_test_accel_counts;
+        frames[i].axis[IMU_AXIS_ACCEL_Z] = (int16_t)IMU_FIFO_ACCEL_LSB_PER_G;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Bit-exact comparison of everything the step writes (except the counter)
+ *
+ * Both instances start from EBS_ABS_InitState (memset), so padding in the
+ * estimator object is zero on both sides.
+ */
+static bool Test_StateEqual(const ebs_abs_system_state_t* a, const ebs_abs_system_state_t* b,
+                            const char** field)
+{
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        const ebs_abs_wheel_state_t* wa = &a->wheel_state[wheel];
+        const ebs_abs_wheel_state_t* wb = &b->wheel_state[wheel];
+
+        if (wa->state != wb->state || wa->phase != wb->phase ||
+            a->wheel_timing[wheel].activation_time != b->wheel_timing[wheel].activation_time ||
+            a->wheel_timing[wheel].phase_time != b->wheel_timing[wheel].phase_time ||
+            wa->fault_detected != wb->fault_detected ||
+            !Test_FloatSame(wa->slip_ratio, wb->slip_ratio) ||
+            !Test_FloatSame(wa->pressure_command, wb->pressure_command) ||
+            !Test_FloatSame(a->wheel_accel[wheel].previous, b->wheel_accel[wheel].previous) ||
+            !Test_FloatSame(a->wheel_accel[wheel].y, b->wheel_accel[wheel].y)) {
+            *field = "wheel_state";
+            return false;
+        }
+    }
+
+    if (!Test_FloatSame(a->vehicle_speed, b->vehicle_speed) ||
+        a->any_wheel_active != b->any_wheel_active ||
+        a->actuation_mask != b->actuation_mask ||
+        a->activation_events != b->activation_events ||
+        a->stats_mask != b->stats_mask || a->entry_mask != b->entry_mask) {
+        *field = "system";
+        return false;
+    }
+
+    if (memcmp(&a->speed_estimator, &b->speed_estimator, sizeof(a->speed_estimator)) != 0) {
+        *field = "speed_estimator";
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Comparison of the statistics expanded from both instances' records
+ */
+static bool Test_StatisticsEqual(const ebs_abs_aggregate_t* a, const ebs_abs_aggregate_t* b)
+{
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        const ebs_abs_statistics_t* sa = &a->wheel[wheel];
+        const ebs_abs_statistics_t* sb = &b->wheel[wheel];
+
+        if (sa->activation_count != sb->activation_count ||
+            sa->total_active_time_ms != sb->total_active_time_ms ||
+            sa->fault_count != sb->fault_count ||
+            sa->last_activation_time != sb->last_activation_time ||
+            !Test_FloatSame(sa->max_slip_ratio, sb->max_slip_ratio) ||
+            !Test_FloatSame(sa->avg_cycle_frequency, sb->avg_cycle_frequency) ||
+            sa->min_active_duration_ms != sb->min_active_duration_ms ||
+            sa->max_active_duration_ms != sb->max_active_duration_ms ||
+            sa->active_run_ms != sb->active_run_ms ||
+            memcmp(sa->slip_histogram, sb->slip_histogram, sizeof(sa->slip_histogram)) != 0) {
+            return false;
+        }
+    }
+
+    return a->system_activation_count == b->system_activation_count;
+}
+
+/**
+ * @brief Field-wise comparison of two cycle records (padding ignored)
+ */
+static bool Test_RecordEqual(const ebs_abs_cycle_record_t* a, const ebs_abs_cycle_record_t* b)
+{
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        if (!Test_FloatSame(a->slip_ratio[wheel], b->slip_ratio[wheel])) {
+            return false;
+        }
+    }
+
+    return a->timestamp == b->timestamp && a->update_mask == b->update_mask &&
+           a->active_mask == b->active_mask && a->fault_mask == b->fault_mask &&
+           a->entry_mask == b->entry_mask;
+}
+
+/**
+ * @brief Same bit pattern
+ */
+static bool Test_FloatSame(float a, float b)
+{
+    return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+/**
+ * @brief Uniform noise in [-amplitude, amplitude] (xorshift32)
+ */
+static float Test_Noise(uint32_t* seed, float amplitude)
+{
+    uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+    return amplitude * (((float)(x & 0xFFFFU) / 32767.5f) - 1.0f);
+}
+
+/**
+ * @brief All wheels valid at one speed
+ */
+static void Test_Uniform(ebs_abs_inputs_t* in, float speed, float accel)
+{
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        in->wheel_speed[wheel] = speed;
+    }
+    in->wheel_valid_mask = (1UL << WHEEL_COUNT) - 1UL;
+    in->longitudinal_accel = accel;
+    in->accel_valid = true;
+}
+
+static void Test_FrameStandstill(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in)
+{
+    (void)step;
+    Test_Uniform(in, 0.0f, Test_Noise(seed, 0.05f));
+}
+
+static void Test_FrameCruise(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in)
+{
+    (void)step;
+    Test_Uniform(in, 80.0f, Test_Noise(seed, 0.3f));
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        in->wheel_speed[wheel] += Test_Noise(seed, 0.3f);
+    }
+}
+
+/**
+ * @brief Braking from 100 km/h; front wheels run lock/recover saw-tooth cycles
+ */
+static void Test_FrameLockCycles(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in)
+{
+    float v = EBS_MAX(100.0f - 8.0f * 3.6f * TEST_DT_S * (float)step, 0.0f);
+    float phase = (float)(step % TEST_LOCK_PERIOD) / (float)TEST_LOCK_PERIOD;
+    float front_slip = TEST_LOCK_SLIP * ((phase < 0.5f) ? (2.0f * phase) : (2.0f - 2.0f * phase));
+
+    Test_Uniform(in, v, (v > 0.0f) ? -8.0f : 0.0f);
+    in->wheel_speed[WHEEL_FRONT_LEFT] = v * (1.0f - front_slip) + Test_Noise(seed, 0.2f);
+    in->wheel_speed[WHEEL_FRONT_RIGHT] = v * (1.0f - 0.8f * front_slip) + Test_Noise(seed, 0.2f);
+    in->wheel_speed[WHEEL_REAR_LEFT] = v * 0.95f;
+    in->wheel_speed[WHEEL_REAR_RIGHT] = v * 0.95f;
+}
+
+/**
+ * @brief Cruise and braking with invalid, out-of-range wheels and IMU dropouts
+ */
+static void Test_FrameDropouts(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in)
+{
+    if ((step / 2000U) % 2U == 0U) {
+        Test_FrameCruise(step, seed, in);
+    } else {
+        Test_FrameLockCycles(step % 2000U, seed, in);
+    }
+
+    uint32_t x = (uint32_t)(Test_Noise(seed, 1000.0f) + 1000.0f);
+    if (x < 100U) {
+        in->wheel_valid_mask &= ~(1UL << (x % WHEEL_COUNT));
+    } else if (x < 130U) {
+        in->wheel_speed[x % WHEEL_COUNT] = EBS_MAX_WHEEL_SPEED + 30.0f;
+    } else if (x < 200U) {
+        in->accel_valid = false;
+        in->longitudinal_accel = 0.0f;
+    }
+}
+
+static void Test_FrameRandom(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in)
+{
+    (void)step;
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        in->wheel_speed[wheel] = 160.0f + Test_Noise(seed, 170.0f);
+    }
+    in->wheel_valid_mask = (uint32_t)(Test_Noise(seed, 8.0f) + 8.0f) & 0x0FU;
+    in->longitudinal_accel = Test_Noise(seed, 12.0f);
+    in->accel_valid = Test_Noise(seed, 1.0f) > -0.8f;
+}
+
+/**
+ * @brief Two minutes of driving: stop, pull away, cruise, normal and emergency stops
+ */
+static void Test_FrameDriveCycle(uint32_t step, uint32_t* seed, ebs_abs_inputs_t* in)
+{
+    uint32_t t = step % 60000U;
+    float v;
+    float accel;
+
+    if (t < 5000U) {                                    /* Standstill */
+        v = 0.0f;
+        accel = 0.0f;
+    } else if (t < 15000U) {                            /* Pull away to 100 km/h */
+        accel = 100.0f / 3.6f / 10.0f;
+        v = accel * 3.6f * TEST_DT_S * (float)(t - 5000U);
+    } else if (t < 45000U) {                            /* Cruise */
+        v = 100.0f;
+        accel = 0.0f;
+    } else if (t < 50000U) {                            /* Normal stop to 60 km/h */
+        accel = -40.0f / 3.6f / 5.0f;
+        v = 100.0f + accel * 3.6f * TEST_DT_S * (float)(t - 45000U);
+    } else if (t < 52000U) {                            /* Emergency stop with ABS */
+        Test_FrameLockCycles(t - 50000U + 1400U, seed, in);   /* From 60 km/h */
+        return;
+    } else {                                            /* Standstill */
+        v = 0.0f;
+        accel = 0.0f;
+    }
+
+    Test_Uniform(in, v, accel + Test_Noise(seed, 0.2f));
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        in->wheel_speed[wheel] = EBS_MAX(v + Test_Noise(seed, 0.2f), 0.0f);
+    }
+}
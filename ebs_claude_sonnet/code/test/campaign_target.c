@@ -0,0 +1,656 @@
+/**
+ * @file campaign_target.c
+ * @brief Electronic Braking System - Fault Campaign Target (virtual time)
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Runs the production ABS, sensor, actuator, diagnostics, safety,
+ * lockstep, watchdog, program-flow and memory modules through the
+ * production main loop (EBS_Scheduler_RunCycle) after a replica of the
+ * ebs_main.c initialization and self-test, one loop iteration per
+ * virtual millisecond. A four-wheel vehicle plant closes the loop
+ * through the raw data seams of the sensor and actuator modules (wheel
+ * speed capture, pressure ADC scan, IMU FIFO, valve coil driver), and the
+ * faults are injected there, so the production monitors diagnose them:
+ *
+ * - wheel speed capture reports an open line: line fault debounce in
+ *   ebs_sensors.c sets DTC_WHEEL_SPEED_SENSOR_*
+ * - wheel pressure ADC channel stuck: hydraulic model plausibility in
+ *   ebs_actuators.c sets DTC_PRESSURE_SENSOR_* (no safe state)
+ * - inlet valve spool stuck off its command: valve feedback monitor in
+ *   ebs_actuators.c sets DTC_INLET_VALVE_* and requests the safe state
+ * - guard word of a task stack lost: memory report in ebs_diagnostics.c
+ *   sets DTC_MEMORY_CORRUPTION (100 ms diagnostics)
+ *
+ * Watchdog starvation and skipped control-cycle calls are injected through
+ * the scheduler's task seam and detected by the production watchdog and
+ * flow monitor. DTCs are read back from the production DTC table and the
+ * safe state from the safety module after every iteration. ESC, TCS and
+ * communication have no host build and keep stand-ins with the same API.
+ *
+ * Safety Level: QM (test equipment)
+ */
+
+#include "campaign_target.h"
+#include "ebs_safety.h"
+#include "ebs_abs.h"
+#if (EBS_ENABLE_ESC == 1U)
+#include "ebs_esc.h"
+#endif
+#if (EBS_ENABLE_TCS == 1U)
+#include "ebs_tcs.h"
+#endif
+#include "ebs_sensors.h"
+#include "ebs_actuators.h"
+#include "ebs_communication.h"
+#include "ebs_diagnostics.h"
+#include "ebs_watchdog.h"
+#include "ebs_memory.h"
+#include "ebs_lockstep.h"
+#include "ebs_flow_monitor.h"
+#include "ebs_scheduler.h"
+#include <math.h>
+#include <string.h>
+
+/* Plant Constants */
+#define PLANT_SUBSTEPS              4U
+#define PLANT_DT_S                  (EBS_CYCLE_TIME_MS / 1000.0f / (float)PLANT_SUBSTEPS)
+#define PLANT_STEP_US               (EBS_CYCLE_TIME_MS * 1000U / PLANT_SUBSTEPS)
+#define PLANT_MASS_KG               1500.0f
+#define PLANT_GRAVITY               9.81f
+#define PLANT_WHEEL_RADIUS_M        (WHEEL_CIRCUMFERENCE_M / (2.0f * PLANT_PI))
+#define PLANT_PI                    3.14159265f
+#define PLANT_WHEEL_INERTIA         1.2f    /* kg m² */
+#define PLANT_MAX_BRAKE_TORQUE      2000.0f /* Nm at full pressure */
+#define PLANT_PRESSURE_TAU_S        0.020f  /* Hydraulic lag */
+#define PLANT_PEAK_SLIP             0.15f
+#define PLANT_STANDSTILL_MS         1.0f    /* Below this the wheels roll with the vehicle */
+#define PLANT_BRAKE_ONSET_MS        20U     /* Driver brakes from this time on */
+
+/* Ground truth: gross and sustained deviation (twice limit and window) */
+#define OBSERVABLE_FACTOR           2U
+
+/* Vehicle plant */
+typedef struct {
+    float speed_ms;                         /* Vehicle speed */
+    float accel_ms2;                        /* Longitudinal acceleration (forward positive) */
+    float omega[WHEEL_COUNT];               /* Wheel angular speed (rad/s) */
+    float pressure[WHEEL_COUNT];            /* Wheel cylinder pressure (0..1) */
+    double pulse_position[WHEEL_COUNT];     /* Tone wheel position in pulses */
+    uint32_t edge_time_us[WHEEL_COUNT];     /* Time of the latest pulse edge */
+    float valve_command[VALVE_COUNT];       /* Coil driver input (0..1) */
+    float valve[VALVE_COUNT];               /* Spool position (0..1) */
+    float mu;                               /* Road friction coefficient */
+    float driver_demand;                    /* Pedal pressure demand (0..1) */
+} campaign_plant_t;
+
+/* Module state of one scenario */
+static const campaign_scenario_t* g_scenario;
+static campaign_result_t* g_result;
+static campaign_plant_t g_plant;
+static uint32_t g_now_ms = 0U;
+static uint32_t g_observable_ms = 0U;       /* Ground truth deviation run length */
+
+/* Static Function Prototypes */
+static void Campaign_SystemInit(void);
+static bool Campaign_SelfTest(void);
+static ebs_result_t Campaign_AbsControl(void);
+static ebs_result_t Campaign_UpdateActuators(void);
+static ebs_result_t Campaign_Refresh(ebs_watchdog_type_t entity);
+static bool Campaign_FaultActive(campaign_fault_t fault);
+static void Campaign_InjectMemoryFault(void);
+static void Campaign_RecordDtcs(void);
+static void Campaign_RecordSafeState(void);
+static void Campaign_UpdateGroundTruth(void);
+static void Plant_Init(campaign_maneuver_t maneuver);
+static void Plant_Step(void);
+static void Plant_AdvanceTone(uint32_t wheel, float angle_rad, uint32_t start_us, uint32_t step_us);
+static float Plant_TireForceCoefficient(float slip);
+static ebs_result_t Plant_WheelCapture(uint32_t wheel, ebs_wheel_capture_t* capture);
+static ebs_result_t Plant_PressureAdc(const uint8_t* channels, uint32_t channel_count,
+                                     uint32_t rounds, uint16_t* buffer);
+static uint32_t Plant_ImuFifo(ebs_imu_fifo_frame_t* frames, uint32_t max_frames);
+static void Plant_ValveDrive(ebs_valve_id_t valve, float duty_cycle);
+static float Plant_ValvePosition(ebs_valve_id_t valve);
+
+/**
+ * @brief Run one scenario from EBS initialization to CAMPAIGN_RUN_MS
+ * @param scenario Scenario to run
+ * @param result Outcome
+ */
+void Campaign_Run(const campaign_scenario_t* scenario, campaign_result_t* result)
+{
+    memset(result, 0, sizeof(*result));
+    result->id = scenario->id;
+    result->first_dtc_ms = CAMPAIGN_NOT_SEEN;
+    result->safe_state_ms = CAMPAIGN_NOT_SEEN;
+    result->observable_ms = CAMPAIGN_NOT_SEEN;
+    result->safe_state_reason = SAFETY_FAULT_NONE;
+
+    g_scenario = scenario;
+    g_result = result;
+    g_now_ms = 0U;
+    g_observable_ms = 0U;
+
+    Plant_Init(scenario->maneuver);
+
+    /* ebs_main.c: init, self-test, seal, enter NORMAL */
+    Campaign_SystemInit();
+    bool self_test_passed = Campaign_SelfTest();
+    EBS_Memory_Seal();
+    EBS_Scheduler_Start(self_test_passed);
+    Campaign_RecordDtcs();
+    Campaign_RecordSafeState();
+
+    for (g_now_ms = 0U; g_now_ms < CAMPAIGN_RUN_MS; g_now_ms++) {
+        if (g_scenario->fault == CAMPAIGN_FAULT_CANARY_CORRUPTION &&
+            g_now_ms == g_scenario->inject_ms) {
+            Campaign_InjectMemoryFault();
+        }
+
+        EBS_Scheduler_RunCycle();
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U) && (EBS_SAFETY_SECONDARY_CORE == 0U)
+        (void)EBS_Lockstep_SecondaryService();
+#endif
+        Campaign_RecordDtcs();
+        Campaign_RecordSafeState();
+        Plant_Step();
+        Campaign_UpdateGroundTruth();
+    }
+
+    result->final_state = EBS_GetSystemState();
+    result->final_speed_kmh = g_plant.speed_ms * 3.6f;
+    result->completed = true;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief Replica of EBS_SystemInit with the plant behind the raw data seams
+ */
+static void Campaign_SystemInit(void)
+{
+    static const ebs_sensor_sources_t sources = {
+        Plant_WheelCapture, Plant_PressureAdc, Plant_ImuFifo
+    };
+    static const ebs_valve_driver_t valve_driver = { Plant_ValveDrive, Plant_ValvePosition };
+    static const ebs_scheduler_tasks_t tasks = {
+        NULL, Campaign_AbsControl, Campaign_UpdateActuators, Campaign_Refresh
+    };
+
+    EBS_Memory_Init();
+    EBS_Watchdog_Init();
+
+    EBS_Safety_Init();
+    EBS_Flow_Init();
+
+    EBS_Sensors_SetSources(&sources);
+    EBS_Sensors_Init();
+
+    EBS_Actuators_SetValveDriver(&valve_driver);
+    EBS_Actuators_Init();
+
+    EBS_ABS_Init();
+
+#if (EBS_SAFETY_DUAL_CHANNEL == 1U)
+    /* No time base in virtual time: latency statistics stay at zero */
+    EBS_Lockstep_Init(LOCKSTEP_COMPARE_EXACT, NULL);
+#endif
+
+    EBS_Diagnostics_Init();
+
+    EBS_Scheduler_SetTasks(&tasks);
+    EBS_Scheduler_Init();
+}
+
+/**
+ * @brief Replica of EBS_SelfTest for the production modules
+ * @return bool True if self-test passed
+ */
+static bool Campaign_SelfTest(void)
+{
+    bool test_result = true;
+
+    if (!EBS_Sensors_SelfTest()) {
+        EBS_Diagnostics_SetDTC(DTC_SENSOR_SELF_TEST_FAILED);
+        test_result = false;
+    }
+
+    if (!EBS_Actuators_SelfTest()) {
+        EBS_Diagnostics_SetDTC(DTC_ACTUATOR_SELF_TEST_FAILED);
+        test_result = false;
+    }
+
+    if (!EBS_Safety_SelfTest() || !EBS_Flow_SelfTest()) {
+        EBS_Diagnostics_SetDTC(DTC_SAFETY_SELF_TEST_FAILED);
+        test_result = false;
+    }
+
+    if (!EBS_ABS_SelfTest()) {
+        EBS_Diagnostics_SetDTC(DTC_ALGORITHM_SELF_TEST_FAILED);
+        test_result = false;
+    }
+
+    return test_result;
+}
+
+/**
+ * @brief ABS control unless skipped (FLOW_SKIP), after the actuators when swapped
+ * @return ebs_result_t Control result
+ */
+static ebs_result_t Campaign_AbsControl(void)
+{
+    bool flow_fault = Campaign_FaultActive(CAMPAIGN_FAULT_FLOW_SKIP);
+    ebs_result_t result = EBS_OK;
+
+    if (flow_fault && g_scenario->target == (uint32_t)CAMPAIGN_SKIP_SWAP_ABS_ACTUATORS) {
+        (void)EBS_Actuators_Update();
+    }
+
+    if (!flow_fault || g_scenario->target != (uint32_t)CAMPAIGN_SKIP_ABS) {
+        result = EBS_ABS_Control();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Actuator update unless skipped or moved ahead of ABS (FLOW_SKIP)
+ * @return ebs_result_t Update result
+ */
+static ebs_result_t Campaign_UpdateActuators(void)
+{
+    bool flow_fault = Campaign_FaultActive(CAMPAIGN_FAULT_FLOW_SKIP);
+
+    if (flow_fault && (g_scenario->target == (uint32_t)CAMPAIGN_SKIP_ACTUATORS ||
+                       g_scenario->target == (uint32_t)CAMPAIGN_SKIP_SWAP_ABS_ACTUATORS)) {
+        return EBS_OK;
+    }
+
+    return EBS_Actuators_Update();
+}
+
+/**
+ * @brief Watchdog alive indication unless the entity is being starved
+ * @param entity Supervised entity
+ * @return ebs_result_t Refresh result
+ */
+static ebs_result_t Campaign_Refresh(ebs_watchdog_type_t entity)
+{
+    if (Campaign_FaultActive(CAMPAIGN_FAULT_WATCHDOG_STARVATION) &&
+        g_scenario->target == (uint32_t)entity) {
+        return EBS_OK;
+    }
+
+    return EBS_Watchdog_Refresh(entity);
+}
+
+/**
+ * @brief Whether the scenario fault is of the given kind and active now
+ * @param fault Fault kind
+ * @return bool True inside the injection window (FLOW_SKIP: injection cycle only)
+ */
+static bool Campaign_FaultActive(campaign_fault_t fault)
+{
+    if (g_scenario->fault != fault || g_now_ms < g_scenario->inject_ms) {
+        return false;
+    }
+
+    if (fault == CAMPAIGN_FAULT_FLOW_SKIP) {
+        return g_now_ms == g_scenario->inject_ms;
+    }
+
+    return g_scenario->duration_ms == CAMPAIGN_PERMANENT ||
+           g_now_ms < g_scenario->inject_ms + g_scenario->duration_ms;
+}
+
+/**
+ * @brief Overwrite the overflow guard (lowest word) of the target stack
+ */
+static void Campaign_InjectMemoryFault(void)
+{
+    uint32_t size = 0U;
+    uint32_t* stack = (uint32_t*)EBS_Memory_GetStack((ebs_memory_stack_id_t)g_scenario->target, &size);
+
+    if (stack != NULL && size >= sizeof(uint32_t)) {
+        stack[0] = 0xDEADBEEFUL;
+    }
+}
+
+/**
+ * @brief Record the first occurrence of every DTC set in the production table
+ */
+static void Campaign_RecordDtcs(void)
+{
+    const ebs_dtc_entry_t* table = EBS_Diagnostics_GetDTCTable();
+
+    if (table == NULL) {
+        return;
+    }
+
+    for (uint32_t entry = 0; entry < DIAGNOSTICS_MAX_DTC_COUNT; entry++) {
+        bool recorded = false;
+
+        if (!table[entry].active) {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < g_result->dtc_count; i++) {
+            recorded = recorded || g_result->dtcs[i] == (uint16_t)table[entry].dtc_code;
+        }
+
+        if (recorded || g_result->dtc_count >= CAMPAIGN_MAX_DTCS) {
+            continue;
+        }
+
+        g_result->dtcs[g_result->dtc_count] = (uint16_t)table[entry].dtc_code;
+        g_result->dtc_ms[g_result->dtc_count] = g_now_ms;
+        g_result->dtc_count++;
+
+        if (g_result->first_dtc_ms == CAMPAIGN_NOT_SEEN) {
+            g_result->first_dtc_ms = g_now_ms;
+        }
+    }
+}
+
+/**
+ * @brief Record when the safety module first latched the safe state, and why
+ */
+static void Campaign_RecordSafeState(void)
+{
+    ebs_safety_fault_t reason = SAFETY_FAULT_NONE;
+
+    if (g_result->safe_state_ms != CAMPAIGN_NOT_SEEN ||
+        EBS_Safety_GetState() != SAFETY_STATE_SAFE) {
+        return;
+    }
+
+    g_result->safe_state_ms = g_now_ms;
+    if (EBS_Safety_GetFaultHistory(&reason, 1U) == 1U) {
+        g_result->safe_state_reason = reason;
+    }
+}
+
+/**
+ * @brief Track whether the injected fault is grossly visible at the plant
+ *
+ * Independent of the production monitors: a sensor or valve deviation of
+ * OBSERVABLE_FACTOR times the monitor limit for OBSERVABLE_FACTOR times
+ * its window marks the fault as one that must have been diagnosed.
+ */
+static void Campaign_UpdateGroundTruth(void)
+{
+    uint32_t wheel = g_scenario->target;
+    float deviation = 0.0f;
+    float limit = 0.0f;
+    uint32_t window = 0U;
+
+    if (Campaign_FaultActive(CAMPAIGN_FAULT_STUCK_PRESSURE)) {
+        deviation = fabsf(g_plant.pressure[wheel] - g_scenario->magnitude);
+        limit = HYDRAULIC_PLAUSIBILITY_LIMIT;
+        window = HYDRAULIC_PLAUSIBILITY_DEBOUNCE_MS;
+    } else if (Campaign_FaultActive(CAMPAIGN_FAULT_VALVE_POSITION) &&
+               EBS_GetSystemState() == EBS_STATE_NORMAL) {
+        deviation = fabsf(g_plant.valve_command[VALVE_INLET_FL + wheel] -
+                          g_plant.valve[VALVE_INLET_FL + wheel]);
+        limit = VALVE_POSITION_ERROR_THRESHOLD;
+        window = VALVE_FAULT_DEBOUNCE_MS;
+    } else {
+        g_observable_ms = 0U;
+        return;
+    }
+
+    if (deviation > limit * (float)OBSERVABLE_FACTOR) {
+        g_observable_ms++;
+    } else {
+        g_observable_ms = 0U;
+    }
+
+    if (g_observable_ms >= window * OBSERVABLE_FACTOR &&
+        g_result->observable_ms == CAMPAIGN_NOT_SEEN) {
+        g_result->observable_ms = g_now_ms;
+    }
+}
+
+/**
+ * @brief Initial conditions of a maneuver
+ * @param maneuver Maneuver
+ */
+static void Plant_Init(campaign_maneuver_t maneuver)
+{
+    static const float initial_speed_kmh[CAMPAIGN_MANEUVER_COUNT] = { 80.0f, 100.0f, 60.0f };
+    static const float road_mu[CAMPAIGN_MANEUVER_COUNT] = { 1.0f, 1.0f, 0.2f };
+
+    memset(&g_plant, 0, sizeof(g_plant));
+    g_plant.speed_ms = initial_speed_kmh[maneuver] / 3.6f;
+    g_plant.mu = road_mu[maneuver];
+
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        g_plant.omega[wheel] = g_plant.speed_ms / PLANT_WHEEL_RADIUS_M;
+
+        /* De-energized coils: inlet open, outlet closed */
+        g_plant.valve_command[VALVE_INLET_FL + wheel] = 1.0f;
+        g_plant.valve[VALVE_INLET_FL + wheel] = 1.0f;
+    }
+}
+
+/**
+ * @brief Advance the plant by one control cycle
+ */
+static void Plant_Step(void)
+{
+    bool braking = g_scenario->maneuver != CAMPAIGN_MANEUVER_CRUISE &&
+                   g_now_ms >= PLANT_BRAKE_ONSET_MS;
+    g_plant.driver_demand = braking ? 1.0f : 0.0f;
+
+    /* Valves hold their last command while the control loop is stopped */
+    for (uint32_t valve = 0; valve < VALVE_COUNT; valve++) {
+        g_plant.valve[valve] = g_plant.valve_command[valve];
+    }
+    if (Campaign_FaultActive(CAMPAIGN_FAULT_VALVE_POSITION)) {
+        g_plant.valve[VALVE_INLET_FL + g_scenario->target] = g_scenario->magnitude;
+    }
+
+    float wheel_load = PLANT_MASS_KG * PLANT_GRAVITY / (float)WHEEL_COUNT;
+
+    for (uint32_t step = 0; step < PLANT_SUBSTEPS; step++) {
+        float total_force = 0.0f;
+
+        uint32_t start_us = g_now_ms * 1000U + step * PLANT_STEP_US;
+
+        for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+            /* The open inlet passes master cylinder pressure up to its opening */
+            float target = EBS_MIN(g_plant.driver_demand, g_plant.valve[VALVE_INLET_FL + wheel]);
+            g_plant.pressure[wheel] += (target - g_plant.pressure[wheel]) *
+                                       (PLANT_DT_S / PLANT_PRESSURE_TAU_S);
+
+            Plant_AdvanceTone(wheel, g_plant.omega[wheel] * PLANT_DT_S, start_us, PLANT_STEP_US);
+
+            if (g_plant.speed_ms < PLANT_STANDSTILL_MS) {
+                g_plant.omega[wheel] = g_plant.speed_ms / PLANT_WHEEL_RADIUS_M;
+                continue;
+            }
+
+            float wheel_speed = g_plant.omega[wheel] * PLANT_WHEEL_RADIUS_M;
+            float slip = (g_plant.speed_ms - wheel_speed) / g_plant.speed_ms;
+            float force = g_plant.mu * Plant_TireForceCoefficient(slip) * wheel_load;
+            float torque = force * PLANT_WHEEL_RADIUS_M -
+                           g_plant.pressure[wheel] * PLANT_MAX_BRAKE_TORQUE;
+
+            g_plant.omega[wheel] += torque / PLANT_WHEEL_INERTIA * PLANT_DT_S;
+            if (g_plant.omega[wheel] < 0.0f) {
+                g_plant.omega[wheel] = 0.0f;
+            }
+            total_force += force;
+        }
+
+        g_plant.accel_ms2 = -total_force / PLANT_MASS_KG;
+        g_plant.speed_ms += g_plant.accel_ms2 * PLANT_DT_S;
+        if (g_plant.speed_ms < 0.0f) {
+            g_plant.speed_ms = 0.0f;
+            g_plant.accel_ms2 = 0.0f;
+        }
+    }
+}
+
+/**
+ * @brief Advance the tone wheel and timestamp the last pulse edge passed
+ * @param wheel Wheel
+ * @param angle_rad Rotation in this step
+ * @param start_us Start time of the step
+ * @param step_us Step length
+ */
+static void Plant_AdvanceTone(uint32_t wheel, float angle_rad, uint32_t start_us, uint32_t step_us)
+{
+    double previous = g_plant.pulse_position[wheel];
+    double position = previous + (double)angle_rad * (double)WHEEL_SPEED_PULSES_PER_REV /
+                                 (2.0 * (double)PLANT_PI);
+    double edge = floor(position);
+
+    if (edge > floor(previous)) {
+        g_plant.edge_time_us[wheel] = start_us +
+            (uint32_t)((double)step_us * (edge - previous) / (position - previous));
+    }
+    g_plant.pulse_position[wheel] = position;
+}
+
+/**
+ * @brief Normalized tire force over slip (linear to the peak, then sliding)
+ * @param slip Longitudinal slip (0..1)
+ * @return float Force coefficient (0..1)
+ */
+static float Plant_TireForceCoefficient(float slip)
+{
+    if (slip <= 0.0f) {
+        return 0.0f;
+    }
+    if (slip < PLANT_PEAK_SLIP) {
+        return slip / PLANT_PEAK_SLIP;
+    }
+    return 1.0f - 0.3f * (EBS_MIN(slip, 1.0f) - PLANT_PEAK_SLIP) / (1.0f - PLANT_PEAK_SLIP);
+}
+
+/* Raw Data Seams */
+
+/**
+ * @brief Wheel speed capture from the tone wheel (SENSOR_INVALID: open line)
+ * @param wheel Wheel index
+ * @param capture Destination
+ * @return ebs_result_t EBS_FAULT while the line is open
+ */
+static ebs_result_t Plant_WheelCapture(uint32_t wheel, ebs_wheel_capture_t* capture)
+{
+    if (Campaign_FaultActive(CAMPAIGN_FAULT_SENSOR_INVALID) && g_scenario->target == wheel) {
+        return EBS_FAULT;
+    }
+
+    capture->pulse_count = (uint32_t)g_plant.pulse_position[wheel];
+    capture->edge_time_us = g_plant.edge_time_us[wheel];
+    capture->capture_time_us = g_now_ms * 1000U;
+
+    return EBS_OK;
+}
+
+/**
+ * @brief Pressure scan: master cylinder and wheel pressures (STUCK_PRESSURE on @target)
+ * @param channels Hardware channel list
+ * @param channel_count Number of channels
+ * @param rounds Number of sweeps
+ * @param buffer Sample buffer to fill
+ * @return ebs_result_t EBS_OK (synchronous)
+ */
+static ebs_result_t Plant_PressureAdc(const uint8_t* channels, uint32_t channel_count,
+                                     uint32_t rounds, uint16_t* buffer)
+{
+    for (uint32_t ch = 0; ch < channel_count; ch++) {
+        uint32_t sensor = (uint32_t)channels[ch] - EBS_PRESSURE_ADC_FIRST_CH;
+        float pressure = g_plant.driver_demand;
+
+        if (sensor > 0U) {
+            bool stuck = Campaign_FaultActive(CAMPAIGN_FAULT_STUCK_PRESSURE) &&
+                         g_scenario->target == sensor - 1U;
+            pressure = stuck ? g_scenario->magnitude : g_plant.pressure[sensor - 1U];
+        }
+
+        uint16_t counts = (uint16_t)lroundf(EBS_CLAMP(pressure, 0.0f, 1.0f) * (float)ADC_SCAN_FULL_SCALE);
+        for (uint32_t round = 0; round < rounds; round++) {
+            buffer[round * channel_count + ch] = counts;
+        }
+    }
+
+    return EBS_OK;
+}
+
+/**
+ * @brief IMU FIFO: one decimation block of the plant acceleration
+ * @param frames Destination buffer
+ * @param max_frames Capacity of @p frames
+ * @return uint32_t Number of frames produced
+ */
+static uint32_t Plant_ImuFifo(ebs_imu_fifo_frame_t* frames, uint32_t max_frames)
+{
+    uint32_t count = EBS_MIN(max_frames, IMU_FIFO_DECIMATION);
+    float accel_lsb = g_plant.accel_ms2 / IMU_ACCEL_MS2_PER_LSB;
+
+    for (uint32_t i = 0; i < count; i++) {
+        memset(&frames[i], 0, sizeof(frames[i]));
+        frames[i].axis[IMU_AXIS_ACCEL_X] = (int16_t)lroundf(EBS_CLAMP(accel_lsb, -32768.0f, 32767.0f));
+        frames[i].axis[IMU_AXIS_ACCEL_Z] = (int16_t)IMU_FIFO_ACCEL_LSB_PER_G;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Valve coil driver: the spool follows the duty cycle at the next plant step
+ * @param valve Valve identifier
+ * @param duty_cycle PWM duty cycle in %
+ */
+static void Plant_ValveDrive(ebs_valve_id_t valve, float duty_cycle)
+{
+    g_plant.valve_command[valve] = duty_cycle / 100.0f;
+}
+
+/**
+ * @brief Valve spool position feedback (VALVE_POSITION: inlet @target stuck at @magnitude)
+ * @param valve Valve identifier
+ * @return float Spool position of the last plant step
+ */
+static float Plant_ValvePosition(ebs_valve_id_t valve)
+{
+    return g_plant.valve[valve];
+}
+
+/* Stand-in Modules */
+
+#if (EBS_ENABLE_ESC == 1U)
+/**
+ * @brief ESC stand-in (no host implementation)
+ * @return ebs_result_t EBS_OK
+ */
+ebs_result_t EBS_ESC_Control(void)
+{
+    return EBS_OK;
+}
+#endif
+
+#if (EBS_ENABLE_TCS == 1U)
+/**
+ * @brief TCS stand-in (no host implementation)
+ * @return ebs_result_t EBS_OK
+ */
+ebs_result_t EBS_TCS_Control(void)
+{
+    return EBS_OK;
+}
+#endif
+
+/**
+ * @brief Communication stand-in (no host implementation)
+ * @return ebs_result_t EBS_OK
+ */
+ebs_result_t EBS_Communication_Process(void)
+{
+    return EBS_OK;
+}
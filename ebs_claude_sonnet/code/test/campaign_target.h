@@ -0,0 +1,87 @@
+/**
+ * @file campaign_target.h
+ * @brief Electronic Braking System - Fault Campaign Target (virtual time)
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * One scenario runs the EBS stack against a vehicle plant in virtual
+ * time (one tick per EBS_CYCLE_TIME_MS) with a single injected fault and
+ * reports when the fault was first diagnosed and when the safe state was
+ * reached. All state is module-static: run one scenario per process.
+ */
+
+#ifndef CAMPAIGN_TARGET_H
+#define CAMPAIGN_TARGET_H
+
+#include "ebs_types.h"
+#include "ebs_config.h"
+
+/* Campaign Constants */
+#define CAMPAIGN_RUN_MS             1500U   /* Virtual time per scenario */
+#define CAMPAIGN_MAX_DTCS           8U      /* DTCs recorded per scenario */
+#define CAMPAIGN_PERMANENT          0U      /* Fault duration: until the end */
+#define CAMPAIGN_NOT_SEEN           UINT32_MAX
+
+/* Injected fault */
+typedef enum {
+    CAMPAIGN_FAULT_NONE = 0,                /* Baseline (false positive check) */
+    CAMPAIGN_FAULT_SENSOR_INVALID,          /* Wheel speed sensor @target invalid */
+    CAMPAIGN_FAULT_STUCK_PRESSURE,          /* Wheel @target pressure reads @magnitude */
+    CAMPAIGN_FAULT_VALVE_POSITION,          /* Inlet valve @target offset by @magnitude */
+    CAMPAIGN_FAULT_WATCHDOG_STARVATION,     /* Supervised entity @target stops refreshing */
+    CAMPAIGN_FAULT_CANARY_CORRUPTION,       /* Guard word of stack @target overwritten */
+    CAMPAIGN_FAULT_FLOW_SKIP,               /* Control-cycle call @target skipped once */
+    CAMPAIGN_FAULT_COUNT
+} campaign_fault_t;
+
+/* Driving maneuver */
+typedef enum {
+    CAMPAIGN_MANEUVER_CRUISE = 0,           /* 80 km/h, no braking */
+    CAMPAIGN_MANEUVER_HARD_BRAKE,           /* 100 km/h, full braking on dry asphalt */
+    CAMPAIGN_MANEUVER_LOW_MU_BRAKE,         /* 60 km/h, full braking on ice */
+    CAMPAIGN_MANEUVER_COUNT
+} campaign_maneuver_t;
+
+/* Flow skip targets */
+typedef enum {
+    CAMPAIGN_SKIP_ABS = 0,
+    CAMPAIGN_SKIP_ACTUATORS,
+    CAMPAIGN_SKIP_SWAP_ABS_ACTUATORS,
+    CAMPAIGN_SKIP_COUNT
+} campaign_skip_t;
+
+/* Scenario definition */
+typedef struct {
+    uint32_t id;
+    campaign_fault_t fault;
+    campaign_maneuver_t maneuver;
+    uint32_t target;                        /* Wheel, entity, stack or skip kind */
+    uint32_t inject_ms;                     /* Injection time */
+    uint32_t duration_ms;                   /* CAMPAIGN_PERMANENT or length */
+    float magnitude;                        /* Fault-specific value */
+} campaign_scenario_t;
+
+/* Scenario outcome */
+typedef struct {
+    uint32_t id;
+    bool completed;                         /* Scenario ran to the end */
+    uint32_t first_dtc_ms;                  /* First DTC (CAMPAIGN_NOT_SEEN) */
+    uint32_t safe_state_ms;                 /* Safe state entry (CAMPAIGN_NOT_SEEN) */
+    uint32_t observable_ms;                 /* Fault grossly visible at the plant (CAMPAIGN_NOT_SEEN) */
+    ebs_safety_fault_t safe_state_reason;
+    ebs_system_state_t final_state;
+    uint32_t dtc_count;
+    uint16_t dtcs[CAMPAIGN_MAX_DTCS];       /* DTC codes in order of first occurrence */
+    uint32_t dtc_ms[CAMPAIGN_MAX_DTCS];     /* Time of first occurrence */
+    float final_speed_kmh;                  /* Vehicle speed at the end */
+} campaign_result_t;
+
+/**
+ * @brief Run one scenario from EBS initialization to CAMPAIGN_RUN_MS
+ * @param scenario Scenario to run
+ * @param result Outcome
+ */
+void Campaign_Run(const campaign_scenario_t* scenario, campaign_result_t* result);
+
+#endif /* CAMPAIGN_TARGET_H */
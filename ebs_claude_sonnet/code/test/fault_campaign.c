@@ -0,0 +1,532 @@
+/**
+ * @file fault_campaign.c
+ * @brief Electronic Braking System - Parallel Fault-Injection Campaign Runner
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Builds the scenario matrix (fault kind x target x variant x maneuver x
+ * injection time), runs every scenario in its own forked process (the EBS
+ * modules keep module-static state) with up to one process per online CPU,
+ * and checks each outcome against the expected diagnosis:
+ *
+ *   fault               expected DTC                bound     safe state
+ *   none                -                           -         forbidden
+ *   sensor invalid      DTC_WHEEL_SPEED_SENSOR_*    10+1 ms   forbidden
+ *   stuck pressure      DTC_PRESSURE_SENSOR_*       if seen   forbidden
+ *   valve position      DTC_INLET_VALVE_*           if seen   required
+ *   watchdog starvation DTC_WATCHDOG_TIMEOUT        deadline+2 ms
+ *   canary corruption   DTC_MEMORY_CORRUPTION       100+1 ms  -
+ *   flow skip           DTC_PROGRAM_FLOW_ERROR      2 ms      required
+ *
+ * "if seen": required once the plant shows the fault grossly (see
+ * Campaign_UpdateGroundTruth), optional before. No other DTC may be set.
+ *
+ * Usage: fault_campaign [--quick] [-j jobs] [-o results.csv] [-v]
+ *
+ * Safety Level: QM (test equipment)
+ */
+
+#define _GNU_SOURCE
+#include "campaign_target.h"
+#include "ebs_memory.h"
+#include "ebs_watchdog.h"
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Campaign Matrix */
+#define CAMPAIGN_INJECT_FIRST_MS    100U
+#define CAMPAIGN_INJECT_LAST_MS     1050U
+#define CAMPAIGN_INJECT_STEP_MS     50U
+#define CAMPAIGN_QUICK_STEP_MS      450U
+#define CAMPAIGN_CHILD_TIMEOUT_S    10U
+#define CAMPAIGN_WDG_ENTITIES       7U      /* MAIN .. DIAGNOSTIC */
+#define CAMPAIGN_UNBOUNDED          UINT32_MAX
+
+/* Expected diagnosis of one scenario */
+typedef struct {
+    uint16_t dtc;                           /* Expected DTC (0: none allowed) */
+    uint32_t dtc_bound_ms;                  /* Latency bound (CAMPAIGN_UNBOUNDED: any) */
+    bool dtc_required;
+    bool safe_required;
+    bool safe_forbidden;
+    ebs_safety_fault_t safe_reason;
+    uint32_t safe_bound_ms;
+} campaign_expectation_t;
+
+/* Per-kind summary */
+typedef struct {
+    uint32_t scenarios;
+    uint32_t failed;
+    uint32_t detected;
+    uint32_t safe_states;
+    uint32_t max_dtc_latency_ms;
+    uint32_t max_safe_latency_ms;
+} campaign_summary_t;
+
+static const char* const g_fault_names[CAMPAIGN_FAULT_COUNT] = {
+    "none", "sensor_invalid", "stuck_pressure", "valve_position",
+    "watchdog_starvation", "canary_corruption", "flow_skip"
+};
+
+static const char* const g_maneuver_names[CAMPAIGN_MANEUVER_COUNT] = {
+    "cruise", "hard_brake", "low_mu_brake"
+};
+
+/* Deadlines of WATCHDOG_MAIN_TASK .. WATCHDOG_DIAGNOSTIC_TASK (ebs_watchdog.c) */
+static const uint32_t g_wdg_deadline_ms[CAMPAIGN_WDG_ENTITIES] = {
+    5U, 5U, 5U, 15U, 30U, 30U, 250U
+};
+
+/* Static Function Prototypes */
+static uint32_t Campaign_BuildMatrix(campaign_scenario_t* scenarios, bool quick);
+static uint32_t Campaign_AddScenario(campaign_scenario_t* scenarios, uint32_t count,
+                                     campaign_fault_t fault, uint32_t target,
+                                     uint32_t duration_ms, float magnitude, uint32_t inject_step);
+static void Campaign_Execute(const campaign_scenario_t* scenarios, campaign_result_t* results,
+                             uint32_t count, uint32_t jobs);
+static void Campaign_Expect(const campaign_scenario_t* scenario, const campaign_result_t* result,
+                            campaign_expectation_t* expect);
+static bool Campaign_Evaluate(const campaign_scenario_t* scenario, const campaign_result_t* result,
+                              const char** reason);
+static void Campaign_WriteCsv(FILE* file, const campaign_scenario_t* scenarios,
+                              const campaign_result_t* results, const bool* passed, uint32_t count);
+
+/**
+ * @brief Campaign entry point
+ * @param argc Argument count
+ * @param argv Arguments
+ * @return int 0 if every scenario passed, 1 otherwise
+ */
+int main(int argc, char** argv)
+{
+    bool quick = false;
+    bool verbose = false;
+    const char* csv_path = NULL;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t jobs = (cpus > 0) ? (uint32_t)cpus : 1U;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            quick = true;
+        } else if (strcmp(argv[i], "-v") == 0) {
+            verbose = true;
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            int value = atoi(argv[++i]);
+            jobs = (value > 0) ? (uint32_t)value : 1U;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--quick] [-j jobs] [-o results.csv] [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    uint32_t capacity = Campaign_BuildMatrix(NULL, quick);
+    campaign_scenario_t* scenarios = calloc(capacity, sizeof(*scenarios));
+    bool* passed = calloc(capacity, sizeof(*passed));
+    campaign_result_t* results = mmap(NULL, capacity * sizeof(*results), PROT_READ | PROT_WRITE,
+                                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (scenarios == NULL || passed == NULL || results == MAP_FAILED) {
+        fprintf(stderr, "fault_campaign: out of memory\n");
+        return 2;
+    }
+
+    uint32_t count = Campaign_BuildMatrix(scenarios, quick);
+
+    printf("EBS fault campaign: %u scenarios x %u ms virtual time, %u jobs\n",
+           count, CAMPAIGN_RUN_MS, jobs);
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    Campaign_Execute(scenarios, results, count, jobs);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double wall_s = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) * 1e-9;
+
+    campaign_summary_t summary[CAMPAIGN_FAULT_COUNT];
+    memset(summary, 0, sizeof(summary));
+    uint32_t failures = 0U;
+
+    for (uint32_t i = 0; i < count; i++) {
+        const campaign_scenario_t* s = &scenarios[i];
+        const campaign_result_t* r = &results[i];
+        campaign_summary_t* sum = &summary[s->fault];
+        const char* reason = NULL;
+
+        passed[i] = Campaign_Evaluate(s, r, &reason);
+        sum->scenarios++;
+
+        if (r->first_dtc_ms != CAMPAIGN_NOT_SEEN) {
+            sum->detected++;
+            sum->max_dtc_latency_ms = EBS_MAX(sum->max_dtc_latency_ms, r->first_dtc_ms - s->inject_ms);
+        }
+        if (r->safe_state_ms != CAMPAIGN_NOT_SEEN) {
+            sum->safe_states++;
+            sum->max_safe_latency_ms = EBS_MAX(sum->max_safe_latency_ms, r->safe_state_ms - s->inject_ms);
+        }
+
+        if (!passed[i]) {
+            sum->failed++;
+            failures++;
+            if (verbose || failures <= 20U) {
+                printf("  FAIL #%u %s/%s target %u at %u ms (dur %u, mag %.2f): %s\n",
+                       s->id, g_fault_names[s->fault], g_maneuver_names[s->maneuver], s->target,
+                       s->inject_ms, s->duration_ms, (double)s->magnitude, reason);
+            }
+        }
+    }
+
+    printf("\n%-20s %9s %7s %9s %9s %12s %12s\n", "fault", "scenarios", "failed",
+           "detected", "safe", "max dtc ms", "max safe ms");
+    for (uint32_t kind = 0; kind < CAMPAIGN_FAULT_COUNT; kind++) {
+        const campaign_summary_t* sum = &summary[kind];
+        printf("%-20s %9u %7u %9u %9u %12u %12u\n", g_fault_names[kind], sum->scenarios,
+               sum->failed, sum->detected, sum->safe_states,
+               sum->max_dtc_latency_ms, sum->max_safe_latency_ms);
+    }
+    printf("\n%u/%u scenarios passed in %.2f s (%.0f scenarios/s)\n",
+           count - failures, count, wall_s, (double)count / wall_s);
+
+    if (csv_path != NULL) {
+        FILE* file = fopen(csv_path, "w");
+        if (file == NULL) {
+            fprintf(stderr, "fault_campaign: cannot write %s: %s\n", csv_path, strerror(errno));
+            return 2;
+        }
+        Campaign_WriteCsv(file, scenarios, results, passed, count);
+        fclose(file);
+    }
+
+    munmap(results, capacity * sizeof(*results));
+    free(passed);
+    free(scenarios);
+
+    return (failures == 0U) ? 0 : 1;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief Enumerate the scenario matrix
+ * @param scenarios Destination (NULL: count only)
+ * @param quick Three injection times instead of the full sweep
+ * @return uint32_t Number of scenarios
+ */
+static uint32_t Campaign_BuildMatrix(campaign_scenario_t* scenarios, bool quick)
+{
+    static const uint32_t sensor_durations_ms[] = { 5U, 20U, CAMPAIGN_PERMANENT };
+    static const float stuck_values[] = { 0.0f, 1.0f };
+    static const float valve_positions[] = { 0.3f, 0.6f };
+    uint32_t step = quick ? CAMPAIGN_QUICK_STEP_MS : CAMPAIGN_INJECT_STEP_MS;
+    uint32_t count = 0U;
+
+    count = Campaign_AddScenario(scenarios, count, CAMPAIGN_FAULT_NONE, 0U, 0U, 0.0f, 0U);
+
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        for (uint32_t i = 0; i < sizeof(sensor_durations_ms) / sizeof(sensor_durations_ms[0]); i++) {
+            count = Campaign_AddScenario(scenarios, count, CAMPAIGN_FAULT_SENSOR_INVALID, wheel,
+                                         sensor_durations_ms[i], 0.0f, step);
+        }
+        for (uint32_t i = 0; i < sizeof(stuck_values) / sizeof(stuck_values[0]); i++) {
+            count = Campaign_AddScenario(scenarios, count, CAMPAIGN_FAULT_STUCK_PRESSURE, wheel,
+                                         CAMPAIGN_PERMANENT, stuck_values[i], step);
+        }
+        for (uint32_t i = 0; i < sizeof(valve_positions) / sizeof(valve_positions[0]); i++) {
+            count = Campaign_AddScenario(scenarios, count, CAMPAIGN_FAULT_VALVE_POSITION, wheel,
+                                         CAMPAIGN_PERMANENT, valve_positions[i], step);
+        }
+    }
+
+    for (uint32_t entity = 0; entity < CAMPAIGN_WDG_ENTITIES; entity++) {
+        /* Tasks compiled out of the variant are not supervised */
+        if ((WDG_CONTROL_ENTITIES & WDG_ENTITY_BIT(entity)) == 0U) {
+            continue;
+        }
+        count = Campaign_AddScenario(scenarios, count, CAMPAIGN_FAULT_WATCHDOG_STARVATION, entity,
+                                     CAMPAIGN_PERMANENT, 0.0f, step);
+    }
+
+    for (uint32_t stack = 0; stack < MEMORY_STACK_COUNT; stack++) {
+        count = Campaign_AddScenario(scenarios, count, CAMPAIGN_FAULT_CANARY_CORRUPTION, stack,
+                                     CAMPAIGN_PERMANENT, 0.0f, step);
+    }
+
+    for (uint32_t skip = 0; skip < CAMPAIGN_SKIP_COUNT; skip++) {
+        count = Campaign_AddScenario(scenarios, count, CAMPAIGN_FAULT_FLOW_SKIP, skip,
+                                     0U, 0.0f, step);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Add one fault variant for every maneuver and injection time
+ * @param scenarios Destination (NULL: count only)
+ * @param count Scenarios so far
+ * @param fault Fault kind
+ * @param target Fault target
+ * @param duration_ms Fault duration
+ * @param magnitude Fault magnitude
+ * @param inject_step Injection time step (0: baseline, a single time)
+ * @return uint32_t New scenario count
+ */
+static uint32_t Campaign_AddScenario(campaign_scenario_t* scenarios, uint32_t count,
+                                     campaign_fault_t fault, uint32_t target,
+                                     uint32_t duration_ms, float magnitude, uint32_t inject_step)
+{
+    for (uint32_t maneuver = 0; maneuver < CAMPAIGN_MANEUVER_COUNT; maneuver++) {
+        uint32_t inject_ms = CAMPAIGN_INJECT_FIRST_MS;
+
+        do {
+            if (scenarios != NULL) {
+                campaign_scenario_t* s = &scenarios[count];
+                s->id = count;
+                s->fault = fault;
+                s->maneuver = (campaign_maneuver_t)maneuver;
+                s->target = target;
+                s->inject_ms = inject_ms;
+                s->duration_ms = duration_ms;
+                s->magnitude = magnitude;
+            }
+            count++;
+            inject_ms += inject_step;
+        } while (inject_step != 0U && inject_ms <= CAMPAIGN_INJECT_LAST_MS);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Run every scenario in a forked process, at most @p jobs at a time
+ *
+ * Children write their result straight into the shared mapping; a child
+ * that crashes or hangs (alarm) leaves its entry with completed == false.
+ *
+ * @param scenarios Scenarios
+ * @param results Shared result array
+ * @param count Number of scenarios
+ * @param jobs Maximum concurrent processes
+ */
+static void Campaign_Execute(const campaign_scenario_t* scenarios, campaign_result_t* results,
+                             uint32_t count, uint32_t jobs)
+{
+    uint32_t next = 0U;
+    uint32_t running = 0U;
+
+    fflush(stdout);
+
+    while (next < count || running > 0U) {
+        while (next < count && running < jobs) {
+            results[next].completed = false;
+            results[next].id = scenarios[next].id;
+
+            pid_t pid = fork();
+            if (pid == 0) {
+                alarm(CAMPAIGN_CHILD_TIMEOUT_S);
+                Campaign_Run(&scenarios[next], &results[next]);
+                _exit(0);
+            }
+            if (pid < 0) {
+                /* Out of processes: run it here once the others finish */
+                if (running == 0U) {
+                    Campaign_Run(&scenarios[next], &results[next]);
+                    next++;
+                }
+                break;
+            }
+
+            next++;
+            running++;
+        }
+
+        if (running > 0U) {
+            int status = 0;
+            if (wait(&status) > 0) {
+                running--;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Expected diagnosis of a scenario
+ * @param scenario Scenario
+ * @param result Outcome (ground truth for the "if seen" faults)
+ * @param expect Expectation
+ */
+static void Campaign_Expect(const campaign_scenario_t* scenario, const campaign_result_t* result,
+                            campaign_expectation_t* expect)
+{
+    memset(expect, 0, sizeof(*expect));
+    expect->dtc_bound_ms = CAMPAIGN_UNBOUNDED;
+    expect->safe_bound_ms = CAMPAIGN_UNBOUNDED;
+
+    switch (scenario->fault) {
+        case CAMPAIGN_FAULT_NONE:
+            expect->safe_forbidden = true;
+            break;
+
+        case CAMPAIGN_FAULT_SENSOR_INVALID:
+            /* Debounced for 10 ms: shorter drop-outs are not diagnosed */
+            expect->dtc = (uint16_t)(DTC_WHEEL_SPEED_SENSOR_FL + scenario->target);
+            expect->dtc_required = scenario->duration_ms == CAMPAIGN_PERMANENT ||
+                                   scenario->duration_ms >= 10U;
+            expect->dtc_bound_ms = 10U + 1U;
+            expect->safe_forbidden = true;
+            break;
+
+        case CAMPAIGN_FAULT_STUCK_PRESSURE:
+            expect->dtc = (uint16_t)(DTC_PRESSURE_SENSOR_FL + scenario->target);
+            expect->dtc_required = result->observable_ms != CAMPAIGN_NOT_SEEN;
+            expect->safe_forbidden = true;
+            break;
+
+        case CAMPAIGN_FAULT_VALVE_POSITION:
+            expect->dtc = (uint16_t)(DTC_INLET_VALVE_FL + scenario->target);
+            expect->dtc_required = result->observable_ms != CAMPAIGN_NOT_SEEN;
+            expect->safe_required = expect->dtc_required;
+            expect->safe_reason = SAFETY_FAULT_ACTUATOR_FAILURE;
+            break;
+
+        case CAMPAIGN_FAULT_WATCHDOG_STARVATION:
+            expect->dtc = DTC_WATCHDOG_TIMEOUT;
+            expect->dtc_required = true;
+            expect->dtc_bound_ms = g_wdg_deadline_ms[scenario->target] + 2U;
+            expect->safe_required = true;
+            expect->safe_reason = SAFETY_FAULT_WATCHDOG_TIMEOUT;
+            expect->safe_bound_ms = expect->dtc_bound_ms;
+            break;
+
+        case CAMPAIGN_FAULT_CANARY_CORRUPTION:
+            expect->dtc = DTC_MEMORY_CORRUPTION;
+            expect->dtc_required = true;
+            expect->dtc_bound_ms = EBS_CYCLE_TIME_DIAG_MS + 1U;
+            break;
+
+        case CAMPAIGN_FAULT_FLOW_SKIP:
+            expect->dtc = DTC_PROGRAM_FLOW_ERROR;
+            expect->dtc_required = true;
+            expect->dtc_bound_ms = 2U;
+            expect->safe_required = true;
+            expect->safe_reason = SAFETY_FAULT_PROGRAM_FLOW;
+            expect->safe_bound_ms = 2U;
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Check an outcome against its expectation
+ * @param scenario Scenario
+ * @param result Outcome
+ * @param reason First violated expectation
+ * @return bool True if the scenario passed
+ */
+static bool Campaign_Evaluate(const campaign_scenario_t* scenario, const campaign_result_t* result,
+                              const char** reason)
+{
+    campaign_expectation_t expect;
+    Campaign_Expect(scenario, result, &expect);
+
+    if (!result->completed) {
+        *reason = "scenario crashed or timed out";
+        return false;
+    }
+
+    bool dtc_seen = false;
+    for (uint32_t i = 0; i < result->dtc_count; i++) {
+        if (result->dtcs[i] != expect.dtc || expect.dtc == 0U) {
+            *reason = "unexpected DTC";
+            return false;
+        }
+        if (result->dtc_ms[i] < scenario->inject_ms) {
+            *reason = "DTC before injection";
+            return false;
+        }
+        if (expect.dtc_bound_ms != CAMPAIGN_UNBOUNDED &&
+            result->dtc_ms[i] - scenario->inject_ms > expect.dtc_bound_ms) {
+            *reason = "DTC too late";
+            return false;
+        }
+        dtc_seen = true;
+    }
+
+    if (expect.dtc_required && !dtc_seen) {
+        *reason = "fault not diagnosed";
+        return false;
+    }
+
+    bool safe_seen = result->safe_state_ms != CAMPAIGN_NOT_SEEN;
+
+    if (expect.safe_forbidden && safe_seen) {
+        *reason = "unexpected safe state";
+        return false;
+    }
+
+    if (expect.safe_required) {
+        if (!safe_seen) {
+            *reason = "safe state not reached";
+            return false;
+        }
+        if (result->safe_state_reason != expect.safe_reason) {
+            *reason = "safe state for the wrong reason";
+            return false;
+        }
+        if (expect.safe_bound_ms != CAMPAIGN_UNBOUNDED &&
+            result->safe_state_ms - scenario->inject_ms > expect.safe_bound_ms) {
+            *reason = "safe state too late";
+            return false;
+        }
+    }
+
+    if (scenario->fault == CAMPAIGN_FAULT_NONE && result->final_state != EBS_STATE_NORMAL) {
+        *reason = "baseline left EBS_STATE_NORMAL";
+        return false;
+    }
+
+    *reason = "ok";
+    return true;
+}
+
+/**
+ * @brief Write one CSV row per scenario
+ * @param file Destination
+ * @param scenarios Scenarios
+ * @param results Outcomes
+ * @param passed Verdicts
+ * @param count Number of scenarios
+ */
+static void Campaign_WriteCsv(FILE* file, const campaign_scenario_t* scenarios,
+                              const campaign_result_t* results, const bool* passed, uint32_t count)
+{
+    fprintf(file, "id,fault,maneuver,target,inject_ms,duration_ms,magnitude,completed,"
+                  "first_dtc_ms,safe_state_ms,safe_reason,observable_ms,final_state,"
+                  "final_speed_kmh,dtcs,passed\n");
+
+    for (uint32_t i = 0; i < count; i++) {
+        const campaign_scenario_t* s = &scenarios[i];
+        const campaign_result_t* r = &results[i];
+
+        fprintf(file, "%u,%s,%s,%u,%u,%u,%.2f,%d,", s->id, g_fault_names[s->fault],
+                g_maneuver_names[s->maneuver], s->target, s->inject_ms, s->duration_ms,
+                (double)s->magnitude, r->completed ? 1 : 0);
+        fprintf(file, "%d,%d,%d,%d,%d,%.1f,", (r->first_dtc_ms == CAMPAIGN_NOT_SEEN) ? -1 : (int)r->first_dtc_ms,
+                (r->safe_state_ms == CAMPAIGN_NOT_SEEN) ? -1 : (int)r->safe_state_ms,
+                (int)r->safe_state_reason,
+                (r->observable_ms == CAMPAIGN_NOT_SEEN) ? -1 : (int)r->observable_ms,
+                (int)r->final_state, (double)r->final_speed_kmh);
+        for (uint32_t d = 0; d < r->dtc_count; d++) {
+            fprintf(file, "%s0x%04X@%u", (d == 0U) ? "" : " ", r->dtcs[d], r->dtc_ms[d]);
+        }
+        fprintf(file, ",%d\n", passed[i] ? 1 : 0);
+    }
+}
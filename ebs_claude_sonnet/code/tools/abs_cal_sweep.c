@@ -0,0 +1,921 @@
+/**
+ * @file abs_cal_sweep.c
+ * @brief Electronic Braking System - ABS Calibration Sweep Explorer
+ * @version 1.0
+ * @date 2025-07-29
+ * @author EBS Development Team
+ *
+ * Explores slip_threshold, slip_target, pressure_reduction_rate and
+ * pressure_increase_rate of ebs_abs_calibration_t. Candidates come from a
+ * full grid over the given ranges (same value on every wheel) or from
+ * Monte-Carlo samples (front and rear axle drawn independently). Every
+ * candidate runs closed-loop EBS_ABS_Step against a longitudinal
+ * vehicle/wheel plant in virtual time on each scenario (µ levels, split-µ,
+ * µ jumps) and is ranked by
+ *
+ *   score = mean(stopping distance / default distance) + w * mean(slip RMS)
+ *
+ * where slip RMS is the deviation of the true wheel slip from slip_target
+ * while the wheel is in ABS_STATE_ACTIVE. Candidate 0 is always the
+ * default calibration.
+ *
+ * EBS_ABS_Step keeps all state in its instance, so runs share one process
+ * on a thread pool. Runs differ in length by an order of magnitude (ice
+ * vs dry, locked vs controlled wheels): each worker owns a contiguous
+ * range of runs and steals the upper half of another worker's remaining
+ * range when its own is empty.
+ *
+ * Usage: abs_cal_sweep [--quick] [--samples n] [--seed s] [--threshold lo:hi:n]
+ *                      [--target lo:hi:n] [--reduction lo:hi:n] [--increase lo:hi:n]
+ *                      [--slip-weight w] [--top n] [-j jobs] [-o results.csv]
+ *
+ * Safety Level: QM (test equipment)
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "ebs_abs.h"
+#include "ebs_sensors.h"
+#include "ebs_actuators.h"
+#include "ebs_diagnostics.h"
+#include "ebs_safety.h"
+
+/* Sweep Configuration */
+#define SWEEP_MAX_RUN_MS            20000U  /* Virtual time limit per run */
+#define SWEEP_BRAKE_ONSET_MS        20U     /* Driver brakes fully from this time on */
+#define SWEEP_STOP_SPEED_MS         0.5f    /* Run ends below this vehicle speed */
+#define SWEEP_LOCK_SLIP             0.9f    /* Wheel counted as locked above this slip */
+#define SWEEP_MAX_CANDIDATES        200000U
+#define SWEEP_MAX_WORKERS           256U
+#define SWEEP_SAMPLE_TRIES          64U     /* Draws per sample until target < threshold */
+#define SWEEP_DEFAULT_TOP           10U
+#define SWEEP_DEFAULT_SLIP_WEIGHT   2.0f
+#define SWEEP_DEFAULT_SEED          0x9E3779B9U
+
+/* Plant Constants (as in the fault campaign plant) */
+#define PLANT_SUBSTEPS              4U
+#define PLANT_DT_S                  (EBS_CYCLE_TIME_MS / 1000.0f / (float)PLANT_SUBSTEPS)
+#define PLANT_MASS_KG               1500.0f
+#define PLANT_GRAVITY               9.81f
+#define PLANT_WHEEL_RADIUS_M        0.3f
+#define PLANT_WHEEL_INERTIA         1.2f    /* kg m² */
+#define PLANT_MAX_BRAKE_TORQUE      2000.0f /* Nm at full pressure */
+#define PLANT_PRESSURE_TAU_S        0.020f  /* Hydraulic lag */
+#define PLANT_PEAK_SLIP             0.15f
+
+/* Swept calibration parameters */
+typedef enum {
+    SWEEP_PARAM_THRESHOLD = 0,              /* slip_threshold */
+    SWEEP_PARAM_TARGET,                     /* slip_target */
+    SWEEP_PARAM_REDUCTION,                  /* pressure_reduction_rate */
+    SWEEP_PARAM_INCREASE,                   /* pressure_increase_rate */
+    SWEEP_PARAM_COUNT
+} sweep_param_t;
+
+/* Axles (front: FL/FR, rear: RL/RR) */
+#define SWEEP_AXLE_COUNT            2U
+#define SWEEP_AXLE(wheel)           ((wheel) / 2U)
+
+/* Parameter range (steps values from lo to hi; 1 step: lo only) */
+typedef struct {
+    float lo;
+    float hi;
+    uint32_t steps;
+} sweep_range_t;
+
+/* Calibration candidate */
+typedef struct {
+    float value[SWEEP_PARAM_COUNT][SWEEP_AXLE_COUNT];
+} sweep_candidate_t;
+
+/* Road scenario */
+typedef struct {
+    const char* name;
+    float speed_kmh;                        /* Speed at brake onset */
+    float mu[WHEEL_COUNT];                  /* Friction per wheel */
+    float mu_after[WHEEL_COUNT];            /* Friction after the jump */
+    uint32_t jump_ms;                       /* µ jump time (0: none) */
+} sweep_scenario_t;
+
+/* Outcome of one candidate on one scenario */
+typedef struct {
+    float distance_m;                       /* From brake onset to stop (or time limit) */
+    float stop_time_s;
+    float slip_rms;                         /* True slip - slip_target while ABS active */
+    uint32_t active_ms;                     /* Wheel-ms in ABS_STATE_ACTIVE */
+    uint32_t locked_ms;                     /* Wheel-ms above SWEEP_LOCK_SLIP */
+    bool stopped;
+} sweep_run_t;
+
+/* Ranked candidate */
+typedef struct {
+    uint32_t candidate;
+    float score;
+    float distance_ratio;
+    float slip_rms;
+    uint32_t locked_ms;
+    bool stopped;                           /* Stopped on every scenario */
+} sweep_rank_t;
+
+/* Longitudinal vehicle/wheel plant */
+typedef struct {
+    float speed_ms;
+    float accel_ms2;                        /* Forward positive */
+    float distance_m;
+    float omega[WHEEL_COUNT];               /* Wheel angular speed (rad/s) */
+    float pressure[WHEEL_COUNT];            /* Wheel cylinder pressure (0..1) */
+} sweep_plant_t;
+
+/* Work-stealing deque: the unclaimed run indices [head, tail) of one worker */
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t head;
+    uint32_t tail;
+} sweep_deque_t;
+
+/* Pool worker */
+typedef struct {
+    uint32_t id;
+    pthread_t thread;
+    uint32_t runs;
+    uint32_t steals;
+    uint64_t busy_ns;
+} sweep_worker_t;
+
+static const sweep_scenario_t g_sweep_scenarios[] = {
+    { "mu_dry",       100.0f, { 1.0f, 1.0f, 1.0f, 1.0f },     { 1.0f, 1.0f, 1.0f, 1.0f },     0U },
+    { "mu_wet",       100.0f, { 0.5f, 0.5f, 0.5f, 0.5f },     { 0.5f, 0.5f, 0.5f, 0.5f },     0U },
+    { "mu_snow",      60.0f,  { 0.25f, 0.25f, 0.25f, 0.25f }, { 0.25f, 0.25f, 0.25f, 0.25f }, 0U },
+    { "mu_ice",       50.0f,  { 0.1f, 0.1f, 0.1f, 0.1f },     { 0.1f, 0.1f, 0.1f, 0.1f },     0U },
+    { "split_mu",     80.0f,  { 1.0f, 0.2f, 1.0f, 0.2f },     { 1.0f, 0.2f, 1.0f, 0.2f },     0U },
+    { "mu_jump_down", 100.0f, { 1.0f, 1.0f, 1.0f, 1.0f },     { 0.2f, 0.2f, 0.2f, 0.2f },     800U },
+    { "mu_jump_up",   80.0f,  { 0.2f, 0.2f, 0.2f, 0.2f },     { 1.0f, 1.0f, 1.0f, 1.0f },     1500U },
+};
+#define SWEEP_SCENARIO_COUNT    (sizeof(g_sweep_scenarios) / sizeof(g_sweep_scenarios[0]))
+
+static const char* const g_sweep_param_names[SWEEP_PARAM_COUNT] = {
+    "threshold", "target", "reduction", "increase"
+};
+
+/* Pool state */
+static const sweep_candidate_t* g_sweep_candidates;
+static sweep_run_t* g_sweep_runs;
+static sweep_deque_t g_sweep_deques[SWEEP_MAX_WORKERS];
+static sweep_worker_t g_sweep_workers[SWEEP_MAX_WORKERS];
+static uint32_t g_sweep_worker_count;
+
+/* Static Function Prototypes */
+static bool Sweep_ParseRange(const char* text, sweep_range_t* range);
+static float Sweep_RangeValue(const sweep_range_t* range, uint32_t index);
+static float Sweep_Random(uint32_t* seed);
+static void Sweep_SetDefault(sweep_candidate_t* candidate);
+static uint32_t Sweep_BuildGrid(const sweep_range_t* ranges, sweep_candidate_t* candidates);
+static uint32_t Sweep_BuildSamples(const sweep_range_t* ranges, uint32_t samples, uint32_t seed,
+                                   sweep_candidate_t* candidates);
+static void Sweep_Execute(uint32_t run_count, uint32_t workers);
+static void* Sweep_Worker(void* arg);
+static bool Sweep_Pop(sweep_deque_t* deque, uint32_t* run);
+static bool Sweep_Steal(sweep_worker_t* worker, uint32_t* run);
+static void Sweep_RunOne(const sweep_candidate_t* candidate, const sweep_scenario_t* scenario,
+                         sweep_run_t* run);
+static void Sweep_Rank(uint32_t count, float slip_weight, sweep_rank_t* ranks);
+static int Sweep_CompareRank(const void* a, const void* b);
+static void Sweep_PrintCandidate(const sweep_candidate_t* candidate);
+static void Sweep_PrintEffects(const sweep_range_t* ranges, const sweep_rank_t* ranks,
+                               uint32_t count);
+static void Sweep_WriteCsv(FILE* file, const sweep_rank_t* ranks, uint32_t count);
+static void Plant_Init(sweep_plant_t* plant, float speed_kmh);
+static void Plant_Step(sweep_plant_t* plant, const float* valve, const float* mu);
+static float Plant_TireForceCoefficient(float slip);
+
+/* Sensor/actuator/diagnostic stubs: the step itself has no side effects */
+ebs_wheel_speed_data_t* EBS_Sensors_GetWheelSpeedData(void) { return NULL; }
+ebs_imu_data_t* EBS_Sensors_GetIMUData(void) { return NULL; }
+ebs_result_t EBS_Actuators_SetPressure(ebs_wheel_position_t wheel, float pressure)
+{
+    (void)wheel;
+    (void)pressure;
+    return EBS_OK;
+}
+ebs_result_t EBS_Diagnostics_SetDTC(ebs_dtc_code_t dtc) { (void)dtc; return EBS_OK; }
+ebs_result_t EBS_Diagnostics_LogEvent(ebs_diag_event_t event, uint32_t data)
+{
+    (void)event;
+    (void)data;
+    return EBS_OK;
+}
+bool EBS_Safety_DualChannelCompare(float channel_a, float channel_b, float tolerance)
+{
+    float diff = channel_a - channel_b;
+    return (diff <= tolerance) && (diff >= -tolerance);
+}
+uint32_t EBS_GetSystemTick(void) { return 0U; }
+
+/**
+ * @brief Sweep entry point
+ * @param argc Argument count
+ * @param argv Arguments
+ * @return int 0 on success, 2 on bad usage or resources
+ */
+int main(int argc, char** argv)
+{
+    sweep_range_t ranges[SWEEP_PARAM_COUNT] = {
+        { 0.08f, 0.24f, 5U }, { 0.04f, 0.16f, 4U }, { 0.50f, 0.95f, 4U }, { 1.02f, 1.30f, 4U }
+    };
+    uint32_t samples = 0U;
+    uint32_t seed = SWEEP_DEFAULT_SEED;
+    uint32_t top = SWEEP_DEFAULT_TOP;
+    float slip_weight = SWEEP_DEFAULT_SLIP_WEIGHT;
+    const char* csv_path = NULL;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t workers = (cpus > 0) ? (uint32_t)cpus : 1U;
+    bool ok = true;
+
+    for (int i = 1; i < argc && ok; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            ranges[SWEEP_PARAM_THRESHOLD].steps = 3U;
+            ranges[SWEEP_PARAM_TARGET].steps = 3U;
+            ranges[SWEEP_PARAM_REDUCTION].steps = 2U;
+            ranges[SWEEP_PARAM_INCREASE].steps = 2U;
+        } else if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+            samples = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            ok = Sweep_ParseRange(argv[++i], &ranges[SWEEP_PARAM_THRESHOLD]);
+        } else if (strcmp(argv[i], "--target") == 0 && i + 1 < argc) {
+            ok = Sweep_ParseRange(argv[++i], &ranges[SWEEP_PARAM_TARGET]);
+        } else if (strcmp(argv[i], "--reduction") == 0 && i + 1 < argc) {
+            ok = Sweep_ParseRange(argv[++i], &ranges[SWEEP_PARAM_REDUCTION]);
+        } else if (strcmp(argv[i], "--increase") == 0 && i + 1 < argc) {
+            ok = Sweep_ParseRange(argv[++i], &ranges[SWEEP_PARAM_INCREASE]);
+        } else if (strcmp(argv[i], "--slip-weight") == 0 && i + 1 < argc) {
+            slip_weight = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            top = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            int value = atoi(argv[++i]);
+            workers = (value > 0) ? (uint32_t)value : 1U;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else {
+            ok = false;
+        }
+    }
+
+    if (!ok) {
+        fprintf(stderr, "usage: %s [--quick] [--samples n] [--seed s] [--threshold lo:hi:n]\n"
+                        "       [--target lo:hi:n] [--reduction lo:hi:n] [--increase lo:hi:n]\n"
+                        "       [--slip-weight w] [--top n] [-j jobs] [-o results.csv]\n", argv[0]);
+        return 2;
+    }
+    workers = EBS_MIN(workers, SWEEP_MAX_WORKERS);
+
+    uint64_t grid = 1U;
+    for (uint32_t p = 0; p < SWEEP_PARAM_COUNT; p++) {
+        grid *= ranges[p].steps;
+    }
+    uint64_t capacity = 1U + ((samples > 0U) ? samples : grid);
+    if (capacity > SWEEP_MAX_CANDIDATES) {
+        fprintf(stderr, "abs_cal_sweep: %llu candidates exceed %u\n",
+                (unsigned long long)capacity, (unsigned)SWEEP_MAX_CANDIDATES);
+        return 2;
+    }
+
+    sweep_candidate_t* candidates = calloc((size_t)capacity, sizeof(*candidates));
+    sweep_rank_t* ranks = calloc((size_t)capacity, sizeof(*ranks));
+    g_sweep_runs = calloc((size_t)capacity * SWEEP_SCENARIO_COUNT, sizeof(*g_sweep_runs));
+    if (candidates == NULL || ranks == NULL || g_sweep_runs == NULL) {
+        fprintf(stderr, "abs_cal_sweep: out of memory\n");
+        return 2;
+    }
+
+    uint32_t count = (samples > 0U) ? Sweep_BuildSamples(ranges, samples, seed, candidates)
+                                    : Sweep_BuildGrid(ranges, candidates);
+    uint32_t run_count = count * (uint32_t)SWEEP_SCENARIO_COUNT;
+    g_sweep_candidates = candidates;
+
+    printf("ABS calibration sweep: %u candidates (%s) x %u scenarios, %u workers\n",
+           count, (samples > 0U) ? "Monte-Carlo" : "grid", (unsigned)SWEEP_SCENARIO_COUNT,
+           workers);
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    Sweep_Execute(run_count, workers);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double wall_s = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) * 1e-9;
+
+    uint64_t busy_ns = 0U;
+    uint32_t steals = 0U;
+    uint32_t min_runs = UINT32_MAX;
+    uint32_t max_runs = 0U;
+    for (uint32_t w = 0; w < g_sweep_worker_count; w++) {
+        busy_ns += g_sweep_workers[w].busy_ns;
+        steals += g_sweep_workers[w].steals;
+        min_runs = EBS_MIN(min_runs, g_sweep_workers[w].runs);
+        max_runs = EBS_MAX(max_runs, g_sweep_workers[w].runs);
+    }
+    printf("%u runs in %.2f s (%.0f runs/s), %u steals, runs per worker %u..%u, "
+           "utilization %.0f%%\n", run_count, wall_s, (double)run_count / wall_s, steals,
+           min_runs, max_runs,
+           100.0 * (double)busy_ns * 1e-9 / (wall_s * (double)g_sweep_worker_count));
+
+    Sweep_Rank(count, slip_weight, ranks);
+
+    /* Default calibration before sorting */
+    sweep_rank_t reference = ranks[0];
+
+    qsort(ranks, count, sizeof(ranks[0]), Sweep_CompareRank);
+
+    printf("\nscore = mean(distance / default) + %.2f * mean(slip RMS)\n", (double)slip_weight);
+    printf("%5s %6s %7s %7s %8s %9s  %-s\n", "rank", "cand", "score", "dist", "slip", "lock ms",
+           "threshold    target       reduction    increase     (front/rear)");
+    for (uint32_t i = 0; i < EBS_MIN(top, count); i++) {
+        const sweep_rank_t* r = &ranks[i];
+        printf("%5u %6u %7.3f %7.3f %8.4f %9u%s ", i + 1U, r->candidate, (double)r->score,
+               (double)r->distance_ratio, (double)r->slip_rms, r->locked_ms,
+               r->stopped ? " " : "*");
+        Sweep_PrintCandidate(&candidates[r->candidate]);
+    }
+    printf("%5s %6u %7.3f %7.3f %8.4f %9u%s ", "dflt", 0U, (double)reference.score,
+           (double)reference.distance_ratio, (double)reference.slip_rms, reference.locked_ms,
+           reference.stopped ? " " : "*");
+    Sweep_PrintCandidate(&candidates[0]);
+    printf("(* did not stop on every scenario within %u ms)\n", (unsigned)SWEEP_MAX_RUN_MS);
+
+    /* Best against default per scenario */
+    const sweep_run_t* best_runs = &g_sweep_runs[ranks[0].candidate * SWEEP_SCENARIO_COUNT];
+    const sweep_run_t* default_runs = &g_sweep_runs[0];
+    printf("\n%-14s %12s %12s %10s %10s %10s %10s\n", "scenario", "default m", "best m",
+           "dflt slip", "best slip", "dflt lock", "best lock");
+    for (uint32_t s = 0; s < SWEEP_SCENARIO_COUNT; s++) {
+        printf("%-14s %12.1f %12.1f %10.4f %10.4f %10u %10u\n", g_sweep_scenarios[s].name,
+               (double)default_runs[s].distance_m, (double)best_runs[s].distance_m,
+               (double)default_runs[s].slip_rms, (double)best_runs[s].slip_rms,
+               default_runs[s].locked_ms, best_runs[s].locked_ms);
+    }
+
+    if (samples == 0U) {
+        Sweep_PrintEffects(ranges, ranks, count);
+    }
+
+    if (csv_path != NULL) {
+        FILE* file = fopen(csv_path, "w");
+        if (file == NULL) {
+            fprintf(stderr, "abs_cal_sweep: cannot write %s: %s\n", csv_path, strerror(errno));
+            return 2;
+        }
+        Sweep_WriteCsv(file, ranks, count);
+        fclose(file);
+        printf("\nResults written to %s\n", csv_path);
+    }
+
+    free(g_sweep_runs);
+    free(ranks);
+    free(candidates);
+
+    return 0;
+}
+
+/* Static Function Implementations */
+
+/**
+ * @brief Parse "lo:hi:n" (or a single value)
+ */
+static bool Sweep_ParseRange(const char* text, sweep_range_t* range)
+{
+    float lo = 0.0f;
+    float hi = 0.0f;
+    unsigned steps = 0U;
+    int fields = sscanf(text, "%f:%f:%u", &lo, &hi, &steps);
+
+    if (fields == 1) {
+        hi = lo;
+        steps = 1U;
+    } else if (fields != 3 || steps == 0U || hi < lo) {
+        return false;
+    }
+
+    range->lo = lo;
+    range->hi = hi;
+    range->steps = steps;
+
+    return true;
+}
+
+/**
+ * @brief Grid value @p index of a range
+ */
+static float Sweep_RangeValue(const sweep_range_t* range, uint32_t index)
+{
+    if (range->steps <= 1U) {
+        return range->lo;
+    }
+    return range->lo + (range->hi - range->lo) * (float)index / (float)(range->steps - 1U);
+}
+
+/**
+ * @brief Uniform [0, 1) from a xorshift32 state
+ */
+static float Sweep_Random(uint32_t* seed)
+{
+    uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+    return (float)(x >> 8) / 16777216.0f;
+}
+
+/**
+ * @brief Production defaults (ABS_InitializeCalibration)
+ */
+static void Sweep_SetDefault(sweep_candidate_t* candidate)
+{
+    for (uint32_t axle = 0; axle < SWEEP_AXLE_COUNT; axle++) {
+        candidate->value[SWEEP_PARAM_THRESHOLD][axle] = ABS_SLIP_THRESHOLD_DEFAULT;
+        candidate->value[SWEEP_PARAM_TARGET][axle] = ABS_SLIP_TARGET_DEFAULT;
+        candidate->value[SWEEP_PARAM_REDUCTION][axle] = ABS_PRESSURE_REDUCTION_RATE;
+        candidate->value[SWEEP_PARAM_INCREASE][axle] = ABS_PRESSURE_INCREASE_RATE;
+    }
+}
+
+/**
+ * @brief Default plus the full grid, skipping target >= threshold
+ * @return uint32_t Number of candidates
+ */
+static uint32_t Sweep_BuildGrid(const sweep_range_t* ranges, sweep_candidate_t* candidates)
+{
+    uint32_t count = 0U;
+    uint32_t index[SWEEP_PARAM_COUNT] = { 0U };
+
+    Sweep_SetDefault(&candidates[count++]);
+
+    for (;;) {
+        sweep_candidate_t* candidate = &candidates[count];
+        for (uint32_t p = 0; p < SWEEP_PARAM_COUNT; p++) {
+            float value = Sweep_RangeValue(&ranges[p], index[p]);
+            candidate->value[p][0] = value;
+            candidate->value[p][1] = value;
+        }
+        if (candidate->value[SWEEP_PARAM_TARGET][0] < candidate->value[SWEEP_PARAM_THRESHOLD][0]) {
+            count++;
+        }
+
+        /* Odometer increment, last parameter fastest */
+        uint32_t p = SWEEP_PARAM_COUNT;
+        while (p > 0U) {
+            p--;
+            if (++index[p] < ranges[p].steps) {
+                break;
+            }
+            index[p] = 0U;
+            if (p == 0U) {
+                return count;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Default plus uniform samples, front and rear axle drawn independently
+ * @return uint32_t Number of candidates
+ */
+static uint32_t Sweep_BuildSamples(const sweep_range_t* ranges, uint32_t samples, uint32_t seed,
+                                   sweep_candidate_t* candidates)
+{
+    uint32_t count = 0U;
+    uint32_t state = (seed != 0U) ? seed : SWEEP_DEFAULT_SEED;
+
+    Sweep_SetDefault(&candidates[count++]);
+
+    for (uint32_t i = 0; i < samples; i++) {
+        sweep_candidate_t* candidate = &candidates[count];
+        bool valid = false;
+
+        for (uint32_t axle = 0; axle < SWEEP_AXLE_COUNT; axle++) {
+            valid = false;
+            for (uint32_t attempt = 0; attempt < SWEEP_SAMPLE_TRIES && !valid; attempt++) {
+                for (uint32_t p = 0; p < SWEEP_PARAM_COUNT; p++) {
+                    candidate->value[p][axle] = ranges[p].lo +
+                                                (ranges[p].hi - ranges[p].lo) * Sweep_Random(&state);
+                }
+                valid = candidate->value[SWEEP_PARAM_TARGET][axle] <
+                        candidate->value[SWEEP_PARAM_THRESHOLD][axle];
+            }
+            if (!valid) {
+                break;
+            }
+        }
+        if (valid) {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Run every (candidate, scenario) pair on the pool
+ * @param run_count Number of runs
+ * @param workers Requested workers
+ */
+static void Sweep_Execute(uint32_t run_count, uint32_t workers)
+{
+    g_sweep_worker_count = EBS_MAX(1U, EBS_MIN(workers, run_count));
+
+    /* Contiguous initial ranges; stealing evens out the run lengths */
+    for (uint32_t w = 0; w < g_sweep_worker_count; w++) {
+        sweep_deque_t* deque = &g_sweep_deques[w];
+        pthread_mutex_init(&deque->lock, NULL);
+        deque->head = (uint32_t)((uint64_t)run_count * w / g_sweep_worker_count);
+        deque->tail = (uint32_t)((uint64_t)run_count * (w + 1U) / g_sweep_worker_count);
+        memset(&g_sweep_workers[w], 0, sizeof(g_sweep_workers[w]));
+        g_sweep_workers[w].id = w;
+    }
+
+    for (uint32_t w = 1; w < g_sweep_worker_count; w++) {
+        if (pthread_create(&g_sweep_workers[w].thread, NULL, Sweep_Worker,
+                           &g_sweep_workers[w]) != 0) {
+            /* Unstarted ranges are stolen by the running workers */
+            g_sweep_workers[w].thread = pthread_self();
+        }
+    }
+    (void)Sweep_Worker(&g_sweep_workers[0]);
+
+    for (uint32_t w = 1; w < g_sweep_worker_count; w++) {
+        if (!pthread_equal(g_sweep_workers[w].thread, pthread_self())) {
+            pthread_join(g_sweep_workers[w].thread, NULL);
+        }
+    }
+    for (uint32_t w = 0; w < g_sweep_worker_count; w++) {
+        pthread_mutex_destroy(&g_sweep_deques[w].lock);
+    }
+}
+
+/**
+ * @brief Pool worker: drain the own range, then steal until every range is empty
+ */
+static void* Sweep_Worker(void* arg)
+{
+    sweep_worker_t* worker = (sweep_worker_t*)arg;
+    uint32_t run = 0U;
+
+    while (Sweep_Pop(&g_sweep_deques[worker->id], &run) || Sweep_Steal(worker, &run)) {
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        Sweep_RunOne(&g_sweep_candidates[run / SWEEP_SCENARIO_COUNT],
+                     &g_sweep_scenarios[run % SWEEP_SCENARIO_COUNT], &g_sweep_runs[run]);
+
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        worker->busy_ns += (uint64_t)(end.tv_sec - start.tv_sec) * 1000000000ULL +
+                           (uint64_t)end.tv_nsec - (uint64_t)start.tv_nsec;
+        worker->runs++;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Take the lowest unclaimed run of a range (owner side)
+ */
+static bool Sweep_Pop(sweep_deque_t* deque, uint32_t* run)
+{
+    bool found = false;
+
+    pthread_mutex_lock(&deque->lock);
+    if (deque->head < deque->tail) {
+        *run = deque->head++;
+        found = true;
+    }
+    pthread_mutex_unlock(&deque->lock);
+
+    return found;
+}
+
+/**
+ * @brief Steal the upper half of the first non-empty range after the own one
+ *
+ * The stolen block is run by the thief: its first run is returned and the
+ * rest becomes the thief's (empty) range, where it can be stolen again.
+ * Only one lock is held at a time.
+ */
+static bool Sweep_Steal(sweep_worker_t* worker, uint32_t* run)
+{
+    for (uint32_t k = 1; k < g_sweep_worker_count; k++) {
+        sweep_deque_t* victim = &g_sweep_deques[(worker->id + k) % g_sweep_worker_count];
+        uint32_t start = 0U;
+        uint32_t end = 0U;
+
+        pthread_mutex_lock(&victim->lock);
+        if (victim->head < victim->tail) {
+            end = victim->tail;
+            start = end - (end - victim->head + 1U) / 2U;
+            victim->tail = start;
+        }
+        pthread_mutex_unlock(&victim->lock);
+
+        if (start < end) {
+            sweep_deque_t* own = &g_sweep_deques[worker->id];
+            pthread_mutex_lock(&own->lock);
+            own->head = start + 1U;
+            own->tail = end;
+            pthread_mutex_unlock(&own->lock);
+
+            worker->steals++;
+            *run = start;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Closed-loop run of one candidate on one scenario
+ *
+ * The driver brakes fully from SWEEP_BRAKE_ONSET_MS on; a wheel gets the
+ * ABS pressure command while the step actuates it and the driver demand
+ * otherwise (as EBS_ABS_Control and the actuator manager do).
+ */
+static void Sweep_RunOne(const sweep_candidate_t* candidate, const sweep_scenario_t* scenario,
+                         sweep_run_t* run)
+{
+    ebs_abs_system_state_t sys;
+    ebs_abs_calibration_t cal;
+    ebs_abs_inputs_t in;
+    ebs_control_commands_t commands;
+    sweep_plant_t plant;
+    float valve[WHEEL_COUNT] = { 0.0f };
+    double slip_error_sq = 0.0;
+    uint32_t ms = 0U;
+
+    memset(run, 0, sizeof(*run));
+    (void)EBS_ABS_InitState(&sys);
+    cal = *EBS_ABS_GetDefaultCalibration();
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        uint32_t axle = SWEEP_AXLE(wheel);
+        cal.slip_threshold[wheel] = candidate->value[SWEEP_PARAM_THRESHOLD][axle];
+        cal.slip_target[wheel] = candidate->value[SWEEP_PARAM_TARGET][axle];
+        cal.pressure_reduction_rate[wheel] = candidate->value[SWEEP_PARAM_REDUCTION][axle];
+        cal.pressure_increase_rate[wheel] = candidate->value[SWEEP_PARAM_INCREASE][axle];
+    }
+    if (EBS_ABS_SetCalibration(&sys, &cal) != EBS_OK) {
+        return;
+    }
+    Plant_Init(&plant, scenario->speed_kmh);
+
+    for (ms = 0U; ms < SWEEP_MAX_RUN_MS; ms++) {
+        bool braking = ms >= SWEEP_BRAKE_ONSET_MS;
+        bool jumped = scenario->jump_ms != 0U && ms >= SWEEP_BRAKE_ONSET_MS + scenario->jump_ms;
+        const float* mu = jumped ? scenario->mu_after : scenario->mu;
+
+        if (ms == SWEEP_BRAKE_ONSET_MS) {
+            plant.distance_m = 0.0f;
+        }
+        if (braking && plant.speed_ms < SWEEP_STOP_SPEED_MS) {
+            run->stopped = true;
+            break;
+        }
+
+        in.wheel_valid_mask = (1UL << WHEEL_COUNT) - 1UL;
+        in.longitudinal_accel = plant.accel_ms2;
+        in.accel_valid = true;
+        in.timestamp = ms;
+        for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+            in.wheel_speed[wheel] = plant.omega[wheel] * PLANT_WHEEL_RADIUS_M * 3.6f;
+        }
+
+        EBS_ABS_Step(&sys, &in, &commands);
+
+        for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+            bool actuated = (sys.actuation_mask & (1UL << wheel)) != 0U;
+            float slip = (plant.speed_ms - plant.omega[wheel] * PLANT_WHEEL_RADIUS_M) /
+                         plant.speed_ms;
+
+            valve[wheel] = actuated ? commands.brake_pressure_cmd[wheel] : (braking ? 1.0f : 0.0f);
+
+            if (sys.wheel_state[wheel].state == ABS_STATE_ACTIVE) {
+                float error = slip - cal.slip_target[wheel];
+                slip_error_sq += (double)(error * error);
+                run->active_ms++;
+            }
+            if (slip > SWEEP_LOCK_SLIP) {
+                run->locked_ms++;
+            }
+        }
+
+        Plant_Step(&plant, valve, mu);
+    }
+
+    run->distance_m = plant.distance_m;
+    run->stop_time_s = (float)(ms - SWEEP_BRAKE_ONSET_MS) / 1000.0f;
+    run->slip_rms = (run->active_ms > 0U) ?
+                    (float)sqrt(slip_error_sq / (double)run->active_ms) : 0.0f;
+}
+
+/**
+ * @brief Score every candidate against the default (candidate 0)
+ */
+static void Sweep_Rank(uint32_t count, float slip_weight, sweep_rank_t* ranks)
+{
+    const sweep_run_t* reference = &g_sweep_runs[0];
+
+    for (uint32_t c = 0; c < count; c++) {
+        const sweep_run_t* runs = &g_sweep_runs[c * SWEEP_SCENARIO_COUNT];
+        sweep_rank_t* rank = &ranks[c];
+        float ratio = 0.0f;
+        float slip = 0.0f;
+
+        memset(rank, 0, sizeof(*rank));
+        rank->candidate = c;
+        rank->stopped = true;
+
+        for (uint32_t s = 0; s < SWEEP_SCENARIO_COUNT; s++) {
+            ratio += runs[s].distance_m / EBS_MAX(reference[s].distance_m, 1.0f);
+            slip += runs[s].slip_rms;
+            rank->locked_ms += runs[s].locked_ms;
+            rank->stopped = rank->stopped && runs[s].stopped;
+        }
+
+        rank->distance_ratio = ratio / (float)SWEEP_SCENARIO_COUNT;
+        rank->slip_rms = slip / (float)SWEEP_SCENARIO_COUNT;
+        rank->score = rank->distance_ratio + slip_weight * rank->slip_rms;
+    }
+}
+
+/**
+ * @brief qsort comparator: candidates that stop everywhere first, then by score
+ */
+static int Sweep_CompareRank(const void* a, const void* b)
+{
+    const sweep_rank_t* x = (const sweep_rank_t*)a;
+    const sweep_rank_t* y = (const sweep_rank_t*)b;
+
+    if (x->stopped != y->stopped) {
+        return x->stopped ? -1 : 1;
+    }
+    if (x->score != y->score) {
+        return (x->score < y->score) ? -1 : 1;
+    }
+    return (x->candidate > y->candidate) - (x->candidate < y->candidate);
+}
+
+/**
+ * @brief Print the parameters of a candidate (front/rear)
+ */
+static void Sweep_PrintCandidate(const sweep_candidate_t* candidate)
+{
+    for (uint32_t p = 0; p < SWEEP_PARAM_COUNT; p++) {
+        printf(" %.3f/%.3f", (double)candidate->value[p][0], (double)candidate->value[p][1]);
+    }
+    printf("\n");
+}
+
+/**
+ * @brief Mean score per grid value of each parameter (marginal effect)
+ *
+ * A parameter whose row is flat does not influence the closed loop over
+ * the swept range.
+ */
+static void Sweep_PrintEffects(const sweep_range_t* ranges, const sweep_rank_t* ranks,
+                               uint32_t count)
+{
+    printf("\nMean score per value (grid marginals)\n");
+
+    for (uint32_t p = 0; p < SWEEP_PARAM_COUNT; p++) {
+        printf("  %-10s", g_sweep_param_names[p]);
+
+        for (uint32_t v = 0; v < ranges[p].steps; v++) {
+            float value = Sweep_RangeValue(&ranges[p], v);
+            double sum = 0.0;
+            uint32_t n = 0U;
+
+            /* Rank 0 may be the default; grid candidates are 1..count-1 */
+            for (uint32_t i = 0; i < count; i++) {
+                const sweep_candidate_t* candidate = &g_sweep_candidates[ranks[i].candidate];
+                if (ranks[i].candidate != 0U && candidate->value[p][0] == value) {
+                    sum += (double)ranks[i].score;
+                    n++;
+                }
+            }
+
+            if (n > 0U) {
+                printf("  %.3f:%.3f", (double)value, sum / (double)n);
+            } else {
+                printf("  %.3f:-", (double)value);
+            }
+        }
+        printf("\n");
+    }
+}
+
+/**
+ * @brief One CSV row per candidate in rank order
+ */
+static void Sweep_WriteCsv(FILE* file, const sweep_rank_t* ranks, uint32_t count)
+{
+    fprintf(file, "rank,candidate");
+    for (uint32_t p = 0; p < SWEEP_PARAM_COUNT; p++) {
+        fprintf(file, ",%s_front,%s_rear", g_sweep_param_names[p], g_sweep_param_names[p]);
+    }
+    fprintf(file, ",score,distance_ratio,slip_rms,locked_ms,stopped");
+    for (uint32_t s = 0; s < SWEEP_SCENARIO_COUNT; s++) {
+        fprintf(file, ",%s_m,%s_slip_rms", g_sweep_scenarios[s].name, g_sweep_scenarios[s].name);
+    }
+    fprintf(file, "\n");
+
+    for (uint32_t i = 0; i < count; i++) {
+        const sweep_rank_t* r = &ranks[i];
+        const sweep_candidate_t* candidate = &g_sweep_candidates[r->candidate];
+        const sweep_run_t* runs = &g_sweep_runs[r->candidate * SWEEP_SCENARIO_COUNT];
+
+        fprintf(file, "%u,%u", i + 1U, r->candidate);
+        for (uint32_t p = 0; p < SWEEP_PARAM_COUNT; p++) {
+            fprintf(file, ",%.4f,%.4f", (double)candidate->value[p][0],
+                    (double)candidate->value[p][1]);
+        }
+        fprintf(file, ",%.4f,%.4f,%.5f,%u,%u", (double)r->score, (double)r->distance_ratio,
+                (double)r->slip_rms, r->locked_ms, r->stopped ? 1U : 0U);
+        for (uint32_t s = 0; s < SWEEP_SCENARIO_COUNT; s++) {
+            fprintf(file, ",%.2f,%.5f", (double)runs[s].distance_m, (double)runs[s].slip_rms);
+        }
+        fprintf(file, "\n");
+    }
+}
+
+/**
+ * @brief Rolling at @p speed_kmh, brakes released
+ */
+static void Plant_Init(sweep_plant_t* plant, float speed_kmh)
+{
+    memset(plant, 0, sizeof(*plant));
+    plant->speed_ms = speed_kmh / 3.6f;
+
+    for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+        plant->omega[wheel] = plant->speed_ms / PLANT_WHEEL_RADIUS_M;
+    }
+}
+
+/**
+ * @brief Advance the plant by one control cycle
+ * @param plant Plant
+ * @param valve Inlet valve position per wheel (0..1)
+ * @param mu Road friction per wheel
+ */
+static void Plant_Step(sweep_plant_t* plant, const float* valve, const float* mu)
+{
+    float wheel_load = PLANT_MASS_KG * PLANT_GRAVITY / (float)WHEEL_COUNT;
+
+    for (uint32_t step = 0; step < PLANT_SUBSTEPS; step++) {
+        float total_force = 0.0f;
+
+        for (uint32_t wheel = 0; wheel < WHEEL_COUNT; wheel++) {
+            plant->pressure[wheel] += (valve[wheel] - plant->pressure[wheel]) *
+                                      (PLANT_DT_S / PLANT_PRESSURE_TAU_S);
+
+            float wheel_speed = plant->omega[wheel] * PLANT_WHEEL_RADIUS_M;
+            float slip = (plant->speed_ms - wheel_speed) / plant->speed_ms;
+            float force = mu[wheel] * Plant_TireForceCoefficient(slip) * wheel_load;
+            float torque = force * PLANT_WHEEL_RADIUS_M -
+                           plant->pressure[wheel] * PLANT_MAX_BRAKE_TORQUE;
+
+            plant->omega[wheel] += torque / PLANT_WHEEL_INERTIA * PLANT_DT_S;
+            if (plant->omega[wheel] < 0.0f) {
+                plant->omega[wheel] = 0.0f;
+            }
+            total_force += force;
+        }
+
+        plant->accel_ms2 = -total_force / PLANT_MASS_KG;
+        plant->distance_m += plant->speed_ms * PLANT_DT_S;
+        plant->speed_ms += plant->accel_ms2 * PLANT_DT_S;
+        if (plant->speed_ms < SWEEP_STOP_SPEED_MS * 0.5f) {
+            plant->speed_ms = SWEEP_STOP_SPEED_MS * 0.5f;
+        }
+    }
+}
+
+/**
+ * @brief Normalized tire force over slip (linear to the peak, then sliding)
+ * @param slip Longitudinal slip (0..1)
+ * @return float Force coefficient (0..1)
+ */
+static float Plant_TireForceCoefficient(float slip)
+{
+    if (slip <= 0.0f) {
+        return 0.0f;
+    }
+    if (slip < PLANT_PEAK_SLIP) {
+        return slip / PLANT_PEAK_SLIP;
+    }
+    return 1.0f - 0.3f * (EBS_MIN(slip, 1.0f) - PLANT_PEAK_SLIP) / (1.0f - PLANT_PEAK_SLIP);
+}
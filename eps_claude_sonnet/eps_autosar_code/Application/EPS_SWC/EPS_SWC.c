@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "EPS_SWC.h"
 #include "Rte_EPS_SWC.h"
+#include "eps_oscillation.h"   /* Shared with the standalone EPS code */
+#include "eps_assist_curve.h"   /* Shared with the standalone EPS code */
 
 /*******************************************************************************
  * Local Constants
@@ -40,23 +42,56 @@
 #define EPS_MIN_ASSISTANCE_FACTOR           (0.3F)    /* 30% at high speeds */
 
 /* Control Parameters */
-#define EPS_BASE_ASSISTANCE_GAIN            (1.5F)
 #define EPS_RETURN_TO_CENTER_GAIN           (0.02F)   /* Nm/deg - EPS-PR-034 */
 #define EPS_RETURN_TO_CENTER_THRESHOLD_NM   (1.0F)    /* Nm */
 #define EPS_DAMPING_COEFFICIENT             (0.05F)   /* Nm*s/deg - EPS-PR-037 */
 #define EPS_SPEED_RTC_FACTOR                (0.01F)
 #define EPS_SPEED_DAMPING_FACTOR            (0.02F)
+#define EPS_SPEED_BUCKET_KMH                (1.0F)    /* km/h - speed gain table step */
 
 /* Safety Limits */
 #define EPS_MAX_ASSISTANCE_RATE_NMS         (10.0F)   /* Nm/s - EPS-FR-005 */
 #define EPS_DEGRADED_MAX_TORQUE_NM          (4.0F)    /* Nm */
-#define EPS_OSCILLATION_BUFFER_SIZE         (10U)
 #define EPS_TORQUE_CHANGE_THRESHOLD_NM      (0.5F)    /* Nm */
 
+/* Oscillation Detection - EPS-SR-006 (1-5 Hz shimmy at 1 ms samples) */
+#define EPS_OSCILLATION_WINDOW_SAMPLES      (3000U)   /* 3 s window */
+#define EPS_OSCILLATION_SIGN_CHANGES        (4U)      /* Detected above this count: 1 Hz completes 5 in 2.5 s */
+#define EPS_OSCILLATION_HALF_CYCLE_SAMPLES  (570U)    /* 0.57 s - slower half-cycles (driver steering) do not count */
+#define EPS_OSCILLATION_AMPLITUDE_NM        (2.0F)    /* Nm - half-cycle peak for its sign change to count */
+#define EPS_OSCILLATION_DEADBAND_NM         EPS_MIN_TORQUE_THRESHOLD_NM
+
 /*******************************************************************************
  * AUTOSAR Memory Sections
  ******************************************************************************/
 
+#define EPS_SWC_START_SEC_CALIB_UNSPECIFIED
+#include "EPS_SWC_MemMap.h"
+
+/* Oscillation detector calibration - EPS-SR-006 */
+static CONST(eps_oscillation_config_t, EPS_SWC_CALIB) EPS_OscillationConfig = {
+    .window_samples = EPS_OSCILLATION_WINDOW_SAMPLES,
+    .sign_change_limit = EPS_OSCILLATION_SIGN_CHANGES,
+    .half_cycle_samples = EPS_OSCILLATION_HALF_CYCLE_SAMPLES,
+    .amplitude_limit = EPS_OSCILLATION_AMPLITUDE_NM,
+    .deadband = EPS_OSCILLATION_DEADBAND_NM
+};
+
+/* Assistance curve calibration - EPS-FR-002, EPS-PR-040 */
+static CONST(eps_assist_curve_config_t, EPS_SWC_CALIB) EPS_AssistCurveConfig = {
+    .low_speed_kmh = EPS_LOW_SPEED_THRESHOLD_KMH,
+    .high_speed_kmh = EPS_HIGH_SPEED_THRESHOLD_KMH,
+    .min_speed_factor = EPS_MIN_ASSISTANCE_FACTOR,
+    .rtc_speed_factor = EPS_SPEED_RTC_FACTOR,
+    .damping_speed_factor = EPS_SPEED_DAMPING_FACTOR,
+    .speed_step_kmh = EPS_SPEED_BUCKET_KMH,
+    .boost_step_nm = EPS_BOOST_CURVE_STEP_NM,
+    .boost_assist_nm = EPS_BOOST_CURVE_ASSIST_NM
+};
+
+#define EPS_SWC_STOP_SEC_CALIB_UNSPECIFIED
+#include "EPS_SWC_MemMap.h"
+
 #define EPS_SWC_START_SEC_VAR_INIT_UNSPECIFIED
 #include "EPS_SWC_MemMap.h"
 
@@ -98,6 +133,13 @@ VAR(EPS_SystemState_T, EPS_SWC_VAR) EPS_IRV_SystemState;
 static VAR(uint32, EPS_SWC_VAR) EPS_SystemTickCounter;
 static VAR(uint32, EPS_SWC_VAR) EPS_LastWatchdogReset;
 
+/* Oscillation detector window (initialized by EPS_Init_Runnable) */
+static VAR(eps_oscillation_detector_t, EPS_SWC_VAR) EPS_OscillationDetector;
+static VAR(uint8, EPS_SWC_VAR) EPS_OscillationCrossing[EPS_OSCILLATION_WINDOW_SAMPLES];
+
+/* Assistance gain tables (built by EPS_Init_Runnable) */
+static VAR(eps_assist_curve_t, EPS_SWC_VAR) EPS_AssistCurve;
+
 #define EPS_SWC_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 #include "EPS_SWC_MemMap.h"
 
@@ -127,8 +169,7 @@ static FUNC(Std_ReturnType, EPS_SWC_CODE) EPS_GenerateMotorCommand(
 );
 
 static FUNC(boolean, EPS_SWC_CODE) EPS_DetectOscillation(
-    P2CONST(float32, AUTOMATIC, EPS_SWC_APPL_CONST) Data,
-    VAR(uint8, AUTOMATIC) Size
+    VAR(float32, AUTOMATIC) Assistance
 );
 
 /*******************************************************************************
@@ -163,6 +204,23 @@ FUNC(void, EPS_SWC_CODE) EPS_Init_Runnable(void)
     EPS_SystemTickCounter = 0U;
     EPS_LastWatchdogReset = 0U;
     
+    /* Initialize oscillation detection - EPS-SR-006 */
+    if (eps_oscillation_init(&EPS_OscillationDetector, &EPS_OscillationConfig,
+                             EPS_OscillationCrossing) == false)
+    {
+        EPS_SystemState.SystemStatus = EPS_STATUS_FAULT;
+        EPS_SystemState.FaultCount++;
+        return;
+    }
+    
+    /* Build the assistance gain tables - EPS-FR-002, EPS-PR-040 */
+    if (eps_assist_curve_init(&EPS_AssistCurve, &EPS_AssistCurveConfig) == false)
+    {
+        EPS_SystemState.SystemStatus = EPS_STATUS_FAULT;
+        EPS_SystemState.FaultCount++;
+        return;
+    }
+    
     /* Initialize power management through RTE */
     retVal = Rte_Call_PowerManagement_Init();
     if (retVal != RTE_E_OK)
@@ -499,19 +557,19 @@ static FUNC(Std_ReturnType, EPS_SWC_CODE) EPS_CalculateAssistance(
 )
 {
     float32 baseAssistance = 0.0F;
-    float32 speedFactor = 1.0F;
     float32 returnToCenterTorque = 0.0F;
     float32 dampingTorque = 0.0F;
+    P2CONST(eps_assist_speed_gains_t, AUTOMATIC, EPS_SWC_VAR) speedGains;
     
     if ((SensorData == NULL_PTR) || (AssistanceParams == NULL_PTR))
     {
         return E_NOT_OK;
     }
     
-    /* Base assistance calculation - EPS-FR-002 */
+    /* Base assistance from the boost curve - EPS-FR-002 */
     if (fabsf(SensorData->DriverTorque_Nm) > EPS_MIN_TORQUE_THRESHOLD_NM)
     {
-        baseAssistance = SensorData->DriverTorque_Nm * EPS_BASE_ASSISTANCE_GAIN;
+        baseAssistance = eps_assist_curve_boost(&EPS_AssistCurve, SensorData->DriverTorque_Nm);
         
         /* Apply torque direction check - EPS-FR-003, EPS-SR-018 */
         if (((SensorData->DriverTorque_Nm > 0.0F) && (baseAssistance < 0.0F)) ||
@@ -523,22 +581,8 @@ static FUNC(Std_ReturnType, EPS_SWC_CODE) EPS_CalculateAssistance(
         }
     }
     
-    /* Speed-sensitive assistance - EPS-FR-017, EPS-PR-040 */
-    if (SensorData->VehicleSpeed_KmH <= EPS_LOW_SPEED_THRESHOLD_KMH)
-    {
-        speedFactor = 1.0F; /* Maximum assistance at low speeds */
-    }
-    else if (SensorData->VehicleSpeed_KmH >= EPS_HIGH_SPEED_THRESHOLD_KMH)
-    {
-        speedFactor = EPS_MIN_ASSISTANCE_FACTOR; /* Minimum assistance at high speeds */
-    }
-    else
-    {
-        /* Linear interpolation between low and high speed thresholds */
-        float32 speedRange = EPS_HIGH_SPEED_THRESHOLD_KMH - EPS_LOW_SPEED_THRESHOLD_KMH;
-        float32 speedOffset = SensorData->VehicleSpeed_KmH - EPS_LOW_SPEED_THRESHOLD_KMH;
-        speedFactor = 1.0F - (speedOffset / speedRange) * (1.0F - EPS_MIN_ASSISTANCE_FACTOR);
-    }
+    /* Speed-sensitive gains, from the table of the speed's bucket - EPS-FR-017, EPS-PR-040 */
+    speedGains = eps_assist_curve_speed_gains(&EPS_AssistCurve, SensorData->VehicleSpeed_KmH);
     
     /* Return-to-center assistance - EPS-FR-023, EPS-PR-034 */
     if (fabsf(SensorData->DriverTorque_Nm) < EPS_RETURN_TO_CENTER_THRESHOLD_NM)
@@ -546,17 +590,17 @@ static FUNC(Std_ReturnType, EPS_SWC_CODE) EPS_CalculateAssistance(
         returnToCenterTorque = -SensorData->SteeringAngle_Deg * EPS_RETURN_TO_CENTER_GAIN;
         
         /* Speed-based return-to-center adjustment - EPS-FR-025 */
-        returnToCenterTorque *= (1.0F + SensorData->VehicleSpeed_KmH * EPS_SPEED_RTC_FACTOR);
+        returnToCenterTorque *= speedGains->rtc_scale;
     }
     
     /* Damping calculation - EPS-FR-029, EPS-PR-037 */
     dampingTorque = -SensorData->SteeringVelocity_DegS * EPS_DAMPING_COEFFICIENT;
     
     /* Speed-based damping adjustment - EPS-FR-031 */
-    dampingTorque *= (1.0F + SensorData->VehicleSpeed_KmH * EPS_SPEED_DAMPING_FACTOR);
+    dampingTorque *= speedGains->damping_scale;
     
     /* Combine all assistance components */
-    AssistanceParams->BaseAssistance_Nm = baseAssistance * speedFactor;
+    AssistanceParams->BaseAssistance_Nm = baseAssistance * speedGains->speed_factor;
     AssistanceParams->ReturnToCenter_Nm = returnToCenterTorque;
     AssistanceParams->Damping_Nm = dampingTorque;
     AssistanceParams->TotalAssistance_Nm = AssistanceParams->BaseAssistance_Nm + 
@@ -564,7 +608,7 @@ static FUNC(Std_ReturnType, EPS_SWC_CODE) EPS_CalculateAssistance(
                                           AssistanceParams->Damping_Nm;
     
     /* Store calculation metadata */
-    AssistanceParams->SpeedFactor = speedFactor;
+    AssistanceParams->SpeedFactor = speedGains->speed_factor;
     AssistanceParams->CalculationTimestamp_Ms = EPS_SystemTickCounter;
     AssistanceParams->SafetyLimited = FALSE;
     AssistanceParams->RateLimited = FALSE;
@@ -611,13 +655,7 @@ static FUNC(Std_ReturnType, EPS_SWC_CODE) EPS_ApplySafetyLimits(
     }
     
     /* Check for oscillation detection - EPS-SR-006 */
-    static float32 previousAssistance[EPS_OSCILLATION_BUFFER_SIZE] = {0.0F};
-    static uint8 bufferIndex = 0U;
-    
-    previousAssistance[bufferIndex] = AssistanceParams->TotalAssistance_Nm;
-    bufferIndex = (bufferIndex + 1U) % EPS_OSCILLATION_BUFFER_SIZE;
-    
-    if (EPS_DetectOscillation(previousAssistance, EPS_OSCILLATION_BUFFER_SIZE) == TRUE)
+    if (EPS_DetectOscillation(AssistanceParams->TotalAssistance_Nm) == TRUE)
     {
         (void)Rte_Call_DiagnosticManager_SetDTC(0x5003U, 0x01U); /* Oscillation detected DTC */
         AssistanceParams->TotalAssistance_Nm = 0.0F; /* Disable assistance */
@@ -748,46 +786,23 @@ static FUNC(Std_ReturnType, EPS_SWC_CODE) EPS_GenerateMotorCommand(
 
 /**
  * @brief Detect oscillation in assistance data
- * @param Data Pointer to data array
- * @param Size Size of data array
+ * @param Assistance Assistance torque of the current cycle
  * @return boolean TRUE if oscillation detected
  *
+ * Adds the sample to the sliding window of the shared incremental
+ * detector (eps_oscillation.h). Oscillation is detected if:
+ * - More than EPS_OSCILLATION_SIGN_CHANGES sign changes in the window,
+ *   counting only those ending a half-cycle that peaked above
+ *   EPS_OSCILLATION_AMPLITUDE_NM within EPS_OSCILLATION_HALF_CYCLE_SAMPLES
+ * Cost is O(1) per cycle at any EPS_OSCILLATION_WINDOW_SAMPLES.
+ *
  * Requirements: EPS-SR-006
  */
 static FUNC(boolean, EPS_SWC_CODE) EPS_DetectOscillation(
-    P2CONST(float32, AUTOMATIC, EPS_SWC_APPL_CONST) Data,
-    VAR(uint8, AUTOMATIC) Size
+    VAR(float32, AUTOMATIC) Assistance
 )
 {
-    uint8 i;
-    uint8 signChanges = 0U;
-    float32 maxAmplitude = 0.0F;
-    
-    if ((Data == NULL_PTR) || (Size < 3U))
-    {
-        return FALSE;
-    }
-    
-    /* Count sign changes and find maximum amplitude */
-    for (i = 1U; i < Size; i++)
-    {
-        if (((Data[i-1U] > 0.0F) && (Data[i] < 0.0F)) ||
-            ((Data[i-1U] < 0.0F) && (Data[i] > 0.0F)))
-        {
-            signChanges++;
-        }
-        
-        if (fabsf(Data[i]) > maxAmplitude)
-        {
-            maxAmplitude = fabsf(Data[i]);
-        }
-    }
-    
-    /* Oscillation detected if:
-     * - More than 4 sign changes in buffer (frequency > 0.5Hz at 1ms cycle)
-     * - Amplitude > 2Nm
-     */
-    if ((signChanges > 4U) && (maxAmplitude > 2.0F))
+    if (eps_oscillation_update(&EPS_OscillationDetector, Assistance) == true)
     {
         return TRUE;
     }
@@ -0,0 +1,122 @@
+/**
+ * @file eps_assist_curve.c
+ * @brief Electronic Power Steering (EPS) Assistance Curve Tables
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * See eps_assist_curve.h. Bucket i holds the gains at speed
+ * i * speed_step_kmh, computed with the same formulas the assistance
+ * calculation used per cycle; a speed maps to the nearest bucket, so the
+ * gains are off by at most half a bucket of speed.
+ *
+ * Requirements Traceability:
+ * - EPS-FR-002: Base assistance
+ * - EPS-FR-017, EPS-PR-040: Speed-sensitive assistance
+ * - EPS-FR-025: Speed-based return-to-center
+ * - EPS-FR-031: Speed-based damping
+ */
+
+#include "eps_assist_curve.h"
+
+/**
+ * @brief Build the tables from a calibration
+ * @param curve Tables to build
+ * @param config Calibration (not referenced afterwards)
+ * @return bool false on a NULL pointer or a non-positive step or speed range
+ */
+bool eps_assist_curve_init(eps_assist_curve_t* curve, const eps_assist_curve_config_t* config)
+{
+    if (!curve || !config) {
+        return false;
+    }
+
+    if ((config->speed_step_kmh <= 0.0f) || (config->boost_step_nm <= 0.0f) ||
+        (config->high_speed_kmh <= config->low_speed_kmh)) {
+        return false;
+    }
+
+    /* Speed gains - EPS-FR-017, EPS-PR-040, EPS-FR-025, EPS-FR-031 */
+    for (uint16_t i = 0; i < EPS_ASSIST_SPEED_BUCKETS; i++) {
+        float speed = (float)i * config->speed_step_kmh;
+        eps_assist_speed_gains_t* gains = &curve->speed_gains[i];
+
+        if (speed <= config->low_speed_kmh) {
+            gains->speed_factor = 1.0f;
+        } else if (speed >= config->high_speed_kmh) {
+            gains->speed_factor = config->min_speed_factor;
+        } else {
+            float speed_range = config->high_speed_kmh - config->low_speed_kmh;
+            float speed_offset = speed - config->low_speed_kmh;
+            gains->speed_factor = 1.0f - (speed_offset / speed_range) * (1.0f - config->min_speed_factor);
+        }
+
+        gains->rtc_scale = 1.0f + speed * config->rtc_speed_factor;
+        gains->damping_scale = 1.0f + speed * config->damping_speed_factor;
+    }
+
+    curve->inv_speed_step = 1.0f / config->speed_step_kmh;
+
+    /* Boost curve segments - EPS-FR-002 */
+    for (uint16_t i = 0; i < EPS_ASSIST_BOOST_POINTS - 1; i++) {
+        float x0 = (float)i * config->boost_step_nm;
+        float slope = (config->boost_assist_nm[i + 1] - config->boost_assist_nm[i]) / config->boost_step_nm;
+
+        curve->boost_slope[i] = slope;
+        curve->boost_offset[i] = config->boost_assist_nm[i] - slope * x0;
+    }
+
+    curve->inv_boost_step = 1.0f / config->boost_step_nm;
+
+    return true;
+}
+
+/**
+ * @brief Speed-dependent gains
+ * @param curve Tables
+ * @param vehicle_speed_kmh Vehicle speed (rounded to the nearest bucket,
+ *        clamped to the table)
+ * @return const eps_assist_speed_gains_t* Gains of the speed's bucket
+ *
+ * Requirements: EPS-FR-017, EPS-PR-040, EPS-FR-025, EPS-FR-031
+ */
+const eps_assist_speed_gains_t* eps_assist_curve_speed_gains(const eps_assist_curve_t* curve,
+                                                             float vehicle_speed_kmh)
+{
+    float position = vehicle_speed_kmh * curve->inv_speed_step + 0.5f;
+    uint16_t bucket;
+
+    if (!(position > 0.0f)) {
+        bucket = 0;     /* Also NaN */
+    } else if (position >= (float)(EPS_ASSIST_SPEED_BUCKETS - 1)) {
+        bucket = EPS_ASSIST_SPEED_BUCKETS - 1;
+    } else {
+        bucket = (uint16_t)position;
+    }
+
+    return &curve->speed_gains[bucket];
+}
+
+/**
+ * @brief Boost curve: assistance for a driver torque
+ * @param curve Tables
+ * @param driver_torque_nm Driver torque
+ * @return float Assistance in Nm (same sign as the driver torque for a
+ *         non-negative curve)
+ *
+ * Requirements: EPS-FR-002
+ */
+float eps_assist_curve_boost(const eps_assist_curve_t* curve, float driver_torque_nm)
+{
+    float magnitude = (driver_torque_nm < 0.0f) ? -driver_torque_nm : driver_torque_nm;
+    float position = magnitude * curve->inv_boost_step;
+    uint16_t segment = EPS_ASSIST_BOOST_POINTS - 2;
+    float assist;
+
+    if (position < (float)segment) {
+        segment = (uint16_t)position;
+    }
+
+    assist = curve->boost_offset[segment] + curve->boost_slope[segment] * magnitude;
+
+    return (driver_torque_nm < 0.0f) ? -assist : assist;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file eps_assist_curve.h
+ * @brief Electronic Power Steering (EPS) Assistance Curve Tables
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Precomputed gain tables for the assistance calculation:
+ *
+ * - Speed gains: speed factor, return-to-center scale and damping scale,
+ *   tabulated per EPS_ASSIST_SPEED_BUCKETS speed buckets at init. The
+ *   control cycle only maps the speed to its bucket.
+ * - Boost curve: assistance vs driver torque, piecewise linear over
+ *   EPS_ASSIST_BOOST_POINTS equally spaced breakpoints and odd-symmetric.
+ *   Each segment is stored as offset + slope, so evaluating the curve costs
+ *   one multiply-add like the fixed gain it replaces. Beyond the last
+ *   breakpoint the last segment is extended.
+ *
+ * The module depends only on <stdint.h> and <stdbool.h> and is shared by
+ * the standalone EPS code and the AUTOSAR EPS_SWC. The configuration is
+ * calibration data; the tables are rebuilt from it by eps_assist_curve_init().
+ * Both use the boost curve breakpoints defined here.
+ *
+ * Requirements Traceability:
+ * - EPS-FR-002: Base assistance
+ * - EPS-FR-017, EPS-PR-040: Speed-sensitive assistance
+ * - EPS-FR-025: Speed-based return-to-center
+ * - EPS-FR-031: Speed-based damping
+ */
+
+#ifndef EPS_ASSIST_CURVE_H
+#define EPS_ASSIST_CURVE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Table Sizes */
+#define EPS_ASSIST_SPEED_BUCKETS        251     /* 0 to 250 km/h at 1 km/h */
+#define EPS_ASSIST_BOOST_POINTS         9
+
+/* Boost Curve - EPS-FR-002 (assistance vs driver torque, odd-symmetric) */
+#define EPS_BOOST_CURVE_STEP_NM         1.0f    /* Nm - driver torque between breakpoints */
+#define EPS_BOOST_CURVE_ASSIST_NM       { 0.0f, 1.5f, 3.0f, 4.5f, 6.0f, 7.5f, 9.0f, 10.5f, 12.0f }
+
+/* Assistance Curve Calibration */
+typedef struct {
+    float low_speed_kmh;            /* Full assistance at or below */
+    float high_speed_kmh;           /* Minimum assistance at or above */
+    float min_speed_factor;         /* Speed factor at high speed */
+    float rtc_speed_factor;         /* Return-to-center scale per km/h */
+    float damping_speed_factor;     /* Damping scale per km/h */
+    float speed_step_kmh;           /* Speed bucket width */
+    float boost_step_nm;            /* Driver torque between boost breakpoints */
+    float boost_assist_nm[EPS_ASSIST_BOOST_POINTS];     /* Assistance at i * boost_step_nm */
+} eps_assist_curve_config_t;
+
+/* Gains of One Speed Bucket */
+typedef struct {
+    float speed_factor;             /* Base assistance scale */
+    float rtc_scale;                /* Return-to-center scale */
+    float damping_scale;            /* Damping scale */
+} eps_assist_speed_gains_t;
+
+/* Assistance Curve Tables */
+typedef struct {
+    eps_assist_speed_gains_t speed_gains[EPS_ASSIST_SPEED_BUCKETS];
+    float inv_speed_step;           /* Buckets per km/h */
+    float boost_offset[EPS_ASSIST_BOOST_POINTS - 1];   /* Nm - segment value at 0 Nm */
+    float boost_slope[EPS_ASSIST_BOOST_POINTS - 1];    /* Nm/Nm */
+    float inv_boost_step;           /* Segments per Nm */
+} eps_assist_curve_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Build the tables from a calibration
+ * @param curve Tables to build
+ * @param config Calibration (not referenced afterwards)
+ * @return bool false on a NULL pointer or a non-positive step or speed range
+ */
+bool eps_assist_curve_init(eps_assist_curve_t* curve, const eps_assist_curve_config_t* config);
+
+/**
+ * @brief Speed-dependent gains
+ * @param curve Tables
+ * @param vehicle_speed_kmh Vehicle speed (rounded to the nearest bucket,
+ *        clamped to the table)
+ * @return const eps_assist_speed_gains_t* Gains of the speed's bucket
+ *
+ * Requirements: EPS-FR-017, EPS-PR-040, EPS-FR-025, EPS-FR-031
+ */
+const eps_assist_speed_gains_t* eps_assist_curve_speed_gains(const eps_assist_curve_t* curve,
+                                                             float vehicle_speed_kmh);
+
+/**
+ * @brief Boost curve: assistance for a driver torque
+ * @param curve Tables
+ * @param driver_torque_nm Driver torque
+ * @return float Assistance in Nm (same sign as the driver torque for a
+ *         non-negative curve)
+ *
+ * Requirements: EPS-FR-002
+ */
+float eps_assist_curve_boost(const eps_assist_curve_t* curve, float driver_torque_nm);
+
+#endif /* EPS_ASSIST_CURVE_H */
@@ -0,0 +1,306 @@
+/**
+ * @file eps_executor.c
+ * @brief Electronic Power Steering (EPS) Multi-Rate Executor
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * See eps_executor.h. The writer stores into slots[(sequence + 1) & 1]
+ * before publishing sequence + 1. The slot of sequence s is rewritten by
+ * the publish of s + 2, which starts while the sequence still reads s + 1,
+ * so a copy is kept only if the sequence did not move at all.
+ *
+ * Requirements Traceability:
+ * - EPS-IR-057: Field-oriented motor control
+ * - EPS-ER-030: PWM frequency
+ * - EPS-PR-019: Control cycle time
+ * - EPS-PR-051: Performance monitoring
+ */
+
+#include "eps_executor.h"
+#include "eps_foc.h"
+
+/* Slow to fast loop commands */
+static eps_command_mailbox_t g_command_mailbox;
+
+/* Fast loop state (PWM interrupt only) */
+static eps_motor_command_t g_fast_command;      /* Latest command picked up */
+static uint32_t g_fast_sequence = 0;            /* Its mailbox sequence */
+static uint32_t g_ticks_since_command = 0;
+static uint32_t g_slow_phase = 0;               /* Fast ticks into the slow period */
+static uint32_t g_last_start_us = 0;
+static bool g_assisting = false;
+
+static eps_executor_stats_t g_executor_stats;
+
+/* Fault check (slow loop only): the counters at the last check */
+static uint32_t g_checked_foc_faults = 0;
+static uint32_t g_checked_timeout_ticks = 0;
+static uint32_t g_checked_overruns = 0;
+static uint32_t g_checked_sequence = 0;
+static uint32_t g_overrun_cycles = 0;           /* Consecutive checks with overruns */
+
+/* Static Function Prototypes */
+static void eps_executor_idle_pwm(void);
+
+/**
+ * @brief Empty a mailbox
+ * @param mailbox Mailbox
+ */
+void eps_command_mailbox_init(eps_command_mailbox_t* mailbox)
+{
+    if (mailbox) {
+        memset((void*)mailbox, 0, sizeof(eps_command_mailbox_t));
+    }
+}
+
+/**
+ * @brief Publish a command (writer side)
+ * @param mailbox Mailbox
+ * @param command Command (copied)
+ */
+void eps_command_mailbox_publish(eps_command_mailbox_t* mailbox, const eps_motor_command_t* command)
+{
+    uint32_t next = mailbox->sequence + 1U;
+
+    if (next == 0) {
+        next = 2;       /* 0 means empty; skip it but keep the slot parity */
+    }
+
+    mailbox->slots[next & 1U] = *command;
+    mailbox->sequence = next;
+}
+
+/**
+ * @brief Copy the latest command (reader side)
+ * @param mailbox Mailbox
+ * @param command Latest command
+ * @param sequence Sequence number of the command copied
+ * @return bool false if nothing was published yet or every copy was torn
+ */
+bool eps_command_mailbox_read(const eps_command_mailbox_t* mailbox,
+                              eps_motor_command_t* command, uint32_t* sequence)
+{
+    for (uint32_t attempt = 0; attempt < EPS_EXECUTOR_READ_ATTEMPTS; attempt++) {
+        uint32_t before = mailbox->sequence;
+
+        if (before == 0) {
+            return false;
+        }
+
+        *command = mailbox->slots[before & 1U];
+
+        if (mailbox->sequence == before) {
+            *sequence = before;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Initialize the executor (mailbox emptied, statistics cleared)
+ * @return eps_result_t Initialization result
+ *
+ * Requirements: EPS-PR-019
+ */
+eps_result_t eps_executor_init(void)
+{
+    eps_command_mailbox_init(&g_command_mailbox);
+    memset(&g_fast_command, 0, sizeof(eps_motor_command_t));
+    memset(&g_executor_stats, 0, sizeof(eps_executor_stats_t));
+
+    g_fast_sequence = 0;
+    g_ticks_since_command = 0;
+    g_slow_phase = 0;
+    g_last_start_us = 0;
+    g_assisting = false;
+    g_checked_foc_faults = 0;
+    g_checked_timeout_ticks = 0;
+    g_checked_overruns = 0;
+    g_checked_sequence = 0;
+    g_overrun_cycles = 0;
+    eps_motor_control_foc_reset();
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Hand a motor command from the slow loop to the fast loop
+ * @param command Motor command
+ * @return eps_result_t Publish result
+ *
+ * Requirements: EPS-FR-013, EPS-PR-014
+ */
+eps_result_t eps_executor_publish_command(const eps_motor_command_t* command)
+{
+    if (!command) {
+        return EPS_ERROR_NULL_POINTER;
+    }
+
+    eps_command_mailbox_publish(&g_command_mailbox, command);
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Fast loop, called from the PWM interrupt once per PWM period
+ * @return bool true when the slow loop is due (every EPS_EXECUTOR_FAST_PER_SLOW calls)
+ *
+ * Requirements: EPS-IR-057, EPS-ER-030
+ */
+bool eps_executor_pwm_isr(void)
+{
+    const uint32_t start_us = eps_platform_time_us();
+    eps_motor_command_t command;
+    eps_motor_feedback_t feedback;
+    uint16_t duty_cycles[3];
+    uint32_t sequence;
+    uint32_t elapsed_us;
+
+    /* Start-to-start jitter - EPS-PR-051 */
+    if (g_executor_stats.fast_ticks > 0) {
+        uint32_t interval_us = start_us - g_last_start_us;
+
+        eps_latency_histogram_record(&g_executor_stats.jitter_us,
+                                     (interval_us > EPS_EXECUTOR_FAST_PERIOD_US) ?
+                                     (interval_us - EPS_EXECUTOR_FAST_PERIOD_US) :
+                                     (EPS_EXECUTOR_FAST_PERIOD_US - interval_us));
+    }
+    g_last_start_us = start_us;
+
+    /* Latest command from the slow loop */
+    if (eps_command_mailbox_read(&g_command_mailbox, &command, &sequence)) {
+        if (sequence != g_fast_sequence) {
+            g_fast_command = command;
+            g_fast_sequence = sequence;
+            g_ticks_since_command = 0;
+            g_executor_stats.commands_received++;
+        }
+    } else if (g_command_mailbox.sequence != 0) {
+        g_executor_stats.missed_reads++;
+    }
+
+    if (g_ticks_since_command < EPS_EXECUTOR_COMMAND_TIMEOUT_TICKS) {
+        g_ticks_since_command++;
+    }
+
+    /* Current loop - EPS-IR-057 */
+    if ((g_fast_sequence == 0) || !g_fast_command.enable) {
+        eps_executor_idle_pwm();
+    } else if (g_ticks_since_command >= EPS_EXECUTOR_COMMAND_TIMEOUT_TICKS) {
+        g_executor_stats.timeout_ticks++;
+        eps_executor_idle_pwm();
+    } else if (eps_motor_control_get_feedback(&feedback) != EPS_SUCCESS) {
+        g_executor_stats.foc_faults++;
+        eps_executor_idle_pwm();
+    } else {
+        float torque_limit = g_fast_command.current_limit * EPS_MOTOR_TORQUE_CONSTANT;
+        float target_torque = g_fast_command.target_torque;
+
+        if (target_torque > torque_limit) {
+            target_torque = torque_limit;
+        } else if (target_torque < -torque_limit) {
+            target_torque = -torque_limit;
+        }
+
+        if (eps_motor_control_foc_calculate(&feedback, target_torque, duty_cycles) != EPS_SUCCESS) {
+            g_executor_stats.foc_faults++;
+        }
+        g_assisting = true;
+        eps_motor_control_update_pwm(duty_cycles);
+    }
+
+    /* Budget check - EPS-PR-019 */
+    elapsed_us = eps_platform_time_us() - start_us;
+    eps_latency_histogram_record(&g_executor_stats.execution_us, elapsed_us);
+    if (elapsed_us > EPS_EXECUTOR_FAST_BUDGET_US) {
+        g_executor_stats.overruns++;
+    }
+
+    g_executor_stats.fast_ticks++;
+
+    /* Release the slow loop - EPS-PR-019 */
+    g_slow_phase++;
+    if (g_slow_phase >= EPS_EXECUTOR_FAST_PER_SLOW) {
+        g_slow_phase = 0;
+        g_executor_stats.slow_releases++;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Fast loop statistics since eps_executor_init()
+ * @return const eps_executor_stats_t* Statistics
+ *
+ * Requirements: EPS-PR-051
+ */
+const eps_executor_stats_t* eps_executor_get_stats(void)
+{
+    return &g_executor_stats;
+}
+
+/**
+ * @brief Fast loop faults since the previous call (slow loop side, once per cycle)
+ * @return uint32_t EPS_EXECUTOR_FAULT_* bits, 0 if none
+ *
+ * A command timeout is reported only if a command was published since the
+ * previous call; a slow loop that stops publishing on a fault of its own
+ * is not the executor's fault. An overrun is reported once overruns
+ * occurred in EPS_EXECUTOR_OVERRUN_DEBOUNCE consecutive calls.
+ *
+ * Requirements: EPS-IR-057, EPS-SR-050
+ */
+uint32_t eps_executor_get_faults(void)
+{
+    const volatile eps_executor_stats_t* stats = &g_executor_stats;
+    uint32_t foc_faults = stats->foc_faults;
+    uint32_t timeout_ticks = stats->timeout_ticks;
+    uint32_t overruns = stats->overruns;
+    uint32_t sequence = g_command_mailbox.sequence;
+    uint32_t faults = 0;
+
+    if (foc_faults != g_checked_foc_faults) {
+        faults |= EPS_EXECUTOR_FAULT_FEEDBACK;
+    }
+    if ((timeout_ticks != g_checked_timeout_ticks) && (sequence != g_checked_sequence)) {
+        faults |= EPS_EXECUTOR_FAULT_TIMEOUT;
+    }
+
+    /* One late interrupt is not a fault; a sustained overload is */
+    if (overruns != g_checked_overruns) {
+        if (g_overrun_cycles < EPS_EXECUTOR_OVERRUN_DEBOUNCE) {
+            g_overrun_cycles++;
+        }
+    } else {
+        g_overrun_cycles = 0;
+    }
+    if (g_overrun_cycles >= EPS_EXECUTOR_OVERRUN_DEBOUNCE) {
+        faults |= EPS_EXECUTOR_FAULT_OVERRUN;
+    }
+
+    g_checked_foc_faults = foc_faults;
+    g_checked_timeout_ticks = timeout_ticks;
+    g_checked_overruns = overruns;
+    g_checked_sequence = sequence;
+
+    return faults;
+}
+
+/**
+ * @brief Output the zero voltage vector and clear the current loop on entry
+ */
+static void eps_executor_idle_pwm(void)
+{
+    static const uint16_t zero_vector[3] = {
+        EPS_FOC_DUTY_FULL_SCALE / 2, EPS_FOC_DUTY_FULL_SCALE / 2, EPS_FOC_DUTY_FULL_SCALE / 2
+    };
+
+    if (g_assisting) {
+        eps_motor_control_foc_reset();
+        g_assisting = false;
+    }
+
+    eps_motor_control_update_pwm(zero_vector);
+}
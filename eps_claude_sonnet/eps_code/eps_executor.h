@@ -0,0 +1,161 @@
+/**
+ * @file eps_executor.h
+ * @brief Electronic Power Steering (EPS) Multi-Rate Executor
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Splits motor control into two rates:
+ *
+ * - Slow loop (eps_system_task(), every EPS_SYSTEM_CYCLE_TIME_MS): sensors,
+ *   assistance, safety limits; publishes one eps_motor_command_t per cycle
+ * - Fast loop (eps_executor_pwm_isr(), once per PWM period): reads the latest
+ *   command, runs the FOC current loop and updates the PWM duty cycles
+ *
+ * The fast loop is the PWM interrupt handler. Every
+ * EPS_EXECUTOR_FAST_PER_SLOW periods it releases the slow loop, so both
+ * rates derive from the PWM timer. Its work is constant: one mailbox read,
+ * one feedback read, one FOC step and one PWM update; no loops, no waits.
+ * Execution time is checked against EPS_EXECUTOR_FAST_BUDGET_US and the
+ * start-to-start jitter against the nominal period is recorded.
+ *
+ * Commands cross from the slow to the fast loop through a single-writer
+ * mailbox: two slots and a sequence number. The writer fills the slot the
+ * reader is not using, then increments the sequence; the reader copies the
+ * slot of the current sequence and keeps the copy only if the sequence is
+ * unchanged afterwards. Neither side locks or blocks. On a single core the
+ * interrupt cannot be preempted by the writer, so the first copy is always
+ * kept. With the writer on another core, a publish during the copy may be
+ * followed by a write into the slot being copied, so any change of the
+ * sequence discards the copy and the reader tries again (such a port also
+ * needs memory barriers around the sequence accesses).
+ *
+ * If no new command arrives for EPS_EXECUTOR_COMMAND_TIMEOUT_TICKS, the
+ * fast loop stops assisting (zero voltage vector) until the slow loop
+ * publishes again.
+ *
+ * Invalid feedback, command timeouts and overruns are counted by the fast
+ * loop only. Once per cycle the slow loop reports the counters that
+ * advanced since its previous call (eps_executor_get_faults()), so the
+ * bookkeeping is written by one side only, like the mailbox. Nothing is
+ * latched: a fault is reported for the cycles in which it occurred. A single
+ * overrun (one late interrupt) is not a fault; overruns in
+ * EPS_EXECUTOR_OVERRUN_DEBOUNCE consecutive slow cycles are.
+ *
+ * Requirements Traceability:
+ * - EPS-IR-057: Field-oriented motor control
+ * - EPS-ER-030: PWM frequency
+ * - EPS-PR-019: Control cycle time
+ * - EPS-PR-051: Performance monitoring
+ */
+
+#ifndef EPS_EXECUTOR_H
+#define EPS_EXECUTOR_H
+
+#include "eps_main.h"
+#include "eps_motor_control.h"
+
+/* Executor Constants */
+#define EPS_EXECUTOR_FAST_RATE_HZ           EPS_MOTOR_PWM_FREQUENCY_HZ
+#define EPS_EXECUTOR_FAST_PERIOD_US         (1000000UL / EPS_EXECUTOR_FAST_RATE_HZ)
+#define EPS_EXECUTOR_FAST_PER_SLOW          (EPS_SYSTEM_CYCLE_TIME_MS * 1000UL / EPS_EXECUTOR_FAST_PERIOD_US)
+#define EPS_EXECUTOR_FAST_BUDGET_US         10      /* us - 20% of the PWM period */
+#define EPS_EXECUTOR_COMMAND_TIMEOUT_TICKS  (3UL * EPS_EXECUTOR_FAST_PER_SLOW)
+#define EPS_EXECUTOR_READ_ATTEMPTS          2       /* Mailbox copies per fast tick */
+#define EPS_EXECUTOR_OVERRUN_DEBOUNCE       3       /* Consecutive slow cycles with overruns */
+
+/* Fast Loop Fault Bits (eps_executor_get_faults()) */
+#define EPS_EXECUTOR_FAULT_FEEDBACK         0x01U   /* Invalid motor feedback or FOC step */
+#define EPS_EXECUTOR_FAULT_TIMEOUT          0x02U   /* Assistance stopped for lack of a fresh command */
+#define EPS_EXECUTOR_FAULT_OVERRUN          0x04U   /* Fast loop over budget, debounced */
+
+/* Motor Command Mailbox (single writer, single reader) */
+typedef struct {
+    volatile eps_motor_command_t slots[2];
+    volatile uint32_t sequence;     /* Commands published; latest in slots[sequence & 1], 0: none */
+} eps_command_mailbox_t;
+
+/* Fast Loop Statistics */
+typedef struct {
+    uint32_t fast_ticks;            /* Fast loop executions */
+    uint32_t slow_releases;         /* Slow loop releases */
+    uint32_t commands_received;     /* New commands picked up */
+    uint32_t missed_reads;          /* Mailbox copies still torn after all attempts */
+    uint32_t timeout_ticks;         /* Ticks without assistance for lack of a fresh command */
+    uint32_t foc_faults;            /* Ticks with invalid motor feedback */
+    uint32_t overruns;              /* Ticks over EPS_EXECUTOR_FAST_BUDGET_US */
+    eps_latency_histogram_t jitter_us;      /* |start-to-start - EPS_EXECUTOR_FAST_PERIOD_US| */
+    eps_latency_histogram_t execution_us;   /* Start to end of the fast loop */
+} eps_executor_stats_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Empty a mailbox
+ * @param mailbox Mailbox
+ */
+void eps_command_mailbox_init(eps_command_mailbox_t* mailbox);
+
+/**
+ * @brief Publish a command (writer side)
+ * @param mailbox Mailbox
+ * @param command Command (copied)
+ */
+void eps_command_mailbox_publish(eps_command_mailbox_t* mailbox, const eps_motor_command_t* command);
+
+/**
+ * @brief Copy the latest command (reader side)
+ * @param mailbox Mailbox
+ * @param command Latest command
+ * @param sequence Sequence number of the command copied
+ * @return bool false if nothing was published yet or every copy was torn
+ */
+bool eps_command_mailbox_read(const eps_command_mailbox_t* mailbox,
+                              eps_motor_command_t* command, uint32_t* sequence);
+
+/**
+ * @brief Initialize the executor (mailbox emptied, statistics cleared)
+ * @return eps_result_t Initialization result
+ *
+ * Requirements: EPS-PR-019
+ */
+eps_result_t eps_executor_init(void);
+
+/**
+ * @brief Hand a motor command from the slow loop to the fast loop
+ * @param command Motor command
+ * @return eps_result_t Publish result
+ *
+ * Requirements: EPS-FR-013, EPS-PR-014
+ */
+eps_result_t eps_executor_publish_command(const eps_motor_command_t* command);
+
+/**
+ * @brief Fast loop, called from the PWM interrupt once per PWM period
+ * @return bool true when the slow loop is due (every EPS_EXECUTOR_FAST_PER_SLOW calls)
+ *
+ * Requirements: EPS-IR-057, EPS-ER-030
+ */
+bool eps_executor_pwm_isr(void);
+
+/**
+ * @brief Fast loop statistics since eps_executor_init()
+ * @return const eps_executor_stats_t* Statistics
+ *
+ * Requirements: EPS-PR-051
+ */
+const eps_executor_stats_t* eps_executor_get_stats(void);
+
+/**
+ * @brief Fast loop faults since the previous call (slow loop side, once per cycle)
+ * @return uint32_t EPS_EXECUTOR_FAULT_* bits, 0 if none
+ *
+ * A command timeout is reported only if a command was published since the
+ * previous call; a slow loop that stops publishing on a fault of its own
+ * is not the executor's fault. An overrun is reported once overruns
+ * occurred in EPS_EXECUTOR_OVERRUN_DEBOUNCE consecutive calls.
+ *
+ * Requirements: EPS-IR-057, EPS-SR-050
+ */
+uint32_t eps_executor_get_faults(void);
+
+#endif /* EPS_EXECUTOR_H */
@@ -0,0 +1,349 @@
+/**
+ * @file eps_executor_test.c
+ * @brief Electronic Power Steering (EPS) Executor Checks
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Checks the multi-rate executor (eps_executor.h) with the production
+ * modules and the SIL stand-ins (eps_sil.h), on a test time base that
+ * advances one PWM period per interrupt:
+ *
+ * - Mailbox: empty, latest command, sequence wrap
+ * - Fault reporting: bits are not latched, overruns are debounced, a
+ *   timeout needs a publish since the previous check
+ * - System: eps_system_task() driven by the PWM interrupt; healthy run,
+ *   invalid motor feedback, stalled slow loop, single and sustained
+ *   overruns, sensor fault. Fast loop faults report one current loop DTC
+ *   and degrade operation; they never force fail-safe.
+ *
+ * Exits non-zero if a check fails.
+ *
+ * Requirements Traceability:
+ * - EPS-IR-057: Field-oriented motor control
+ * - EPS-PR-019: Control cycle time
+ * - EPS-SR-050: Fault response
+ */
+
+#include <stdio.h>
+#include "eps_executor.h"
+#include "eps_sensors.h"
+#include "eps_sil.h"
+
+/* Check Configuration */
+#define TEST_OVERRUN_US             (2U * EPS_EXECUTOR_FAST_BUDGET_US)
+#define TEST_SETTLE_CYCLES          100U
+
+/* Check State */
+static uint32_t g_test_failures = 0;
+static uint32_t g_test_now_us = 0;
+static uint32_t g_test_isr_cost_us = 0;     /* Added by each time read in the next interrupt */
+static bool g_test_sensor_disconnected = false;
+
+/* Function Prototypes */
+static void test_check(bool condition, const char* description);
+static void test_command(eps_motor_command_t* command, float target_torque);
+static bool test_isr(uint32_t cost_us);
+static void test_cycle(bool run_task);
+static bool test_system_start(void);
+static void test_mailbox(void);
+static void test_fault_reporting(void);
+static void test_system(void);
+
+/**
+ * @brief Check entry point
+ */
+int main(void)
+{
+    printf("=== EPS Executor Checks ===\n");
+
+    test_mailbox();
+    test_fault_reporting();
+    test_system();
+
+    printf("\n%s\n", (g_test_failures == 0) ? "✓ Executor checks passed" :
+                                               "✗ Executor checks failed");
+
+    return (g_test_failures == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Microsecond time base: the current PWM period's start, plus the
+ *        injected interrupt cost on each read
+ * @return uint32_t Time in microseconds
+ */
+uint32_t eps_platform_time_us(void)
+{
+    uint32_t now_us = g_test_now_us;
+
+    g_test_now_us += g_test_isr_cost_us;
+    return now_us;
+}
+
+/**
+ * @brief Raw sensor samples: wheel centered and released, primary torque
+ *        channel optionally disconnected
+ * @param block Raw sample block output
+ * @return eps_result_t Acquisition result
+ */
+eps_result_t eps_platform_sensors_acquire(eps_sensor_raw_block_t* block)
+{
+    for (uint32_t i = 0; i < EPS_SENSOR_COUNT; i++) {
+        block->counts[i] = (EPS_SENSOR_SPAN_LOW_COUNTS + EPS_SENSOR_SPAN_HIGH_COUNTS) / 2;
+    }
+    if (g_test_sensor_disconnected) {
+        block->counts[EPS_SENSOR_TORQUE_PRIMARY] = 0;
+    }
+    block->vehicle_speed = 0.0f;
+    block->timestamp = g_test_now_us / 1000U;
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Record and print one check
+ * @param condition Check passed
+ * @param description What was checked
+ */
+static void test_check(bool condition, const char* description)
+{
+    printf("  %s %s\n", condition ? "✓" : "✗", description);
+    if (!condition) {
+        g_test_failures++;
+    }
+}
+
+/**
+ * @brief An enabled motor command
+ * @param command Command output
+ * @param target_torque Torque (identifies the command)
+ */
+static void test_command(eps_motor_command_t* command, float target_torque)
+{
+    memset(command, 0, sizeof(eps_motor_command_t));
+    command->target_torque = target_torque;
+    command->current_limit = EPS_MOTOR_MAX_CURRENT_A;
+    command->enable = true;
+}
+
+/**
+ * @brief Raise the PWM interrupt for one period
+ * @param cost_us Execution time the interrupt measures
+ * @return bool Slow loop due
+ */
+static bool test_isr(uint32_t cost_us)
+{
+    uint32_t period_start_us = g_test_now_us;
+    bool task_due;
+
+    g_test_isr_cost_us = cost_us;
+    task_due = eps_executor_pwm_isr();
+    g_test_isr_cost_us = 0;
+    g_test_now_us = period_start_us + EPS_EXECUTOR_FAST_PERIOD_US;
+
+    return task_due;
+}
+
+/**
+ * @brief One slow cycle: PWM interrupts until the slow loop is due
+ * @param run_task false: the slow loop misses its cycle (stalled)
+ */
+static void test_cycle(bool run_task)
+{
+    while (!test_isr(0)) {
+    }
+
+    if (run_task) {
+        (void)eps_system_task();
+    }
+}
+
+/**
+ * @brief Fresh system on the stand-ins, settled in normal operation
+ * @return bool System initialized and in normal operation
+ */
+static bool test_system_start(void)
+{
+    eps_sil_reset();
+    g_test_sensor_disconnected = false;
+
+    if (eps_system_init() != EPS_SUCCESS) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < TEST_SETTLE_CYCLES; i++) {
+        test_cycle(true);
+    }
+
+    return eps_get_system_state()->operating_mode == EPS_MODE_NORMAL;
+}
+
+/**
+ * @brief Mailbox publish and read
+ */
+static void test_mailbox(void)
+{
+    eps_command_mailbox_t mailbox;
+    eps_motor_command_t command;
+    eps_motor_command_t copy;
+    uint32_t sequence = 0;
+
+    printf("\nMailbox:\n");
+
+    eps_command_mailbox_init(&mailbox);
+    test_check(!eps_command_mailbox_read(&mailbox, &copy, &sequence),
+               "empty mailbox has no command");
+
+    test_command(&command, 1.0f);
+    eps_command_mailbox_publish(&mailbox, &command);
+    test_command(&command, 2.0f);
+    eps_command_mailbox_publish(&mailbox, &command);
+    test_check(eps_command_mailbox_read(&mailbox, &copy, &sequence) &&
+               (copy.target_torque == 2.0f) && (sequence == 2),
+               "read returns the latest command and its sequence");
+
+    mailbox.sequence = UINT32_MAX;
+    test_command(&command, 3.0f);
+    eps_command_mailbox_publish(&mailbox, &command);
+    test_check((mailbox.sequence == 2) &&
+               eps_command_mailbox_read(&mailbox, &copy, &sequence) &&
+               (copy.target_torque == 3.0f) && (sequence == 2),
+               "sequence wrap skips 0 and keeps the slot parity");
+}
+
+/**
+ * @brief eps_executor_get_faults: clear on read, debounce, timeout rule
+ */
+static void test_fault_reporting(void)
+{
+    eps_motor_command_t command;
+    uint32_t faults;
+    bool debounced = true;
+
+    printf("\nFault reporting:\n");
+
+    eps_sil_reset();
+    eps_executor_init();
+    test_command(&command, 0.0f);
+    eps_executor_publish_command(&command);
+
+    for (uint32_t i = 0; i < EPS_EXECUTOR_FAST_PER_SLOW; i++) {
+        (void)test_isr(0);
+    }
+    test_check(eps_executor_get_faults() == 0, "healthy fast loop reports nothing");
+
+    eps_sil_set_motor_feedback_valid(false);
+    (void)test_isr(0);
+    eps_sil_set_motor_feedback_valid(true);
+    faults = eps_executor_get_faults();
+    test_check((faults == EPS_EXECUTOR_FAULT_FEEDBACK) && (eps_executor_get_faults() == 0),
+               "invalid feedback reported once, then cleared");
+
+    for (uint32_t check = 1; check < EPS_EXECUTOR_OVERRUN_DEBOUNCE; check++) {
+        eps_executor_publish_command(&command);
+        (void)test_isr(TEST_OVERRUN_US);
+        debounced = debounced && (eps_executor_get_faults() == 0);
+    }
+    test_check(debounced, "overruns below the debounce count are not reported");
+
+    eps_executor_publish_command(&command);
+    (void)test_isr(TEST_OVERRUN_US);
+    test_check(eps_executor_get_faults() == EPS_EXECUTOR_FAULT_OVERRUN,
+               "overruns in consecutive checks are reported");
+
+    eps_executor_publish_command(&command);
+    (void)test_isr(0);
+    test_check(eps_executor_get_faults() == 0, "overrun cleared after a clean check");
+
+    for (uint32_t i = 0; i <= EPS_EXECUTOR_COMMAND_TIMEOUT_TICKS; i++) {
+        (void)test_isr(0);
+    }
+    test_check(eps_executor_get_faults() == 0,
+               "timeout without a publish since the last check is not reported");
+
+    eps_executor_publish_command(&command);
+    (void)test_isr(0);
+    (void)eps_executor_get_faults();
+    eps_executor_publish_command(&command);
+    for (uint32_t i = 0; i <= EPS_EXECUTOR_COMMAND_TIMEOUT_TICKS; i++) {
+        (void)test_isr(0);
+    }
+    test_check(eps_executor_get_faults() == EPS_EXECUTOR_FAULT_TIMEOUT,
+               "timeout after a publish is reported");
+}
+
+/**
+ * @brief Fast loop faults under eps_system_task()
+ */
+static void test_system(void)
+{
+    bool started;
+    bool normal = true;
+
+    printf("\nSystem:\n");
+
+    /* Healthy */
+    started = test_system_start();
+    for (uint32_t i = 0; i < 1000U; i++) {
+        test_cycle(true);
+    }
+    test_check(started && (eps_get_system_state()->operating_mode == EPS_MODE_NORMAL) &&
+               (eps_sil_get_dtc_total() == 0) && (eps_executor_get_stats()->commands_received > 0),
+               "healthy: no DTC, normal operation");
+
+    /* Invalid motor feedback */
+    started = test_system_start();
+    eps_sil_set_motor_feedback_valid(false);
+    for (uint32_t i = 0; i < 100U; i++) {
+        test_cycle(true);
+    }
+    test_check(started && (eps_sil_get_dtc_count(EPS_DTC_CURRENT_LOOP_FAULT) == 1) &&
+               (eps_get_system_state()->operating_mode == EPS_MODE_DEGRADED) &&
+               !eps_sil_motor_disabled(),
+               "invalid feedback: one current loop DTC, degraded");
+
+    /* Slow loop stalled for 5 cycles */
+    started = test_system_start();
+    for (uint32_t i = 0; i < 5U; i++) {
+        test_cycle(false);
+    }
+    for (uint32_t i = 0; i < 10U; i++) {
+        test_cycle(true);
+    }
+    test_check(started && (eps_executor_get_stats()->timeout_ticks > 0) &&
+               (eps_sil_get_dtc_count(EPS_DTC_CURRENT_LOOP_FAULT) == 1) &&
+               (eps_get_system_state()->operating_mode == EPS_MODE_DEGRADED),
+               "stalled slow loop: timeout, one current loop DTC, degraded");
+
+    /* One late interrupt per cycle, in non-consecutive cycles */
+    started = test_system_start();
+    for (uint32_t i = 0; i < 100U; i++) {
+        if ((i % 2U) == 0) {
+            (void)test_isr(TEST_OVERRUN_US);
+        }
+        test_cycle(true);
+        normal = normal && (eps_get_system_state()->operating_mode == EPS_MODE_NORMAL);
+    }
+    test_check(started && normal && (eps_executor_get_stats()->overruns == 50U) &&
+               (eps_sil_get_dtc_total() == 0),
+               "isolated overruns: no DTC, normal operation");
+
+    /* Overruns in consecutive cycles */
+    started = test_system_start();
+    for (uint32_t i = 0; i < EPS_EXECUTOR_OVERRUN_DEBOUNCE + 2U; i++) {
+        (void)test_isr(TEST_OVERRUN_US);
+        test_cycle(true);
+    }
+    test_check(started && (eps_sil_get_dtc_count(EPS_DTC_CURRENT_LOOP_FAULT) == 1) &&
+               (eps_get_system_state()->operating_mode == EPS_MODE_DEGRADED),
+               "sustained overruns: one current loop DTC, degraded");
+
+    /* Sensor fault: the slow loop stops publishing on its own fault */
+    started = test_system_start();
+    g_test_sensor_disconnected = true;
+    for (uint32_t i = 0; i < 10U; i++) {
+        test_cycle(true);
+    }
+    test_check(started && (eps_sil_get_dtc_count(EPS_DTC_CURRENT_LOOP_FAULT) == 0) &&
+               (eps_sil_get_dtc_count(EPS_DTC_TORQUE_SENSOR_FAULT) == 1),
+               "sensor fault: torque sensor DTC, no current loop DTC");
+}
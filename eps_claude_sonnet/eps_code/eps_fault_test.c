@@ -0,0 +1,289 @@
+/**
+ * @file eps_fault_test.c
+ * @brief Electronic Power Steering (EPS) Fault Accumulator Checks
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Checks the per-cycle fault accumulator and its resolution in
+ * eps_system_task(), with the production modules on the SIL stand-ins
+ * (eps_sil.h) and faults injected at the raw sensor block and the motor
+ * feedback:
+ *
+ * - A stage fault ends the cycle: later stages are skipped and the
+ *   cycle returns the fault's result
+ * - A persisting fault reports its DTC once; a fault that clears and
+ *   returns is reported again
+ * - Severity: critical faults enter fail-safe and disable the motor,
+ *   major faults (oscillation, current loop) degrade operation; only
+ *   init leaves fail-safe; several faults in one cycle take the most severe
+ * - Flag-only faults (current loop) do not skip stages
+ *
+ * Exits non-zero if a check fails.
+ *
+ * Requirements Traceability:
+ * - EPS-SR-050, EPS-SR-051, EPS-SR-052: Fault response
+ * - EPS-SR-036: Degraded operation
+ * - EPS-DR-031: Diagnostic trouble codes
+ */
+
+#include <stdio.h>
+#include "eps_executor.h"
+#include "eps_sensors.h"
+#include "eps_sil.h"
+
+/* Check Configuration */
+#define TEST_SETTLE_CYCLES          100U
+#define TEST_FAULT_CYCLES           50U
+#define TEST_MID_SPAN_COUNTS        ((EPS_SENSOR_SPAN_LOW_COUNTS + EPS_SENSOR_SPAN_HIGH_COUNTS) / 2)
+#define TEST_TORQUE_COUNTS_PER_NM   ((float)(EPS_SENSOR_SPAN_HIGH_COUNTS - EPS_SENSOR_SPAN_LOW_COUNTS) / \
+                                     (2.0f * EPS_TORQUE_SENSOR_RANGE_NM))
+#define TEST_SHIMMY_HZ              3.0f    /* Within the detected 1-5 Hz band */
+#define TEST_SHIMMY_NM              3.0f    /* Above EPS_OSCILLATION_AMPLITUDE_NM */
+
+/* Check State */
+static uint32_t g_test_failures = 0;
+static uint32_t g_test_now_us = 0;
+static float g_test_driver_torque_nm = 0.0f;
+static bool g_test_sensor_disconnected = false;
+static eps_result_t g_test_acquire_result = EPS_SUCCESS;
+
+/* Function Prototypes */
+static void test_check(bool condition, const char* description);
+static eps_result_t test_cycle(void);
+static bool test_cycles(uint32_t cycles, eps_result_t expected);
+static bool test_system_start(void);
+static eps_operating_mode_t test_mode(void);
+static void test_stage_skip(void);
+static void test_rising_edge(void);
+static void test_severity(void);
+
+/**
+ * @brief Check entry point
+ */
+int main(void)
+{
+    printf("=== EPS Fault Accumulator Checks ===\n");
+
+    test_stage_skip();
+    test_rising_edge();
+    test_severity();
+
+    printf("\n%s\n", (g_test_failures == 0) ? "✓ Fault accumulator checks passed" :
+                                               "✗ Fault accumulator checks failed");
+
+    return (g_test_failures == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Microsecond time base: advanced one PWM period per interrupt
+ * @return uint32_t Time in microseconds
+ */
+uint32_t eps_platform_time_us(void)
+{
+    return g_test_now_us;
+}
+
+/**
+ * @brief Raw sample block: mid-span except the driver torque on both torque
+ *        channels; optionally disconnected or failing
+ * @param block Raw sample block output
+ * @return eps_result_t g_test_acquire_result
+ */
+eps_result_t eps_platform_sensors_acquire(eps_sensor_raw_block_t* block)
+{
+    int32_t torque_counts = (int32_t)lroundf(g_test_driver_torque_nm * TEST_TORQUE_COUNTS_PER_NM);
+
+    for (uint32_t i = 0; i < EPS_SENSOR_COUNT; i++) {
+        block->counts[i] = TEST_MID_SPAN_COUNTS;
+    }
+    block->counts[EPS_SENSOR_TORQUE_PRIMARY] = (uint16_t)(TEST_MID_SPAN_COUNTS + torque_counts);
+    block->counts[EPS_SENSOR_TORQUE_SECONDARY] = (uint16_t)(TEST_MID_SPAN_COUNTS - torque_counts);
+    if (g_test_sensor_disconnected) {
+        block->counts[EPS_SENSOR_TORQUE_PRIMARY] = 0;
+    }
+    block->vehicle_speed = 0.0f;
+    block->timestamp = g_test_now_us / 1000U;
+
+    return g_test_acquire_result;
+}
+
+/**
+ * @brief Record and print one check
+ * @param condition Check passed
+ * @param description What was checked
+ */
+static void test_check(bool condition, const char* description)
+{
+    printf("  %s %s\n", condition ? "✓" : "✗", description);
+    if (!condition) {
+        g_test_failures++;
+    }
+}
+
+/**
+ * @brief One slow cycle: PWM interrupts until the slow loop is due, then
+ *        the system task
+ * @return eps_result_t System task result
+ */
+static eps_result_t test_cycle(void)
+{
+    bool task_due = false;
+
+    while (!task_due) {
+        task_due = eps_executor_pwm_isr();
+        g_test_now_us += EPS_EXECUTOR_FAST_PERIOD_US;
+    }
+
+    return eps_system_task();
+}
+
+/**
+ * @brief Run cycles
+ * @param cycles Number of cycles
+ * @param expected Expected result of every cycle
+ * @return bool Every cycle returned the expected result
+ */
+static bool test_cycles(uint32_t cycles, eps_result_t expected)
+{
+    bool as_expected = true;
+
+    for (uint32_t i = 0; i < cycles; i++) {
+        as_expected = (test_cycle() == expected) && as_expected;
+    }
+
+    return as_expected;
+}
+
+/**
+ * @brief Fresh system on the stand-ins, settled in normal operation
+ * @return bool System initialized and in normal operation
+ */
+static bool test_system_start(void)
+{
+    eps_sil_reset();
+    g_test_driver_torque_nm = 0.0f;
+    g_test_sensor_disconnected = false;
+    g_test_acquire_result = EPS_SUCCESS;
+
+    if (eps_system_init() != EPS_SUCCESS) {
+        return false;
+    }
+
+    return test_cycles(TEST_SETTLE_CYCLES, EPS_SUCCESS) && (test_mode() == EPS_MODE_NORMAL);
+}
+
+/**
+ * @brief Current operating mode
+ */
+static eps_operating_mode_t test_mode(void)
+{
+    return eps_get_system_state()->operating_mode;
+}
+
+/**
+ * @brief A stage fault ends the cycle with its result; a flag-only fault
+ *        does not
+ */
+static void test_stage_skip(void)
+{
+    uint32_t commands;
+    bool started;
+
+    printf("\nStage skip:\n");
+
+    /* The fast loop picks up the last healthy command in the first cycle */
+    started = test_system_start();
+    g_test_acquire_result = EPS_ERROR_TIMEOUT;
+    started = started && (test_cycle() == EPS_ERROR_TIMEOUT);
+    commands = eps_executor_get_stats()->commands_received;
+    test_check(started && test_cycles(TEST_FAULT_CYCLES, EPS_ERROR_TIMEOUT) &&
+               (eps_executor_get_stats()->commands_received == commands),
+               "sensor read error: cycle returns it, no motor command published");
+
+    started = test_system_start();
+    commands = eps_executor_get_stats()->commands_received;
+    eps_sil_set_motor_feedback_valid(false);
+    test_check(started && test_cycles(TEST_FAULT_CYCLES, EPS_SUCCESS) &&
+               (eps_executor_get_stats()->commands_received == commands + TEST_FAULT_CYCLES),
+               "current loop fault: cycle goes on, every command published");
+}
+
+/**
+ * @brief DTCs on the rising edge of a fault only
+ */
+static void test_rising_edge(void)
+{
+    bool started;
+
+    printf("\nRising edge:\n");
+
+    started = test_system_start();
+    eps_sil_set_motor_feedback_valid(false);
+    (void)test_cycles(TEST_FAULT_CYCLES, EPS_SUCCESS);
+    test_check(started && (eps_sil_get_dtc_count(EPS_DTC_CURRENT_LOOP_FAULT) == 1) &&
+               (eps_sil_get_dtc_total() == 1),
+               "persisting fault reports its DTC once");
+
+    eps_sil_set_motor_feedback_valid(true);
+    (void)test_cycles(TEST_FAULT_CYCLES, EPS_SUCCESS);
+    eps_sil_set_motor_feedback_valid(false);
+    (void)test_cycles(TEST_FAULT_CYCLES, EPS_SUCCESS);
+    test_check(eps_sil_get_dtc_count(EPS_DTC_CURRENT_LOOP_FAULT) == 2,
+               "fault that clears and returns is reported again");
+}
+
+/**
+ * @brief Operating mode from the most severe new fault
+ */
+static void test_severity(void)
+{
+    bool started;
+    bool detected = false;
+
+    printf("\nSeverity:\n");
+
+    /* Critical */
+    started = test_system_start();
+    g_test_sensor_disconnected = true;
+    test_check(started && test_cycles(TEST_FAULT_CYCLES, EPS_ERROR_SENSOR_FAULT) &&
+               (test_mode() == EPS_MODE_FAIL_SAFE) && eps_sil_motor_disabled() &&
+               (eps_sil_get_dtc_count(EPS_DTC_TORQUE_SENSOR_FAULT) == 1),
+               "sensor fault (critical): fail-safe, motor disabled, one DTC");
+
+    /* Recovery does not leave fail-safe */
+    g_test_sensor_disconnected = false;
+    (void)test_cycles(TEST_FAULT_CYCLES, EPS_SUCCESS);
+    test_check(test_mode() == EPS_MODE_FAIL_SAFE, "fail-safe kept after the sensor recovers");
+
+    /* Critical after major */
+    started = test_system_start();
+    eps_sil_set_motor_feedback_valid(false);
+    (void)test_cycles(TEST_FAULT_CYCLES, EPS_SUCCESS);
+    started = started && (test_mode() == EPS_MODE_DEGRADED);
+    g_test_sensor_disconnected = true;
+    (void)test_cycles(TEST_FAULT_CYCLES, EPS_ERROR_SENSOR_FAULT);
+    test_check(started && (test_mode() == EPS_MODE_FAIL_SAFE) && eps_sil_motor_disabled(),
+               "critical fault in degraded operation: fail-safe");
+
+    /* Major: oscillation detected in the assistance pipeline */
+    started = test_system_start();
+    for (uint32_t cycle = 0; (cycle < 3U * EPS_OSCILLATION_WINDOW_SAMPLES) && !detected; cycle++) {
+        g_test_driver_torque_nm = TEST_SHIMMY_NM *
+            sinf(2.0f * 3.14159265f * TEST_SHIMMY_HZ * (float)cycle * (EPS_SYSTEM_CYCLE_TIME_MS / 1000.0f));
+        detected = (test_cycle() == EPS_ERROR_OSCILLATION_DETECTED);
+    }
+    test_check(started && detected && (test_mode() == EPS_MODE_DEGRADED) &&
+               !eps_sil_motor_disabled() &&
+               (eps_sil_get_dtc_count(EPS_DTC_OSCILLATION_DETECTED) == 1),
+               "oscillation (major): degraded, motor enabled, one DTC");
+
+    /* Critical and major in one cycle */
+    started = test_system_start();
+    eps_sil_set_motor_feedback_valid(false);
+    g_test_sensor_disconnected = true;
+    test_check(started && (test_cycle() == EPS_ERROR_SENSOR_FAULT) &&
+               (test_mode() == EPS_MODE_FAIL_SAFE) &&
+               (eps_sil_get_dtc_count(EPS_DTC_TORQUE_SENSOR_FAULT) == 1) &&
+               (eps_sil_get_dtc_count(EPS_DTC_CURRENT_LOOP_FAULT) == 1),
+               "critical and major in one cycle: both DTCs, fail-safe");
+}
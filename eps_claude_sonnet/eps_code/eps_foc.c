@@ -0,0 +1,544 @@
+/**
+ * @file eps_foc.c
+ * @brief Electronic Power Steering (EPS) Field-Oriented Control Kernel
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * See eps_foc.h. The kernels are straight-line code apart from the
+ * clamps: no divisions, no libm calls and no data-dependent loops, so the
+ * execution time is the same every PWM period.
+ *
+ * Requirements Traceability:
+ * - EPS-IR-057: Field-oriented motor control
+ * - EPS-ER-030: PWM frequency
+ * - EPS-ER-032: Motor current control
+ */
+
+#include "eps_foc.h"
+
+/* Quarter-Wave Sine Table */
+#define EPS_FOC_TABLE_BITS              8
+#define EPS_FOC_TABLE_SIZE              (1U << EPS_FOC_TABLE_BITS)
+#define EPS_FOC_FRACTION_BITS           (30 - EPS_FOC_TABLE_BITS)
+#define EPS_FOC_FRACTION_MASK           ((1UL << EPS_FOC_FRACTION_BITS) - 1U)
+
+/* Constants */
+#define EPS_FOC_INV_SQRT3               0.57735027f
+#define EPS_FOC_SQRT3_2                 0.86602540f
+#define EPS_FOC_Q31_SCALE               2147483648.0f          /* 2^31 */
+#define EPS_FOC_Q31_TO_FLOAT            (1.0f / EPS_FOC_Q31_SCALE)
+#define EPS_FOC_Q31_INV_SQRT3           1239850262             /* 1/sqrt(3) */
+#define EPS_FOC_Q31_SQRT3_2             1859775393             /* sqrt(3)/2 */
+#define EPS_FOC_Q31_HALF                0x40000000
+#define EPS_FOC_INV_TORQUE_CONSTANT     (1.0f / EPS_MOTOR_TORQUE_CONSTANT)     /* A/Nm, folded at compile time */
+
+/* sin(i * 90 deg / 256) in Q31, i = 0..256 */
+static const eps_q31_t g_foc_sin_table[EPS_FOC_TABLE_SIZE + 1] = {
+    0, 13176712, 26352928, 39528151, 52701887, 65873638,
+    79042909, 92209205, 105372028, 118530885, 131685278, 144834714,
+    157978697, 171116733, 184248325, 197372981, 210490206, 223599506,
+    236700388, 249792358, 262874923, 275947592, 289009871, 302061269,
+    315101295, 328129457, 341145265, 354148230, 367137861, 380113669,
+    393075166, 406021865, 418953276, 431868915, 444768294, 457650927,
+    470516330, 483364019, 496193509, 509004318, 521795963, 534567963,
+    547319836, 560051104, 572761285, 585449903, 598116479, 610760536,
+    623381598, 635979190, 648552838, 661102068, 673626408, 686125387,
+    698598533, 711045377, 723465451, 735858287, 748223418, 760560380,
+    772868706, 785147934, 797397602, 809617249, 821806413, 833964638,
+    846091463, 858186435, 870249095, 882278992, 894275671, 906238681,
+    918167572, 930061894, 941921200, 953745043, 965532978, 977284562,
+    988999351, 1000676905, 1012316784, 1023918550, 1035481766, 1047005996,
+    1058490808, 1069935768, 1081340445, 1092704411, 1104027237, 1115308496,
+    1126547765, 1137744621, 1148898640, 1160009405, 1171076495, 1182099496,
+    1193077991, 1204011567, 1214899813, 1225742318, 1236538675, 1247288478,
+    1257991320, 1268646800, 1279254516, 1289814068, 1300325060, 1310787095,
+    1321199781, 1331562723, 1341875533, 1352137822, 1362349204, 1372509294,
+    1382617710, 1392674072, 1402678000, 1412629117, 1422527051, 1432371426,
+    1442161874, 1451898025, 1461579514, 1471205974, 1480777044, 1490292364,
+    1499751576, 1509154322, 1518500250, 1527789007, 1537020244, 1546193612,
+    1555308768, 1564365367, 1573363068, 1582301533, 1591180426, 1599999411,
+    1608758157, 1617456335, 1626093616, 1634669676, 1643184191, 1651636841,
+    1660027308, 1668355276, 1676620432, 1684822463, 1692961062, 1701035922,
+    1709046739, 1716993211, 1724875040, 1732691928, 1740443581, 1748129707,
+    1755750017, 1763304224, 1770792044, 1778213194, 1785567396, 1792854372,
+    1800073849, 1807225553, 1814309216, 1821324572, 1828271356, 1835149306,
+    1841958164, 1848697674, 1855367581, 1861967634, 1868497586, 1874957189,
+    1881346202, 1887664383, 1893911494, 1900087301, 1906191570, 1912224073,
+    1918184581, 1924072871, 1929888720, 1935631910, 1941302225, 1946899451,
+    1952423377, 1957873796, 1963250501, 1968553292, 1973781967, 1978936331,
+    1984016189, 1989021350, 1993951625, 1998806829, 2003586779, 2008291295,
+    2012920201, 2017473321, 2021950484, 2026351522, 2030676269, 2034924562,
+    2039096241, 2043191150, 2047209133, 2051150040, 2055013723, 2058800036,
+    2062508835, 2066139983, 2069693342, 2073168777, 2076566160, 2079885360,
+    2083126254, 2086288720, 2089372638, 2092377892, 2095304370, 2098151960,
+    2100920556, 2103610054, 2106220352, 2108751352, 2111202959, 2113575080,
+    2115867626, 2118080511, 2120213651, 2122266967, 2124240380, 2126133817,
+    2127947206, 2129680480, 2131333572, 2132906420, 2134398966, 2135811153,
+    2137142927, 2138394240, 2139565043, 2140655293, 2141664948, 2142593971,
+    2143442326, 2144209982, 2144896910, 2145503083, 2146028480, 2146473080,
+    2146836866, 2147119825, 2147321946, 2147443222, 2147483647
+};
+
+/* Motor control FOC (float kernel) */
+static const eps_foc_config_t g_foc_config = {
+    EPS_FOC_CURRENT_KP,
+    EPS_FOC_CURRENT_KI,
+    EPS_FOC_BUS_VOLTAGE_V,
+    EPS_FOC_SAMPLE_TIME_S
+};
+static eps_foc_state_t g_foc_state;
+static bool g_foc_initialized = false;
+
+/* Static Function Prototypes */
+static eps_q31_t eps_foc_sin_lookup(uint32_t angle);
+static float eps_foc_clamp(float value, float limit);
+static float eps_foc_pi(float* integral, float error, float kp, float ki_ts, float limit);
+static void eps_foc_svpwm(float v_alpha, float v_beta, uint16_t duty_cycles[3]);
+static eps_q31_t eps_q31_sat(int64_t value);
+static eps_q31_t eps_q31_clamp(int64_t value, eps_q31_t limit);
+static eps_q31_t eps_q31_from_gain(float gain);
+static eps_q31_t eps_foc_q31_pi(eps_q31_t* integral, eps_q31_t error,
+                                const eps_foc_q31_state_t* foc);
+static void eps_foc_q31_svpwm(eps_q31_t v_alpha, eps_q31_t v_beta, uint16_t duty_cycles[3]);
+
+/**
+ * @brief Initialize the float kernel (integrators cleared)
+ * @param foc State
+ * @param config Gains, bus voltage and sample time
+ */
+void eps_foc_init(eps_foc_state_t* foc, const eps_foc_config_t* config)
+{
+    if (!foc || !config) {
+        return;
+    }
+
+    memset(foc, 0, sizeof(eps_foc_state_t));
+    foc->kp = config->kp;
+    foc->ki_ts = config->ki * config->sample_time_s;
+    foc->voltage_limit_v = config->bus_voltage_v * EPS_FOC_INV_SQRT3;
+    foc->inv_bus_voltage = 1.0f / config->bus_voltage_v;
+}
+
+/**
+ * @brief Clear the float kernel's integrators
+ * @param foc State
+ */
+void eps_foc_reset(eps_foc_state_t* foc)
+{
+    if (foc) {
+        foc->id_integral_v = 0.0f;
+        foc->iq_integral_v = 0.0f;
+    }
+}
+
+/**
+ * @brief One float FOC step
+ * @param foc State
+ * @param ia_a Phase A current (A)
+ * @param ib_a Phase B current (A)
+ * @param angle Electrical rotor angle (phase, 2^32 per turn)
+ * @param id_ref_a d-axis current reference (A)
+ * @param iq_ref_a q-axis (torque) current reference (A)
+ * @param duty_cycles Output duty cycles (0 to EPS_FOC_DUTY_FULL_SCALE)
+ *
+ * Requirements: EPS-IR-057, EPS-ER-032
+ */
+void eps_foc_step(eps_foc_state_t* foc, float ia_a, float ib_a, uint32_t angle,
+                  float id_ref_a, float iq_ref_a, uint16_t duty_cycles[3])
+{
+    float sin_theta;
+    float cos_theta;
+    float i_alpha;
+    float i_beta;
+    float v_alpha;
+    float v_beta;
+
+    eps_foc_sin_cos(angle, &sin_theta, &cos_theta);
+
+    /* Clarke: ic = -(ia + ib) */
+    i_alpha = ia_a;
+    i_beta = (ia_a + 2.0f * ib_a) * EPS_FOC_INV_SQRT3;
+
+    /* Park */
+    foc->id_a = i_alpha * cos_theta + i_beta * sin_theta;
+    foc->iq_a = i_beta * cos_theta - i_alpha * sin_theta;
+
+    /* d/q current loops */
+    foc->vd_v = eps_foc_pi(&foc->id_integral_v, id_ref_a - foc->id_a,
+                           foc->kp, foc->ki_ts, foc->voltage_limit_v);
+    foc->vq_v = eps_foc_pi(&foc->iq_integral_v, iq_ref_a - foc->iq_a,
+                           foc->kp, foc->ki_ts, foc->voltage_limit_v);
+
+    /* Inverse Park */
+    v_alpha = foc->vd_v * cos_theta - foc->vq_v * sin_theta;
+    v_beta = foc->vd_v * sin_theta + foc->vq_v * cos_theta;
+
+    eps_foc_svpwm(v_alpha * foc->inv_bus_voltage, v_beta * foc->inv_bus_voltage, duty_cycles);
+}
+
+/**
+ * @brief Initialize the Q31 kernel (integrators cleared)
+ * @param foc State
+ * @param config Gains, bus voltage and sample time (converted to per unit)
+ */
+void eps_foc_q31_init(eps_foc_q31_state_t* foc, const eps_foc_config_t* config)
+{
+    float per_unit;
+
+    if (!foc || !config) {
+        return;
+    }
+
+    /* Voltage per unit of current, both per unit */
+    per_unit = EPS_FOC_CURRENT_BASE_A / config->bus_voltage_v;
+
+    memset(foc, 0, sizeof(eps_foc_q31_state_t));
+    foc->kp = eps_q31_from_gain(config->kp * per_unit);
+    foc->ki_ts = eps_q31_from_gain(config->ki * config->sample_time_s * per_unit);
+    foc->voltage_limit = EPS_FOC_Q31_INV_SQRT3;
+}
+
+/**
+ * @brief Clear the Q31 kernel's integrators
+ * @param foc State
+ */
+void eps_foc_q31_reset(eps_foc_q31_state_t* foc)
+{
+    if (foc) {
+        foc->id_integral = 0;
+        foc->iq_integral = 0;
+    }
+}
+
+/**
+ * @brief One Q31 FOC step
+ * @param foc State
+ * @param ia Phase A current (per unit)
+ * @param ib Phase B current (per unit)
+ * @param angle Electrical rotor angle (phase, 2^32 per turn)
+ * @param id_ref d-axis current reference (per unit)
+ * @param iq_ref q-axis (torque) current reference (per unit)
+ * @param duty_cycles Output duty cycles (0 to EPS_FOC_DUTY_FULL_SCALE)
+ *
+ * Requirements: EPS-IR-057, EPS-ER-032
+ */
+void eps_foc_q31_step(eps_foc_q31_state_t* foc, eps_q31_t ia, eps_q31_t ib, uint32_t angle,
+                      eps_q31_t id_ref, eps_q31_t iq_ref, uint16_t duty_cycles[3])
+{
+    eps_q31_t sin_theta;
+    eps_q31_t cos_theta;
+    eps_q31_t i_alpha;
+    eps_q31_t i_beta;
+    eps_q31_t v_alpha;
+    eps_q31_t v_beta;
+
+    eps_foc_sin_cos_q31(angle, &sin_theta, &cos_theta);
+
+    /* Clarke: ic = -(ia + ib) */
+    i_alpha = ia;
+    i_beta = eps_q31_sat(((int64_t)ia * EPS_FOC_Q31_INV_SQRT3 +
+                          2 * (int64_t)ib * EPS_FOC_Q31_INV_SQRT3) >> 31);
+
+    /* Park */
+    foc->id = eps_q31_sat(((int64_t)i_alpha * cos_theta + (int64_t)i_beta * sin_theta) >> 31);
+    foc->iq = eps_q31_sat(((int64_t)i_beta * cos_theta - (int64_t)i_alpha * sin_theta) >> 31);
+
+    /* d/q current loops */
+    foc->vd = eps_foc_q31_pi(&foc->id_integral, eps_q31_sat((int64_t)id_ref - foc->id), foc);
+    foc->vq = eps_foc_q31_pi(&foc->iq_integral, eps_q31_sat((int64_t)iq_ref - foc->iq), foc);
+
+    /* Inverse Park */
+    v_alpha = eps_q31_sat(((int64_t)foc->vd * cos_theta - (int64_t)foc->vq * sin_theta) >> 31);
+    v_beta = eps_q31_sat(((int64_t)foc->vd * sin_theta + (int64_t)foc->vq * cos_theta) >> 31);
+
+    eps_foc_q31_svpwm(v_alpha, v_beta, duty_cycles);
+}
+
+/**
+ * @brief Sine and cosine from the quarter-wave table (Q31)
+ * @param angle Phase (2^32 per turn)
+ * @param sin_out Sine
+ * @param cos_out Cosine
+ */
+void eps_foc_sin_cos_q31(uint32_t angle, eps_q31_t* sin_out, eps_q31_t* cos_out)
+{
+    *sin_out = eps_foc_sin_lookup(angle);
+    *cos_out = eps_foc_sin_lookup(angle + EPS_FOC_ANGLE_QUARTER);
+}
+
+/**
+ * @brief Sine and cosine from the quarter-wave table
+ * @param angle Phase (2^32 per turn)
+ * @param sin_out Sine
+ * @param cos_out Cosine
+ */
+void eps_foc_sin_cos(uint32_t angle, float* sin_out, float* cos_out)
+{
+    *sin_out = (float)eps_foc_sin_lookup(angle) * EPS_FOC_Q31_TO_FLOAT;
+    *cos_out = (float)eps_foc_sin_lookup(angle + EPS_FOC_ANGLE_QUARTER) * EPS_FOC_Q31_TO_FLOAT;
+}
+
+/**
+ * @brief Convert an electrical angle to a phase
+ * @param electrical_deg Angle in degrees (any sign or magnitude)
+ * @return uint32_t Phase (2^32 per turn)
+ */
+uint32_t eps_foc_angle_from_deg(float electrical_deg)
+{
+    float turns = electrical_deg * (1.0f / 360.0f);
+
+    turns -= floorf(turns);
+
+    /* 24 bits of a turn is the float resolution; 1.0 wraps to 0 */
+    return ((uint32_t)(turns * 16777216.0f)) << 8;
+}
+
+/**
+ * @brief Convert a current to per unit Q31 (saturating)
+ * @param current_a Current (A)
+ * @return eps_q31_t Current / EPS_FOC_CURRENT_BASE_A
+ */
+eps_q31_t eps_foc_current_to_q31(float current_a)
+{
+    float per_unit = current_a * (1.0f / EPS_FOC_CURRENT_BASE_A);
+
+    if (per_unit >= 1.0f) {
+        return EPS_Q31_ONE;
+    }
+    if (per_unit <= -1.0f) {
+        return INT32_MIN;
+    }
+
+    return (eps_q31_t)(per_unit * EPS_FOC_Q31_SCALE);
+}
+
+/**
+ * @brief Perform field-oriented control calculation
+ * @param feedback Pointer to motor feedback data
+ * @param target_torque Target torque in Nm
+ * @param duty_cycles Output PWM duty cycles
+ * @return eps_result_t Calculation result
+ *
+ * Torque is commanded as q-axis current (EPS_MOTOR_TORQUE_CONSTANT) with
+ * zero d-axis current. Invalid feedback clears the integrators and
+ * outputs the zero voltage vector (all phases at 50%).
+ *
+ * Requirements: EPS-IR-057, EPS-ER-032
+ */
+eps_result_t eps_motor_control_foc_calculate(const eps_motor_feedback_t* feedback,
+                                           float target_torque,
+                                           uint16_t duty_cycles[3])
+{
+    float iq_ref;
+
+    if (!feedback || !duty_cycles) {
+        return EPS_ERROR_NULL_POINTER;
+    }
+
+    if (!g_foc_initialized) {
+        eps_foc_init(&g_foc_state, &g_foc_config);
+        g_foc_initialized = true;
+    }
+
+    if (!feedback->data_valid) {
+        eps_foc_reset(&g_foc_state);
+        duty_cycles[0] = EPS_FOC_DUTY_FULL_SCALE / 2;
+        duty_cycles[1] = EPS_FOC_DUTY_FULL_SCALE / 2;
+        duty_cycles[2] = EPS_FOC_DUTY_FULL_SCALE / 2;
+        return EPS_ERROR_SENSOR_FAULT;
+    }
+
+    /* Torque to q-axis current - EPS-ER-027 */
+    iq_ref = eps_foc_clamp(target_torque * EPS_FOC_INV_TORQUE_CONSTANT, EPS_MOTOR_MAX_CURRENT_A);
+
+    eps_foc_step(&g_foc_state, feedback->current_a[0], feedback->current_a[1],
+                 eps_foc_angle_from_deg(feedback->position_deg * EPS_MOTOR_POLE_PAIRS),
+                 0.0f, iq_ref, duty_cycles);
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Clear the integrators of eps_motor_control_foc_calculate()
+ */
+void eps_motor_control_foc_reset(void)
+{
+    eps_foc_reset(&g_foc_state);
+}
+
+/**
+ * @brief sin(angle) by linear interpolation in the quarter-wave table
+ */
+static eps_q31_t eps_foc_sin_lookup(uint32_t angle)
+{
+    const uint32_t quadrant = angle >> 30;
+    const uint32_t position = angle & (EPS_FOC_ANGLE_QUARTER - 1U);
+    const uint32_t index = position >> EPS_FOC_FRACTION_BITS;
+    const int64_t fraction = (int64_t)(position & EPS_FOC_FRACTION_MASK);
+    eps_q31_t value;
+
+    if (quadrant & 1U) {
+        /* Falling quarter: sin(90 + x) = sin(90 - x), read the table backwards */
+        const eps_q31_t upper = g_foc_sin_table[EPS_FOC_TABLE_SIZE - index];
+        const eps_q31_t lower = g_foc_sin_table[EPS_FOC_TABLE_SIZE - 1U - index];
+        value = upper - (eps_q31_t)(((int64_t)(upper - lower) * fraction) >> EPS_FOC_FRACTION_BITS);
+    } else {
+        const eps_q31_t lower = g_foc_sin_table[index];
+        const eps_q31_t upper = g_foc_sin_table[index + 1U];
+        value = lower + (eps_q31_t)(((int64_t)(upper - lower) * fraction) >> EPS_FOC_FRACTION_BITS);
+    }
+
+    /* Second half turn is the negated first */
+    return (quadrant & 2U) ? -value : value;
+}
+
+/**
+ * @brief Clamp to +/-limit
+ */
+static float eps_foc_clamp(float value, float limit)
+{
+    if (value > limit) {
+        return limit;
+    }
+    if (value < -limit) {
+        return -limit;
+    }
+    return value;
+}
+
+/**
+ * @brief PI controller; integrator and output clamped to +/-limit (anti-windup)
+ */
+static float eps_foc_pi(float* integral, float error, float kp, float ki_ts, float limit)
+{
+    *integral = eps_foc_clamp(*integral + ki_ts * error, limit);
+    return eps_foc_clamp(kp * error + *integral, limit);
+}
+
+/**
+ * @brief Space-vector PWM from alpha/beta voltages (fractions of the bus)
+ *
+ * Min/max zero-sequence injection centres the three phase voltages in the
+ * bus range; duty cycles beyond 0-100% (overmodulation) are clipped.
+ */
+static void eps_foc_svpwm(float v_alpha, float v_beta, uint16_t duty_cycles[3])
+{
+    float v[3];
+    float v_max;
+    float v_min;
+    float offset;
+
+    /* Inverse Clarke */
+    v[0] = v_alpha;
+    v[1] = -0.5f * v_alpha + EPS_FOC_SQRT3_2 * v_beta;
+    v[2] = -0.5f * v_alpha - EPS_FOC_SQRT3_2 * v_beta;
+
+    v_max = (v[0] > v[1]) ? v[0] : v[1];
+    v_max = (v[2] > v_max) ? v[2] : v_max;
+    v_min = (v[0] < v[1]) ? v[0] : v[1];
+    v_min = (v[2] < v_min) ? v[2] : v_min;
+    offset = 0.5f - 0.5f * (v_max + v_min);
+
+    for (uint32_t phase = 0; phase < 3; phase++) {
+        float duty = v[phase] + offset;
+
+        if (duty < 0.0f) {
+            duty = 0.0f;
+        } else if (duty > 1.0f) {
+            duty = 1.0f;
+        }
+        duty_cycles[phase] = (uint16_t)(duty * EPS_FOC_DUTY_FULL_SCALE + 0.5f);
+    }
+}
+
+/**
+ * @brief Saturate to the Q31 range
+ */
+static eps_q31_t eps_q31_sat(int64_t value)
+{
+    if (value > EPS_Q31_ONE) {
+        return EPS_Q31_ONE;
+    }
+    if (value < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (eps_q31_t)value;
+}
+
+/**
+ * @brief Clamp to +/-limit
+ */
+static eps_q31_t eps_q31_clamp(int64_t value, eps_q31_t limit)
+{
+    if (value > limit) {
+        return limit;
+    }
+    if (value < -(int64_t)limit) {
+        return -limit;
+    }
+    return (eps_q31_t)value;
+}
+
+/**
+ * @brief Convert a per unit gain to Q27 (saturating)
+ */
+static eps_q31_t eps_q31_from_gain(float gain)
+{
+    float scaled = gain * (float)(1UL << EPS_FOC_GAIN_SHIFT);
+
+    if (scaled >= EPS_FOC_Q31_SCALE) {
+        return EPS_Q31_ONE;
+    }
+    if (scaled <= -EPS_FOC_Q31_SCALE) {
+        return INT32_MIN;
+    }
+    return (eps_q31_t)scaled;
+}
+
+/**
+ * @brief Q31 PI controller; integrator and output clamped (anti-windup)
+ */
+static eps_q31_t eps_foc_q31_pi(eps_q31_t* integral, eps_q31_t error,
+                                const eps_foc_q31_state_t* foc)
+{
+    *integral = eps_q31_clamp((int64_t)*integral +
+                              (((int64_t)foc->ki_ts * error) >> EPS_FOC_GAIN_SHIFT),
+                              foc->voltage_limit);
+
+    return eps_q31_clamp((((int64_t)foc->kp * error) >> EPS_FOC_GAIN_SHIFT) + *integral,
+                         foc->voltage_limit);
+}
+
+/**
+ * @brief Space-vector PWM from alpha/beta voltages (Q31 fractions of the bus)
+ */
+static void eps_foc_q31_svpwm(eps_q31_t v_alpha, eps_q31_t v_beta, uint16_t duty_cycles[3])
+{
+    int64_t v[3];
+    int64_t v_max;
+    int64_t v_min;
+    int64_t offset;
+    const int64_t beta = ((int64_t)v_beta * EPS_FOC_Q31_SQRT3_2) >> 31;
+
+    /* Inverse Clarke */
+    v[0] = v_alpha;
+    v[1] = -((int64_t)v_alpha >> 1) + beta;
+    v[2] = -((int64_t)v_alpha >> 1) - beta;
+
+    v_max = (v[0] > v[1]) ? v[0] : v[1];
+    v_max = (v[2] > v_max) ? v[2] : v_max;
+    v_min = (v[0] < v[1]) ? v[0] : v[1];
+    v_min = (v[2] < v_min) ? v[2] : v_min;
+    offset = EPS_FOC_Q31_HALF - ((v_max + v_min) >> 1);
+
+    for (uint32_t phase = 0; phase < 3; phase++) {
+        int64_t duty = v[phase] + offset;
+
+        if (duty < 0) {
+            duty = 0;
+        } else if (duty > EPS_Q31_ONE) {
+            duty = EPS_Q31_ONE;
+        }
+        duty_cycles[phase] = (uint16_t)((duty * EPS_FOC_DUTY_FULL_SCALE + EPS_FOC_Q31_HALF) >> 31);
+    }
+}
@@ -0,0 +1,184 @@
+/**
+ * @file eps_foc.h
+ * @brief Electronic Power Steering (EPS) Field-Oriented Control Kernel
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Current control of the assist motor, executed once per PWM period
+ * (EPS_MOTOR_PWM_FREQUENCY_HZ):
+ *
+ * 1. Clarke transform of the phase currents (ia + ib + ic = 0)
+ * 2. Park transform to the rotor frame (d/q)
+ * 3. PI current loops on d and q with anti-windup clamping
+ * 4. Inverse Park transform of the voltage command
+ * 5. Space-vector PWM (min/max zero-sequence injection)
+ *
+ * Rotor angles are unsigned 32-bit phases (2^32 = one electrical turn), so
+ * they wrap for free. Sine and cosine come from a quarter-wave table with
+ * linear interpolation (error < 5e-6).
+ *
+ * Two variants with the same structure:
+ * - Float: SI units (A, V), for FPU targets and SIL
+ * - Q31: per-unit fixed point (current base EPS_FOC_CURRENT_BASE_A, voltage
+ *   base the bus voltage), for targets without a single-precision FPU
+ *
+ * eps_motor_control_foc_calculate() runs the float kernel.
+ *
+ * Requirements Traceability:
+ * - EPS-IR-057: Field-oriented motor control
+ * - EPS-ER-030: PWM frequency
+ * - EPS-ER-032: Motor current control
+ */
+
+#ifndef EPS_FOC_H
+#define EPS_FOC_H
+
+#include "eps_motor_control.h"
+
+/* FOC Constants */
+#define EPS_FOC_SAMPLE_TIME_S           (1.0f / EPS_MOTOR_PWM_FREQUENCY_HZ)
+#define EPS_FOC_BUS_VOLTAGE_V           EPS_MOTOR_MAX_VOLTAGE_V
+#define EPS_FOC_CURRENT_KP              0.3f    /* V/A - 1 kHz bandwidth, L = 50 uH */
+#define EPS_FOC_CURRENT_KI              125.0f  /* V/(A*s) - R = 20 mOhm */
+#define EPS_FOC_DUTY_FULL_SCALE         1000    /* eps_motor_control_update_pwm() range */
+#define EPS_FOC_CURRENT_BASE_A          EPS_MOTOR_PEAK_CURRENT_A   /* Q31 1.0 */
+#define EPS_FOC_ANGLE_QUARTER           0x40000000UL   /* 90 deg as a phase */
+
+/* Q31 Fixed Point (-1.0 to 1.0 - 2^-31) */
+typedef int32_t eps_q31_t;
+
+#define EPS_Q31_ONE                     0x7FFFFFFF
+#define EPS_FOC_GAIN_SHIFT              27      /* Q31 gains are Q27 (range +/-16) */
+
+/* FOC Configuration */
+typedef struct {
+    float kp;                       /* V/A - Current loop proportional gain */
+    float ki;                       /* V/(A*s) - Current loop integral gain */
+    float bus_voltage_v;            /* V - DC link voltage */
+    float sample_time_s;            /* s - PWM period */
+} eps_foc_config_t;
+
+/* Float FOC State */
+typedef struct {
+    float kp;                       /* V/A */
+    float ki_ts;                    /* V/A per step */
+    float voltage_limit_v;          /* Per axis, linear SVPWM range */
+    float inv_bus_voltage;          /* 1/V */
+    float id_integral_v;
+    float iq_integral_v;
+    float id_a;                     /* Last measured d/q currents */
+    float iq_a;
+    float vd_v;                     /* Last commanded d/q voltages */
+    float vq_v;
+} eps_foc_state_t;
+
+/* Q31 FOC State (per unit) */
+typedef struct {
+    eps_q31_t kp;                   /* Q27 */
+    eps_q31_t ki_ts;                /* Q27 */
+    eps_q31_t voltage_limit;        /* Per axis, fraction of the bus voltage */
+    eps_q31_t id_integral;
+    eps_q31_t iq_integral;
+    eps_q31_t id;
+    eps_q31_t iq;
+    eps_q31_t vd;
+    eps_q31_t vq;
+} eps_foc_q31_state_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Initialize the float kernel (integrators cleared)
+ * @param foc State
+ * @param config Gains, bus voltage and sample time
+ */
+void eps_foc_init(eps_foc_state_t* foc, const eps_foc_config_t* config);
+
+/**
+ * @brief Clear the float kernel's integrators
+ * @param foc State
+ */
+void eps_foc_reset(eps_foc_state_t* foc);
+
+/**
+ * @brief One float FOC step
+ * @param foc State
+ * @param ia_a Phase A current (A)
+ * @param ib_a Phase B current (A)
+ * @param angle Electrical rotor angle (phase, 2^32 per turn)
+ * @param id_ref_a d-axis current reference (A)
+ * @param iq_ref_a q-axis (torque) current reference (A)
+ * @param duty_cycles Output duty cycles (0 to EPS_FOC_DUTY_FULL_SCALE)
+ *
+ * Requirements: EPS-IR-057, EPS-ER-032
+ */
+void eps_foc_step(eps_foc_state_t* foc, float ia_a, float ib_a, uint32_t angle,
+                  float id_ref_a, float iq_ref_a, uint16_t duty_cycles[3]);
+
+/**
+ * @brief Initialize the Q31 kernel (integrators cleared)
+ * @param foc State
+ * @param config Gains, bus voltage and sample time (converted to per unit)
+ */
+void eps_foc_q31_init(eps_foc_q31_state_t* foc, const eps_foc_config_t* config);
+
+/**
+ * @brief Clear the Q31 kernel's integrators
+ * @param foc State
+ */
+void eps_foc_q31_reset(eps_foc_q31_state_t* foc);
+
+/**
+ * @brief One Q31 FOC step
+ * @param foc State
+ * @param ia Phase A current (per unit)
+ * @param ib Phase B current (per unit)
+ * @param angle Electrical rotor angle (phase, 2^32 per turn)
+ * @param id_ref d-axis current reference (per unit)
+ * @param iq_ref q-axis (torque) current reference (per unit)
+ * @param duty_cycles Output duty cycles (0 to EPS_FOC_DUTY_FULL_SCALE)
+ *
+ * Requirements: EPS-IR-057, EPS-ER-032
+ */
+void eps_foc_q31_step(eps_foc_q31_state_t* foc, eps_q31_t ia, eps_q31_t ib, uint32_t angle,
+                      eps_q31_t id_ref, eps_q31_t iq_ref, uint16_t duty_cycles[3]);
+
+/**
+ * @brief Sine and cosine from the quarter-wave table (Q31)
+ * @param angle Phase (2^32 per turn)
+ * @param sin_out Sine
+ * @param cos_out Cosine
+ */
+void eps_foc_sin_cos_q31(uint32_t angle, eps_q31_t* sin_out, eps_q31_t* cos_out);
+
+/**
+ * @brief Sine and cosine from the quarter-wave table
+ * @param angle Phase (2^32 per turn)
+ * @param sin_out Sine
+ * @param cos_out Cosine
+ */
+void eps_foc_sin_cos(uint32_t angle, float* sin_out, float* cos_out);
+
+/**
+ * @brief Convert an electrical angle to a phase
+ * @param electrical_deg Angle in degrees (any sign or magnitude)
+ * @return uint32_t Phase (2^32 per turn)
+ */
+uint32_t eps_foc_angle_from_deg(float electrical_deg);
+
+/**
+ * @brief Clear the integrators of eps_motor_control_foc_calculate()
+ *
+ * Called when the motor is disabled, so assistance restarts from zero
+ * voltage.
+ */
+void eps_motor_control_foc_reset(void);
+
+/**
+ * @brief Convert a current to per unit Q31 (saturating)
+ * @param current_a Current (A)
+ * @return eps_q31_t Current / EPS_FOC_CURRENT_BASE_A
+ */
+eps_q31_t eps_foc_current_to_q31(float current_a);
+
+#endif /* EPS_FOC_H */
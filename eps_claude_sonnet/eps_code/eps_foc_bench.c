@@ -0,0 +1,400 @@
+/**
+ * @file eps_foc_bench.c
+ * @brief Electronic Power Steering (EPS) FOC Kernel Benchmark
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Host benchmark of the field-oriented control kernels (eps_foc.h):
+ *
+ * - Checks: sine table error, q-axis current tracking in closed loop with
+ *   a simulated motor (float and Q31), agreement of the Q31 duty cycles
+ *   with the float ones on the same inputs
+ * - Timing: ns per FOC step for both variants (best and median of the
+ *   repetitions) against the 50 us PWM period
+ *
+ * The kernels are timed on recorded closed-loop inputs, so the motor model
+ * is not part of the measurement. Exits non-zero if a check fails.
+ *
+ * Usage: eps_foc_bench [steps]
+ *
+ * Requirements Traceability:
+ * - EPS-IR-057: Field-oriented motor control
+ * - EPS-ER-030: PWM frequency
+ */
+
+#define _XOPEN_SOURCE 600
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "eps_foc.h"
+
+/* Benchmark Configuration */
+#define BENCH_DEFAULT_STEPS         20000   /* 1 s of PWM periods */
+#define BENCH_REPETITIONS           25
+#define BENCH_TABLE_SAMPLES         (1UL << 20)
+
+/* Simulated Motor (assist motor at steering speed) */
+#define BENCH_MOTOR_R_OHM           0.02f
+#define BENCH_MOTOR_L_H             50e-6f
+#define BENCH_MOTOR_FLUX_VS         (EPS_MOTOR_TORQUE_CONSTANT / (1.5f * EPS_MOTOR_POLE_PAIRS))
+#define BENCH_MOTOR_SPEED_RPM       300.0f
+#define BENCH_MOTOR_SUBSTEPS        10
+#define BENCH_IQ_REF_A              30.0f
+
+/* Check Limits */
+#define BENCH_MAX_TABLE_ERROR       1e-5
+#define BENCH_MAX_IQ_ERROR          0.01    /* Fraction of the reference */
+#define BENCH_MAX_DUTY_DIFFERENCE   2       /* Counts of EPS_FOC_DUTY_FULL_SCALE */
+
+#define BENCH_PI                    3.14159265358979
+
+/* Recorded kernel inputs of one PWM period */
+typedef struct {
+    float ia_a;
+    float ib_a;
+    uint32_t angle;
+} bench_frame_t;
+
+/* Simulated motor in the rotor frame */
+typedef struct {
+    double id_a;
+    double iq_a;
+    double angle_rad;               /* Electrical */
+} bench_motor_t;
+
+/* Kernel under test */
+typedef enum {
+    BENCH_KERNEL_FLOAT = 0,
+    BENCH_KERNEL_Q31
+} bench_kernel_t;
+
+/* Function Prototypes */
+static double bench_now_ns(void);
+static int bench_compare_double(const void* a, const void* b);
+static double bench_table_error(void);
+static double bench_closed_loop(bench_kernel_t kernel, bench_frame_t* frames, uint32_t steps);
+static void bench_motor_step(bench_motor_t* motor, const uint16_t duty_cycles[3]);
+static int bench_duty_difference(const bench_frame_t* frames, uint32_t steps);
+static void bench_time_kernel(bench_kernel_t kernel, const bench_frame_t* frames, uint32_t steps,
+                              double* best_ns, double* median_ns);
+
+/* Keeps the timed kernels from being optimized away */
+static volatile uint32_t g_bench_sink;
+
+/**
+ * @brief Benchmark entry point
+ * @param argc Argument count
+ * @param argv Arguments (optional step count)
+ */
+int main(int argc, char* argv[])
+{
+    const double period_ns = 1e9 / EPS_MOTOR_PWM_FREQUENCY_HZ;
+    uint32_t steps = BENCH_DEFAULT_STEPS;
+    bench_frame_t* frames;
+    double table_error;
+    double iq_error_float;
+    double iq_error_q31;
+    int duty_difference;
+    double best_ns;
+    double median_ns;
+    bool passed;
+
+    if (argc > 1) {
+        steps = (uint32_t)strtoul(argv[1], NULL, 10);
+        if (steps < 100) {
+            fprintf(stderr, "usage: %s [steps >= 100]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    frames = malloc(steps * sizeof(bench_frame_t));
+    if (!frames) {
+        fprintf(stderr, "out of memory\n");
+        return 2;
+    }
+
+    printf("=== EPS FOC Kernel Benchmark ===\n");
+    printf("PWM period: %.1f us, %u steps, %d repetitions\n\n", period_ns / 1000.0, steps, BENCH_REPETITIONS);
+
+    /* Checks (the float closed loop also records the timing inputs) */
+    table_error = bench_table_error();
+    iq_error_q31 = bench_closed_loop(BENCH_KERNEL_Q31, frames, steps);
+    iq_error_float = bench_closed_loop(BENCH_KERNEL_FLOAT, frames, steps);
+    duty_difference = bench_duty_difference(frames, steps);
+
+    passed = (table_error <= BENCH_MAX_TABLE_ERROR) &&
+             (iq_error_float <= BENCH_MAX_IQ_ERROR) &&
+             (iq_error_q31 <= BENCH_MAX_IQ_ERROR) &&
+             (duty_difference <= BENCH_MAX_DUTY_DIFFERENCE);
+
+    printf("Checks:\n");
+    printf("  Sine table max error:        %.2e (limit %.0e)\n", table_error, BENCH_MAX_TABLE_ERROR);
+    printf("  Float iq tracking error:     %.3f%% (limit %.1f%%)\n", iq_error_float * 100.0, BENCH_MAX_IQ_ERROR * 100.0);
+    printf("  Q31 iq tracking error:       %.3f%% (limit %.1f%%)\n", iq_error_q31 * 100.0, BENCH_MAX_IQ_ERROR * 100.0);
+    printf("  Q31 vs float duty (max):     %d counts (limit %d)\n\n", duty_difference, BENCH_MAX_DUTY_DIFFERENCE);
+
+    /* Timing */
+    printf("%-8s %12s %12s %12s\n", "Kernel", "best ns", "median ns", "% period");
+    bench_time_kernel(BENCH_KERNEL_FLOAT, frames, steps, &best_ns, &median_ns);
+    printf("%-8s %12.1f %12.1f %11.3f%%\n", "float", best_ns, median_ns, median_ns / period_ns * 100.0);
+    bench_time_kernel(BENCH_KERNEL_Q31, frames, steps, &best_ns, &median_ns);
+    printf("%-8s %12.1f %12.1f %11.3f%%\n", "q31", best_ns, median_ns, median_ns / period_ns * 100.0);
+
+    printf("\n%s\n", passed ? "✓ FOC checks passed" : "✗ FOC checks failed");
+
+    free(frames);
+    return passed ? 0 : 1;
+}
+
+/**
+ * @brief Monotonic time
+ * @return double Time in nanoseconds
+ */
+static double bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief qsort comparison of doubles
+ */
+static int bench_compare_double(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Largest sine/cosine error of the table over the full turn
+ * @return double Error of the float and Q31 lookups (larger of both)
+ */
+static double bench_table_error(void)
+{
+    double max_error = 0.0;
+
+    for (uint32_t i = 0; i < BENCH_TABLE_SAMPLES; i++) {
+        uint32_t angle = i * (uint32_t)(0x100000000ULL / BENCH_TABLE_SAMPLES) + (i * 2654435761U >> 12);
+        double theta = (double)angle * (2.0 * BENCH_PI / 4294967296.0);
+        float sin_f;
+        float cos_f;
+        eps_q31_t sin_q;
+        eps_q31_t cos_q;
+        double errors[4];
+
+        eps_foc_sin_cos(angle, &sin_f, &cos_f);
+        eps_foc_sin_cos_q31(angle, &sin_q, &cos_q);
+
+        errors[0] = fabs(sin_f - sin(theta));
+        errors[1] = fabs(cos_f - cos(theta));
+        errors[2] = fabs(sin_q / 2147483648.0 - sin(theta));
+        errors[3] = fabs(cos_q / 2147483648.0 - cos(theta));
+
+        for (uint32_t k = 0; k < 4; k++) {
+            if (errors[k] > max_error) {
+                max_error = errors[k];
+            }
+        }
+    }
+
+    return max_error;
+}
+
+/**
+ * @brief Run a kernel in closed loop with the simulated motor
+ * @param kernel Kernel
+ * @param frames Kernel inputs of each step (output)
+ * @param steps Number of PWM periods
+ * @return double Mean |iq - reference| over the last half, fraction of the reference
+ */
+static double bench_closed_loop(bench_kernel_t kernel, bench_frame_t* frames, uint32_t steps)
+{
+    const eps_foc_config_t config = {
+        EPS_FOC_CURRENT_KP, EPS_FOC_CURRENT_KI, EPS_FOC_BUS_VOLTAGE_V, EPS_FOC_SAMPLE_TIME_S
+    };
+    eps_foc_state_t foc;
+    eps_foc_q31_state_t foc_q31;
+    bench_motor_t motor = { 0.0, 0.0, 0.0 };
+    uint16_t duty_cycles[3];
+    double error_sum = 0.0;
+    uint32_t error_samples = 0;
+
+    eps_foc_init(&foc, &config);
+    eps_foc_q31_init(&foc_q31, &config);
+
+    for (uint32_t step = 0; step < steps; step++) {
+        double cos_theta = cos(motor.angle_rad);
+        double sin_theta = sin(motor.angle_rad);
+        double i_alpha = motor.id_a * cos_theta - motor.iq_a * sin_theta;
+        double i_beta = motor.id_a * sin_theta + motor.iq_a * cos_theta;
+        bench_frame_t* frame = &frames[step];
+
+        /* Phase current measurement and rotor angle */
+        frame->ia_a = (float)i_alpha;
+        frame->ib_a = (float)(-0.5 * i_alpha + 0.5 * sqrt(3.0) * i_beta);
+        frame->angle = eps_foc_angle_from_deg((float)(motor.angle_rad * 180.0 / BENCH_PI));
+
+        if (kernel == BENCH_KERNEL_FLOAT) {
+            eps_foc_step(&foc, frame->ia_a, frame->ib_a, frame->angle,
+                         0.0f, BENCH_IQ_REF_A, duty_cycles);
+        } else {
+            eps_foc_q31_step(&foc_q31, eps_foc_current_to_q31(frame->ia_a),
+                             eps_foc_current_to_q31(frame->ib_a), frame->angle,
+                             0, eps_foc_current_to_q31(BENCH_IQ_REF_A), duty_cycles);
+        }
+
+        bench_motor_step(&motor, duty_cycles);
+
+        if (step >= steps / 2) {
+            error_sum += fabs(motor.iq_a - BENCH_IQ_REF_A);
+            error_samples++;
+        }
+    }
+
+    return error_sum / error_samples / BENCH_IQ_REF_A;
+}
+
+/**
+ * @brief Advance the simulated motor by one PWM period
+ * @param motor Motor
+ * @param duty_cycles Applied duty cycles (average voltage over the period)
+ */
+static void bench_motor_step(bench_motor_t* motor, const uint16_t duty_cycles[3])
+{
+    const double omega = BENCH_MOTOR_SPEED_RPM / 60.0 * 2.0 * BENCH_PI * EPS_MOTOR_POLE_PAIRS;
+    const double dt = EPS_FOC_SAMPLE_TIME_S / BENCH_MOTOR_SUBSTEPS;
+    double v[3];
+    double v_alpha;
+    double v_beta;
+
+    for (uint32_t phase = 0; phase < 3; phase++) {
+        v[phase] = (double)duty_cycles[phase] / EPS_FOC_DUTY_FULL_SCALE * EPS_FOC_BUS_VOLTAGE_V;
+    }
+
+    /* Clarke (common mode has no effect on a star-connected motor) */
+    v_alpha = (2.0 * v[0] - v[1] - v[2]) / 3.0;
+    v_beta = (v[1] - v[2]) / sqrt(3.0);
+
+    for (uint32_t i = 0; i < BENCH_MOTOR_SUBSTEPS; i++) {
+        double cos_theta = cos(motor->angle_rad);
+        double sin_theta = sin(motor->angle_rad);
+        double vd = v_alpha * cos_theta + v_beta * sin_theta;
+        double vq = v_beta * cos_theta - v_alpha * sin_theta;
+        double did = (vd - BENCH_MOTOR_R_OHM * motor->id_a + omega * BENCH_MOTOR_L_H * motor->iq_a) / BENCH_MOTOR_L_H;
+        double diq = (vq - BENCH_MOTOR_R_OHM * motor->iq_a - omega * BENCH_MOTOR_L_H * motor->id_a -
+                      omega * BENCH_MOTOR_FLUX_VS) / BENCH_MOTOR_L_H;
+
+        motor->id_a += did * dt;
+        motor->iq_a += diq * dt;
+        motor->angle_rad = fmod(motor->angle_rad + omega * dt, 2.0 * BENCH_PI);
+    }
+}
+
+/**
+ * @brief Largest duty difference between the kernels on the same inputs
+ * @param frames Kernel inputs
+ * @param steps Number of frames
+ * @return int Difference in counts
+ */
+static int bench_duty_difference(const bench_frame_t* frames, uint32_t steps)
+{
+    const eps_foc_config_t config = {
+        EPS_FOC_CURRENT_KP, EPS_FOC_CURRENT_KI, EPS_FOC_BUS_VOLTAGE_V, EPS_FOC_SAMPLE_TIME_S
+    };
+    eps_foc_state_t foc;
+    eps_foc_q31_state_t foc_q31;
+    int max_difference = 0;
+
+    eps_foc_init(&foc, &config);
+    eps_foc_q31_init(&foc_q31, &config);
+
+    for (uint32_t step = 0; step < steps; step++) {
+        uint16_t duty_float[3];
+        uint16_t duty_q31[3];
+
+        eps_foc_step(&foc, frames[step].ia_a, frames[step].ib_a, frames[step].angle,
+                     0.0f, BENCH_IQ_REF_A, duty_float);
+        eps_foc_q31_step(&foc_q31, eps_foc_current_to_q31(frames[step].ia_a),
+                         eps_foc_current_to_q31(frames[step].ib_a), frames[step].angle,
+                         0, eps_foc_current_to_q31(BENCH_IQ_REF_A), duty_q31);
+
+        for (uint32_t phase = 0; phase < 3; phase++) {
+            int difference = abs((int)duty_float[phase] - (int)duty_q31[phase]);
+            if (difference > max_difference) {
+                max_difference = difference;
+            }
+        }
+    }
+
+    return max_difference;
+}
+
+/**
+ * @brief Time one kernel over the recorded inputs
+ * @param kernel Kernel
+ * @param frames Kernel inputs
+ * @param steps Number of frames (steps per repetition)
+ * @param best_ns Fastest repetition, ns per step
+ * @param median_ns Median repetition, ns per step
+ */
+static void bench_time_kernel(bench_kernel_t kernel, const bench_frame_t* frames, uint32_t steps,
+                              double* best_ns, double* median_ns)
+{
+    const eps_foc_config_t config = {
+        EPS_FOC_CURRENT_KP, EPS_FOC_CURRENT_KI, EPS_FOC_BUS_VOLTAGE_V, EPS_FOC_SAMPLE_TIME_S
+    };
+    const eps_q31_t iq_ref = eps_foc_current_to_q31(BENCH_IQ_REF_A);
+    eps_foc_state_t foc;
+    eps_foc_q31_state_t foc_q31;
+    eps_q31_t* currents_q31;
+    double samples[BENCH_REPETITIONS];
+    uint16_t duty_cycles[3];
+    uint32_t sink = 0;
+
+    /* Per unit currents are converted up front, as an ADC would deliver them */
+    currents_q31 = malloc(2 * steps * sizeof(eps_q31_t));
+    if (!currents_q31) {
+        *best_ns = 0.0;
+        *median_ns = 0.0;
+        return;
+    }
+    for (uint32_t step = 0; step < steps; step++) {
+        currents_q31[2 * step] = eps_foc_current_to_q31(frames[step].ia_a);
+        currents_q31[2 * step + 1] = eps_foc_current_to_q31(frames[step].ib_a);
+    }
+
+    eps_foc_init(&foc, &config);
+    eps_foc_q31_init(&foc_q31, &config);
+
+    for (uint32_t rep = 0; rep < BENCH_REPETITIONS; rep++) {
+        double start = bench_now_ns();
+
+        if (kernel == BENCH_KERNEL_FLOAT) {
+            for (uint32_t step = 0; step < steps; step++) {
+                eps_foc_step(&foc, frames[step].ia_a, frames[step].ib_a, frames[step].angle,
+                             0.0f, BENCH_IQ_REF_A, duty_cycles);
+                sink += duty_cycles[0] ^ duty_cycles[1] ^ duty_cycles[2];
+            }
+        } else {
+            for (uint32_t step = 0; step < steps; step++) {
+                eps_foc_q31_step(&foc_q31, currents_q31[2 * step], currents_q31[2 * step + 1],
+                                 frames[step].angle, 0, iq_ref, duty_cycles);
+                sink += duty_cycles[0] ^ duty_cycles[1] ^ duty_cycles[2];
+            }
+        }
+
+        samples[rep] = (bench_now_ns() - start) / steps;
+    }
+
+    g_bench_sink = sink;
+    free(currents_q31);
+
+    qsort(samples, BENCH_REPETITIONS, sizeof(double), bench_compare_double);
+    *best_ns = samples[0];
+    *median_ns = samples[BENCH_REPETITIONS / 2];
+}
@@ -0,0 +1,200 @@
+/**
+ * @file eps_latency_histogram.c
+ * @brief Electronic Power Steering (EPS) Latency Histogram
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * See eps_latency_histogram.h. Bucket index of a value v >= SUB_BUCKETS
+ * with most significant bit m: shift = m - SUB_BUCKET_BITS, index =
+ * (shift + 1) * SUB_BUCKETS + (v >> shift) - SUB_BUCKETS. Values below
+ * SUB_BUCKETS map to themselves, so the index is continuous.
+ *
+ * Requirements Traceability:
+ * - EPS-PR-014: Response time
+ * - EPS-PR-051: Performance monitoring
+ */
+
+#include <string.h>
+#include "eps_latency_histogram.h"
+
+/* Static Function Prototypes */
+static uint32_t eps_latency_bucket_index(uint32_t value_us);
+static uint32_t eps_latency_bucket_upper(uint32_t index);
+static uint32_t eps_latency_msb(uint32_t value);
+
+/**
+ * @brief Empty a histogram
+ * @param histogram Histogram
+ */
+void eps_latency_histogram_reset(eps_latency_histogram_t* histogram)
+{
+    if (histogram) {
+        memset(histogram, 0, sizeof(eps_latency_histogram_t));
+    }
+}
+
+/**
+ * @brief Record one latency
+ * @param histogram Histogram
+ * @param latency_us Latency in microseconds
+ *
+ * Requirements: EPS-PR-014
+ */
+void eps_latency_histogram_record(eps_latency_histogram_t* histogram, uint32_t latency_us)
+{
+    uint32_t value = latency_us;
+
+    if (!histogram) {
+        return;
+    }
+
+    if (value > EPS_LATENCY_MAX_US) {
+        value = EPS_LATENCY_MAX_US;
+        histogram->saturated_count++;
+    }
+
+    histogram->counts[eps_latency_bucket_index(value)]++;
+
+    if ((histogram->total_count == 0) || (latency_us < histogram->min_us)) {
+        histogram->min_us = latency_us;
+    }
+    if (latency_us > histogram->max_us) {
+        histogram->max_us = latency_us;
+    }
+
+    histogram->total_count++;
+    histogram->sum_us += latency_us;
+}
+
+/**
+ * @brief Add the counts of one histogram to another
+ * @param destination Histogram accumulating both runs
+ * @param source Histogram added (unchanged)
+ */
+void eps_latency_histogram_merge(eps_latency_histogram_t* destination,
+                                 const eps_latency_histogram_t* source)
+{
+    if (!destination || !source || (source->total_count == 0)) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < EPS_LATENCY_BUCKET_COUNT; i++) {
+        destination->counts[i] += source->counts[i];
+    }
+
+    if ((destination->total_count == 0) || (source->min_us < destination->min_us)) {
+        destination->min_us = source->min_us;
+    }
+    if (source->max_us > destination->max_us) {
+        destination->max_us = source->max_us;
+    }
+
+    destination->total_count += source->total_count;
+    destination->saturated_count += source->saturated_count;
+    destination->sum_us += source->sum_us;
+}
+
+/**
+ * @brief Latency at or below which a given share of the samples fall
+ * @param histogram Histogram
+ * @param percentile Percentile, 0 to 100 (e.g. 99.9)
+ * @return uint32_t Latency in microseconds (upper edge of the bucket,
+ *         capped at the recorded maximum; 0 when empty)
+ */
+uint32_t eps_latency_histogram_percentile(const eps_latency_histogram_t* histogram, float percentile)
+{
+    uint64_t rank;
+    uint64_t cumulative = 0;
+
+    if (!histogram || (histogram->total_count == 0)) {
+        return 0;
+    }
+
+    if (percentile < 0.0f) {
+        percentile = 0.0f;
+    } else if (percentile > 100.0f) {
+        percentile = 100.0f;
+    }
+
+    /* Rank of the sample reported (1-based, rounded up) */
+    rank = (uint64_t)((double)percentile / 100.0 * (double)histogram->total_count + 0.999999);
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    for (uint32_t i = 0; i < EPS_LATENCY_BUCKET_COUNT; i++) {
+        cumulative += histogram->counts[i];
+        if (cumulative >= rank) {
+            uint32_t upper = eps_latency_bucket_upper(i);
+            return (upper < histogram->max_us) ? upper : histogram->max_us;
+        }
+    }
+
+    return histogram->max_us;
+}
+
+/**
+ * @brief Mean of the recorded latencies
+ * @param histogram Histogram
+ * @return float Mean in microseconds (0 when empty)
+ */
+float eps_latency_histogram_mean(const eps_latency_histogram_t* histogram)
+{
+    if (!histogram || (histogram->total_count == 0)) {
+        return 0.0f;
+    }
+
+    return (float)((double)histogram->sum_us / (double)histogram->total_count);
+}
+
+/**
+ * @brief Bucket of a value (value <= EPS_LATENCY_MAX_US)
+ */
+static uint32_t eps_latency_bucket_index(uint32_t value_us)
+{
+    uint32_t shift;
+
+    if (value_us < EPS_LATENCY_SUB_BUCKETS) {
+        return value_us;
+    }
+
+    shift = eps_latency_msb(value_us) - EPS_LATENCY_SUB_BUCKET_BITS;
+    return ((shift + 1U) << EPS_LATENCY_SUB_BUCKET_BITS) + (value_us >> shift) - EPS_LATENCY_SUB_BUCKETS;
+}
+
+/**
+ * @brief Largest value counted in a bucket
+ */
+static uint32_t eps_latency_bucket_upper(uint32_t index)
+{
+    uint32_t group = index >> EPS_LATENCY_SUB_BUCKET_BITS;
+    uint32_t shift;
+
+    if (group == 0) {
+        return index;
+    }
+
+    shift = group - 1U;
+    return ((((index & (EPS_LATENCY_SUB_BUCKETS - 1U)) + EPS_LATENCY_SUB_BUCKETS) << shift) +
+            (1UL << shift)) - 1U;
+}
+
+/**
+ * @brief Index of the most significant set bit (value > 0)
+ */
+static uint32_t eps_latency_msb(uint32_t value)
+{
+#if defined(__GNUC__)
+    return 31U - (uint32_t)__builtin_clz(value);
+#else
+    uint32_t msb = 0;
+
+    if (value >= (1UL << 16)) { value >>= 16; msb += 16; }
+    if (value >= (1UL << 8))  { value >>= 8;  msb += 8; }
+    if (value >= (1UL << 4))  { value >>= 4;  msb += 4; }
+    if (value >= (1UL << 2))  { value >>= 2;  msb += 2; }
+    if (value >= (1UL << 1))  { msb += 1; }
+
+    return msb;
+#endif
+}
@@ -0,0 +1,87 @@
+/**
+ * @file eps_latency_histogram.h
+ * @brief Electronic Power Steering (EPS) Latency Histogram
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Fixed-memory log-linear histogram of latencies in microseconds. Values
+ * below EPS_LATENCY_SUB_BUCKETS are counted exactly; above that, each
+ * power of two is split into EPS_LATENCY_SUB_BUCKETS linear buckets, so a
+ * reported value is within 1/EPS_LATENCY_SUB_BUCKETS (1.6%) of the
+ * recorded one at any magnitude (e.g. 16 us buckets around 1 ms).
+ *
+ * Recording is O(1) and never allocates; percentiles walk the buckets
+ * and belong in reporting, not in the control cycle. Histograms from
+ * separate runs are combined with eps_latency_histogram_merge().
+ *
+ * Requirements Traceability:
+ * - EPS-PR-014: Response time
+ * - EPS-PR-051: Performance monitoring
+ */
+
+#ifndef EPS_LATENCY_HISTOGRAM_H
+#define EPS_LATENCY_HISTOGRAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Histogram Layout */
+#define EPS_LATENCY_SUB_BUCKET_BITS     6
+#define EPS_LATENCY_SUB_BUCKETS         (1U << EPS_LATENCY_SUB_BUCKET_BITS)
+#define EPS_LATENCY_RANGE_BITS          24      /* Up to 16.7 s; larger values saturate */
+#define EPS_LATENCY_MAX_US              ((1UL << EPS_LATENCY_RANGE_BITS) - 1U)
+#define EPS_LATENCY_BUCKET_COUNT        ((EPS_LATENCY_RANGE_BITS - EPS_LATENCY_SUB_BUCKET_BITS + 1) * \
+                                         EPS_LATENCY_SUB_BUCKETS)
+
+/* Latency Histogram (all-zero is an empty histogram) */
+typedef struct {
+    uint32_t counts[EPS_LATENCY_BUCKET_COUNT];
+    uint32_t total_count;
+    uint32_t saturated_count;       /* Recorded above EPS_LATENCY_MAX_US */
+    uint32_t min_us;                /* Exact, valid if total_count > 0 */
+    uint32_t max_us;                /* Exact (saturated values included) */
+    uint64_t sum_us;                /* For the mean */
+} eps_latency_histogram_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Empty a histogram
+ * @param histogram Histogram
+ */
+void eps_latency_histogram_reset(eps_latency_histogram_t* histogram);
+
+/**
+ * @brief Record one latency
+ * @param histogram Histogram
+ * @param latency_us Latency in microseconds
+ *
+ * Requirements: EPS-PR-014
+ */
+void eps_latency_histogram_record(eps_latency_histogram_t* histogram, uint32_t latency_us);
+
+/**
+ * @brief Add the counts of one histogram to another
+ * @param destination Histogram accumulating both runs
+ * @param source Histogram added (unchanged)
+ */
+void eps_latency_histogram_merge(eps_latency_histogram_t* destination,
+                                 const eps_latency_histogram_t* source);
+
+/**
+ * @brief Latency at or below which a given share of the samples fall
+ * @param histogram Histogram
+ * @param percentile Percentile, 0 to 100 (e.g. 99.9)
+ * @return uint32_t Latency in microseconds (upper edge of the bucket,
+ *         capped at the recorded maximum; 0 when empty)
+ */
+uint32_t eps_latency_histogram_percentile(const eps_latency_histogram_t* histogram, float percentile);
+
+/**
+ * @brief Mean of the recorded latencies
+ * @param histogram Histogram
+ * @return float Mean in microseconds (0 when empty)
+ */
+float eps_latency_histogram_mean(const eps_latency_histogram_t* histogram);
+
+#endif /* EPS_LATENCY_HISTOGRAM_H */
@@ -0,0 +1,265 @@
+/**
+ * @file eps_latency_histogram_test.c
+ * @brief Electronic Power Steering (EPS) Latency Histogram Checks
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Checks the latency histogram (eps_latency_histogram.h) against the exact
+ * sorted samples:
+ *
+ * - Accuracy: 1M samples each of a heavy-tailed and a uniform latency
+ *   distribution; p50 to p99.99 within TEST_MAX_ERROR of the exact rank,
+ *   never below it; min, max and mean exact
+ * - Merge: two halves merged give the histogram of the whole run
+ * - Edges: empty histogram, exact values below EPS_LATENCY_SUB_BUCKETS,
+ *   saturation above EPS_LATENCY_MAX_US
+ * - Speed: ns per record
+ *
+ * Exits non-zero if a check fails.
+ *
+ * Requirements Traceability:
+ * - EPS-PR-014: Response time
+ * - EPS-PR-051: Performance monitoring
+ */
+
+#define _XOPEN_SOURCE 600
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "eps_latency_histogram.h"
+
+/* Check Configuration */
+#define TEST_SAMPLES                1000000U
+#define TEST_MAX_ERROR              0.015   /* Relative, reported percentile against exact */
+
+/* Latency distribution of one accuracy run */
+typedef uint32_t (*test_distribution_t)(uint32_t* seed);
+
+/* Check State */
+static uint32_t g_test_failures = 0;
+static uint32_t g_test_samples[TEST_SAMPLES];
+static eps_latency_histogram_t g_test_histogram;
+static eps_latency_histogram_t g_test_halves[2];
+
+/* Function Prototypes */
+static void test_check(bool condition, const char* description);
+static double test_now_s(void);
+static double test_random_unit(uint32_t* seed);
+static uint32_t test_heavy_tailed_us(uint32_t* seed);
+static uint32_t test_uniform_us(uint32_t* seed);
+static int test_compare(const void* a, const void* b);
+static void test_accuracy(const char* name, test_distribution_t distribution);
+static void test_edges(void);
+static void test_speed(void);
+
+/**
+ * @brief Check entry point
+ */
+int main(void)
+{
+    printf("=== EPS Latency Histogram Checks ===\n");
+    printf("%u samples per distribution, percentiles within %.1f%%\n",
+           TEST_SAMPLES, TEST_MAX_ERROR * 100.0);
+
+    test_accuracy("Heavy-tailed (response time, 0.2-50 ms)", test_heavy_tailed_us);
+    test_accuracy("Uniform (0-2 ms)", test_uniform_us);
+    test_edges();
+    test_speed();
+
+    printf("\n%s\n", (g_test_failures == 0) ? "✓ Latency histogram checks passed" :
+                                               "✗ Latency histogram checks failed");
+
+    return (g_test_failures == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Record and print one check
+ * @param condition Check passed
+ * @param description What was checked
+ */
+static void test_check(bool condition, const char* description)
+{
+    printf("  %s %s\n", condition ? "✓" : "✗", description);
+    if (!condition) {
+        g_test_failures++;
+    }
+}
+
+/**
+ * @brief Monotonic time
+ * @return double Time in seconds
+ */
+static double test_now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Uniform random number (deterministic)
+ * @param seed Generator state
+ * @return double Value in (0, 1)
+ */
+static double test_random_unit(uint32_t* seed)
+{
+    *seed = *seed * 1664525U + 1013904223U;
+    return ((double)(*seed >> 8) + 0.5) / (double)(1U << 24);
+}
+
+/**
+ * @brief Log-normal latency around 1 ms with a tail to tens of ms
+ */
+static uint32_t test_heavy_tailed_us(uint32_t* seed)
+{
+    double u1 = test_random_unit(seed);
+    double u2 = test_random_unit(seed);
+    double normal = sqrt(-2.0 * log(u1)) * cos(2.0 * 3.14159265358979 * u2);
+
+    return (uint32_t)(1000.0 * exp(0.8 * normal));
+}
+
+/**
+ * @brief Uniform latency over two PWM-to-cycle scales
+ */
+static uint32_t test_uniform_us(uint32_t* seed)
+{
+    return (uint32_t)(2000.0 * test_random_unit(seed));
+}
+
+/**
+ * @brief qsort order of latencies
+ */
+static int test_compare(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Percentiles, extremes, mean and merge against the sorted samples
+ * @param name Distribution name
+ * @param distribution Latency generator
+ */
+static void test_accuracy(const char* name, test_distribution_t distribution)
+{
+    static const float percentiles[] = { 50.0f, 90.0f, 99.0f, 99.9f, 99.99f };
+    uint32_t seed = 2025U;
+    uint64_t sum = 0;
+    double worst_error = 0.0;
+    bool within = true;
+    bool merged = true;
+    char description[96];
+
+    printf("\n%s:\n", name);
+
+    eps_latency_histogram_reset(&g_test_histogram);
+    eps_latency_histogram_reset(&g_test_halves[0]);
+    eps_latency_histogram_reset(&g_test_halves[1]);
+
+    for (uint32_t i = 0; i < TEST_SAMPLES; i++) {
+        g_test_samples[i] = distribution(&seed);
+        sum += g_test_samples[i];
+        eps_latency_histogram_record(&g_test_histogram, g_test_samples[i]);
+        eps_latency_histogram_record(&g_test_halves[i < TEST_SAMPLES / 2 ? 0 : 1], g_test_samples[i]);
+    }
+    qsort(g_test_samples, TEST_SAMPLES, sizeof(uint32_t), test_compare);
+
+    for (uint32_t i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); i++) {
+        uint64_t rank = (uint64_t)ceil((double)percentiles[i] / 100.0 * TEST_SAMPLES);
+        uint32_t exact = g_test_samples[rank - 1];
+        uint32_t reported = eps_latency_histogram_percentile(&g_test_histogram, percentiles[i]);
+        double error = ((double)reported - (double)exact) / (double)exact;
+
+        printf("    p%-6.2f exact %7u us, reported %7u us (%+.2f%%)\n",
+               (double)percentiles[i], exact, reported, error * 100.0);
+        if ((error < 0.0) || (error > TEST_MAX_ERROR)) {
+            within = false;
+        }
+        if (error > worst_error) {
+            worst_error = error;
+        }
+    }
+
+    snprintf(description, sizeof(description), "percentiles within %.1f%% (worst %.2f%%)",
+             TEST_MAX_ERROR * 100.0, worst_error * 100.0);
+    test_check(within, description);
+
+    test_check((g_test_histogram.min_us == g_test_samples[0]) &&
+               (g_test_histogram.max_us == g_test_samples[TEST_SAMPLES - 1]) &&
+               (eps_latency_histogram_percentile(&g_test_histogram, 100.0f) == g_test_samples[TEST_SAMPLES - 1]),
+               "min, max and p100 exact");
+
+    test_check(fabs(eps_latency_histogram_mean(&g_test_histogram) - (double)sum / TEST_SAMPLES) <=
+               1e-6 * (double)sum / TEST_SAMPLES,
+               "mean exact");
+
+    eps_latency_histogram_merge(&g_test_halves[0], &g_test_halves[1]);
+    for (uint32_t i = 0; i < EPS_LATENCY_BUCKET_COUNT; i++) {
+        merged = merged && (g_test_halves[0].counts[i] == g_test_histogram.counts[i]);
+    }
+    test_check(merged && (g_test_halves[0].total_count == g_test_histogram.total_count) &&
+               (g_test_halves[0].min_us == g_test_histogram.min_us) &&
+               (g_test_halves[0].max_us == g_test_histogram.max_us) &&
+               (g_test_halves[0].sum_us == g_test_histogram.sum_us),
+               "merged halves equal the whole run");
+}
+
+/**
+ * @brief Empty histogram, exact small values, saturation
+ */
+static void test_edges(void)
+{
+    bool exact = true;
+
+    printf("\nEdges:\n");
+
+    eps_latency_histogram_reset(&g_test_histogram);
+    test_check((eps_latency_histogram_percentile(&g_test_histogram, 50.0f) == 0) &&
+               (eps_latency_histogram_mean(&g_test_histogram) == 0.0f),
+               "empty histogram reports 0");
+
+    for (uint32_t value = 0; value < EPS_LATENCY_SUB_BUCKETS; value++) {
+        eps_latency_histogram_reset(&g_test_histogram);
+        eps_latency_histogram_record(&g_test_histogram, value);
+        eps_latency_histogram_record(&g_test_histogram, EPS_LATENCY_SUB_BUCKETS * 4U);
+        exact = exact && (eps_latency_histogram_percentile(&g_test_histogram, 50.0f) == value);
+    }
+    test_check(exact, "values below EPS_LATENCY_SUB_BUCKETS are exact");
+
+    eps_latency_histogram_reset(&g_test_histogram);
+    eps_latency_histogram_record(&g_test_histogram, 100U);
+    eps_latency_histogram_record(&g_test_histogram, EPS_LATENCY_MAX_US + 1000U);
+    test_check((g_test_histogram.saturated_count == 1) &&
+               (g_test_histogram.max_us == EPS_LATENCY_MAX_US + 1000U) &&
+               (eps_latency_histogram_percentile(&g_test_histogram, 100.0f) >= EPS_LATENCY_MAX_US),
+               "values above EPS_LATENCY_MAX_US saturate and are counted");
+}
+
+/**
+ * @brief Time per record
+ */
+static void test_speed(void)
+{
+    uint32_t seed = 7U;
+    double start_s;
+    double wall_s;
+
+    for (uint32_t i = 0; i < TEST_SAMPLES; i++) {
+        g_test_samples[i] = test_heavy_tailed_us(&seed);
+    }
+
+    eps_latency_histogram_reset(&g_test_histogram);
+    start_s = test_now_s();
+    for (uint32_t i = 0; i < TEST_SAMPLES; i++) {
+        eps_latency_histogram_record(&g_test_histogram, g_test_samples[i]);
+    }
+    wall_s = test_now_s() - start_s;
+
+    printf("\nSpeed: %.1f ns per record\n", wall_s * 1e9 / TEST_SAMPLES);
+}
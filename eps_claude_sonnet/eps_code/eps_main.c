@@ -17,9 +17,14 @@
 #include "eps_safety.h"
 #include "eps_motor_control.h"
 #include "eps_sensors.h"
+#include "eps_sensor_provider.h"
 #include "eps_communication.h"
 #include "eps_diagnostics.h"
 #include "eps_power_management.h"
+#include "eps_oscillation.h"
+#include "eps_executor.h"
+#include "eps_assist_curve.h"
+#include "eps_thermal.h"
 
 /* Global system state */
 static eps_system_state_t g_eps_system_state;
@@ -30,6 +35,69 @@ static eps_performance_data_t g_eps_performance_data;
 static uint32_t g_system_tick_counter = 0;
 static uint32_t g_last_watchdog_reset = 0;
 
+/* Response time measurement - EPS-PR-014 */
+static uint32_t g_response_start_us = 0;    /* Frame time of the pending torque change */
+static bool g_response_pending = false;
+
+/* Fault response per fault source - EPS-SR-050, EPS-DR-031 */
+static const eps_fault_response_t g_fault_response[EPS_FAULT_ID_COUNT] = {
+    [EPS_FAULT_ID_SAFETY_MONITOR]       = { EPS_FAULT_CRITICAL, EPS_DTC_NO_FAULT },
+    [EPS_FAULT_ID_SENSOR]               = { EPS_FAULT_CRITICAL, EPS_DTC_NO_FAULT },
+    [EPS_FAULT_ID_CALCULATION]          = { EPS_FAULT_CRITICAL, EPS_DTC_NO_FAULT },
+    [EPS_FAULT_ID_DIRECTION_MISMATCH]   = { EPS_FAULT_CRITICAL, EPS_DTC_DIRECTION_MISMATCH },
+    [EPS_FAULT_ID_EXCESSIVE_ASSISTANCE] = { EPS_FAULT_MINOR, EPS_DTC_EXCESSIVE_ASSISTANCE },
+    [EPS_FAULT_ID_OSCILLATION]          = { EPS_FAULT_MAJOR, EPS_DTC_OSCILLATION_DETECTED },
+    [EPS_FAULT_ID_MOTOR]                = { EPS_FAULT_CRITICAL, EPS_DTC_MOTOR_FAULT },
+    [EPS_FAULT_ID_EXECUTOR]             = { EPS_FAULT_MAJOR, EPS_DTC_CURRENT_LOOP_FAULT },
+    [EPS_FAULT_ID_COMMUNICATION]        = { EPS_FAULT_MINOR, EPS_DTC_COMMUNICATION_FAULT },
+    [EPS_FAULT_ID_DIAGNOSTIC]           = { EPS_FAULT_MINOR, EPS_DTC_NO_FAULT }
+};
+static uint32_t g_active_faults = 0;        /* Faults of the previous cycle */
+
+/* Oscillation detection on the assistance torque - EPS-SR-006 */
+static const eps_oscillation_config_t g_oscillation_config = {
+    EPS_OSCILLATION_WINDOW_SAMPLES,
+    EPS_OSCILLATION_SIGN_CHANGES,
+    EPS_OSCILLATION_HALF_CYCLE_SAMPLES,
+    EPS_OSCILLATION_AMPLITUDE,
+    EPS_OSCILLATION_DEADBAND
+};
+static eps_oscillation_detector_t g_oscillation_detector;
+static uint8_t g_oscillation_crossing[EPS_OSCILLATION_WINDOW_SAMPLES];
+
+/* Assistance curve calibration and tables - EPS-FR-002, EPS-PR-040 */
+static const eps_assist_curve_config_t g_assist_curve_config = {
+    EPS_LOW_SPEED_THRESHOLD,
+    EPS_HIGH_SPEED_THRESHOLD,
+    EPS_MIN_ASSISTANCE_FACTOR,
+    EPS_SPEED_RTC_FACTOR,
+    EPS_SPEED_DAMPING_FACTOR,
+    EPS_SPEED_BUCKET_KMH,
+    EPS_BOOST_CURVE_STEP_NM,
+    EPS_BOOST_CURVE_ASSIST_NM
+};
+static eps_assist_curve_t g_assist_curve;
+
+/* Thermal model - EPS-ER-027 */
+static eps_thermal_model_t g_thermal_model;
+static bool g_thermal_fully_derated = false;
+
+/* Static Function Prototypes */
+static eps_result_t eps_calculate_assistance(const eps_sensor_data_t* sensor_data,
+                                           eps_assistance_params_t* assistance_params);
+static eps_result_t eps_apply_safety_limits(eps_assistance_params_t* assistance_params);
+static void eps_update_performance_data(const eps_sensor_data_t* sensor_data, uint32_t frame_time_us);
+static void eps_record_response_time(void);
+static void eps_accumulate_fault(eps_fault_accumulator_t* accumulator, eps_fault_id_t fault_id,
+                                 eps_result_t result);
+static eps_result_t eps_resolve_faults(const eps_fault_accumulator_t* accumulator);
+static eps_result_t eps_system_self_test(void);
+static eps_result_t eps_generate_motor_command(const eps_assistance_params_t* assistance_params,
+                                             eps_motor_command_t* motor_command);
+static bool eps_detect_oscillation(float assistance);
+static void eps_apply_thermal_derating(const eps_sensor_data_t* sensor_data,
+                                       eps_motor_command_t* motor_command);
+
 /**
  * @brief Initialize the EPS system
  * @return eps_result_t System initialization result
@@ -39,11 +107,14 @@ static uint32_t g_last_watchdog_reset = 0;
 eps_result_t eps_system_init(void)
 {
     eps_result_t result = EPS_SUCCESS;
+    eps_thermal_config_t thermal_config;
     
     /* Initialize system state */
     memset(&g_eps_system_state, 0, sizeof(eps_system_state_t));
     memset(&g_eps_safety_state, 0, sizeof(eps_safety_state_t));
     memset(&g_eps_performance_data, 0, sizeof(eps_performance_data_t));
+    g_response_pending = false;
+    g_active_faults = 0;
     
     g_eps_system_state.operating_mode = EPS_MODE_INIT;
     g_eps_system_state.system_status = EPS_STATUS_INITIALIZING;
@@ -76,6 +147,13 @@ eps_result_t eps_system_init(void)
         return result;
     }
     
+    /* Initialize the fast current loop and its command mailbox - EPS-PR-019 */
+    result = eps_executor_init();
+    if (result != EPS_SUCCESS) {
+        g_eps_system_state.system_status = EPS_STATUS_FAULT;
+        return result;
+    }
+    
     /* Initialize communication - EPS-IR-001, EPS-IR-045 */
     result = eps_communication_init();
     if (result != EPS_SUCCESS) {
@@ -90,6 +168,27 @@ eps_result_t eps_system_init(void)
         return result;
     }
     
+    /* Initialize oscillation detection - EPS-SR-006 */
+    if (!eps_oscillation_init(&g_oscillation_detector, &g_oscillation_config,
+                              g_oscillation_crossing)) {
+        g_eps_system_state.system_status = EPS_STATUS_FAULT;
+        return EPS_ERROR_INVALID_PARAMETER;
+    }
+    
+    /* Build the assistance gain tables - EPS-FR-002, EPS-PR-040 */
+    if (!eps_assist_curve_init(&g_assist_curve, &g_assist_curve_config)) {
+        g_eps_system_state.system_status = EPS_STATUS_FAULT;
+        return EPS_ERROR_INVALID_PARAMETER;
+    }
+    
+    /* Initialize the thermal model - EPS-ER-027 */
+    eps_thermal_default_config(&thermal_config, EPS_SYSTEM_CYCLE_TIME_MS / 1000.0f);
+    if (!eps_thermal_init(&g_thermal_model, &thermal_config)) {
+        g_eps_system_state.system_status = EPS_STATUS_FAULT;
+        return EPS_ERROR_INVALID_PARAMETER;
+    }
+    g_thermal_fully_derated = false;
+    
     /* Perform initial self-test - EPS-DR-002 */
     result = eps_system_self_test();
     if (result != EPS_SUCCESS) {
@@ -114,9 +213,11 @@ eps_result_t eps_system_init(void)
 eps_result_t eps_system_task(void)
 {
     eps_result_t result = EPS_SUCCESS;
+    eps_fault_accumulator_t faults = { 0, EPS_SUCCESS };
     eps_sensor_data_t sensor_data;
     eps_motor_command_t motor_command;
     eps_assistance_params_t assistance_params;
+    uint32_t frame_time_us = 0;
     
     /* Increment system tick counter */
     g_system_tick_counter++;
@@ -127,64 +228,84 @@ eps_result_t eps_system_task(void)
         g_last_watchdog_reset = g_system_tick_counter;
     }
     
+    /* Each stage runs only while the cycle is fault-free; faults are
+     * accumulated and resolved once at the end of the cycle */
+    
     /* Safety monitoring - EPS-SR-047, EPS-DR-003 */
     result = eps_safety_monitor(&g_eps_safety_state);
-    if (result != EPS_SUCCESS) {
-        return eps_handle_safety_fault(result);
-    }
+    eps_accumulate_fault(&faults, EPS_FAULT_ID_SAFETY_MONITOR, result);
     
-    /* Read sensor data - EPS-FR-007, EPS-IR-028 */
-    result = eps_sensors_read_all(&sensor_data);
-    if (result != EPS_SUCCESS) {
-        return eps_handle_sensor_fault(result);
+    /* Fast loop faults (invalid feedback, command timeout, sustained overrun):
+     * the fast loop already idled the affected periods, so the cycle goes on
+     * and the fault only degrades operation - EPS-IR-057 */
+    if (eps_executor_get_faults() != 0) {
+        faults.faults |= EPS_FAULT_FLAG(EPS_FAULT_ID_EXECUTOR);
     }
     
-    /* Validate sensor data - EPS-SR-019, EPS-DR-011 */
-    result = eps_sensors_validate_data(&sensor_data);
-    if (result != EPS_SUCCESS) {
-        return eps_handle_sensor_fault(result);
+    /* Read and validate sensor data in one pass (injected frame in test
+     * builds) - EPS-FR-007, EPS-IR-028, EPS-SR-019, EPS-DR-011 */
+    if (faults.first_result == EPS_SUCCESS) {
+        frame_time_us = eps_platform_time_us();
+        result = EPS_SENSORS_READ(&sensor_data);
+        eps_accumulate_fault(&faults, EPS_FAULT_ID_SENSOR, result);
     }
     
-    /* Update performance data - EPS-PR-051 */
-    eps_update_performance_data(&sensor_data);
-    
     /* Calculate steering assistance - EPS-FR-002, EPS-FR-017 */
-    result = eps_calculate_assistance(&sensor_data, &assistance_params);
-    if (result != EPS_SUCCESS) {
-        return eps_handle_calculation_fault(result);
+    if (faults.first_result == EPS_SUCCESS) {
+        /* Update performance data - EPS-PR-051 */
+        eps_update_performance_data(&sensor_data, frame_time_us);
+        
+        result = eps_calculate_assistance(&sensor_data, &assistance_params);
+        eps_accumulate_fault(&faults, (result == EPS_ERROR_DIRECTION_MISMATCH) ?
+                             EPS_FAULT_ID_DIRECTION_MISMATCH : EPS_FAULT_ID_CALCULATION, result);
     }
     
     /* Apply safety limits - EPS-SR-021, EPS-SR-005 */
-    result = eps_apply_safety_limits(&assistance_params);
-    if (result != EPS_SUCCESS) {
-        return eps_handle_safety_fault(result);
+    if (faults.first_result == EPS_SUCCESS) {
+        result = eps_apply_safety_limits(&assistance_params);
+        eps_accumulate_fault(&faults, (result == EPS_ERROR_OSCILLATION_DETECTED) ?
+                             EPS_FAULT_ID_OSCILLATION : EPS_FAULT_ID_CALCULATION, result);
+        
+        /* Limited assistance is still applied */
+        if (assistance_params.safety_limited) {
+            faults.faults |= EPS_FAULT_FLAG(EPS_FAULT_ID_EXCESSIVE_ASSISTANCE);
+        }
     }
     
     /* Generate motor command - EPS-FR-012, EPS-IR-055 */
-    result = eps_generate_motor_command(&assistance_params, &motor_command);
-    if (result != EPS_SUCCESS) {
-        return eps_handle_motor_fault(result);
+    if (faults.first_result == EPS_SUCCESS) {
+        result = eps_generate_motor_command(&assistance_params, &motor_command);
+        eps_accumulate_fault(&faults, EPS_FAULT_ID_MOTOR, result);
     }
     
-    /* Execute motor control - EPS-FR-013, EPS-PR-014 */
-    result = eps_motor_control_execute(&motor_command);
-    if (result != EPS_SUCCESS) {
-        return eps_handle_motor_fault(result);
+    if (faults.first_result == EPS_SUCCESS) {
+        /* Thermal current derating - EPS-ER-027 */
+        eps_apply_thermal_derating(&sensor_data, &motor_command);
+        
+        /* Hand the command to the PWM-rate current loop - EPS-FR-013, EPS-PR-014 */
+        result = eps_executor_publish_command(&motor_command);
+        eps_accumulate_fault(&faults, EPS_FAULT_ID_MOTOR, result);
+        
+        /* Torque change answered by a motor command - EPS-PR-014 */
+        if (result == EPS_SUCCESS) {
+            eps_record_response_time();
+        }
     }
     
     /* Update communication - EPS-IR-006, EPS-IR-007 */
-    result = eps_communication_update(&sensor_data, &assistance_params);
-    if (result != EPS_SUCCESS) {
-        return eps_handle_communication_fault(result);
+    if (faults.first_result == EPS_SUCCESS) {
+        result = eps_communication_update(&sensor_data, &assistance_params);
+        eps_accumulate_fault(&faults, EPS_FAULT_ID_COMMUNICATION, result);
     }
     
     /* Update diagnostics - EPS-DR-089, EPS-DR-093 */
-    result = eps_diagnostics_update(&sensor_data, &assistance_params);
-    if (result != EPS_SUCCESS) {
-        return eps_handle_diagnostic_fault(result);
+    if (faults.first_result == EPS_SUCCESS) {
+        result = eps_diagnostics_update(&sensor_data, &assistance_params);
+        eps_accumulate_fault(&faults, EPS_FAULT_ID_DIAGNOSTIC, result);
     }
     
-    return EPS_SUCCESS;
+    /* Fault resolution - EPS-SR-050 */
+    return eps_resolve_faults(&faults);
 }
 
 /**
@@ -202,52 +323,44 @@ static eps_result_t eps_calculate_assistance(const eps_sensor_data_t* sensor_dat
         return EPS_ERROR_NULL_POINTER;
     }
     
+    memset(assistance_params, 0, sizeof(eps_assistance_params_t));
+    
     float base_assistance = 0.0f;
-    float speed_factor = 1.0f;
     float return_to_center_torque = 0.0f;
     float damping_torque = 0.0f;
+    const eps_assist_speed_gains_t* speed_gains;
     
-    /* Base assistance calculation - EPS-FR-002 */
+    /* Base assistance from the boost curve - EPS-FR-002 */
     if (fabs(sensor_data->driver_torque) > EPS_MIN_TORQUE_THRESHOLD) {
-        base_assistance = sensor_data->driver_torque * EPS_BASE_ASSISTANCE_GAIN;
+        base_assistance = eps_assist_curve_boost(&g_assist_curve, sensor_data->driver_torque);
         
         /* Apply torque direction check - EPS-FR-003, EPS-SR-018 */
         if ((sensor_data->driver_torque > 0 && base_assistance < 0) ||
             (sensor_data->driver_torque < 0 && base_assistance > 0)) {
             /* Direction mismatch detected - safety fault */
-            eps_diagnostics_set_dtc(EPS_DTC_DIRECTION_MISMATCH);
             return EPS_ERROR_DIRECTION_MISMATCH;
         }
     }
     
-    /* Speed-sensitive assistance - EPS-FR-017, EPS-PR-040 */
-    if (sensor_data->vehicle_speed <= EPS_LOW_SPEED_THRESHOLD) {
-        speed_factor = 1.0f; /* Maximum assistance at low speeds */
-    } else if (sensor_data->vehicle_speed >= EPS_HIGH_SPEED_THRESHOLD) {
-        speed_factor = EPS_MIN_ASSISTANCE_FACTOR; /* Minimum assistance at high speeds */
-    } else {
-        /* Linear interpolation between low and high speed thresholds */
-        float speed_range = EPS_HIGH_SPEED_THRESHOLD - EPS_LOW_SPEED_THRESHOLD;
-        float speed_offset = sensor_data->vehicle_speed - EPS_LOW_SPEED_THRESHOLD;
-        speed_factor = 1.0f - (speed_offset / speed_range) * (1.0f - EPS_MIN_ASSISTANCE_FACTOR);
-    }
+    /* Speed-sensitive gains, from the table of the speed's bucket - EPS-FR-017, EPS-PR-040 */
+    speed_gains = eps_assist_curve_speed_gains(&g_assist_curve, sensor_data->vehicle_speed);
     
     /* Return-to-center assistance - EPS-FR-023, EPS-PR-034 */
     if (fabs(sensor_data->driver_torque) < EPS_RETURN_TO_CENTER_THRESHOLD) {
         return_to_center_torque = -sensor_data->steering_angle * EPS_RETURN_TO_CENTER_GAIN;
         
         /* Speed-based return-to-center adjustment - EPS-FR-025 */
-        return_to_center_torque *= (1.0f + sensor_data->vehicle_speed * EPS_SPEED_RTC_FACTOR);
+        return_to_center_torque *= speed_gains->rtc_scale;
     }
     
     /* Damping calculation - EPS-FR-029, EPS-PR-037 */
     damping_torque = -sensor_data->steering_velocity * EPS_DAMPING_COEFFICIENT;
     
     /* Speed-based damping adjustment - EPS-FR-031 */
-    damping_torque *= (1.0f + sensor_data->vehicle_speed * EPS_SPEED_DAMPING_FACTOR);
+    damping_torque *= speed_gains->damping_scale;
     
     /* Combine all assistance components */
-    assistance_params->base_assistance = base_assistance * speed_factor;
+    assistance_params->base_assistance = base_assistance * speed_gains->speed_factor;
     assistance_params->return_to_center = return_to_center_torque;
     assistance_params->damping = damping_torque;
     assistance_params->total_assistance = assistance_params->base_assistance + 
@@ -255,7 +368,7 @@ static eps_result_t eps_calculate_assistance(const eps_sensor_data_t* sensor_dat
                                         assistance_params->damping;
     
     /* Store calculation metadata */
-    assistance_params->speed_factor = speed_factor;
+    assistance_params->speed_factor = speed_gains->speed_factor;
     assistance_params->calculation_timestamp = g_system_tick_counter;
     
     return EPS_SUCCESS;
@@ -276,8 +389,6 @@ static eps_result_t eps_apply_safety_limits(eps_assistance_params_t* assistance_
     
     /* Check for excessive assistance - EPS-SR-021 */
     if (fabs(assistance_params->total_assistance) > EPS_MAX_ASSISTANCE_TORQUE) {
-        eps_diagnostics_set_dtc(EPS_DTC_EXCESSIVE_ASSISTANCE);
-        
         /* Limit assistance to maximum allowed - EPS-FR-004 */
         if (assistance_params->total_assistance > 0) {
             assistance_params->total_assistance = EPS_MAX_ASSISTANCE_TORQUE;
@@ -289,14 +400,7 @@ static eps_result_t eps_apply_safety_limits(eps_assistance_params_t* assistance_
     }
     
     /* Check for oscillation detection - EPS-SR-006 */
-    static float previous_assistance[EPS_OSCILLATION_BUFFER_SIZE] = {0};
-    static uint8_t buffer_index = 0;
-    
-    previous_assistance[buffer_index] = assistance_params->total_assistance;
-    buffer_index = (buffer_index + 1) % EPS_OSCILLATION_BUFFER_SIZE;
-    
-    if (eps_detect_oscillation(previous_assistance, EPS_OSCILLATION_BUFFER_SIZE)) {
-        eps_diagnostics_set_dtc(EPS_DTC_OSCILLATION_DETECTED);
+    if (eps_detect_oscillation(assistance_params->total_assistance)) {
         assistance_params->total_assistance = 0.0f; /* Disable assistance */
         assistance_params->oscillation_detected = true;
         return EPS_ERROR_OSCILLATION_DETECTED;
@@ -320,38 +424,152 @@ static eps_result_t eps_apply_safety_limits(eps_assistance_params_t* assistance_
     return EPS_SUCCESS;
 }
 
+/**
+ * @brief Detect oscillation in the assistance torque
+ * @param assistance Assistance torque of the current cycle
+ * @return bool true if oscillation detected
+ * 
+ * Adds the sample to the sliding window; sign changes ending a half-cycle
+ * above EPS_OSCILLATION_AMPLITUDE and shorter than
+ * EPS_OSCILLATION_HALF_CYCLE_SAMPLES are counted incrementally, so the cost
+ * does not grow with EPS_OSCILLATION_WINDOW_SAMPLES.
+ * 
+ * Requirements: EPS-SR-006
+ */
+static bool eps_detect_oscillation(float assistance)
+{
+    return eps_oscillation_update(&g_oscillation_detector, assistance);
+}
+
+/**
+ * @brief Generate the motor command for the cycle's assistance
+ * @param assistance_params Pointer to the limited assistance parameters
+ * @param motor_command Pointer to the motor command output
+ * @return eps_result_t Generation result
+ *
+ * The fast loop computes the duty cycles from the target torque; the
+ * command only carries the torque, the current limit and the enable. In
+ * degraded mode the torque is clamped to EPS_DEGRADED_MAX_TORQUE; in the
+ * fail-safe state the motor is not enabled (manual steering).
+ *
+ * Requirements: EPS-FR-012, EPS-IR-055, EPS-SR-036, EPS-SR-050
+ */
+static eps_result_t eps_generate_motor_command(const eps_assistance_params_t* assistance_params,
+                                             eps_motor_command_t* motor_command)
+{
+    float target_torque;
+
+    if (!assistance_params || !motor_command) {
+        return EPS_ERROR_NULL_POINTER;
+    }
+
+    memset(motor_command, 0, sizeof(eps_motor_command_t));
+    target_torque = assistance_params->total_assistance;
+
+    switch (g_eps_system_state.operating_mode) {
+        case EPS_MODE_NORMAL:
+            motor_command->enable = true;
+            break;
+
+        case EPS_MODE_DEGRADED:
+            /* Reduced assistance - EPS-SR-036 */
+            if (target_torque > EPS_DEGRADED_MAX_TORQUE) {
+                target_torque = EPS_DEGRADED_MAX_TORQUE;
+            } else if (target_torque < -EPS_DEGRADED_MAX_TORQUE) {
+                target_torque = -EPS_DEGRADED_MAX_TORQUE;
+            }
+            motor_command->enable = true;
+            break;
+
+        default:
+            /* No assistance outside normal and degraded operation - EPS-SR-050 */
+            target_torque = 0.0f;
+            motor_command->enable = false;
+            break;
+    }
+
+    motor_command->target_torque = target_torque;
+    motor_command->current_limit = EPS_MOTOR_MAX_CURRENT_A;
+    motor_command->command_timestamp = g_system_tick_counter;
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Derate the motor current limit from the thermal model
+ * @param sensor_data Pointer to current sensor data (temperature sensors)
+ * @param motor_command Pointer to the motor command to limit
+ * 
+ * The model is driven by the measured phase currents; without valid
+ * feedback the currents are estimated from the commanded torque (q-axis
+ * current aligned with phase A). Full derating is reported as an
+ * overtemperature once per episode.
+ * 
+ * Requirements: EPS-ER-027, EPS-DR-031
+ */
+static void eps_apply_thermal_derating(const eps_sensor_data_t* sensor_data,
+                                       eps_motor_command_t* motor_command)
+{
+    eps_motor_feedback_t feedback;
+    float current_limit;
+    
+    if (!sensor_data || !motor_command) {
+        return;
+    }
+    
+    if ((eps_motor_control_get_feedback(&feedback) != EPS_SUCCESS) || !feedback.data_valid) {
+        float iq = (float)fabs(motor_command->target_torque) / EPS_MOTOR_TORQUE_CONSTANT;
+        
+        feedback.current_a[0] = iq;
+        feedback.current_a[1] = -0.5f * iq;
+        feedback.current_a[2] = -0.5f * iq;
+    }
+    
+    current_limit = eps_thermal_update(&g_thermal_model, feedback.current_a,
+                                       sensor_data->motor_temperature,
+                                       sensor_data->ecu_temperature);
+    
+    if (current_limit < motor_command->current_limit) {
+        motor_command->current_limit = current_limit;
+    }
+    
+    g_eps_performance_data.winding_temperature = g_thermal_model.winding_c;
+    g_eps_performance_data.junction_temperature = g_thermal_model.junction_c;
+    g_eps_performance_data.thermal_current_limit = current_limit;
+    
+    /* Overtemperature on entering full derating - EPS-DR-031 */
+    if (current_limit <= EPS_THERMAL_MIN_CURRENT_A) {
+        if (!g_thermal_fully_derated) {
+            eps_diagnostics_set_dtc(EPS_DTC_OVERTEMPERATURE);
+        }
+        g_thermal_fully_derated = true;
+    } else {
+        g_thermal_fully_derated = false;
+    }
+}
+
 /**
  * @brief Update system performance data
  * @param sensor_data Pointer to current sensor data
+ * @param frame_time_us Time the sensor frame was read
  * 
  * Requirements: EPS-PR-051, EPS-DR-093
  */
-static void eps_update_performance_data(const eps_sensor_data_t* sensor_data)
+static void eps_update_performance_data(const eps_sensor_data_t* sensor_data, uint32_t frame_time_us)
 {
     if (!sensor_data) {
         return;
     }
     
-    /* Update response time measurement - EPS-PR-014 */
-    static uint32_t last_torque_change_time = 0;
+    /* Start response time measurement on a torque change - EPS-PR-014 */
     static float last_driver_torque = 0.0f;
     
     if (fabs(sensor_data->driver_torque - last_driver_torque) > EPS_TORQUE_CHANGE_THRESHOLD) {
-        if (last_torque_change_time > 0) {
-            uint32_t response_time = g_system_tick_counter - last_torque_change_time;
-            g_eps_performance_data.last_response_time_ms = response_time;
-            
-            /* Update response time statistics */
-            if (response_time > g_eps_performance_data.max_response_time_ms) {
-                g_eps_performance_data.max_response_time_ms = response_time;
-            }
-            
-            /* Check response time requirement - EPS-PR-014 */
-            if (response_time > EPS_MAX_RESPONSE_TIME_MS) {
-                eps_diagnostics_set_dtc(EPS_DTC_SLOW_RESPONSE);
-            }
+        /* A change not yet answered keeps the earlier start */
+        if (!g_response_pending) {
+            g_response_start_us = frame_time_us;
+            g_response_pending = true;
         }
-        last_torque_change_time = g_system_tick_counter;
         last_driver_torque = sensor_data->driver_torque;
     }
     
@@ -367,47 +585,127 @@ static void eps_update_performance_data(const eps_sensor_data_t* sensor_data)
 }
 
 /**
- * @brief Handle safety fault conditions
- * @param fault_code Fault code indicating the type of safety fault
- * @return eps_result_t Fault handling result
+ * @brief Complete a pending response time measurement
+ * 
+ * Called once the cycle's motor command is handed to the current loop,
+ * which applies it at the next PWM period: the latency from the frame
+ * that showed the torque change is recorded in the response time
+ * histogram (cycles that faulted before actuation extend it).
+ * 
+ * Requirements: EPS-PR-014, EPS-PR-051
+ */
+static void eps_record_response_time(void)
+{
+    uint32_t response_time_us;
+    
+    if (!g_response_pending) {
+        return;
+    }
+    
+    response_time_us = eps_platform_time_us() - g_response_start_us;
+    g_response_pending = false;
+    
+    eps_latency_histogram_record(&g_eps_performance_data.response_time_us, response_time_us);
+    g_eps_performance_data.last_response_time_ms = response_time_us / 1000;
+    
+    /* Update response time statistics */
+    if (g_eps_performance_data.last_response_time_ms > g_eps_performance_data.max_response_time_ms) {
+        g_eps_performance_data.max_response_time_ms = g_eps_performance_data.last_response_time_ms;
+    }
+    
+    /* Check response time requirement - EPS-PR-014 */
+    if (response_time_us > EPS_MAX_RESPONSE_TIME_MS * 1000) {
+        eps_diagnostics_set_dtc(EPS_DTC_SLOW_RESPONSE);
+    }
+}
+
+/**
+ * @brief Record a stage result in the cycle's fault accumulator
+ * @param accumulator Cycle fault accumulator
+ * @param fault_id Fault source of the stage
+ * @param result Stage result (EPS_SUCCESS records nothing)
  * 
- * Requirements: EPS-SR-050, EPS-SR-051, EPS-SR-052
+ * Requirements: EPS-SR-050
  */
-static eps_result_t eps_handle_safety_fault(eps_result_t fault_code)
+static void eps_accumulate_fault(eps_fault_accumulator_t* accumulator, eps_fault_id_t fault_id,
+                                 eps_result_t result)
 {
-    /* Determine fault severity and required response */
-    eps_fault_severity_t severity = eps_get_fault_severity(fault_code);
+    if (result == EPS_SUCCESS) {
+        return;
+    }
+    
+    accumulator->faults |= EPS_FAULT_FLAG(fault_id);
+    if (accumulator->first_result == EPS_SUCCESS) {
+        accumulator->first_result = result;
+    }
+}
+
+/**
+ * @brief Resolve the cycle's faults through the fault response table
+ * @param accumulator Faults accumulated during the cycle
+ * @return eps_result_t Result of the cycle's first fault (EPS_SUCCESS if none)
+ * 
+ * Only faults absent in the previous cycle are acted on: their DTCs are
+ * reported once and the most severe of them sets the operating mode, so a
+ * persisting fault costs one comparison per cycle.
+ * 
+ * Requirements: EPS-SR-050, EPS-SR-051, EPS-SR-052, EPS-DR-031
+ */
+static eps_result_t eps_resolve_faults(const eps_fault_accumulator_t* accumulator)
+{
+    uint32_t new_faults = accumulator->faults & ~g_active_faults;
+    eps_fault_severity_t severity = EPS_FAULT_NONE;
+    
+    g_active_faults = accumulator->faults;
+    
+    if (new_faults == 0) {
+        return accumulator->first_result;
+    }
+    
+    /* Report the new faults - EPS-DR-031 */
+    for (uint32_t fault_id = 0; fault_id < EPS_FAULT_ID_COUNT; fault_id++) {
+        const eps_fault_response_t* response = &g_fault_response[fault_id];
+        
+        if (!(new_faults & EPS_FAULT_FLAG(fault_id))) {
+            continue;
+        }
+        
+        if (response->dtc != EPS_DTC_NO_FAULT) {
+            eps_diagnostics_set_dtc(response->dtc);
+        }
+        if (response->severity > severity) {
+            severity = response->severity;
+        }
+        g_eps_safety_state.fault_count++;
+    }
     
     switch (severity) {
         case EPS_FAULT_CRITICAL:
             /* Critical fault - immediate safe state - EPS-SR-050 */
             g_eps_system_state.operating_mode = EPS_MODE_FAIL_SAFE;
             eps_motor_control_disable();
-            eps_diagnostics_set_dtc(eps_get_dtc_for_fault(fault_code));
             break;
             
         case EPS_FAULT_MAJOR:
-            /* Major fault - degraded operation - EPS-SR-036 */
-            g_eps_system_state.operating_mode = EPS_MODE_DEGRADED;
-            eps_motor_control_limit_torque(EPS_DEGRADED_MAX_TORQUE);
-            eps_diagnostics_set_dtc(eps_get_dtc_for_fault(fault_code));
-            break;
-            
-        case EPS_FAULT_MINOR:
-            /* Minor fault - continue with monitoring */
-            eps_diagnostics_set_dtc(eps_get_dtc_for_fault(fault_code));
+            /* Major fault - degraded operation (never out of the safe state) - EPS-SR-036 */
+            if (g_eps_system_state.operating_mode != EPS_MODE_FAIL_SAFE) {
+                g_eps_system_state.operating_mode = EPS_MODE_DEGRADED;
+                eps_motor_control_limit_torque(EPS_DEGRADED_MAX_TORQUE);
+            }
             break;
             
         default:
+            /* Minor fault - continue with monitoring */
             break;
     }
     
     /* Update safety state */
-    g_eps_safety_state.last_fault_code = fault_code;
-    g_eps_safety_state.fault_count++;
+    if (accumulator->first_result != EPS_SUCCESS) {
+        g_eps_safety_state.last_fault_code = accumulator->first_result;
+    }
     g_eps_safety_state.last_fault_time = g_system_tick_counter;
     
-    return fault_code;
+    return accumulator->first_result;
 }
 
 /**
@@ -15,6 +15,7 @@
 #include <stdbool.h>
 #include <string.h>
 #include <math.h>
+#include "eps_latency_histogram.h"
 
 /* System Constants - Based on Performance Requirements */
 #define EPS_MAX_ASSISTANCE_TORQUE       8.0f    /* Nm - EPS-PR-002 */
@@ -29,19 +30,25 @@
 #define EPS_MIN_ASSISTANCE_FACTOR       0.3f    /* 30% at high speeds */
 
 /* Control Parameters */
-#define EPS_BASE_ASSISTANCE_GAIN        1.5f
 #define EPS_RETURN_TO_CENTER_GAIN       0.02f   /* Nm/deg - EPS-PR-034 */
 #define EPS_RETURN_TO_CENTER_THRESHOLD  1.0f    /* Nm */
 #define EPS_DAMPING_COEFFICIENT         0.05f   /* Nm*s/deg - EPS-PR-037 */
 #define EPS_SPEED_RTC_FACTOR            0.01f
 #define EPS_SPEED_DAMPING_FACTOR        0.02f
+#define EPS_SPEED_BUCKET_KMH            1.0f    /* km/h - speed gain table step */
 
 /* Safety Limits */
 #define EPS_MAX_ASSISTANCE_RATE         10.0f   /* Nm/s - EPS-FR-005 */
 #define EPS_DEGRADED_MAX_TORQUE         4.0f    /* Nm */
-#define EPS_OSCILLATION_BUFFER_SIZE     10
 #define EPS_TORQUE_CHANGE_THRESHOLD     0.5f    /* Nm */
 
+/* Oscillation Detection - EPS-SR-006 (1-5 Hz shimmy at 1 ms samples) */
+#define EPS_OSCILLATION_WINDOW_SAMPLES  3000    /* 3 s window */
+#define EPS_OSCILLATION_SIGN_CHANGES    4       /* Detected above this count: 1 Hz completes 5 in 2.5 s */
+#define EPS_OSCILLATION_HALF_CYCLE_SAMPLES  570 /* 0.57 s - slower half-cycles (driver steering below ~0.9 Hz) do not count */
+#define EPS_OSCILLATION_AMPLITUDE       2.0f    /* Nm - half-cycle peak for its sign change to count */
+#define EPS_OSCILLATION_DEADBAND        EPS_MIN_TORQUE_THRESHOLD   /* Nm */
+
 /* System Result Codes */
 typedef enum {
     EPS_SUCCESS = 0,
@@ -148,10 +155,14 @@ typedef struct {
 typedef struct {
     uint32_t last_response_time_ms;
     uint32_t max_response_time_ms;
+    eps_latency_histogram_t response_time_us;   /* Torque change to motor command - EPS-PR-014 */
     float current_power_consumption;
     float max_power_consumption;
     float ecu_temperature;
     float motor_temperature;
+    float winding_temperature;      /* °C - Thermal model estimate */
+    float junction_temperature;     /* °C - Thermal model estimate */
+    float thermal_current_limit;    /* A - Derated current limit - EPS-ER-027 */
     uint32_t system_uptime_ms;
     uint32_t total_steering_cycles;
 } eps_performance_data_t;
@@ -162,6 +173,7 @@ typedef enum {
     EPS_DTC_TORQUE_SENSOR_FAULT = 0x1001,
     EPS_DTC_ANGLE_SENSOR_FAULT = 0x1002,
     EPS_DTC_MOTOR_FAULT = 0x2001,
+    EPS_DTC_CURRENT_LOOP_FAULT = 0x2002,
     EPS_DTC_POWER_SUPPLY_FAULT = 0x3001,
     EPS_DTC_COMMUNICATION_FAULT = 0x4001,
     EPS_DTC_EXCESSIVE_ASSISTANCE = 0x5001,
@@ -171,6 +183,35 @@ typedef enum {
     EPS_DTC_OVERTEMPERATURE = 0x7001
 } eps_dtc_code_t;
 
+/* Cycle Fault Sources - one bit each in the cycle's fault accumulator */
+typedef enum {
+    EPS_FAULT_ID_SAFETY_MONITOR = 0,
+    EPS_FAULT_ID_SENSOR,
+    EPS_FAULT_ID_CALCULATION,
+    EPS_FAULT_ID_DIRECTION_MISMATCH,
+    EPS_FAULT_ID_EXCESSIVE_ASSISTANCE,
+    EPS_FAULT_ID_OSCILLATION,
+    EPS_FAULT_ID_MOTOR,
+    EPS_FAULT_ID_EXECUTOR,
+    EPS_FAULT_ID_COMMUNICATION,
+    EPS_FAULT_ID_DIAGNOSTIC,
+    EPS_FAULT_ID_COUNT
+} eps_fault_id_t;
+
+#define EPS_FAULT_FLAG(fault_id)        (1uL << (uint32_t)(fault_id))
+
+/* Fault Response (per fault source, constant table) - EPS-SR-050 */
+typedef struct {
+    eps_fault_severity_t severity;
+    eps_dtc_code_t dtc;             /* EPS_DTC_NO_FAULT: reported by the detecting module */
+} eps_fault_response_t;
+
+/* Cycle Fault Accumulator - EPS-SR-050 */
+typedef struct {
+    uint32_t faults;                /* EPS_FAULT_FLAG() of every fault this cycle */
+    eps_result_t first_result;      /* Result code of the first fault */
+} eps_fault_accumulator_t;
+
 /* Function Prototypes */
 
 /**
@@ -203,22 +244,12 @@ const eps_system_state_t* eps_get_system_state(void);
  */
 const eps_performance_data_t* eps_get_performance_data(void);
 
-/* Internal Function Prototypes */
-static eps_result_t eps_calculate_assistance(const eps_sensor_data_t* sensor_data, 
-                                           eps_assistance_params_t* assistance_params);
-static eps_result_t eps_apply_safety_limits(eps_assistance_params_t* assistance_params);
-static void eps_update_performance_data(const eps_sensor_data_t* sensor_data);
-static eps_result_t eps_handle_safety_fault(eps_result_t fault_code);
-static eps_result_t eps_handle_sensor_fault(eps_result_t fault_code);
-static eps_result_t eps_handle_motor_fault(eps_result_t fault_code);
-static eps_result_t eps_handle_communication_fault(eps_result_t fault_code);
-static eps_result_t eps_handle_calculation_fault(eps_result_t fault_code);
-static eps_result_t eps_handle_diagnostic_fault(eps_result_t fault_code);
-static eps_result_t eps_system_self_test(void);
-static eps_result_t eps_generate_motor_command(const eps_assistance_params_t* assistance_params,
-                                             eps_motor_command_t* motor_command);
-static bool eps_detect_oscillation(const float* data, uint8_t size);
-static eps_fault_severity_t eps_get_fault_severity(eps_result_t fault_code);
-static eps_dtc_code_t eps_get_dtc_for_fault(eps_result_t fault_code);
+/**
+ * @brief Free-running microsecond time base (provided by the platform)
+ * @return uint32_t Time in microseconds (wraps around)
+ * 
+ * Requirements: EPS-PR-014
+ */
+uint32_t eps_platform_time_us(void);
 
 #endif /* EPS_MAIN_H */
\ No newline at end of file
@@ -0,0 +1,116 @@
+/**
+ * @file eps_oscillation.c
+ * @brief Electronic Power Steering (EPS) Incremental Oscillation Detector
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * See eps_oscillation.h. The crossing flags form a ring over the window;
+ * the slot about to be written holds the oldest sample's flag, so eviction
+ * and insertion touch one slot per sample.
+ *
+ * Requirements Traceability:
+ * - EPS-SR-006: Oscillation detection
+ */
+
+#include "eps_oscillation.h"
+
+#define EPS_OSC_MIN_WINDOW      3U
+
+/**
+ * @brief Initialize an oscillation detector
+ * @param detector Detector to initialize
+ * @param config Configuration (copied)
+ * @param crossing Crossing flag storage (config->window_samples entries)
+ * @return bool false on a NULL pointer or a window shorter than 3 samples
+ */
+bool eps_oscillation_init(eps_oscillation_detector_t* detector,
+                          const eps_oscillation_config_t* config,
+                          uint8_t* crossing)
+{
+    if (!detector || !config || !crossing) {
+        return false;
+    }
+
+    if (config->window_samples < EPS_OSC_MIN_WINDOW) {
+        return false;
+    }
+
+    detector->config = *config;
+    detector->crossing = crossing;
+    eps_oscillation_reset(detector);
+
+    return true;
+}
+
+/**
+ * @brief Empty the window (configuration and storage kept)
+ * @param detector Detector
+ */
+void eps_oscillation_reset(eps_oscillation_detector_t* detector)
+{
+    if (!detector) {
+        return;
+    }
+
+    detector->head = 0;
+    detector->count = 0;
+    detector->sign_changes = 0;
+    detector->half_cycle_length = 0;
+    detector->half_cycle_peak = 0.0f;
+    detector->last_sign = 0;
+}
+
+/**
+ * @brief Add one sample and evaluate the window
+ * @param detector Detector
+ * @param sample New sample (oldest one is evicted once the window is full)
+ * @return bool true if the window shows oscillation
+ *
+ * Requirements: EPS-SR-006
+ */
+bool eps_oscillation_update(eps_oscillation_detector_t* detector, float sample)
+{
+    const uint16_t slot = detector->head;
+    float magnitude = (sample < 0.0f) ? -sample : sample;
+    int8_t sign = 0;
+    uint8_t crossed = 0;
+
+    /* Evict the oldest sample (it occupies the slot about to be written) */
+    if (detector->count == detector->config.window_samples) {
+        detector->sign_changes -= detector->crossing[slot];
+    } else {
+        detector->count++;
+    }
+
+    if (detector->half_cycle_length < UINT16_MAX) {
+        detector->half_cycle_length++;
+    }
+
+    /* Sign change against the last sample outside the deadband */
+    if (sample > detector->config.deadband) {
+        sign = 1;
+    } else if (sample < -detector->config.deadband) {
+        sign = -1;
+    }
+
+    if ((sign != 0) && (detector->last_sign != 0) && (sign != detector->last_sign)) {
+        /* Counts only if the half-cycle it ends was large and fast enough */
+        crossed = ((detector->half_cycle_peak > detector->config.amplitude_limit) &&
+                   (detector->half_cycle_length <= detector->config.half_cycle_samples)) ? 1 : 0;
+        detector->half_cycle_peak = magnitude;
+        detector->half_cycle_length = 0;
+    } else if (magnitude > detector->half_cycle_peak) {
+        detector->half_cycle_peak = magnitude;
+    }
+
+    if (sign != 0) {
+        detector->last_sign = sign;
+    }
+
+    detector->crossing[slot] = crossed;
+    detector->sign_changes += crossed;
+
+    detector->head = (uint16_t)((slot + 1U == detector->config.window_samples) ? 0U : slot + 1U);
+
+    return detector->sign_changes > detector->config.sign_change_limit;
+}
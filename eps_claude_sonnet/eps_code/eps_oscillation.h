@@ -0,0 +1,88 @@
+/**
+ * @file eps_oscillation.h
+ * @brief Electronic Power Steering (EPS) Incremental Oscillation Detector
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Sliding-window oscillation detector on the assistance torque, updated
+ * one sample per control cycle. The window statistic is maintained
+ * incrementally instead of being rescanned: each sample records whether
+ * it completed a full half-cycle, and the count adds the new sample's
+ * flag and drops the evicted one's.
+ *
+ * A half-cycle is full when its peak exceeds the amplitude limit and it
+ * is shorter than the longest half-cycle of an oscillation. Oscillation is
+ * reported when the window holds more than the configured number of full
+ * half-cycles. Small half-cycles (noise around zero, light corrections
+ * while a large manoeuvre is held) and half-cycles at driver steering
+ * rates (slalom, lane changes) are not counted.
+ *
+ * An update costs O(1) at any window length, so the window can span
+ * seconds (1-5 Hz shimmy) instead of the few milliseconds a rescan per
+ * cycle could afford.
+ *
+ * The module depends only on <stdint.h> and <stdbool.h> and is shared by
+ * the standalone EPS code and the AUTOSAR EPS_SWC. Storage is supplied by
+ * the caller, sized to the window.
+ *
+ * Requirements Traceability:
+ * - EPS-SR-006: Oscillation detection
+ */
+
+#ifndef EPS_OSCILLATION_H
+#define EPS_OSCILLATION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Detector Configuration */
+typedef struct {
+    uint16_t window_samples;        /* Window length in samples (>= 3) */
+    uint16_t sign_change_limit;     /* Detected above this many counted sign changes */
+    uint16_t half_cycle_samples;    /* Longest half-cycle whose sign change counts */
+    float amplitude_limit;          /* Half-cycle peak for its sign change to count */
+    float deadband;                 /* |sample| <= deadband carries no sign */
+} eps_oscillation_config_t;
+
+/* Detector State */
+typedef struct {
+    eps_oscillation_config_t config;
+    uint8_t* crossing;              /* Sample completed a full half-cycle (0/1) */
+    uint16_t head;                  /* Next ring slot written */
+    uint16_t count;                 /* Samples in the window */
+    uint16_t sign_changes;          /* Counted sign changes in the window */
+    uint16_t half_cycle_length;     /* Samples since the last sign change */
+    float half_cycle_peak;          /* Largest |sample| since the last sign change */
+    int8_t last_sign;               /* Sign of the last sample outside the deadband */
+} eps_oscillation_detector_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Initialize an oscillation detector
+ * @param detector Detector to initialize
+ * @param config Configuration (copied)
+ * @param crossing Crossing flag storage (config->window_samples entries)
+ * @return bool false on a NULL pointer or a window shorter than 3 samples
+ */
+bool eps_oscillation_init(eps_oscillation_detector_t* detector,
+                          const eps_oscillation_config_t* config,
+                          uint8_t* crossing);
+
+/**
+ * @brief Empty the window (configuration and storage kept)
+ * @param detector Detector
+ */
+void eps_oscillation_reset(eps_oscillation_detector_t* detector);
+
+/**
+ * @brief Add one sample and evaluate the window
+ * @param detector Detector
+ * @param sample New sample (oldest one is evicted once the window is full)
+ * @return bool true if the window shows oscillation
+ *
+ * Requirements: EPS-SR-006
+ */
+bool eps_oscillation_update(eps_oscillation_detector_t* detector, float sample);
+
+#endif /* EPS_OSCILLATION_H */
@@ -0,0 +1,465 @@
+/**
+ * @file eps_oscillation_bench.c
+ * @brief Electronic Power Steering (EPS) Oscillation Detector Validation
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Host validation of the oscillation detector (eps_oscillation.h) with the
+ * production configuration of eps_main.h, on the assistance torque at the
+ * 1 ms control rate:
+ *
+ * - Reference: the incremental window count against a brute-force rescan
+ *   of the window at every sample, for several window lengths, on random
+ *   half-cycles that fall on both sides of the amplitude and length limits
+ * - Detection: sinusoidal oscillation at 1-6 Hz, just above the half-cycle
+ *   amplitude, with torque sensor noise; each frequency must be detected
+ *   well inside the window (BENCH_MAX_LATENCY_S)
+ * - False positives: driver manoeuvres that must not be detected (parking
+ *   lock to lock, double lane change, slalom at the fastest sustained
+ *   driver rate, highway corrections, step steer and release into noise,
+ *   on-centre noise)
+ * - Speed: ns per detector update
+ *
+ * Exits non-zero if a check fails.
+ *
+ * Usage: eps_oscillation_bench
+ *
+ * Requirements Traceability:
+ * - EPS-SR-006: Oscillation detection
+ */
+
+#define _XOPEN_SOURCE 600
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "eps_main.h"
+#include "eps_oscillation.h"
+
+/* Validation Configuration */
+#define BENCH_SAMPLE_RATE_HZ        (1000.0 / EPS_SYSTEM_CYCLE_TIME_MS)
+#define BENCH_DETECT_SECONDS        6.0     /* Per oscillation frequency */
+#define BENCH_MANOEUVRE_SECONDS     60.0    /* Per driver manoeuvre */
+#define BENCH_NOISE_NM              0.3     /* Torque sensor noise through the boost curve (peak) */
+#define BENCH_TIMING_SAMPLES        10000000UL
+#define BENCH_WINDOW_S              (EPS_OSCILLATION_WINDOW_SAMPLES / BENCH_SAMPLE_RATE_HZ)
+#define BENCH_MAX_LATENCY_S         (0.9 * BENCH_WINDOW_S)
+
+/* Reference Check (window lengths down to the minimum of 3 samples) */
+#define BENCH_REFERENCE_SAMPLES     200000U
+#define BENCH_REFERENCE_WINDOWS     { 3U, 64U, 1000U, EPS_OSCILLATION_WINDOW_SAMPLES }
+
+/* Oscillation Cases */
+#define BENCH_MIN_FREQUENCY_HZ      1.0
+#define BENCH_MAX_FREQUENCY_HZ      6.0
+#define BENCH_FREQUENCY_STEP_HZ     0.5
+#define BENCH_OSCILLATION_NM        (1.25 * EPS_OSCILLATION_AMPLITUDE)
+
+#define BENCH_PI                    3.14159265358979
+
+/* Assistance torque profile of one case */
+typedef double (*bench_profile_t)(double t_s, double frequency_hz);
+
+/* Driver manoeuvre case */
+typedef struct {
+    const char* name;
+    bench_profile_t profile;
+    double frequency_hz;
+} bench_manoeuvre_t;
+
+/* Function Prototypes */
+static double bench_now_s(void);
+static double bench_noise_nm(uint32_t* seed);
+static double bench_oscillation(double t_s, double frequency_hz);
+static double bench_parking(double t_s, double frequency_hz);
+static double bench_lane_change(double t_s, double frequency_hz);
+static double bench_slalom(double t_s, double frequency_hz);
+static double bench_step_release(double t_s, double frequency_hz);
+static double bench_on_centre(double t_s, double frequency_hz);
+static double bench_random_unit(uint32_t* seed);
+static void bench_reference_signal(void);
+static void bench_config(eps_oscillation_config_t* config, uint16_t window_samples);
+static bool bench_init_detector(eps_oscillation_detector_t* detector);
+static int8_t bench_sign(float sample, float deadband);
+static uint32_t bench_reference(uint16_t window_samples);
+static double bench_run(bench_profile_t profile, double frequency_hz, double seconds, uint32_t* detections);
+
+/* Detector storage (one detector at a time) */
+static uint8_t g_bench_crossing[EPS_OSCILLATION_WINDOW_SAMPLES];
+
+/* Reference check: signal and its per-sample full half-cycle flags */
+static float g_bench_signal[BENCH_REFERENCE_SAMPLES];
+static uint8_t g_bench_flags[BENCH_REFERENCE_SAMPLES];
+
+/* Driver manoeuvres that must not be detected */
+static const bench_manoeuvre_t g_bench_manoeuvres[] = {
+    { "Parking, lock to lock",          bench_parking,      0.05 },
+    { "Double lane change",             bench_lane_change,  0.5 },
+    { "Slalom (fastest driver rate)",   bench_slalom,       0.8 },
+    { "Highway corrections",            bench_slalom,       1.5 },
+    { "Step steer and release",         bench_step_release, 0.5 },
+    { "On-centre noise",                bench_on_centre,    0.0 }
+};
+
+/**
+ * @brief Validation entry point
+ */
+int main(void)
+{
+    static const uint16_t windows[] = BENCH_REFERENCE_WINDOWS;
+    eps_oscillation_detector_t detector;
+    uint32_t detections;
+    uint32_t mismatches;
+    double latency_s;
+    double max_latency_s = 0.0;
+    double start_s;
+    double wall_s;
+    bool passed = true;
+    volatile bool sink = false;
+
+    printf("=== EPS Oscillation Detector Validation ===\n");
+    printf("Window %d samples, detected above %d half-cycles peaking above %.1f Nm within %d samples\n\n",
+           EPS_OSCILLATION_WINDOW_SAMPLES, EPS_OSCILLATION_SIGN_CHANGES, (double)EPS_OSCILLATION_AMPLITUDE,
+           EPS_OSCILLATION_HALF_CYCLE_SAMPLES);
+
+    printf("Reference (window rescanned at each of %u samples):\n", BENCH_REFERENCE_SAMPLES);
+    bench_reference_signal();
+    for (uint32_t i = 0; i < sizeof(windows) / sizeof(windows[0]); i++) {
+        mismatches = bench_reference(windows[i]);
+        printf("  %4u-sample window: %u mismatches\n", windows[i], mismatches);
+        if (mismatches != 0) {
+            passed = false;
+        }
+    }
+    printf("\n");
+
+    printf("Detection (%.2f Nm oscillation, %.1f Nm noise, limit %.2f s):\n",
+           BENCH_OSCILLATION_NM, BENCH_NOISE_NM, BENCH_MAX_LATENCY_S);
+    for (double f = BENCH_MIN_FREQUENCY_HZ; f <= BENCH_MAX_FREQUENCY_HZ + 1e-9; f += BENCH_FREQUENCY_STEP_HZ) {
+        latency_s = bench_run(bench_oscillation, f, BENCH_DETECT_SECONDS, &detections);
+
+        if (latency_s < 0.0) {
+            printf("  %.1f Hz: not detected\n", f);
+            passed = false;
+        } else {
+            printf("  %.1f Hz: detected after %.3f s\n", f, latency_s);
+            if (latency_s > BENCH_MAX_LATENCY_S) {
+                passed = false;
+            }
+            if (latency_s > max_latency_s) {
+                max_latency_s = latency_s;
+            }
+        }
+    }
+    printf("  Worst latency: %.3f s\n\n", max_latency_s);
+
+    printf("False positives (%.0f s per manoeuvre):\n", BENCH_MANOEUVRE_SECONDS);
+    for (uint32_t i = 0; i < sizeof(g_bench_manoeuvres) / sizeof(g_bench_manoeuvres[0]); i++) {
+        const bench_manoeuvre_t* manoeuvre = &g_bench_manoeuvres[i];
+
+        (void)bench_run(manoeuvre->profile, manoeuvre->frequency_hz, BENCH_MANOEUVRE_SECONDS, &detections);
+        printf("  %-32s %u detections\n", manoeuvre->name, detections);
+        if (detections != 0) {
+            passed = false;
+        }
+    }
+
+    /* Speed on a noisy oscillation (sign changes in most half-cycles) */
+    if (!bench_init_detector(&detector)) {
+        return 1;
+    }
+    start_s = bench_now_s();
+    for (uint32_t i = 0; i < BENCH_TIMING_SAMPLES; i++) {
+        sink ^= eps_oscillation_update(&detector, (float)bench_oscillation(i / BENCH_SAMPLE_RATE_HZ, 3.0));
+    }
+    wall_s = bench_now_s() - start_s;
+    printf("\nSpeed: %.1f ns per update\n", wall_s * 1e9 / BENCH_TIMING_SAMPLES);
+
+    printf("\n%s\n", passed ? "✓ Oscillation checks passed" : "✗ Oscillation checks failed");
+
+    return passed ? 0 : 1;
+}
+
+/**
+ * @brief Monotonic time
+ * @return double Time in seconds
+ */
+static double bench_now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Uniform torque sensor noise (deterministic)
+ * @param seed Generator state
+ * @return double Noise in [-BENCH_NOISE_NM, BENCH_NOISE_NM]
+ */
+static double bench_noise_nm(uint32_t* seed)
+{
+    *seed = *seed * 1664525U + 1013904223U;
+    return ((double)(*seed >> 8) / (double)(1U << 24) * 2.0 - 1.0) * BENCH_NOISE_NM;
+}
+
+/**
+ * @brief Sinusoidal oscillation just above the half-cycle amplitude
+ */
+static double bench_oscillation(double t_s, double frequency_hz)
+{
+    return BENCH_OSCILLATION_NM * sin(2.0 * BENCH_PI * frequency_hz * t_s);
+}
+
+/**
+ * @brief Uniform random number (deterministic)
+ * @param seed Generator state
+ * @return double Value in [0, 1)
+ */
+static double bench_random_unit(uint32_t* seed)
+{
+    *seed = *seed * 1664525U + 1013904223U;
+    return (double)(*seed >> 8) / (double)(1U << 24);
+}
+
+/**
+ * @brief Reference check signal: half-sine half-cycles of alternating sign
+ *        plus noise
+ *
+ * Half the half-cycles are short (oscillation), half within 30 samples of
+ * EPS_OSCILLATION_HALF_CYCLE_SAMPLES; peaks are spread around
+ * EPS_OSCILLATION_AMPLITUDE, so the flags depend on both limits.
+ */
+static void bench_reference_signal(void)
+{
+    uint32_t seed = 777U;
+    uint32_t length = 0;
+    uint32_t position = 0;
+    double peak = 0.0;
+    double sign = -1.0;
+
+    for (uint32_t n = 0; n < BENCH_REFERENCE_SAMPLES; n++) {
+        if (position == length) {
+            length = (bench_random_unit(&seed) < 0.5) ?
+                     100U + (uint32_t)(300.0 * bench_random_unit(&seed)) :
+                     EPS_OSCILLATION_HALF_CYCLE_SAMPLES - 30U + (uint32_t)(60.0 * bench_random_unit(&seed));
+            peak = EPS_OSCILLATION_AMPLITUDE * (0.75 + 0.5 * bench_random_unit(&seed));
+            sign = -sign;
+            position = 0;
+        }
+
+        g_bench_signal[n] = (float)(sign * peak * sin(BENCH_PI * position / length) +
+                                    bench_noise_nm(&seed));
+        position++;
+    }
+}
+
+/**
+ * @brief Parking: ramp to full assistance, hold at the lock, across to the other lock
+ */
+static double bench_parking(double t_s, double frequency_hz)
+{
+    double t = fmod(t_s * frequency_hz, 1.0);
+
+    if (t < 0.1) {
+        return EPS_MAX_ASSISTANCE_TORQUE * t / 0.1;
+    } else if (t < 0.3) {
+        return EPS_MAX_ASSISTANCE_TORQUE;
+    } else if (t < 0.5) {
+        return EPS_MAX_ASSISTANCE_TORQUE * (1.0 - (t - 0.3) / 0.1);
+    } else if (t < 0.7) {
+        return -EPS_MAX_ASSISTANCE_TORQUE;
+    } else if (t < 0.8) {
+        return -EPS_MAX_ASSISTANCE_TORQUE * (1.0 - (t - 0.7) / 0.1);
+    }
+
+    return 0.0;
+}
+
+/**
+ * @brief Double lane change: one and a half cycles, then straight for 7 s
+ */
+static double bench_lane_change(double t_s, double frequency_hz)
+{
+    double t = fmod(t_s, 10.0);
+
+    if (t * frequency_hz < 1.5) {
+        return 0.75 * EPS_MAX_ASSISTANCE_TORQUE * sin(2.0 * BENCH_PI * frequency_hz * t);
+    }
+
+    return 0.0;
+}
+
+/**
+ * @brief Sustained sinusoidal steering (amplitude falls with frequency as for a driver)
+ */
+static double bench_slalom(double t_s, double frequency_hz)
+{
+    double amplitude = (frequency_hz < 1.0) ? 0.75 * EPS_MAX_ASSISTANCE_TORQUE : 0.5 * EPS_OSCILLATION_AMPLITUDE;
+
+    return amplitude * sin(2.0 * BENCH_PI * frequency_hz * t_s);
+}
+
+/**
+ * @brief Step steer held for half the period, then hands off (noise around zero)
+ */
+static double bench_step_release(double t_s, double frequency_hz)
+{
+    double t = fmod(t_s * frequency_hz, 1.0);
+    double sign = (fmod(t_s * frequency_hz, 2.0) < 1.0) ? 1.0 : -1.0;
+
+    return (t < 0.5) ? sign * 0.75 * EPS_MAX_ASSISTANCE_TORQUE : 0.0;
+}
+
+/**
+ * @brief Straight ahead, hands on (noise only)
+ */
+static double bench_on_centre(double t_s, double frequency_hz)
+{
+    (void)t_s;
+    (void)frequency_hz;
+
+    return 0.0;
+}
+
+/**
+ * @brief Production configuration with a given window length
+ * @param config Configuration output
+ * @param window_samples Window length
+ */
+static void bench_config(eps_oscillation_config_t* config, uint16_t window_samples)
+{
+    config->window_samples = window_samples;
+    config->sign_change_limit = EPS_OSCILLATION_SIGN_CHANGES;
+    config->half_cycle_samples = EPS_OSCILLATION_HALF_CYCLE_SAMPLES;
+    config->amplitude_limit = EPS_OSCILLATION_AMPLITUDE;
+    config->deadband = EPS_OSCILLATION_DEADBAND;
+}
+
+/**
+ * @brief Initialize a detector with the production configuration
+ * @param detector Detector
+ * @return bool Initialization result
+ */
+static bool bench_init_detector(eps_oscillation_detector_t* detector)
+{
+    eps_oscillation_config_t config;
+
+    bench_config(&config, EPS_OSCILLATION_WINDOW_SAMPLES);
+
+    return eps_oscillation_init(detector, &config, g_bench_crossing);
+}
+
+/**
+ * @brief Sign of a sample outside the deadband
+ * @return int8_t 1, -1, or 0 inside the deadband
+ */
+static int8_t bench_sign(float sample, float deadband)
+{
+    if (sample > deadband) {
+        return 1;
+    }
+
+    return (sample < -deadband) ? -1 : 0;
+}
+
+/**
+ * @brief Compare the detector with a brute-force evaluation of each window
+ * @param window_samples Window length
+ * @return uint32_t Samples where the count or the verdict differ
+ *
+ * Each sample's flag is derived from the signal alone: a sign change whose
+ * half-cycle (from the previous sign change, or the first sample) peaked
+ * above the amplitude limit within the half-cycle length. The window count
+ * is then summed over the whole window at every sample.
+ */
+static uint32_t bench_reference(uint16_t window_samples)
+{
+    eps_oscillation_config_t config;
+    eps_oscillation_detector_t detector;
+    uint32_t previous_change = 0;
+    bool changed = false;
+    int8_t last_sign = 0;
+    uint32_t mismatches = 0;
+
+    bench_config(&config, window_samples);
+    if (!eps_oscillation_init(&detector, &config, g_bench_crossing)) {
+        return BENCH_REFERENCE_SAMPLES;
+    }
+
+    for (uint32_t n = 0; n < BENCH_REFERENCE_SAMPLES; n++) {
+        int8_t sign;
+        uint32_t start = changed ? previous_change : 0;
+        uint32_t length = changed ? n - previous_change : n + 1;
+        uint32_t count = 0;
+        float peak = 0.0f;
+        bool detected;
+
+        sign = bench_sign(g_bench_signal[n], config.deadband);
+
+        /* Flag of the new sample */
+        g_bench_flags[n] = 0;
+        if ((sign != 0) && (last_sign != 0) && (sign != last_sign)) {
+            for (uint32_t i = start; i < n; i++) {
+                float magnitude = fabsf(g_bench_signal[i]);
+                if (magnitude > peak) {
+                    peak = magnitude;
+                }
+            }
+            g_bench_flags[n] = ((peak > config.amplitude_limit) &&
+                                (length <= config.half_cycle_samples)) ? 1 : 0;
+            previous_change = n;
+            changed = true;
+        }
+        if (sign != 0) {
+            last_sign = sign;
+        }
+
+        /* Window count, rescanned */
+        for (uint32_t i = (n + 1 >= window_samples) ? n + 1 - window_samples : 0; i <= n; i++) {
+            count += g_bench_flags[i];
+        }
+
+        detected = eps_oscillation_update(&detector, g_bench_signal[n]);
+        if ((detector.sign_changes != count) || (detected != (count > config.sign_change_limit))) {
+            mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+/**
+ * @brief Feed a profile plus noise to a fresh detector
+ * @param profile Assistance torque profile
+ * @param frequency_hz Profile frequency
+ * @param seconds Simulated time
+ * @param detections Samples reported as oscillation
+ * @return double Time of the first detection in seconds (-1 if none)
+ */
+static double bench_run(bench_profile_t profile, double frequency_hz, double seconds, uint32_t* detections)
+{
+    eps_oscillation_detector_t detector;
+    uint32_t samples = (uint32_t)(seconds * BENCH_SAMPLE_RATE_HZ);
+    uint32_t seed = 12345U;
+    double first_s = -1.0;
+
+    *detections = 0;
+    if (!bench_init_detector(&detector)) {
+        return first_s;
+    }
+
+    for (uint32_t i = 0; i < samples; i++) {
+        double t_s = i / BENCH_SAMPLE_RATE_HZ;
+        float assistance = (float)(profile(t_s, frequency_hz) + bench_noise_nm(&seed));
+
+        if (eps_oscillation_update(&detector, assistance)) {
+            if (*detections == 0) {
+                first_s = t_s;
+            }
+            (*detections)++;
+        }
+    }
+
+    return first_s;
+}
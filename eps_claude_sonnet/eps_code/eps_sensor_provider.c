@@ -0,0 +1,169 @@
+/**
+ * @file eps_sensor_provider.c
+ * @brief Electronic Power Steering (EPS) Sensor Provider Implementation
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Compiled only in test builds (EPS_SENSOR_INJECTION); see
+ * eps_sensor_provider.h.
+ *
+ * Requirements Traceability:
+ * - EPS-IR-025 to EPS-IR-049: Sensor Interface Requirements
+ */
+
+#include "eps_sensor_provider.h"
+
+#ifdef EPS_SENSOR_INJECTION
+
+/* Selected provider (hardware until eps_sensor_provider_select) */
+static eps_sensor_provider_t g_hardware_provider = {
+    EPS_SENSOR_SOURCE_HARDWARE, NULL, NULL
+};
+static const eps_sensor_provider_t* g_sensor_provider = &g_hardware_provider;
+
+/* Static Function Prototypes */
+static eps_result_t eps_sensor_provider_read_hardware(void* context, eps_sensor_data_t* sensor_data);
+static eps_result_t eps_sensor_provider_read_trace(void* context, eps_sensor_data_t* sensor_data);
+
+/**
+ * @brief Provider reading the sensor hardware (eps_sensors_read_all)
+ * @param provider Provider to initialize
+ * @return eps_result_t Initialization result
+ */
+eps_result_t eps_sensor_provider_init_hardware(eps_sensor_provider_t* provider)
+{
+    if (!provider) {
+        return EPS_ERROR_NULL_POINTER;
+    }
+
+    provider->source = EPS_SENSOR_SOURCE_HARDWARE;
+    provider->read = eps_sensor_provider_read_hardware;
+    provider->context = NULL;
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Provider generating frames with a callback
+ * @param provider Provider to initialize
+ * @param script Frame generator
+ * @param context Passed to @p script
+ * @return eps_result_t Initialization result
+ */
+eps_result_t eps_sensor_provider_init_scripted(eps_sensor_provider_t* provider,
+                                              eps_sensor_read_fn_t script,
+                                              void* context)
+{
+    if (!provider || !script) {
+        return EPS_ERROR_NULL_POINTER;
+    }
+
+    provider->source = EPS_SENSOR_SOURCE_SCRIPTED;
+    provider->read = script;
+    provider->context = context;
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Provider replaying a recorded trace
+ * @param provider Provider to initialize
+ * @param trace Trace (frames referenced, position reset to the start)
+ * @return eps_result_t Initialization result
+ */
+eps_result_t eps_sensor_provider_init_trace(eps_sensor_provider_t* provider,
+                                           eps_sensor_trace_t* trace)
+{
+    if (!provider || !trace || !trace->frames) {
+        return EPS_ERROR_NULL_POINTER;
+    }
+
+    if (trace->frame_count == 0) {
+        return EPS_ERROR_INVALID_PARAMETER;
+    }
+
+    trace->position = 0;
+
+    provider->source = EPS_SENSOR_SOURCE_TRACE;
+    provider->read = eps_sensor_provider_read_trace;
+    provider->context = trace;
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Select the provider read by eps_system_task()
+ * @param provider Provider (referenced; NULL selects the hardware)
+ * @return eps_result_t Selection result
+ */
+eps_result_t eps_sensor_provider_select(const eps_sensor_provider_t* provider)
+{
+    if (provider && !provider->read) {
+        return EPS_ERROR_INVALID_PARAMETER;
+    }
+
+    g_sensor_provider = provider ? provider : &g_hardware_provider;
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Read the current cycle's frame from the selected provider
+ * @param sensor_data Frame output
+ * @return eps_result_t Read result (EPS_ERROR_TIMEOUT at the end of a trace,
+ *         EPS_ERROR_SENSOR_FAULT for an injected frame failing
+ *         eps_sensors_validate_data)
+ *
+ * Requirements: EPS-FR-007, EPS-IR-028
+ */
+eps_result_t eps_sensor_provider_read(eps_sensor_data_t* sensor_data)
+{
+    eps_result_t result;
+
+    if (!sensor_data) {
+        return EPS_ERROR_NULL_POINTER;
+    }
+
+    if (g_sensor_provider->source == EPS_SENSOR_SOURCE_HARDWARE) {
+        return eps_sensors_read_all(sensor_data);
+    }
+
+    result = g_sensor_provider->read(g_sensor_provider->context, sensor_data);
+    if (result != EPS_SUCCESS) {
+        return result;
+    }
+
+    /* Injected frames bypass the checks of eps_sensors_read_all() */
+    return eps_sensors_validate_data(sensor_data);
+}
+
+/**
+ * @brief Hardware read through the provider interface
+ */
+static eps_result_t eps_sensor_provider_read_hardware(void* context, eps_sensor_data_t* sensor_data)
+{
+    (void)context;
+    return eps_sensors_read_all(sensor_data);
+}
+
+/**
+ * @brief Replay the next frame of a trace
+ */
+static eps_result_t eps_sensor_provider_read_trace(void* context, eps_sensor_data_t* sensor_data)
+{
+    eps_sensor_trace_t* trace = (eps_sensor_trace_t*)context;
+
+    if (trace->position >= trace->frame_count) {
+        if (!trace->loop) {
+            return EPS_ERROR_TIMEOUT;
+        }
+        trace->position = 0;
+    }
+
+    *sensor_data = trace->frames[trace->position];
+    trace->position++;
+
+    return EPS_SUCCESS;
+}
+
+#endif /* EPS_SENSOR_INJECTION */
@@ -0,0 +1,111 @@
+/**
+ * @file eps_sensor_provider.h
+ * @brief Electronic Power Steering (EPS) Sensor Provider Interface
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Source of the sensor frame that eps_system_task() processes each cycle.
+ * Test builds (EPS_SENSOR_INJECTION defined) select a provider at init:
+ *
+ * - Hardware: eps_sensors_read_all(), as in production
+ * - Scripted: a callback generates each frame (test scenarios)
+ * - Trace: recorded frames are replayed in order
+ *
+ * Production builds do not define EPS_SENSOR_INJECTION; EPS_SENSORS_READ
+ * then expands to eps_sensors_read_all() and this module compiles to
+ * nothing, so the injection port costs no code, data or indirect call.
+ *
+ * Requirements Traceability:
+ * - EPS-IR-025 to EPS-IR-049: Sensor Interface Requirements
+ * - EPS-VVR-019, EPS-VVR-073: Fault injection and integration testing
+ */
+
+#ifndef EPS_SENSOR_PROVIDER_H
+#define EPS_SENSOR_PROVIDER_H
+
+#include "eps_main.h"
+#include "eps_sensors.h"
+
+#ifdef EPS_SENSOR_INJECTION
+
+/* Sensor Provider Types */
+typedef enum {
+    EPS_SENSOR_SOURCE_HARDWARE = 0,
+    EPS_SENSOR_SOURCE_SCRIPTED,
+    EPS_SENSOR_SOURCE_TRACE
+} eps_sensor_source_t;
+
+/* Frame source: fill @p sensor_data for the current cycle */
+typedef eps_result_t (*eps_sensor_read_fn_t)(void* context, eps_sensor_data_t* sensor_data);
+
+/* Sensor Provider */
+typedef struct {
+    eps_sensor_source_t source;
+    eps_sensor_read_fn_t read;
+    void* context;
+} eps_sensor_provider_t;
+
+/* Recorded Sensor Trace (replayed one frame per cycle) */
+typedef struct {
+    const eps_sensor_data_t* frames;
+    uint32_t frame_count;
+    uint32_t position;              /* Next frame to replay */
+    bool loop;                      /* Restart at the end instead of timing out */
+} eps_sensor_trace_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Provider reading the sensor hardware (eps_sensors_read_all)
+ * @param provider Provider to initialize
+ * @return eps_result_t Initialization result
+ */
+eps_result_t eps_sensor_provider_init_hardware(eps_sensor_provider_t* provider);
+
+/**
+ * @brief Provider generating frames with a callback
+ * @param provider Provider to initialize
+ * @param script Frame generator
+ * @param context Passed to @p script
+ * @return eps_result_t Initialization result
+ */
+eps_result_t eps_sensor_provider_init_scripted(eps_sensor_provider_t* provider,
+                                              eps_sensor_read_fn_t script,
+                                              void* context);
+
+/**
+ * @brief Provider replaying a recorded trace
+ * @param provider Provider to initialize
+ * @param trace Trace (frames referenced, position reset to the start)
+ * @return eps_result_t Initialization result
+ */
+eps_result_t eps_sensor_provider_init_trace(eps_sensor_provider_t* provider,
+                                           eps_sensor_trace_t* trace);
+
+/**
+ * @brief Select the provider read by eps_system_task()
+ * @param provider Provider (referenced; NULL selects the hardware)
+ * @return eps_result_t Selection result
+ */
+eps_result_t eps_sensor_provider_select(const eps_sensor_provider_t* provider);
+
+/**
+ * @brief Read the current cycle's frame from the selected provider
+ * @param sensor_data Frame output
+ * @return eps_result_t Read result (EPS_ERROR_TIMEOUT at the end of a trace,
+ *         EPS_ERROR_SENSOR_FAULT for an injected frame failing
+ *         eps_sensors_validate_data)
+ *
+ * Requirements: EPS-FR-007, EPS-IR-028
+ */
+eps_result_t eps_sensor_provider_read(eps_sensor_data_t* sensor_data);
+
+#define EPS_SENSORS_READ(sensor_data)   eps_sensor_provider_read(sensor_data)
+
+#else
+
+#define EPS_SENSORS_READ(sensor_data)   eps_sensors_read_all(sensor_data)
+
+#endif /* EPS_SENSOR_INJECTION */
+
+#endif /* EPS_SENSOR_PROVIDER_H */
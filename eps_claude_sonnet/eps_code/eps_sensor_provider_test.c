@@ -0,0 +1,435 @@
+/**
+ * @file eps_sensor_provider_test.c
+ * @brief Electronic Power Steering (EPS) Sensor Provider Checks
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Checks the sensor frame injection port (eps_sensor_provider.h) on its own,
+ * and the hardware read behind it, with the platform ADC driver replaced by
+ * a counting stand-in:
+ *
+ * - Hardware: the default provider, and NULL selection, read the ADC block
+ * - Scripted: frames come from the callback with its context; callback
+ *   errors are passed on and invalid frames are rejected
+ * - Trace: frames replay in order, then time out or restart when looping
+ * - Selection and initialization reject incomplete providers and traces
+ * - Plausibility: single noisy samples pass, steps and channel mismatch
+ *   are reported after EPS_SENSOR_PLAUSIBILITY_DEBOUNCE samples, vehicle
+ *   speed is range and step checked
+ *
+ * Exits non-zero if a check fails. Built with EPS_SENSOR_INJECTION.
+ *
+ * Requirements Traceability:
+ * - EPS-IR-025 to EPS-IR-049: Sensor Interface Requirements
+ * - EPS-VVR-019, EPS-VVR-073: Fault injection and integration testing
+ * - EPS-SR-042, EPS-SR-045: Plausibility and range checks
+ */
+
+#include <stdio.h>
+#include "eps_sensor_provider.h"
+#include "eps_sil.h"
+
+/* Check Configuration */
+#define TEST_TRACE_FRAMES           3
+#define TEST_HARDWARE_SPEED_KPH     42.0f   /* Marks frames read from the ADC stand-in */
+#define TEST_MID_SPAN_COUNTS        ((EPS_SENSOR_SPAN_LOW_COUNTS + EPS_SENSOR_SPAN_HIGH_COUNTS) / 2)
+#define TEST_TORQUE_STEP_COUNTS     200     /* 1.2 Nm: above EPS_TORQUE_SENSOR_MAX_STEP_NM */
+#define TEST_MISMATCH_COUNTS        100     /* 0.6 Nm: above EPS_TORQUE_CHANNEL_TOLERANCE_NM */
+
+/* Scripted Provider Context */
+typedef struct {
+    eps_sensor_data_t frame;        /* Returned by the script */
+    eps_result_t result;            /* Script result */
+    uint32_t calls;
+} test_script_t;
+
+/* Check State */
+static uint32_t g_test_failures = 0;
+static uint32_t g_test_acquisitions = 0;
+static eps_sensor_raw_block_t g_test_block;        /* Returned by the ADC stand-in */
+
+/* Function Prototypes */
+static void test_check(bool condition, const char* description);
+static void test_valid_frame(eps_sensor_data_t* frame, float driver_torque);
+static eps_result_t test_script(void* context, eps_sensor_data_t* sensor_data);
+static void test_hardware(void);
+static void test_scripted(void);
+static void test_trace(void);
+static void test_selection(void);
+static void test_block_reset(void);
+static void test_torque_counts(int32_t primary_offset, int32_t secondary_offset);
+static bool test_read_clean(uint32_t samples);
+static void test_plausibility(void);
+
+/**
+ * @brief Check entry point
+ */
+int main(void)
+{
+    printf("=== EPS Sensor Provider Checks ===\n");
+
+    eps_sil_reset();
+    eps_sensors_init();
+    test_block_reset();
+
+    test_hardware();
+    test_scripted();
+    test_trace();
+    test_selection();
+    test_plausibility();
+
+    printf("\n%s\n", (g_test_failures == 0) ? "✓ Sensor provider checks passed" :
+                                               "✗ Sensor provider checks failed");
+
+    return (g_test_failures == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Acquire the raw sample block: the check's block (every channel at
+ *        mid-span unless a check changes it)
+ * @param block Raw sample block output
+ * @return eps_result_t Acquisition result
+ */
+eps_result_t eps_platform_sensors_acquire(eps_sensor_raw_block_t* block)
+{
+    *block = g_test_block;
+    block->timestamp = g_test_acquisitions;
+    g_test_acquisitions++;
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Record and print one check
+ * @param condition Check passed
+ * @param description What was checked
+ */
+static void test_check(bool condition, const char* description)
+{
+    printf("  %s %s\n", condition ? "✓" : "✗", description);
+    if (!condition) {
+        g_test_failures++;
+    }
+}
+
+/**
+ * @brief A frame that passes eps_sensors_validate_data
+ * @param frame Frame output
+ * @param driver_torque Driver torque (identifies the frame)
+ */
+static void test_valid_frame(eps_sensor_data_t* frame, float driver_torque)
+{
+    memset(frame, 0, sizeof(eps_sensor_data_t));
+    frame->driver_torque = driver_torque;
+    frame->vehicle_speed = 50.0f;
+    frame->ecu_temperature = 25.0f;
+    frame->motor_temperature = 25.0f;
+    frame->data_valid = true;
+}
+
+/**
+ * @brief Scripted frame source: the context's frame and result
+ */
+static eps_result_t test_script(void* context, eps_sensor_data_t* sensor_data)
+{
+    test_script_t* script = (test_script_t*)context;
+
+    script->calls++;
+    *sensor_data = script->frame;
+
+    return script->result;
+}
+
+/**
+ * @brief The hardware provider reads the ADC block
+ */
+static void test_hardware(void)
+{
+    eps_sensor_provider_t provider;
+    eps_sensor_data_t frame;
+    uint32_t acquisitions = g_test_acquisitions;
+
+    printf("\nHardware:\n");
+
+    test_check((eps_sensor_provider_read(&frame) == EPS_SUCCESS) &&
+               (g_test_acquisitions == acquisitions + 1) &&
+               (frame.vehicle_speed == TEST_HARDWARE_SPEED_KPH),
+               "default provider reads the ADC block");
+
+    test_check((eps_sensor_provider_init_hardware(&provider) == EPS_SUCCESS) &&
+               (provider.source == EPS_SENSOR_SOURCE_HARDWARE) &&
+               (eps_sensor_provider_select(&provider) == EPS_SUCCESS) &&
+               (eps_sensor_provider_read(&frame) == EPS_SUCCESS) &&
+               (g_test_acquisitions == acquisitions + 2),
+               "hardware provider reads the ADC block");
+
+    test_check(eps_sensor_provider_read(NULL) == EPS_ERROR_NULL_POINTER,
+               "read without a frame is rejected");
+}
+
+/**
+ * @brief Scripted frames: context, errors, validation
+ */
+static void test_scripted(void)
+{
+    eps_sensor_provider_t provider;
+    eps_sensor_data_t frame;
+    test_script_t script;
+    uint32_t acquisitions;
+
+    printf("\nScripted:\n");
+
+    memset(&script, 0, sizeof(script));
+    test_valid_frame(&script.frame, 3.5f);
+    script.result = EPS_SUCCESS;
+
+    test_check(eps_sensor_provider_init_scripted(&provider, NULL, &script) == EPS_ERROR_NULL_POINTER,
+               "provider without a script is rejected");
+
+    eps_sensor_provider_init_scripted(&provider, test_script, &script);
+    eps_sensor_provider_select(&provider);
+    acquisitions = g_test_acquisitions;
+
+    test_check((eps_sensor_provider_read(&frame) == EPS_SUCCESS) &&
+               (script.calls == 1) && (frame.driver_torque == 3.5f) &&
+               (g_test_acquisitions == acquisitions),
+               "frame comes from the script, not the ADC");
+
+    script.result = EPS_ERROR_TIMEOUT;
+    test_check(eps_sensor_provider_read(&frame) == EPS_ERROR_TIMEOUT,
+               "script error is passed on");
+    script.result = EPS_SUCCESS;
+
+    script.frame.driver_torque = 2.0f * EPS_TORQUE_SENSOR_RANGE_NM;
+    test_check(eps_sensor_provider_read(&frame) == EPS_ERROR_SENSOR_FAULT,
+               "torque out of range is rejected");
+
+    test_valid_frame(&script.frame, 0.0f);
+    script.frame.motor_temperature = EPS_TEMPERATURE_SENSOR_MAX_C + 1.0f;
+    test_check(eps_sensor_provider_read(&frame) == EPS_ERROR_SENSOR_FAULT,
+               "temperature out of range is rejected");
+
+    test_valid_frame(&script.frame, 0.0f);
+    script.frame.steering_angle = NAN;
+    test_check(eps_sensor_provider_read(&frame) == EPS_ERROR_SENSOR_FAULT,
+               "NaN angle is rejected");
+
+    test_valid_frame(&script.frame, 0.0f);
+    script.frame.data_valid = false;
+    test_check(eps_sensor_provider_read(&frame) == EPS_ERROR_SENSOR_FAULT,
+               "frame marked invalid is rejected");
+
+    eps_sensor_provider_select(NULL);
+}
+
+/**
+ * @brief Trace replay: order, end of trace, looping
+ */
+static void test_trace(void)
+{
+    eps_sensor_data_t frames[TEST_TRACE_FRAMES];
+    eps_sensor_trace_t trace;
+    eps_sensor_provider_t provider;
+    eps_sensor_data_t frame;
+    bool in_order = true;
+
+    printf("\nTrace:\n");
+
+    for (uint32_t i = 0; i < TEST_TRACE_FRAMES; i++) {
+        test_valid_frame(&frames[i], (float)i);
+    }
+
+    trace.frames = frames;
+    trace.frame_count = 0;
+    trace.position = 0;
+    trace.loop = false;
+    test_check(eps_sensor_provider_init_trace(&provider, &trace) == EPS_ERROR_INVALID_PARAMETER,
+               "empty trace is rejected");
+
+    trace.frame_count = TEST_TRACE_FRAMES;
+    trace.position = 2;
+    test_check((eps_sensor_provider_init_trace(&provider, &trace) == EPS_SUCCESS) &&
+               (trace.position == 0),
+               "init rewinds the trace");
+    eps_sensor_provider_select(&provider);
+
+    for (uint32_t i = 0; i < TEST_TRACE_FRAMES; i++) {
+        in_order = in_order && (eps_sensor_provider_read(&frame) == EPS_SUCCESS) &&
+                   (frame.driver_torque == (float)i);
+    }
+    test_check(in_order, "frames replay in order");
+    test_check(eps_sensor_provider_read(&frame) == EPS_ERROR_TIMEOUT,
+               "end of trace times out");
+
+    trace.loop = true;
+    test_check((eps_sensor_provider_read(&frame) == EPS_SUCCESS) &&
+               (frame.driver_torque == 0.0f),
+               "looping trace restarts at the first frame");
+
+    eps_sensor_provider_select(NULL);
+}
+
+/**
+ * @brief Selection keeps or restores a usable provider
+ */
+static void test_selection(void)
+{
+    eps_sensor_provider_t provider;
+    eps_sensor_provider_t incomplete;
+    eps_sensor_data_t frame;
+    test_script_t script;
+    uint32_t acquisitions;
+
+    printf("\nSelection:\n");
+
+    memset(&script, 0, sizeof(script));
+    test_valid_frame(&script.frame, 1.0f);
+    script.result = EPS_SUCCESS;
+    eps_sensor_provider_init_scripted(&provider, test_script, &script);
+    eps_sensor_provider_select(&provider);
+
+    memset(&incomplete, 0, sizeof(incomplete));
+    incomplete.source = EPS_SENSOR_SOURCE_SCRIPTED;
+    test_check((eps_sensor_provider_select(&incomplete) == EPS_ERROR_INVALID_PARAMETER) &&
+               (eps_sensor_provider_read(&frame) == EPS_SUCCESS) && (script.calls == 1),
+               "provider without a read is rejected, selection kept");
+
+    acquisitions = g_test_acquisitions;
+    test_check((eps_sensor_provider_select(NULL) == EPS_SUCCESS) &&
+               (eps_sensor_provider_read(&frame) == EPS_SUCCESS) &&
+               (g_test_acquisitions == acquisitions + 1) && (script.calls == 1),
+               "NULL selects the hardware again");
+}
+
+/**
+ * @brief Every channel at mid-span, hardware vehicle speed
+ */
+static void test_block_reset(void)
+{
+    for (uint32_t i = 0; i < EPS_SENSOR_COUNT; i++) {
+        g_test_block.counts[i] = TEST_MID_SPAN_COUNTS;
+    }
+    g_test_block.vehicle_speed = TEST_HARDWARE_SPEED_KPH;
+}
+
+/**
+ * @brief Move the torque channels from mid-span
+ * @param primary_offset Primary channel counts offset
+ * @param secondary_offset Secondary channel counts offset (inverted: the
+ *        negated primary offset is the same torque)
+ */
+static void test_torque_counts(int32_t primary_offset, int32_t secondary_offset)
+{
+    g_test_block.counts[EPS_SENSOR_TORQUE_PRIMARY] = (uint16_t)(TEST_MID_SPAN_COUNTS + primary_offset);
+    g_test_block.counts[EPS_SENSOR_TORQUE_SECONDARY] = (uint16_t)(TEST_MID_SPAN_COUNTS + secondary_offset);
+}
+
+/**
+ * @brief Read samples from the current block
+ * @param samples Number of reads
+ * @return bool Every read succeeded with no status bit
+ */
+static bool test_read_clean(uint32_t samples)
+{
+    eps_sensor_data_t frame;
+    bool clean = true;
+
+    for (uint32_t i = 0; i < samples; i++) {
+        clean = clean && (eps_sensors_read_all(&frame) == EPS_SUCCESS) &&
+                (eps_sensors_get_status() == 0);
+    }
+
+    return clean;
+}
+
+/**
+ * @brief Debounced step and mismatch faults, vehicle speed checks
+ */
+static void test_plausibility(void)
+{
+    const uint32_t torque_noisy = EPS_SENSOR_STATUS_BIT(EPS_SENSOR_TORQUE_PRIMARY, EPS_SENSOR_STATUS_NOISY);
+    const uint32_t torque_mismatch = EPS_SENSOR_STATUS_BIT(EPS_SENSOR_TORQUE_PRIMARY, EPS_SENSOR_STATUS_FAULT);
+    const uint32_t speed_faults = EPS_SENSOR_STATUS_MASK(EPS_SENSOR_VEHICLE_SPEED);
+    eps_sensor_data_t frame;
+    bool pending = true;
+
+    printf("\nPlausibility:\n");
+
+    eps_sil_reset();
+    eps_sensors_init();
+    test_block_reset();
+    (void)test_read_clean(1);
+
+    /* One-sample spike: a step out and a step back */
+    test_torque_counts(TEST_TORQUE_STEP_COUNTS, -TEST_TORQUE_STEP_COUNTS);
+    pending = test_read_clean(1);
+    test_torque_counts(0, 0);
+    pending = pending && test_read_clean(2);
+    test_check(pending && (eps_sil_get_dtc_count(EPS_DTC_TORQUE_SENSOR_FAULT) == 0),
+               "single noisy torque sample is not a fault");
+
+    /* Steps in consecutive samples */
+    pending = true;
+    for (uint32_t i = 1; i <= EPS_SENSOR_PLAUSIBILITY_DEBOUNCE; i++) {
+        int32_t offset = ((i % 2U) == 1U) ? TEST_TORQUE_STEP_COUNTS : 0;
+
+        test_torque_counts(offset, -offset);
+        if (i < EPS_SENSOR_PLAUSIBILITY_DEBOUNCE) {
+            pending = pending && test_read_clean(1);
+        }
+    }
+    test_check(pending && (eps_sensors_read_all(&frame) == EPS_ERROR_SENSOR_FAULT) &&
+               (eps_sensors_get_status() & torque_noisy) &&
+               (eps_sil_get_dtc_count(EPS_DTC_TORQUE_SENSOR_FAULT) == 1),
+               "noisy torque reported after the debounce count");
+
+    test_torque_counts(0, 0);
+    (void)eps_sensors_read_all(&frame);
+    test_check(test_read_clean(1), "torque clean again once the steps stop");
+
+    /* Channel mismatch */
+    test_torque_counts(TEST_MISMATCH_COUNTS, 0);
+    pending = test_read_clean(EPS_SENSOR_PLAUSIBILITY_DEBOUNCE - 1);
+    test_check(pending && (eps_sensors_read_all(&frame) == EPS_ERROR_SENSOR_FAULT) &&
+               (eps_sensors_get_status() & torque_mismatch),
+               "torque channel mismatch reported after the debounce count");
+    test_torque_counts(0, 0);
+    (void)test_read_clean(1);
+
+    /* Vehicle speed range */
+    g_test_block.vehicle_speed = EPS_VEHICLE_SPEED_MAX_KMH + 1.0f;
+    test_check((eps_sensors_read_all(&frame) == EPS_ERROR_SENSOR_FAULT) &&
+               (eps_sensors_get_status() == EPS_SENSOR_STATUS_BIT(EPS_SENSOR_VEHICLE_SPEED,
+                                                                  EPS_SENSOR_STATUS_OUT_OF_RANGE)) &&
+               (frame.vehicle_speed == TEST_HARDWARE_SPEED_KPH) &&
+               (eps_sil_get_dtc_count(EPS_DTC_COMMUNICATION_FAULT) == 1),
+               "vehicle speed out of range: reported at once, last valid speed held");
+
+    g_test_block.vehicle_speed = NAN;
+    test_check((eps_sensors_read_all(&frame) == EPS_ERROR_SENSOR_FAULT) &&
+               (eps_sensors_get_status() & speed_faults) &&
+               (frame.vehicle_speed == TEST_HARDWARE_SPEED_KPH),
+               "NaN vehicle speed is out of range");
+
+    /* Vehicle speed steps */
+    g_test_block.vehicle_speed = TEST_HARDWARE_SPEED_KPH;
+    (void)test_read_clean(1);
+    g_test_block.vehicle_speed = TEST_HARDWARE_SPEED_KPH + 5.0f;
+    pending = test_read_clean(2);
+    test_check(pending && (eps_sensors_read_all(&frame) == EPS_SUCCESS) &&
+               (frame.vehicle_speed == TEST_HARDWARE_SPEED_KPH + 5.0f),
+               "single vehicle speed jump is not a fault");
+
+    pending = true;
+    for (uint32_t i = 1; i < EPS_SENSOR_PLAUSIBILITY_DEBOUNCE; i++) {
+        g_test_block.vehicle_speed += 5.0f;
+        pending = pending && test_read_clean(1);
+    }
+    g_test_block.vehicle_speed += 5.0f;
+    test_check(pending && (eps_sensors_read_all(&frame) == EPS_ERROR_SENSOR_FAULT) &&
+               (eps_sensors_get_status() == EPS_SENSOR_STATUS_BIT(EPS_SENSOR_VEHICLE_SPEED,
+                                                                  EPS_SENSOR_STATUS_NOISY)),
+               "implausible vehicle speed rate reported after the debounce count");
+
+    test_block_reset();
+}
@@ -0,0 +1,422 @@
+/**
+ * @file eps_sensors.c
+ * @brief Electronic Power Steering (EPS) Sensors Module Implementation
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * eps_sensors_read_all() processes the platform's raw sample block in one
+ * pass over the channels: each sample is calibrated with a gain and offset
+ * precomputed at init, then checked against its raw signal rails, its
+ * valid range and its largest plausible step. Faults are collected in the
+ * status bitmask (EPS_SENSOR_STATUS_BIT) rather than per-check result
+ * codes. The redundant torque channels are then cross-checked and fused,
+ * the vehicle speed from the bus is checked the same way, and the sensor
+ * frame is filled from the calibrated values.
+ *
+ * Rail and range faults are reported at once. A step or a channel
+ * mismatch is reported only when it persists for
+ * EPS_SENSOR_PLAUSIBILITY_DEBOUNCE consecutive samples, so a single noisy
+ * sample does not fail the sensor.
+ *
+ * A sensor outside its rails or range keeps its last valid value, so it is
+ * not also reported as a step when it recovers.
+ *
+ * The secondary torque channel has the inverted characteristic of the
+ * primary (a common-mode fault moves the two apart); its calibration maps
+ * both to the same torque.
+ *
+ * Requirements Traceability:
+ * - EPS-IR-025 to EPS-IR-049: Sensor Interface Requirements
+ * - EPS-FR-007 to EPS-FR-011: Torque Sensing Functions
+ * - EPS-SR-019, EPS-SR-029, EPS-SR-031: Dual-channel torque sensing
+ * - EPS-SR-042, EPS-SR-044, EPS-SR-045: Plausibility and range checks
+ * - EPS-DR-011: Sensor signal quality
+ */
+
+#include "eps_sensors.h"
+#include "eps_diagnostics.h"
+
+/* Channel Configuration */
+typedef struct {
+    uint16_t low_counts;            /* Span endpoints */
+    uint16_t high_counts;
+    float low_value;                /* Value at the span endpoints */
+    float high_value;
+    float min_value;                /* Valid range */
+    float max_value;
+    float max_step;                 /* Per sample (0: not checked) */
+    bool rail_check;                /* Raw signal must stay within the rails */
+} eps_sensor_channel_config_t;
+
+static const eps_sensor_channel_config_t g_sensor_channel_config[EPS_SENSOR_COUNT] = {
+    /* EPS_SENSOR_TORQUE_PRIMARY */
+    { EPS_SENSOR_SPAN_LOW_COUNTS, EPS_SENSOR_SPAN_HIGH_COUNTS,
+      -EPS_TORQUE_SENSOR_RANGE_NM, EPS_TORQUE_SENSOR_RANGE_NM,
+      -EPS_TORQUE_SENSOR_RANGE_NM, EPS_TORQUE_SENSOR_RANGE_NM,
+      EPS_TORQUE_SENSOR_MAX_STEP_NM, true },
+    /* EPS_SENSOR_TORQUE_SECONDARY (inverted) */
+    { EPS_SENSOR_SPAN_LOW_COUNTS, EPS_SENSOR_SPAN_HIGH_COUNTS,
+      EPS_TORQUE_SENSOR_RANGE_NM, -EPS_TORQUE_SENSOR_RANGE_NM,
+      -EPS_TORQUE_SENSOR_RANGE_NM, EPS_TORQUE_SENSOR_RANGE_NM,
+      EPS_TORQUE_SENSOR_MAX_STEP_NM, true },
+    /* EPS_SENSOR_STEERING_ANGLE */
+    { EPS_SENSOR_SPAN_LOW_COUNTS, EPS_SENSOR_SPAN_HIGH_COUNTS,
+      -EPS_ANGLE_SENSOR_RANGE_DEG, EPS_ANGLE_SENSOR_RANGE_DEG,
+      -EPS_ANGLE_SENSOR_RANGE_DEG, EPS_ANGLE_SENSOR_RANGE_DEG,
+      EPS_ANGLE_SENSOR_MAX_STEP_DEG, true },
+    /* EPS_SENSOR_MOTOR_POSITION (full-scale resolver angle, wraps) */
+    { 0, EPS_SENSOR_ADC_FULL_SCALE, 0.0f, 360.0f,
+      0.0f, 360.0f, 0.0f, false },
+    /* EPS_SENSOR_TEMPERATURE_ECU */
+    { EPS_SENSOR_SPAN_LOW_COUNTS, EPS_SENSOR_SPAN_HIGH_COUNTS,
+      EPS_TEMPERATURE_SENSOR_MIN_C, EPS_TEMPERATURE_SENSOR_MAX_C,
+      EPS_TEMPERATURE_SENSOR_MIN_C, EPS_TEMPERATURE_SENSOR_MAX_C,
+      EPS_TEMPERATURE_MAX_STEP_C, true },
+    /* EPS_SENSOR_TEMPERATURE_MOTOR */
+    { EPS_SENSOR_SPAN_LOW_COUNTS, EPS_SENSOR_SPAN_HIGH_COUNTS,
+      EPS_TEMPERATURE_SENSOR_MIN_C, EPS_TEMPERATURE_SENSOR_MAX_C,
+      EPS_TEMPERATURE_SENSOR_MIN_C, EPS_TEMPERATURE_SENSOR_MAX_C,
+      EPS_TEMPERATURE_MAX_STEP_C, true }
+};
+
+/* Sensor State */
+static eps_sensor_channel_t g_sensor_channels[EPS_SENSOR_COUNT];
+static eps_sensor_raw_block_t g_sensor_raw_block;
+static float g_sensor_values[EPS_SENSOR_COUNT];     /* Latest calibrated values */
+static float g_sensor_vehicle_speed = 0.0f;         /* Latest valid vehicle speed */
+static uint8_t g_sensor_suspect_samples[EPS_SENSOR_COUNT + 1];  /* Consecutive step or mismatch samples */
+static uint32_t g_sensor_status = 0;
+static bool g_sensors_primed = false;               /* Previous values available */
+
+/* Static Function Prototypes */
+static eps_result_t eps_sensors_process(eps_sensor_data_t* sensor_data);
+static uint32_t eps_sensors_debounce(uint32_t suspect);
+static void eps_sensors_report_faults(uint32_t status, uint32_t previous);
+
+/**
+ * @brief Initialize the sensors: precompute the channel calibration
+ * @return eps_result_t Initialization result
+ *
+ * Requirements: EPS-FR-007, EPS-IR-025
+ */
+eps_result_t eps_sensors_init(void)
+{
+    for (uint32_t i = 0; i < EPS_SENSOR_COUNT; i++) {
+        const eps_sensor_channel_config_t* config = &g_sensor_channel_config[i];
+        eps_sensor_channel_t* channel = &g_sensor_channels[i];
+        float span_counts = (float)config->high_counts - (float)config->low_counts;
+
+        channel->gain = (config->high_value - config->low_value) / span_counts;
+        channel->offset = config->low_value - channel->gain * (float)config->low_counts;
+        channel->min_value = config->min_value;
+        channel->max_value = config->max_value;
+        channel->max_step = config->max_step;
+        channel->rail_low_counts = config->rail_check ? EPS_SENSOR_RAIL_LOW_COUNTS : 0;
+        channel->rail_high_counts = config->rail_check ? EPS_SENSOR_RAIL_HIGH_COUNTS : UINT16_MAX;
+    }
+
+    memset(&g_sensor_raw_block, 0, sizeof(eps_sensor_raw_block_t));
+    memset(g_sensor_values, 0, sizeof(g_sensor_values));
+    memset(g_sensor_suspect_samples, 0, sizeof(g_sensor_suspect_samples));
+    g_sensor_vehicle_speed = 0.0f;
+    g_sensor_status = 0;
+    g_sensors_primed = false;
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Read, check and fuse all sensors
+ * @param sensor_data Sensor frame output (data_valid false on a fault)
+ * @return eps_result_t EPS_ERROR_SENSOR_FAULT if any status bit is set
+ *
+ * Requirements: EPS-FR-007, EPS-IR-028, EPS-SR-019, EPS-SR-031, EPS-DR-011
+ */
+eps_result_t eps_sensors_read_all(eps_sensor_data_t* sensor_data)
+{
+    eps_result_t result;
+
+    if (!sensor_data) {
+        return EPS_ERROR_NULL_POINTER;
+    }
+
+    result = eps_platform_sensors_acquire(&g_sensor_raw_block);
+    if (result != EPS_SUCCESS) {
+        sensor_data->data_valid = false;
+        return result;
+    }
+
+    return eps_sensors_process(sensor_data);
+}
+
+/**
+ * @brief Validate a sensor frame that did not come from eps_sensors_read_all
+ * @param sensor_data Sensor frame
+ * @return eps_result_t EPS_ERROR_SENSOR_FAULT if invalid or out of range
+ *
+ * Frames read by eps_sensors_read_all() are checked during the read; this
+ * check is for injected frames (test builds).
+ *
+ * Requirements: EPS-SR-019, EPS-DR-011
+ */
+eps_result_t eps_sensors_validate_data(const eps_sensor_data_t* sensor_data)
+{
+    if (!sensor_data) {
+        return EPS_ERROR_NULL_POINTER;
+    }
+
+    /* Written so that NaN fails every range */
+    if (!sensor_data->data_valid ||
+        !(fabsf(sensor_data->driver_torque) <= EPS_TORQUE_SENSOR_RANGE_NM) ||
+        !(fabsf(sensor_data->steering_angle) <= EPS_ANGLE_SENSOR_RANGE_DEG) ||
+        !(sensor_data->vehicle_speed >= 0.0f) ||
+        !(sensor_data->vehicle_speed <= EPS_VEHICLE_SPEED_MAX_KMH) ||
+        !(sensor_data->ecu_temperature >= EPS_TEMPERATURE_SENSOR_MIN_C) ||
+        !(sensor_data->ecu_temperature <= EPS_TEMPERATURE_SENSOR_MAX_C) ||
+        !(sensor_data->motor_temperature >= EPS_TEMPERATURE_SENSOR_MIN_C) ||
+        !(sensor_data->motor_temperature <= EPS_TEMPERATURE_SENSOR_MAX_C)) {
+        return EPS_ERROR_SENSOR_FAULT;
+    }
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Sensor self-test: one read with all sensors connected and in range
+ * @return eps_result_t Self-test result
+ *
+ * Requirements: EPS-DR-002
+ */
+eps_result_t eps_sensors_self_test(void)
+{
+    eps_sensor_data_t sensor_data;
+
+    g_sensors_primed = false;
+    memset(g_sensor_suspect_samples, 0, sizeof(g_sensor_suspect_samples));
+
+    return eps_sensors_read_all(&sensor_data);
+}
+
+/**
+ * @brief Zero-point calibration at the latest sample (torque and angle)
+ * @param sensor_type Sensor to calibrate (the wheel centered and released)
+ * @return eps_result_t EPS_ERROR_CALIBRATION_FAULT if the sensor is faulty
+ *
+ * Requirements: EPS-DR-077
+ */
+eps_result_t eps_sensors_calibrate(eps_sensor_type_t sensor_type)
+{
+    eps_sensor_channel_t* channel;
+
+    if ((sensor_type != EPS_SENSOR_TORQUE_PRIMARY) &&
+        (sensor_type != EPS_SENSOR_TORQUE_SECONDARY) &&
+        (sensor_type != EPS_SENSOR_STEERING_ANGLE)) {
+        return EPS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (!g_sensors_primed || (g_sensor_status & EPS_SENSOR_STATUS_MASK(sensor_type))) {
+        return EPS_ERROR_CALIBRATION_FAULT;
+    }
+
+    channel = &g_sensor_channels[sensor_type];
+    channel->offset = -channel->gain * (float)g_sensor_raw_block.counts[sensor_type];
+    g_sensor_values[sensor_type] = 0.0f;
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Latest reading of one sensor
+ * @param sensor_type Sensor
+ * @return eps_sensor_reading_t Reading (first fault status of the sensor)
+ */
+eps_sensor_reading_t eps_sensors_read_single(eps_sensor_type_t sensor_type)
+{
+    eps_sensor_reading_t reading;
+
+    memset(&reading, 0, sizeof(eps_sensor_reading_t));
+    if ((uint32_t)sensor_type >= EPS_SENSOR_COUNT) {
+        reading.status = EPS_SENSOR_STATUS_FAULT;
+        return reading;
+    }
+
+    reading.raw_value = (float)g_sensor_raw_block.counts[sensor_type];
+    reading.calibrated_value = g_sensor_values[sensor_type];
+    reading.timestamp = g_sensor_raw_block.timestamp;
+    reading.status = EPS_SENSOR_STATUS_OK;
+
+    for (uint32_t status = EPS_SENSOR_STATUS_FAULT; status <= EPS_SENSOR_STATUS_NOISY; status++) {
+        if (g_sensor_status & EPS_SENSOR_STATUS_BIT(sensor_type, status)) {
+            reading.status = (eps_sensor_status_t)status;
+            break;
+        }
+    }
+
+    reading.valid = g_sensors_primed && (reading.status == EPS_SENSOR_STATUS_OK);
+
+    return reading;
+}
+
+/**
+ * @brief Status of all sensors after the latest read
+ * @return uint32_t EPS_SENSOR_STATUS_BIT() flags, 0 if all sensors are OK
+ */
+uint32_t eps_sensors_get_status(void)
+{
+    return g_sensor_status;
+}
+
+/**
+ * @brief Calibrate, check and fuse the raw sample block in one pass
+ */
+static eps_result_t eps_sensors_process(eps_sensor_data_t* sensor_data)
+{
+    const eps_sensor_raw_block_t* block = &g_sensor_raw_block;
+    float previous_angle = g_sensor_values[EPS_SENSOR_STEERING_ANGLE];
+    float previous_position = g_sensor_values[EPS_SENSOR_MOTOR_POSITION];
+    uint32_t status = 0;            /* Rail and range faults */
+    uint32_t suspect = 0;           /* Steps and channel mismatch, debounced */
+    float vehicle_speed = block->vehicle_speed;
+    float position_step;
+
+    /* Calibration, rail, range and step checks - EPS-SR-042, EPS-SR-044 */
+    for (uint32_t i = 0; i < EPS_SENSOR_COUNT; i++) {
+        const eps_sensor_channel_t* channel = &g_sensor_channels[i];
+        uint16_t counts = block->counts[i];
+        float value = channel->offset + channel->gain * (float)counts;
+
+        if ((counts < channel->rail_low_counts) || (counts > channel->rail_high_counts)) {
+            status |= EPS_SENSOR_STATUS_BIT(i, EPS_SENSOR_STATUS_DISCONNECTED);
+        } else if ((value < channel->min_value) || (value > channel->max_value)) {
+            status |= EPS_SENSOR_STATUS_BIT(i, EPS_SENSOR_STATUS_OUT_OF_RANGE);
+        } else {
+            if (g_sensors_primed && (channel->max_step > 0.0f) &&
+                (fabsf(value - g_sensor_values[i]) > channel->max_step)) {
+                suspect |= EPS_SENSOR_STATUS_BIT(i, EPS_SENSOR_STATUS_NOISY);
+            }
+
+            /* A disconnected or out of range sensor holds its last value */
+            g_sensor_values[i] = value;
+        }
+    }
+
+    /* Cross-check and fuse the torque channels (the DTC is reported on the
+     * rising edge with the other status bits) - EPS-SR-019, EPS-SR-031 */
+    if (!(status & (EPS_SENSOR_STATUS_MASK(EPS_SENSOR_TORQUE_PRIMARY) |
+                    EPS_SENSOR_STATUS_MASK(EPS_SENSOR_TORQUE_SECONDARY)))) {
+        if (fabsf(g_sensor_values[EPS_SENSOR_TORQUE_PRIMARY] -
+                  g_sensor_values[EPS_SENSOR_TORQUE_SECONDARY]) > EPS_TORQUE_CHANNEL_TOLERANCE_NM) {
+            suspect |= EPS_SENSOR_STATUS_BIT(EPS_SENSOR_TORQUE_PRIMARY, EPS_SENSOR_STATUS_FAULT) |
+                       EPS_SENSOR_STATUS_BIT(EPS_SENSOR_TORQUE_SECONDARY, EPS_SENSOR_STATUS_FAULT);
+        }
+    }
+
+    /* Vehicle speed: range and step like a channel (NaN is out of range),
+     * held at its last valid value - EPS-SR-045 */
+    if (!(vehicle_speed >= 0.0f) || !(vehicle_speed <= EPS_VEHICLE_SPEED_MAX_KMH)) {
+        status |= EPS_SENSOR_STATUS_BIT(EPS_SENSOR_VEHICLE_SPEED, EPS_SENSOR_STATUS_OUT_OF_RANGE);
+    } else {
+        if (g_sensors_primed &&
+            (fabsf(vehicle_speed - g_sensor_vehicle_speed) > EPS_VEHICLE_SPEED_MAX_STEP_KMH)) {
+            suspect |= EPS_SENSOR_STATUS_BIT(EPS_SENSOR_VEHICLE_SPEED, EPS_SENSOR_STATUS_NOISY);
+        }
+        g_sensor_vehicle_speed = vehicle_speed;
+    }
+
+    status |= eps_sensors_debounce(suspect);
+
+    sensor_data->driver_torque = 0.5f * (g_sensor_values[EPS_SENSOR_TORQUE_PRIMARY] +
+                                         g_sensor_values[EPS_SENSOR_TORQUE_SECONDARY]);
+    sensor_data->steering_angle = g_sensor_values[EPS_SENSOR_STEERING_ANGLE];
+    sensor_data->vehicle_speed = g_sensor_vehicle_speed;
+    sensor_data->motor_position = g_sensor_values[EPS_SENSOR_MOTOR_POSITION];
+    sensor_data->ecu_temperature = g_sensor_values[EPS_SENSOR_TEMPERATURE_ECU];
+    sensor_data->motor_temperature = g_sensor_values[EPS_SENSOR_TEMPERATURE_MOTOR];
+    sensor_data->timestamp = block->timestamp;
+
+    /* Rates from consecutive samples (motor position wraps at 360 deg) */
+    if (g_sensors_primed) {
+        position_step = sensor_data->motor_position - previous_position;
+        if (position_step > 180.0f) {
+            position_step -= 360.0f;
+        } else if (position_step < -180.0f) {
+            position_step += 360.0f;
+        }
+
+        sensor_data->steering_velocity = (sensor_data->steering_angle - previous_angle) *
+                                         (float)EPS_SENSOR_SAMPLE_RATE_HZ;
+        sensor_data->motor_velocity = position_step * ((float)EPS_SENSOR_SAMPLE_RATE_HZ * 60.0f / 360.0f);
+    } else {
+        sensor_data->steering_velocity = 0.0f;
+        sensor_data->motor_velocity = 0.0f;
+    }
+
+    eps_sensors_report_faults(status, g_sensor_status);
+    g_sensor_status = status;
+    g_sensors_primed = true;
+
+    sensor_data->data_valid = (status == 0);
+
+    return (status == 0) ? EPS_SUCCESS : EPS_ERROR_SENSOR_FAULT;
+}
+
+/**
+ * @brief Step and channel mismatch bits that persisted long enough
+ * @param suspect Step and mismatch bits of this read
+ * @return uint32_t Bits to report: a sensor's bits once it has had them for
+ *         EPS_SENSOR_PLAUSIBILITY_DEBOUNCE consecutive samples, or at once
+ *         on the first read after init or self-test
+ *
+ * Requirements: EPS-SR-042, EPS-DR-011
+ */
+static uint32_t eps_sensors_debounce(uint32_t suspect)
+{
+    uint32_t reported = 0;
+
+    for (uint32_t i = 0; i <= EPS_SENSOR_COUNT; i++) {
+        uint32_t bits = suspect & EPS_SENSOR_STATUS_MASK(i);
+
+        if (bits == 0) {
+            g_sensor_suspect_samples[i] = 0;
+            continue;
+        }
+
+        if (g_sensor_suspect_samples[i] < EPS_SENSOR_PLAUSIBILITY_DEBOUNCE) {
+            g_sensor_suspect_samples[i]++;
+        }
+        if (!g_sensors_primed || (g_sensor_suspect_samples[i] >= EPS_SENSOR_PLAUSIBILITY_DEBOUNCE)) {
+            reported |= bits;
+        }
+    }
+
+    return reported;
+}
+
+/**
+ * @brief Diagnostic trouble codes for sensors that became faulty
+ * @param status Status bits of this read
+ * @param previous Status bits of the previous read
+ *
+ * A DTC is reported when its sensor goes from no status bit to any, so a
+ * fault that changes kind (e.g. a step followed by a channel mismatch)
+ * is not reported again.
+ *
+ * Requirements: EPS-DR-031
+ */
+static void eps_sensors_report_faults(uint32_t status, uint32_t previous)
+{
+    const uint32_t torque_faults = EPS_SENSOR_STATUS_MASK(EPS_SENSOR_TORQUE_PRIMARY) |
+                                   EPS_SENSOR_STATUS_MASK(EPS_SENSOR_TORQUE_SECONDARY);
+    const uint32_t angle_faults = EPS_SENSOR_STATUS_MASK(EPS_SENSOR_STEERING_ANGLE);
+    const uint32_t speed_faults = EPS_SENSOR_STATUS_MASK(EPS_SENSOR_VEHICLE_SPEED);
+
+    if ((status & torque_faults) && !(previous & torque_faults)) {
+        eps_diagnostics_set_dtc(EPS_DTC_TORQUE_SENSOR_FAULT);
+    }
+    if ((status & angle_faults) && !(previous & angle_faults)) {
+        eps_diagnostics_set_dtc(EPS_DTC_ANGLE_SENSOR_FAULT);
+    }
+    if ((status & speed_faults) && !(previous & speed_faults)) {
+        eps_diagnostics_set_dtc(EPS_DTC_COMMUNICATION_FAULT);
+    }
+}
@@ -20,6 +20,29 @@
 #define EPS_ANGLE_SENSOR_RANGE_DEG      720.0f  /* ±720° - EPS-PR-047 */
 #define EPS_ANGLE_SENSOR_ACCURACY       1.0f    /* ±1° - EPS-PR-048 */
 #define EPS_SENSOR_SAMPLE_RATE_HZ       1000    /* Hz - EPS-IR-028 */
+#define EPS_TORQUE_CHANNEL_TOLERANCE_NM (2.0f * EPS_TORQUE_SENSOR_ACCURACY * EPS_TORQUE_SENSOR_RANGE_NM)
+
+/* Raw Signal Layout (12-bit ADC) */
+#define EPS_SENSOR_ADC_FULL_SCALE       4096    /* Counts */
+#define EPS_SENSOR_SPAN_LOW_COUNTS      410     /* 10% - lower end of the signal span */
+#define EPS_SENSOR_SPAN_HIGH_COUNTS     3686    /* 90% - upper end of the signal span */
+#define EPS_SENSOR_RAIL_LOW_COUNTS      205     /* 5% - below: open circuit or short to ground */
+#define EPS_SENSOR_RAIL_HIGH_COUNTS     3891    /* 95% - above: short to supply */
+#define EPS_TEMPERATURE_SENSOR_MIN_C    -40.0f  /* degC at the lower span end */
+#define EPS_TEMPERATURE_SENSOR_MAX_C    150.0f  /* degC at the upper span end */
+
+/* Plausibility: largest change between consecutive samples - EPS-SR-042 */
+#define EPS_TORQUE_SENSOR_MAX_STEP_NM   1.0f
+#define EPS_ANGLE_SENSOR_MAX_STEP_DEG   2.0f
+#define EPS_TEMPERATURE_MAX_STEP_C      1.0f
+#define EPS_VEHICLE_SPEED_MAX_STEP_KMH  1.0f
+
+/* Vehicle speed (bus signal) valid range - EPS-SR-045 */
+#define EPS_VEHICLE_SPEED_MAX_KMH       300.0f
+
+/* Step and channel mismatch faults are reported after this many
+ * consecutive samples; rail and range faults at once */
+#define EPS_SENSOR_PLAUSIBILITY_DEBOUNCE 3u
 
 /* Sensor Types */
 typedef enum {
@@ -29,7 +52,8 @@ typedef enum {
     EPS_SENSOR_MOTOR_POSITION,
     EPS_SENSOR_TEMPERATURE_ECU,
     EPS_SENSOR_TEMPERATURE_MOTOR,
-    EPS_SENSOR_COUNT
+    EPS_SENSOR_COUNT,
+    EPS_SENSOR_VEHICLE_SPEED = EPS_SENSOR_COUNT     /* Bus signal: status bits only */
 } eps_sensor_type_t;
 
 /* Sensor Status */
@@ -41,6 +65,32 @@ typedef enum {
     EPS_SENSOR_STATUS_NOISY
 } eps_sensor_status_t;
 
+/* Sensor Status Bitmask: EPS_SENSOR_STATUS_BITS per sensor (and the
+ * vehicle speed), one bit per fault status (EPS_SENSOR_STATUS_OK has none) */
+#define EPS_SENSOR_STATUS_BITS          4u
+#define EPS_SENSOR_STATUS_BIT(sensor, status) \
+    (1uL << ((uint32_t)(sensor) * EPS_SENSOR_STATUS_BITS + (uint32_t)(status) - 1u))
+#define EPS_SENSOR_STATUS_MASK(sensor) \
+    (0xFuL << ((uint32_t)(sensor) * EPS_SENSOR_STATUS_BITS))
+
+/* Raw Sample Block (one conversion sequence, indexed by eps_sensor_type_t) */
+typedef struct {
+    uint16_t counts[EPS_SENSOR_COUNT];  /* ADC counts */
+    float vehicle_speed;            /* km/h - From the vehicle bus */
+    uint32_t timestamp;             /* ms - Conversion timestamp */
+} eps_sensor_raw_block_t;
+
+/* Channel Calibration (precomputed at init) */
+typedef struct {
+    float gain;                     /* Units per count */
+    float offset;                   /* Value at 0 counts */
+    float min_value;                /* Valid range */
+    float max_value;
+    float max_step;                 /* Per sample (0: not checked) */
+    uint16_t rail_low_counts;       /* Valid raw signal range */
+    uint16_t rail_high_counts;
+} eps_sensor_channel_t;
+
 /* Individual Sensor Data */
 typedef struct {
     float raw_value;
@@ -58,4 +108,19 @@ eps_result_t eps_sensors_self_test(void);
 eps_result_t eps_sensors_calibrate(eps_sensor_type_t sensor_type);
 eps_sensor_reading_t eps_sensors_read_single(eps_sensor_type_t sensor_type);
 
+/**
+ * @brief Status of all sensors after the latest read
+ * @return uint32_t EPS_SENSOR_STATUS_BIT() flags, 0 if all sensors are OK
+ */
+uint32_t eps_sensors_get_status(void);
+
+/**
+ * @brief Acquire the raw sample block (provided by the platform ADC driver)
+ * @param block Raw sample block output
+ * @return eps_result_t Acquisition result
+ *
+ * Requirements: EPS-IR-028
+ */
+eps_result_t eps_platform_sensors_acquire(eps_sensor_raw_block_t* block);
+
 #endif /* EPS_SENSORS_H */
\ No newline at end of file
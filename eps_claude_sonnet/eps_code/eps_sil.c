@@ -0,0 +1,289 @@
+/**
+ * @file eps_sil.c
+ * @brief Electronic Power Steering (EPS) Software-in-the-Loop Stand-ins
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * See eps_sil.h. Host builds only; the target links the real motor drive,
+ * diagnostics, communication and power management modules.
+ *
+ * Requirements Traceability:
+ * - EPS-VVR-019, EPS-VVR-073: Fault injection and integration testing
+ */
+
+#include "eps_sil.h"
+#include "eps_motor_control.h"
+#include "eps_diagnostics.h"
+#include "eps_communication.h"
+#include "eps_power_management.h"
+
+/* SIL Configuration */
+#define EPS_SIL_DTC_SLOTS           16      /* Distinct DTCs counted */
+
+/* DTC Count */
+typedef struct {
+    eps_dtc_code_t code;
+    uint32_t count;
+} eps_sil_dtc_entry_t;
+
+/* Stand-in State */
+static eps_sil_dtc_entry_t g_sil_dtcs[EPS_SIL_DTC_SLOTS];
+static uint32_t g_sil_dtc_total = 0;
+static bool g_sil_feedback_valid = true;
+static bool g_sil_motor_disabled = false;
+static float g_sil_torque_limit_nm = EPS_MAX_ASSISTANCE_TORQUE;
+static uint16_t g_sil_duty_cycles[3];
+
+/**
+ * @brief Reset the stand-ins (DTC counts cleared, motor feedback valid)
+ */
+void eps_sil_reset(void)
+{
+    memset(g_sil_dtcs, 0, sizeof(g_sil_dtcs));
+    memset(g_sil_duty_cycles, 0, sizeof(g_sil_duty_cycles));
+    g_sil_dtc_total = 0;
+    g_sil_feedback_valid = true;
+    g_sil_motor_disabled = false;
+    g_sil_torque_limit_nm = EPS_MAX_ASSISTANCE_TORQUE;
+}
+
+/**
+ * @brief Number of times a DTC was set since eps_sil_reset()
+ * @param dtc_code DTC
+ * @return uint32_t Count
+ */
+uint32_t eps_sil_get_dtc_count(eps_dtc_code_t dtc_code)
+{
+    for (uint32_t i = 0; i < EPS_SIL_DTC_SLOTS; i++) {
+        if (g_sil_dtcs[i].count > 0 && g_sil_dtcs[i].code == dtc_code) {
+            return g_sil_dtcs[i].count;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Number of DTCs set since eps_sil_reset(), all codes
+ * @return uint32_t Count
+ */
+uint32_t eps_sil_get_dtc_total(void)
+{
+    return g_sil_dtc_total;
+}
+
+/**
+ * @brief Make the motor feedback read fail (fault injection)
+ * @param valid false: eps_motor_control_get_feedback() returns EPS_ERROR_MOTOR_FAULT
+ */
+void eps_sil_set_motor_feedback_valid(bool valid)
+{
+    g_sil_feedback_valid = valid;
+}
+
+/**
+ * @brief Whether eps_motor_control_disable() was called since eps_sil_reset()
+ * @return bool true if the motor drive was disabled
+ */
+bool eps_sil_motor_disabled(void)
+{
+    return g_sil_motor_disabled;
+}
+
+/* Motor Drive (eps_motor_control.h) */
+
+/**
+ * @brief Initialize motor control subsystem
+ * @return eps_result_t Initialization result
+ */
+eps_result_t eps_motor_control_init(void)
+{
+    g_sil_motor_disabled = false;
+    g_sil_torque_limit_nm = EPS_MAX_ASSISTANCE_TORQUE;
+
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Disable motor control
+ */
+void eps_motor_control_disable(void)
+{
+    g_sil_motor_disabled = true;
+}
+
+/**
+ * @brief Set motor torque limit
+ * @param torque_limit_nm Maximum torque limit in Nm
+ * @return eps_result_t Result of setting limit
+ */
+eps_result_t eps_motor_control_limit_torque(float torque_limit_nm)
+{
+    if (!(torque_limit_nm >= 0.0f)) {
+        return EPS_ERROR_INVALID_PARAMETER;
+    }
+
+    g_sil_torque_limit_nm = torque_limit_nm;
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Get motor feedback data: a motor at rest, drawing no current
+ * @param feedback Pointer to feedback data structure
+ * @return eps_result_t EPS_ERROR_MOTOR_FAULT while feedback is made invalid
+ */
+eps_result_t eps_motor_control_get_feedback(eps_motor_feedback_t* feedback)
+{
+    if (!feedback) {
+        return EPS_ERROR_NULL_POINTER;
+    }
+
+    memset(feedback, 0, sizeof(eps_motor_feedback_t));
+    feedback->temperature_c = 30.0f;
+    feedback->data_valid = g_sil_feedback_valid;
+
+    return g_sil_feedback_valid ? EPS_SUCCESS : EPS_ERROR_MOTOR_FAULT;
+}
+
+/**
+ * @brief Perform motor control self-test
+ * @return eps_result_t Self-test result
+ */
+eps_result_t eps_motor_control_self_test(void)
+{
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Update PWM duty cycles
+ * @param duty_cycles Array of 3 duty cycle values
+ * @return eps_result_t Update result
+ */
+eps_result_t eps_motor_control_update_pwm(const uint16_t duty_cycles[3])
+{
+    if (!duty_cycles) {
+        return EPS_ERROR_NULL_POINTER;
+    }
+
+    memcpy(g_sil_duty_cycles, duty_cycles, sizeof(g_sil_duty_cycles));
+    return EPS_SUCCESS;
+}
+
+/* Diagnostics (eps_diagnostics.h) */
+
+/**
+ * @brief Initialize diagnostics (DTC counts are kept until eps_sil_reset)
+ * @return eps_result_t Initialization result
+ */
+eps_result_t eps_diagnostics_init(void)
+{
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Periodic diagnostics
+ * @param sensor_data Pointer to current sensor data
+ * @param assistance_params Pointer to current assistance parameters
+ * @return eps_result_t Update result
+ */
+eps_result_t eps_diagnostics_update(const eps_sensor_data_t* sensor_data,
+                                   const eps_assistance_params_t* assistance_params)
+{
+    (void)sensor_data;
+    (void)assistance_params;
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Perform diagnostics self-test
+ * @return eps_result_t Self-test result
+ */
+eps_result_t eps_diagnostics_self_test(void)
+{
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Set a diagnostic trouble code (counted per code)
+ * @param dtc_code DTC
+ */
+void eps_diagnostics_set_dtc(eps_dtc_code_t dtc_code)
+{
+    g_sil_dtc_total++;
+
+    for (uint32_t i = 0; i < EPS_SIL_DTC_SLOTS; i++) {
+        if (g_sil_dtcs[i].count == 0 || g_sil_dtcs[i].code == dtc_code) {
+            g_sil_dtcs[i].code = dtc_code;
+            g_sil_dtcs[i].count++;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Save diagnostic data to non-volatile memory
+ */
+void eps_diagnostics_save_data(void)
+{
+}
+
+/* Communication (eps_communication.h) */
+
+/**
+ * @brief Initialize communication
+ * @return eps_result_t Initialization result
+ */
+eps_result_t eps_communication_init(void)
+{
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Periodic communication
+ * @param sensor_data Pointer to current sensor data
+ * @param assistance_params Pointer to current assistance parameters
+ * @return eps_result_t Update result
+ */
+eps_result_t eps_communication_update(const eps_sensor_data_t* sensor_data,
+                                     const eps_assistance_params_t* assistance_params)
+{
+    (void)sensor_data;
+    (void)assistance_params;
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Perform communication self-test
+ * @return eps_result_t Self-test result
+ */
+eps_result_t eps_communication_self_test(void)
+{
+    return EPS_SUCCESS;
+}
+
+/* Power Management (eps_power_management.h) */
+
+/**
+ * @brief Initialize power management
+ * @return eps_result_t Initialization result
+ */
+eps_result_t eps_power_management_init(void)
+{
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Enter sleep mode
+ */
+void eps_power_management_sleep(void)
+{
+}
+
+/**
+ * @brief Power consumption (not measured in SIL)
+ * @return float Power consumption in W
+ */
+float eps_power_get_consumption(void)
+{
+    return 0.0f;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file eps_sil.h
+ * @brief Electronic Power Steering (EPS) Software-in-the-Loop Stand-ins
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Host implementations of the modules that only exist on the target: the
+ * motor drive (eps_motor_control.h), diagnostics (eps_diagnostics.h),
+ * communication (eps_communication.h) and power management
+ * (eps_power_management.h). They keep the target's interfaces so the test
+ * program links the production modules unchanged:
+ *
+ * - Motor drive: valid feedback of a motor at rest, PWM duty cycles stored
+ * - Diagnostics: each DTC set is counted, so tests can check what was reported
+ * - Communication and power management: accept every call
+ *
+ * The functions below let test programs inspect and steer the stand-ins.
+ *
+ * Requirements Traceability:
+ * - EPS-VVR-019, EPS-VVR-073: Fault injection and integration testing
+ */
+
+#ifndef EPS_SIL_H
+#define EPS_SIL_H
+
+#include "eps_main.h"
+
+/* Function Prototypes */
+
+/**
+ * @brief Reset the stand-ins (DTC counts cleared, motor feedback valid)
+ */
+void eps_sil_reset(void);
+
+/**
+ * @brief Number of times a DTC was set since eps_sil_reset()
+ * @param dtc_code DTC
+ * @return uint32_t Count
+ */
+uint32_t eps_sil_get_dtc_count(eps_dtc_code_t dtc_code);
+
+/**
+ * @brief Number of DTCs set since eps_sil_reset(), all codes
+ * @return uint32_t Count
+ */
+uint32_t eps_sil_get_dtc_total(void);
+
+/**
+ * @brief Make the motor feedback read fail (fault injection)
+ * @param valid false: eps_motor_control_get_feedback() returns EPS_ERROR_MOTOR_FAULT
+ */
+void eps_sil_set_motor_feedback_valid(bool valid);
+
+/**
+ * @brief Whether eps_motor_control_disable() was called since eps_sil_reset()
+ * @return bool true if the motor drive was disabled
+ */
+bool eps_sil_motor_disabled(void);
+
+#endif /* EPS_SIL_H */
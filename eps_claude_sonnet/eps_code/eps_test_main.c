@@ -13,18 +13,64 @@
  * - Safety mechanism validation
  * - Fault injection and recovery
  * - Performance measurement
+ * 
+ * Clock Modes:
+ * - Real time: one eps_system_task() per EPS_SYSTEM_CYCLE_TIME_MS of wall time
+ * - Virtual (--virtual): no sleeping; simulated time advances one cycle per
+ *   task call, so long soak runs complete in a fraction of simulated time
+ * 
+ * Between task calls the test clock stands in for the PWM timer: it raises
+ * the simulated PWM interrupt (eps_executor_pwm_isr()) once per PWM period
+ * until the executor releases the next task call. In real time the periods
+ * are absolute wall-clock deadlines, so the reported fast loop jitter is the
+ * host's wake-up jitter; in virtual time the interrupts are exactly periodic
+ * and the execution time is what is measured.
+ * 
+ * Sensor Stimulus:
+ * - Scenarios feed their generated frames through a scripted sensor provider
+ * - The continuous operation test reads the sensor hardware, or replays a
+ *   recorded trace (--trace): one CSV line per cycle with driver_torque,
+ *   steering_angle, steering_velocity, vehicle_speed, motor_position,
+ *   motor_velocity, ecu_temperature, motor_temperature; '#' starts a comment
+ * 
+ * Usage: eps_test [--virtual] [--cycles N] [--soak N] [--trace file.csv]
  */
 
+#define _XOPEN_SOURCE 600
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
-#include <unistd.h>
 #include "eps_main.h"
+#include "eps_sensor_provider.h"
+#include "eps_executor.h"
 
 /* Test Configuration */
 #define TEST_DURATION_SECONDS       10
-#define TEST_CYCLE_TIME_MS          1
+#define TEST_CYCLE_TIME_MS          EPS_SYSTEM_CYCLE_TIME_MS
+#define TEST_SCENARIO_CYCLES        100
 #define MAX_TEST_SCENARIOS          5
+#define TEST_TRACE_LINE_LENGTH      256
+
+/* Test Clock Modes */
+typedef enum {
+    TEST_CLOCK_REALTIME = 0,        /* Sleep one cycle time per cycle */
+    TEST_CLOCK_VIRTUAL              /* Advance simulated time without sleeping */
+} test_clock_mode_t;
+
+/* Test Run Configuration (command line) */
+typedef struct {
+    test_clock_mode_t clock_mode;
+    uint32_t scenario_cycles;       /* Cycles per test scenario */
+    uint32_t soak_cycles;           /* Cycles of the continuous operation test */
+    const char* trace_path;         /* Sensor trace replayed by the continuous test (NULL: hardware) */
+} test_config_t;
+
+/* Simulated vs wall time of one run */
+typedef struct {
+    uint32_t start_cycle;           /* Simulated time at start (cycles) */
+    double start_wall_s;            /* Wall time at start (s) */
+} test_stopwatch_t;
 
 /* Test Scenario Types */
 typedef enum {
@@ -41,15 +87,23 @@ typedef struct {
     uint32_t successful_cycles;
     uint32_t failed_cycles;
     uint32_t safety_faults;
-    float max_response_time_ms;
-    float avg_response_time_ms;
+    eps_latency_histogram_t response_time_us;   /* Merged from the system under test */
+    eps_latency_histogram_t fast_jitter_us;     /* Fast loop start-to-start jitter */
+    eps_latency_histogram_t fast_execution_us;  /* Fast loop execution time */
+    uint32_t fast_ticks;
+    uint32_t fast_overruns;
+    uint32_t fast_timeout_ticks;
     float max_assistance_torque;
     bool all_tests_passed;
 } test_results_t;
 
 /* Global test data */
 static test_results_t g_test_results;
-static uint32_t g_test_cycle_counter = 0;
+static test_config_t g_test_config;
+static uint32_t g_test_cycle_counter = 0;   /* Simulated time in cycles */
+static uint32_t g_test_pwm_tick = 0;        /* PWM periods into the current cycle */
+static double g_test_tick_start_s = 0.0;    /* Wall time the current PWM period started */
+static struct timespec g_test_next_pwm;     /* Real-time deadline of the next PWM interrupt */
 
 /* Function Prototypes */
 static void print_test_header(void);
@@ -57,18 +111,44 @@ static void print_test_results(void);
 static eps_result_t run_test_scenario(test_scenario_t scenario);
 static eps_sensor_data_t generate_test_sensor_data(test_scenario_t scenario);
 static void simulate_driver_input(test_scenario_t scenario, eps_sensor_data_t* sensor_data);
-static void validate_system_response(const eps_assistance_params_t* assistance);
+static eps_result_t test_scenario_sensor_script(void* context, eps_sensor_data_t* sensor_data);
+static bool load_sensor_trace(const char* path, eps_sensor_trace_t* trace);
 static void inject_test_fault(void);
 static void measure_performance(void);
+static bool parse_arguments(int argc, char* argv[], test_config_t* config);
+static void test_clock_advance(void);
+static void test_clock_wait_pwm_period(void);
+static double test_wall_time_s(void);
+static void test_stopwatch_start(test_stopwatch_t* stopwatch);
+static void test_stopwatch_report(const test_stopwatch_t* stopwatch);
 
 /**
  * @brief Main test program entry point
+ * @param argc Argument count
+ * @param argv Arguments (see file header for usage)
  */
-int main(void)
+int main(int argc, char* argv[])
 {
+    test_stopwatch_t stopwatch;
+    eps_sensor_trace_t trace;
+    eps_sensor_provider_t trace_provider;
+    
+    if (!parse_arguments(argc, argv, &g_test_config)) {
+        fprintf(stderr, "usage: %s [--virtual] [--cycles N] [--soak N] [--trace file.csv]\n", argv[0]);
+        fprintf(stderr, "  --virtual   run on simulated time without sleeping\n");
+        fprintf(stderr, "  --cycles N  cycles per test scenario (default %d)\n", TEST_SCENARIO_CYCLES);
+        fprintf(stderr, "  --soak N    cycles of the continuous operation test (default %d)\n",
+                TEST_DURATION_SECONDS * 1000 / TEST_CYCLE_TIME_MS);
+        fprintf(stderr, "  --trace F   replay sensor trace F (looped) in the continuous test\n");
+        return -1;
+    }
+    
     printf("=== Electronic Power Steering (EPS) System Test Program ===\n");
     printf("Version: 1.0\n");
-    printf("Date: 2025-07-29\n\n");
+    printf("Date: 2025-07-29\n");
+    printf("Clock: %s\n\n", (g_test_config.clock_mode == TEST_CLOCK_VIRTUAL) ? "virtual" : "real time");
+    g_test_tick_start_s = test_wall_time_s();
+    clock_gettime(CLOCK_MONOTONIC, &g_test_next_pwm);
     
     print_test_header();
     
@@ -119,7 +199,9 @@ int main(void)
                 break;
         }
         
+        test_stopwatch_start(&stopwatch);
         eps_result_t scenario_result = run_test_scenario((test_scenario_t)scenario);
+        test_stopwatch_report(&stopwatch);
         if (scenario_result == EPS_SUCCESS) {
             printf("✓ Scenario %d completed successfully\n", scenario + 1);
         } else {
@@ -129,15 +211,24 @@ int main(void)
     }
     
     /* Run continuous operation test */
-    printf("\nRunning Continuous Operation Test (%d seconds)...\n", TEST_DURATION_SECONDS);
+    printf("\nRunning Continuous Operation Test (%.3f simulated seconds)...\n",
+           (double)g_test_config.soak_cycles * TEST_CYCLE_TIME_MS / 1000.0);
+    
+    if (g_test_config.trace_path) {
+        if (!load_sensor_trace(g_test_config.trace_path, &trace) ||
+            eps_sensor_provider_init_trace(&trace_provider, &trace) != EPS_SUCCESS) {
+            printf("ERROR: cannot load sensor trace %s\n", g_test_config.trace_path);
+            return -1;
+        }
+        (void)eps_sensor_provider_select(&trace_provider);
+        printf("  Replaying %u sensor frames from %s\n", trace.frame_count, g_test_config.trace_path);
+    }
     
-    time_t start_time = time(NULL);
-    time_t current_time;
+    test_stopwatch_start(&stopwatch);
     
-    do {
+    for (uint32_t cycle = 0; cycle < g_test_config.soak_cycles; cycle++) {
         /* Execute system task */
         eps_result_t task_result = eps_system_task();
-        g_test_cycle_counter++;
         g_test_results.total_cycles++;
         
         if (task_result == EPS_SUCCESS) {
@@ -149,20 +240,21 @@ int main(void)
             }
         }
         
-        /* Measure performance every 100 cycles */
-        if (g_test_cycle_counter % 100 == 0) {
-            measure_performance();
-        }
-        
-        /* Simulate real-time operation */
-        usleep(TEST_CYCLE_TIME_MS * 1000); /* Convert ms to microseconds */
-        
-        current_time = time(NULL);
-        
-    } while ((current_time - start_time) < TEST_DURATION_SECONDS);
+        /* Advance simulated time (sleeps in real-time mode) */
+        test_clock_advance();
+    }
     
+    test_stopwatch_report(&stopwatch);
     printf("✓ Continuous operation test completed\n");
     
+    /* Collect the run's response times before shutdown */
+    measure_performance();
+    
+    if (g_test_config.trace_path) {
+        (void)eps_sensor_provider_select(NULL);
+        free((void*)trace.frames);
+    }
+    
     /* System shutdown */
     printf("\nShutting down EPS System...\n");
     eps_result_t shutdown_result = eps_system_shutdown();
@@ -209,17 +301,16 @@ static void print_test_header(void)
 static eps_result_t run_test_scenario(test_scenario_t scenario)
 {
     eps_result_t result = EPS_SUCCESS;
-    const int SCENARIO_CYCLES = 100; /* Run each scenario for 100 cycles */
+    eps_sensor_provider_t provider;
     
-    for (int cycle = 0; cycle < SCENARIO_CYCLES; cycle++) {
-        /* Generate test sensor data for this scenario */
-        eps_sensor_data_t sensor_data = generate_test_sensor_data(scenario);
-        
-        /* Simulate driver input */
-        simulate_driver_input(scenario, &sensor_data);
-        
-        /* Execute system task with test data */
-        /* Note: In a real implementation, we would inject this test data */
+    /* Scenario frames replace the sensor hardware for the scenario */
+    result = eps_sensor_provider_init_scripted(&provider, test_scenario_sensor_script, &scenario);
+    if (result == EPS_SUCCESS) {
+        result = eps_sensor_provider_select(&provider);
+    }
+    
+    for (uint32_t cycle = 0; cycle < g_test_config.scenario_cycles && result == EPS_SUCCESS; cycle++) {
+        /* Execute system task on the generated frame */
         eps_result_t task_result = eps_system_task();
         
         if (task_result != EPS_SUCCESS) {
@@ -228,17 +319,38 @@ static eps_result_t run_test_scenario(test_scenario_t scenario)
         }
         
         /* Special handling for fault injection scenario */
-        if (scenario == TEST_SCENARIO_FAULT_INJECTION && cycle == 50) {
+        if (scenario == TEST_SCENARIO_FAULT_INJECTION && cycle == g_test_config.scenario_cycles / 2) {
             inject_test_fault();
         }
         
-        /* Small delay to simulate real-time operation */
-        usleep(1000); /* 1ms delay */
+        /* Advance simulated time (sleeps in real-time mode) */
+        test_clock_advance();
     }
     
+    (void)eps_sensor_provider_select(NULL);
+    
     return result;
 }
 
+/**
+ * @brief Scripted sensor provider: the scenario's frame for this cycle
+ * @param context Scenario (test_scenario_t)
+ * @param sensor_data Frame output
+ * @return eps_result_t EPS_SUCCESS
+ */
+static eps_result_t test_scenario_sensor_script(void* context, eps_sensor_data_t* sensor_data)
+{
+    test_scenario_t scenario = *(const test_scenario_t*)context;
+    
+    /* Generate test sensor data for this scenario */
+    *sensor_data = generate_test_sensor_data(scenario);
+    
+    /* Simulate driver input */
+    simulate_driver_input(scenario, sensor_data);
+    
+    return EPS_SUCCESS;
+}
+
 /**
  * @brief Generate test sensor data for a specific scenario
  * @param scenario Test scenario type
@@ -351,27 +463,284 @@ static void inject_test_fault(void)
 
 /**
  * @brief Measure system performance
+ * 
+ * Merges the system's response time and fast loop histograms into the
+ * test results, so
+ * results of several runs (e.g. after a re-initialization) add up.
  */
 static void measure_performance(void)
 {
     const eps_performance_data_t* perf_data = eps_get_performance_data();
+    const eps_executor_stats_t* executor_stats = eps_executor_get_stats();
     
     if (perf_data) {
-        /* Update maximum response time */
-        if (perf_data->last_response_time_ms > g_test_results.max_response_time_ms) {
-            g_test_results.max_response_time_ms = perf_data->last_response_time_ms;
+        /* Response time distribution since eps_system_init (EPS-PR-014) */
+        eps_latency_histogram_merge(&g_test_results.response_time_us, &perf_data->response_time_us);
+    }
+    
+    if (executor_stats) {
+        /* PWM-rate current loop timing (EPS-PR-019) */
+        eps_latency_histogram_merge(&g_test_results.fast_jitter_us, &executor_stats->jitter_us);
+        eps_latency_histogram_merge(&g_test_results.fast_execution_us, &executor_stats->execution_us);
+        g_test_results.fast_ticks += executor_stats->fast_ticks;
+        g_test_results.fast_overruns += executor_stats->overruns;
+        g_test_results.fast_timeout_ticks += executor_stats->timeout_ticks;
+        
+        /* Track maximum assistance torque */
+        /* This would be available from system state in real implementation */
+    }
+}
+
+/**
+ * @brief Parse command line arguments
+ * @param argc Argument count
+ * @param argv Arguments
+ * @param config Resulting run configuration
+ * @return bool False on an unknown option or invalid value
+ */
+static bool parse_arguments(int argc, char* argv[], test_config_t* config)
+{
+    config->clock_mode = TEST_CLOCK_REALTIME;
+    config->scenario_cycles = TEST_SCENARIO_CYCLES;
+    config->soak_cycles = TEST_DURATION_SECONDS * 1000 / TEST_CYCLE_TIME_MS;
+    config->trace_path = NULL;
+    
+    for (int i = 1; i < argc; i++) {
+        uint32_t* value = NULL;
+        
+        if (strcmp(argv[i], "--virtual") == 0) {
+            config->clock_mode = TEST_CLOCK_VIRTUAL;
+            continue;
+        } else if (strcmp(argv[i], "--cycles") == 0) {
+            value = &config->scenario_cycles;
+        } else if (strcmp(argv[i], "--soak") == 0) {
+            value = &config->soak_cycles;
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            config->trace_path = argv[++i];
+            continue;
+        } else {
+            return false;
         }
         
-        /* Calculate average response time */
-        static float total_response_time = 0.0f;
-        static uint32_t response_time_samples = 0;
+        char* end = NULL;
+        if (++i >= argc) {
+            return false;
+        }
+        unsigned long parsed = strtoul(argv[i], &end, 10);
+        if (end == argv[i] || *end != '\0' || parsed == 0 || parsed > UINT32_MAX) {
+            return false;
+        }
+        *value = (uint32_t)parsed;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Load a sensor trace from CSV (see file header for the columns)
+ * @param path CSV file
+ * @param trace Trace output (frames allocated, looped; free trace->frames)
+ * @return bool False if the file cannot be read, a line is malformed or it is empty
+ */
+static bool load_sensor_trace(const char* path, eps_sensor_trace_t* trace)
+{
+    char line[TEST_TRACE_LINE_LENGTH];
+    eps_sensor_data_t* frames = NULL;
+    uint32_t count = 0;
+    uint32_t capacity = 0;
+    bool ok = true;
+    FILE* file = fopen(path, "r");
+    
+    if (!file) {
+        return false;
+    }
+    
+    while (ok && fgets(line, sizeof(line), file)) {
+        eps_sensor_data_t frame;
         
-        total_response_time += perf_data->last_response_time_ms;
-        response_time_samples++;
-        g_test_results.avg_response_time_ms = total_response_time / response_time_samples;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') {
+            continue;
+        }
         
-        /* Track maximum assistance torque */
-        /* This would be available from system state in real implementation */
+        if (count == capacity) {
+            uint32_t grown = (capacity == 0) ? 1024 : capacity * 2;
+            eps_sensor_data_t* resized = realloc(frames, grown * sizeof(eps_sensor_data_t));
+            if (!resized) {
+                ok = false;
+                break;
+            }
+            frames = resized;
+            capacity = grown;
+        }
+        
+        memset(&frame, 0, sizeof(frame));
+        ok = sscanf(line, "%f,%f,%f,%f,%f,%f,%f,%f",
+                    &frame.driver_torque, &frame.steering_angle, &frame.steering_velocity,
+                    &frame.vehicle_speed, &frame.motor_position, &frame.motor_velocity,
+                    &frame.ecu_temperature, &frame.motor_temperature) == 8;
+        frame.timestamp = count * TEST_CYCLE_TIME_MS;
+        frame.data_valid = true;
+        frames[count++] = frame;
+    }
+    
+    fclose(file);
+    
+    if (!ok || count == 0) {
+        free(frames);
+        return false;
+    }
+    
+    trace->frames = frames;
+    trace->frame_count = count;
+    trace->position = 0;
+    trace->loop = true;
+    
+    return true;
+}
+
+/**
+ * @brief Advance simulated time by one system cycle
+ * 
+ * Raises the simulated PWM interrupt once per PWM period until the
+ * executor releases the next task call. In real-time mode each period is
+ * waited out on the wall clock; in virtual mode the interrupts follow each
+ * other immediately.
+ */
+static void test_clock_advance(void)
+{
+    bool task_due = false;
+    
+    for (uint32_t tick = 0; tick < EPS_EXECUTOR_FAST_PER_SLOW && !task_due; tick++) {
+        g_test_pwm_tick = tick;
+        
+        if (g_test_config.clock_mode == TEST_CLOCK_REALTIME) {
+            test_clock_wait_pwm_period();
+        } else {
+            g_test_tick_start_s = test_wall_time_s();
+        }
+        
+        task_due = eps_executor_pwm_isr();
+    }
+    
+    g_test_cycle_counter++;
+    g_test_pwm_tick = 0;
+    g_test_tick_start_s = test_wall_time_s();
+}
+
+/**
+ * @brief Sleep until the next PWM period starts (real-time mode)
+ * 
+ * Deadlines are absolute, so wake-up latency does not accumulate. After a
+ * stall longer than one cycle (e.g. console output between scenarios) the
+ * deadlines restart from now instead of firing a burst of late interrupts.
+ */
+static void test_clock_wait_pwm_period(void)
+{
+    struct timespec now;
+    
+    g_test_next_pwm.tv_nsec += (long)EPS_EXECUTOR_FAST_PERIOD_US * 1000L;
+    if (g_test_next_pwm.tv_nsec >= 1000000000L) {
+        g_test_next_pwm.tv_nsec -= 1000000000L;
+        g_test_next_pwm.tv_sec++;
+    }
+    
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if ((double)(now.tv_sec - g_test_next_pwm.tv_sec) * 1e6 +
+        (double)(now.tv_nsec - g_test_next_pwm.tv_nsec) * 1e-3 > TEST_CYCLE_TIME_MS * 1000.0) {
+        g_test_next_pwm = now;
+        return;
+    }
+    
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &g_test_next_pwm, NULL) != 0) {
+        /* Interrupted by a signal: sleep again until the deadline */
+    }
+}
+
+/**
+ * @brief Microsecond time base of the system under test
+ * @return uint32_t Time in microseconds
+ * 
+ * Real time: the monotonic clock. Virtual time: the simulated cycle and
+ * PWM period plus the wall time spent in the period so far (capped below
+ * the next period, so simulated time never runs backwards), so in-cycle
+ * latencies keep their measured microsecond resolution.
+ */
+uint32_t eps_platform_time_us(void)
+{
+    const double cycle_us = TEST_CYCLE_TIME_MS * 1000.0;
+    const double period_us = EPS_EXECUTOR_FAST_PERIOD_US;
+    double in_period_us;
+    
+    if (g_test_config.clock_mode == TEST_CLOCK_REALTIME) {
+        return (uint32_t)(uint64_t)(test_wall_time_s() * 1e6);
+    }
+    
+    in_period_us = (test_wall_time_s() - g_test_tick_start_s) * 1e6;
+    if (in_period_us > period_us - 1.0) {
+        in_period_us = period_us - 1.0;
+    }
+    
+    return (uint32_t)((uint64_t)g_test_cycle_counter * (uint64_t)cycle_us +
+                      (uint64_t)g_test_pwm_tick * (uint64_t)period_us + (uint64_t)in_period_us);
+}
+
+/**
+ * @brief Raw sensor samples of the system under test
+ * @param block Raw sample block output
+ * @return eps_result_t Acquisition result
+ * 
+ * SIL has no sensor hardware (the scenarios inject frames through the
+ * sensor provider): every channel reads mid-span, i.e. the wheel centered
+ * and released, which lets the sensor self-test pass at init.
+ */
+eps_result_t eps_platform_sensors_acquire(eps_sensor_raw_block_t* block)
+{
+    for (uint32_t i = 0; i < EPS_SENSOR_COUNT; i++) {
+        block->counts[i] = (EPS_SENSOR_SPAN_LOW_COUNTS + EPS_SENSOR_SPAN_HIGH_COUNTS) / 2;
+    }
+    block->vehicle_speed = 0.0f;
+    block->timestamp = g_test_cycle_counter;
+    
+    return EPS_SUCCESS;
+}
+
+/**
+ * @brief Monotonic wall time
+ * @return double Wall time in seconds
+ */
+static double test_wall_time_s(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Start measuring simulated and wall time
+ * @param stopwatch Stopwatch
+ */
+static void test_stopwatch_start(test_stopwatch_t* stopwatch)
+{
+    stopwatch->start_cycle = g_test_cycle_counter;
+    stopwatch->start_wall_s = test_wall_time_s();
+}
+
+/**
+ * @brief Print simulated time, wall time and their ratio since start
+ * @param stopwatch Stopwatch
+ */
+static void test_stopwatch_report(const test_stopwatch_t* stopwatch)
+{
+    uint32_t cycles = g_test_cycle_counter - stopwatch->start_cycle;
+    double simulated_s = (double)cycles * TEST_CYCLE_TIME_MS / 1000.0;
+    double wall_s = test_wall_time_s() - stopwatch->start_wall_s;
+    
+    if (wall_s > 0.0 && cycles > 0) {
+        printf("  %.3f s simulated in %.3f s wall (%.1f simulated s/wall s, %.0f ns/cycle)\n",
+               simulated_s, wall_s, simulated_s / wall_s, wall_s * 1e9 / cycles);
+    } else {
+        printf("  %.3f s simulated\n", simulated_s);
     }
 }
 
@@ -380,6 +749,10 @@ static void measure_performance(void)
  */
 static void print_test_results(void)
 {
+    const eps_latency_histogram_t* response_times = &g_test_results.response_time_us;
+    const eps_latency_histogram_t* fast_jitter = &g_test_results.fast_jitter_us;
+    const eps_latency_histogram_t* fast_execution = &g_test_results.fast_execution_us;
+    
     printf("\n");
     printf("=== EPS SYSTEM TEST RESULTS ===\n");
     printf("================================\n");
@@ -397,13 +770,34 @@ static void print_test_results(void)
     }
     
     printf("\nPerformance Measurements:\n");
-    printf("  Maximum Response Time: %.2f ms\n", g_test_results.max_response_time_ms);
-    printf("  Average Response Time: %.2f ms\n", g_test_results.avg_response_time_ms);
+    printf("  Response Time Samples: %u\n", response_times->total_count);
+    printf("  Response Time p50/p99/p99.9: %.3f / %.3f / %.3f ms\n",
+           eps_latency_histogram_percentile(response_times, 50.0f) / 1000.0,
+           eps_latency_histogram_percentile(response_times, 99.0f) / 1000.0,
+           eps_latency_histogram_percentile(response_times, 99.9f) / 1000.0);
+    printf("  Maximum Response Time: %.3f ms\n", response_times->max_us / 1000.0);
+    printf("  Average Response Time: %.3f ms\n", eps_latency_histogram_mean(response_times) / 1000.0);
     printf("  Maximum Assistance Torque: %.2f Nm\n", g_test_results.max_assistance_torque);
     
+    printf("\nFast Loop (%d Hz current control):\n", EPS_EXECUTOR_FAST_RATE_HZ);
+    printf("  PWM Interrupts: %u\n", g_test_results.fast_ticks);
+    printf("  Jitter p50/p99/p99.9/max: %u / %u / %u / %u us\n",
+           eps_latency_histogram_percentile(fast_jitter, 50.0f),
+           eps_latency_histogram_percentile(fast_jitter, 99.0f),
+           eps_latency_histogram_percentile(fast_jitter, 99.9f),
+           fast_jitter->max_us);
+    printf("  Execution p50/p99/max: %u / %u / %u us (budget %d us)\n",
+           eps_latency_histogram_percentile(fast_execution, 50.0f),
+           eps_latency_histogram_percentile(fast_execution, 99.0f),
+           fast_execution->max_us, EPS_EXECUTOR_FAST_BUDGET_US);
+    printf("  Budget Overruns: %u\n", g_test_results.fast_overruns);
+    printf("  Command Timeout Ticks: %u\n", g_test_results.fast_timeout_ticks);
+    
     printf("\nRequirements Validation:\n");
     printf("  Response Time Requirement (≤50ms): %s\n", 
-           g_test_results.max_response_time_ms <= 50.0f ? "PASS" : "FAIL");
+           response_times->max_us <= EPS_MAX_RESPONSE_TIME_MS * 1000 ? "PASS" : "FAIL");
+    printf("  Fast Loop Budget (≤%dus): %s\n", EPS_EXECUTOR_FAST_BUDGET_US,
+           g_test_results.fast_overruns == 0 ? "PASS" : "FAIL");
     printf("  Torque Limit Requirement (≤8Nm): %s\n", 
            g_test_results.max_assistance_torque <= 8.0f ? "PASS" : "FAIL");
     
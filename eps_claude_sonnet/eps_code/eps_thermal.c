@@ -0,0 +1,209 @@
+/**
+ * @file eps_thermal.c
+ * @brief Electronic Power Steering (EPS) Thermal Model and Current Derating
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * See eps_thermal.h. The copper loss uses the winding estimate of the
+ * previous sample for the phase resistance, which lags the winding by one
+ * sample (1 ms against time constants of seconds).
+ *
+ * Requirements Traceability:
+ * - EPS-ER-027: Motor current limit
+ * - EPS-ER-028: Peak motor current
+ * - EPS-DR-031: Diagnostic trouble codes (overtemperature)
+ */
+
+#include "eps_thermal.h"
+
+#define EPS_THERMAL_REFERENCE_C         20.0f   /* Phase resistance reference temperature */
+
+/* Static Function Prototypes */
+static bool eps_thermal_init_path(const eps_thermal_path_config_t* path, float sample_time_s,
+                                  float decay[EPS_THERMAL_NODES], float gain[EPS_THERMAL_NODES]);
+static bool eps_thermal_init_derating(eps_thermal_derating_t* derating,
+                                      const eps_thermal_derating_config_t* config);
+static float eps_thermal_derate(const eps_thermal_derating_t* derating, float temperature_c);
+
+/**
+ * @brief Default configuration from the EPS_THERMAL_* constants
+ * @param config Configuration output
+ * @param sample_time_s Update period
+ */
+void eps_thermal_default_config(eps_thermal_config_t* config, float sample_time_s)
+{
+    static const float winding_r[EPS_THERMAL_NODES] = EPS_THERMAL_WINDING_R;
+    static const float winding_tau[EPS_THERMAL_NODES] = EPS_THERMAL_WINDING_TAU;
+    static const float junction_r[EPS_THERMAL_NODES] = EPS_THERMAL_JUNCTION_R;
+    static const float junction_tau[EPS_THERMAL_NODES] = EPS_THERMAL_JUNCTION_TAU;
+    static const float derate_a[EPS_THERMAL_DERATE_POINTS] = EPS_THERMAL_DERATE_CURRENT_A;
+
+    if (!config) {
+        return;
+    }
+
+    config->sample_time_s = sample_time_s;
+    config->phase_resistance_ohm = EPS_THERMAL_PHASE_RESISTANCE;
+    config->copper_coeff_per_k = EPS_THERMAL_COPPER_COEFF;
+    config->switch_resistance_ohm = EPS_THERMAL_SWITCH_RESISTANCE;
+
+    memcpy(config->winding.resistance_k_per_w, winding_r, sizeof(winding_r));
+    memcpy(config->winding.time_constant_s, winding_tau, sizeof(winding_tau));
+    memcpy(config->junction.resistance_k_per_w, junction_r, sizeof(junction_r));
+    memcpy(config->junction.time_constant_s, junction_tau, sizeof(junction_tau));
+
+    config->winding_derating.start_c = EPS_THERMAL_WINDING_DERATE_C;
+    config->winding_derating.step_c = EPS_THERMAL_DERATE_STEP_C;
+    memcpy(config->winding_derating.current_limit_a, derate_a, sizeof(derate_a));
+
+    config->junction_derating.start_c = EPS_THERMAL_JUNCTION_DERATE_C;
+    config->junction_derating.step_c = EPS_THERMAL_DERATE_STEP_C;
+    memcpy(config->junction_derating.current_limit_a, derate_a, sizeof(derate_a));
+}
+
+/**
+ * @brief Initialize the model (no temperature rise, full current)
+ * @param model Model
+ * @param config Configuration (not referenced afterwards)
+ * @return bool false on a NULL pointer or a non-positive time constant,
+ *         sample time or derating step
+ */
+bool eps_thermal_init(eps_thermal_model_t* model, const eps_thermal_config_t* config)
+{
+    if (!model || !config || (config->sample_time_s <= 0.0f)) {
+        return false;
+    }
+
+    memset(model, 0, sizeof(eps_thermal_model_t));
+
+    if (!eps_thermal_init_path(&config->winding, config->sample_time_s,
+                               model->winding_decay, model->winding_gain) ||
+        !eps_thermal_init_path(&config->junction, config->sample_time_s,
+                               model->junction_decay, model->junction_gain) ||
+        !eps_thermal_init_derating(&model->winding_derating, &config->winding_derating) ||
+        !eps_thermal_init_derating(&model->junction_derating, &config->junction_derating)) {
+        return false;
+    }
+
+    /* R(T) = R20 * (1 + alpha * (T - 20)) = r0 + r1 * T */
+    model->copper_r1_ohm_per_k = config->phase_resistance_ohm * config->copper_coeff_per_k;
+    model->copper_r0_ohm = config->phase_resistance_ohm - model->copper_r1_ohm_per_k * EPS_THERMAL_REFERENCE_C;
+    model->switch_resistance_ohm = config->switch_resistance_ohm;
+
+    model->winding_c = EPS_THERMAL_REFERENCE_C;
+    model->junction_c = EPS_THERMAL_REFERENCE_C;
+    model->current_limit_a = model->winding_derating.first_a;
+    if (model->junction_derating.first_a < model->current_limit_a) {
+        model->current_limit_a = model->junction_derating.first_a;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Advance the model by one sample
+ * @param model Model
+ * @param phase_current_a Phase currents (A) over the sample
+ * @param motor_temperature_c Motor temperature sensor
+ * @param ecu_temperature_c ECU temperature sensor
+ * @return float Derated current limit in A
+ *
+ * Requirements: EPS-ER-027
+ */
+float eps_thermal_update(eps_thermal_model_t* model, const float phase_current_a[3],
+                         float motor_temperature_c, float ecu_temperature_c)
+{
+    float current_squared = phase_current_a[0] * phase_current_a[0] +
+                            phase_current_a[1] * phase_current_a[1] +
+                            phase_current_a[2] * phase_current_a[2];
+    float copper_loss_w = current_squared * (model->copper_r0_ohm + model->copper_r1_ohm_per_k * model->winding_c);
+    float switch_loss_w = current_squared * model->switch_resistance_ohm;
+    float winding_c = motor_temperature_c;
+    float junction_c = ecu_temperature_c;
+    float junction_limit_a;
+
+    for (uint32_t n = 0; n < EPS_THERMAL_NODES; n++) {
+        model->winding_rise_k[n] = model->winding_decay[n] * model->winding_rise_k[n] +
+                                   model->winding_gain[n] * copper_loss_w;
+        model->junction_rise_k[n] = model->junction_decay[n] * model->junction_rise_k[n] +
+                                    model->junction_gain[n] * switch_loss_w;
+        winding_c += model->winding_rise_k[n];
+        junction_c += model->junction_rise_k[n];
+    }
+
+    model->winding_c = winding_c;
+    model->junction_c = junction_c;
+
+    /* Lower of the two derated limits - EPS-ER-027 */
+    model->current_limit_a = eps_thermal_derate(&model->winding_derating, winding_c);
+    junction_limit_a = eps_thermal_derate(&model->junction_derating, junction_c);
+    if (junction_limit_a < model->current_limit_a) {
+        model->current_limit_a = junction_limit_a;
+    }
+
+    return model->current_limit_a;
+}
+
+/**
+ * @brief Decay factors and gains of one Foster path
+ */
+static bool eps_thermal_init_path(const eps_thermal_path_config_t* path, float sample_time_s,
+                                  float decay[EPS_THERMAL_NODES], float gain[EPS_THERMAL_NODES])
+{
+    for (uint32_t n = 0; n < EPS_THERMAL_NODES; n++) {
+        if (path->time_constant_s[n] <= 0.0f) {
+            return false;
+        }
+
+        decay[n] = expf(-sample_time_s / path->time_constant_s[n]);
+        gain[n] = (1.0f - decay[n]) * path->resistance_k_per_w[n];
+    }
+
+    return true;
+}
+
+/**
+ * @brief Segments of one derating table
+ */
+static bool eps_thermal_init_derating(eps_thermal_derating_t* derating,
+                                      const eps_thermal_derating_config_t* config)
+{
+    if (config->step_c <= 0.0f) {
+        return false;
+    }
+
+    derating->start_c = config->start_c;
+    derating->inv_step = 1.0f / config->step_c;
+
+    for (uint32_t i = 0; i < EPS_THERMAL_DERATE_POINTS - 1; i++) {
+        float slope = (config->current_limit_a[i + 1] - config->current_limit_a[i]) / config->step_c;
+
+        derating->slope_a_per_k[i] = slope;
+        derating->offset_a[i] = config->current_limit_a[i] - slope * ((float)i * config->step_c);
+    }
+
+    derating->first_a = config->current_limit_a[0];
+    derating->last_a = config->current_limit_a[EPS_THERMAL_DERATE_POINTS - 1];
+
+    return true;
+}
+
+/**
+ * @brief Current limit for a hot spot temperature
+ */
+static float eps_thermal_derate(const eps_thermal_derating_t* derating, float temperature_c)
+{
+    float above_start_k = temperature_c - derating->start_c;
+    float position = above_start_k * derating->inv_step;
+    uint32_t segment;
+
+    if (!(position < (float)(EPS_THERMAL_DERATE_POINTS - 1))) {
+        return derating->last_a;    /* Also NaN: fully derated */
+    }
+    if (position <= 0.0f) {
+        return derating->first_a;
+    }
+
+    segment = (uint32_t)position;
+    return derating->offset_a[segment] + derating->slope_a_per_k[segment] * above_start_k;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file eps_thermal.h
+ * @brief Electronic Power Steering (EPS) Thermal Model and Current Derating
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Lumped thermal model of the two hot spots the temperature sensors cannot
+ * see, updated once per control cycle from the phase currents:
+ *
+ * - Motor winding, above the motor temperature sensor, heated by the
+ *   copper loss (phase resistance rising with winding temperature)
+ * - Power stage junction, above the ECU temperature sensor, heated by the
+ *   conduction loss of the bridge
+ *
+ * Each path is a Foster network of EPS_THERMAL_NODES first-order nodes
+ * (thermal resistance R, time constant tau). A node's temperature rise
+ * follows rise = a * rise + (1 - a) * R * P with a = exp(-Ts / tau), exact
+ * for a loss held over the sample. a and (1 - a) * R are computed at init,
+ * so an update costs two multiply-adds per node plus the loss.
+ *
+ * Each hot spot maps to a current limit through a derating table
+ * (EPS_THERMAL_DERATE_POINTS equally spaced temperatures, linear in
+ * between, clamped at both ends); the lower of the two limits applies.
+ *
+ * Requirements Traceability:
+ * - EPS-ER-027: Motor current limit
+ * - EPS-ER-028: Peak motor current
+ * - EPS-DR-031: Diagnostic trouble codes (overtemperature)
+ */
+
+#ifndef EPS_THERMAL_H
+#define EPS_THERMAL_H
+
+#include "eps_motor_control.h"
+
+/* Model Layout */
+#define EPS_THERMAL_NODES               2       /* Foster nodes per path */
+#define EPS_THERMAL_DERATE_POINTS       7
+
+/* Winding Path (above the motor temperature sensor) */
+#define EPS_THERMAL_PHASE_RESISTANCE    0.02f   /* Ohm per phase at 20 degC */
+#define EPS_THERMAL_COPPER_COEFF        0.00393f    /* 1/K */
+#define EPS_THERMAL_WINDING_R           { 0.10f, 0.30f }    /* K/W */
+#define EPS_THERMAL_WINDING_TAU         { 5.0f, 120.0f }    /* s */
+
+/* Junction Path (above the ECU temperature sensor) */
+#define EPS_THERMAL_SWITCH_RESISTANCE   0.002f  /* Ohm - conducting switch per phase */
+#define EPS_THERMAL_JUNCTION_R          { 1.0f, 2.0f }      /* K/W */
+#define EPS_THERMAL_JUNCTION_TAU        { 0.01f, 1.5f }     /* s */
+
+/* Derating (current limit in A at start, start + step, ...): peak current
+ * while cool, the continuous rating at mid-range, a floor when hot */
+#define EPS_THERMAL_WINDING_DERATE_C    120.0f  /* degC - first breakpoint */
+#define EPS_THERMAL_JUNCTION_DERATE_C   110.0f  /* degC - first breakpoint */
+#define EPS_THERMAL_DERATE_STEP_C       10.0f   /* degC */
+#define EPS_THERMAL_DERATE_CURRENT_A    { EPS_MOTOR_PEAK_CURRENT_A, 85.0f, 70.0f, EPS_MOTOR_MAX_CURRENT_A, \
+                                          35.0f, 20.0f, EPS_THERMAL_MIN_CURRENT_A }
+#define EPS_THERMAL_MIN_CURRENT_A       10.0f   /* A - fully derated (assist reduced, not lost) */
+
+/* Foster Path Parameters */
+typedef struct {
+    float resistance_k_per_w[EPS_THERMAL_NODES];
+    float time_constant_s[EPS_THERMAL_NODES];
+} eps_thermal_path_config_t;
+
+/* Derating Table */
+typedef struct {
+    float start_c;                  /* Temperature of the first breakpoint */
+    float step_c;                   /* Between breakpoints */
+    float current_limit_a[EPS_THERMAL_DERATE_POINTS];
+} eps_thermal_derating_config_t;
+
+/* Thermal Model Configuration */
+typedef struct {
+    float sample_time_s;            /* Update period */
+    float phase_resistance_ohm;     /* Winding, per phase at 20 degC */
+    float copper_coeff_per_k;       /* Winding resistance temperature coefficient */
+    float switch_resistance_ohm;    /* Conducting switch, per phase */
+    eps_thermal_path_config_t winding;
+    eps_thermal_path_config_t junction;
+    eps_thermal_derating_config_t winding_derating;
+    eps_thermal_derating_config_t junction_derating;
+} eps_thermal_config_t;
+
+/* Derating Table (precomputed segments) */
+typedef struct {
+    float start_c;
+    float inv_step;                 /* Segments per K */
+    float offset_a[EPS_THERMAL_DERATE_POINTS - 1];     /* A - segment value at start_c */
+    float slope_a_per_k[EPS_THERMAL_DERATE_POINTS - 1];
+    float first_a;                  /* Below start_c */
+    float last_a;                   /* Beyond the last breakpoint */
+} eps_thermal_derating_t;
+
+/* Thermal Model State */
+typedef struct {
+    float winding_decay[EPS_THERMAL_NODES];     /* a = exp(-Ts / tau) */
+    float winding_gain[EPS_THERMAL_NODES];      /* (1 - a) * R, K/W */
+    float winding_rise_k[EPS_THERMAL_NODES];
+    float junction_decay[EPS_THERMAL_NODES];
+    float junction_gain[EPS_THERMAL_NODES];
+    float junction_rise_k[EPS_THERMAL_NODES];
+    float copper_r0_ohm;            /* Phase resistance = r0 + r1 * T */
+    float copper_r1_ohm_per_k;
+    float switch_resistance_ohm;
+    eps_thermal_derating_t winding_derating;
+    eps_thermal_derating_t junction_derating;
+    float winding_c;                /* Latest hot spot estimates */
+    float junction_c;
+    float current_limit_a;          /* Latest derated current limit */
+} eps_thermal_model_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Default configuration from the EPS_THERMAL_* constants
+ * @param config Configuration output
+ * @param sample_time_s Update period
+ */
+void eps_thermal_default_config(eps_thermal_config_t* config, float sample_time_s);
+
+/**
+ * @brief Initialize the model (no temperature rise, full current)
+ * @param model Model
+ * @param config Configuration (not referenced afterwards)
+ * @return bool false on a NULL pointer or a non-positive time constant,
+ *         sample time or derating step
+ */
+bool eps_thermal_init(eps_thermal_model_t* model, const eps_thermal_config_t* config);
+
+/**
+ * @brief Advance the model by one sample
+ * @param model Model
+ * @param phase_current_a Phase currents (A) over the sample
+ * @param motor_temperature_c Motor temperature sensor
+ * @param ecu_temperature_c ECU temperature sensor
+ * @return float Derated current limit in A
+ *
+ * Requirements: EPS-ER-027
+ */
+float eps_thermal_update(eps_thermal_model_t* model, const float phase_current_a[3],
+                         float motor_temperature_c, float ecu_temperature_c);
+
+#endif /* EPS_THERMAL_H */
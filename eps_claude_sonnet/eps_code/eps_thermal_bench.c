@@ -0,0 +1,342 @@
+/**
+ * @file eps_thermal_bench.c
+ * @brief Electronic Power Steering (EPS) Thermal Model Validation
+ * @version 1.0
+ * @date 2025-07-29
+ *
+ * Faster-than-real-time validation of the thermal model (eps_thermal.h)
+ * over repeated parking manoeuvres at a hot ambient:
+ *
+ * - Closed loop: the derated current limit caps the next cycle's current,
+ *   as in eps_system_task(); a simulated motor housing and ECU board heat
+ *   up and feed the temperature sensor inputs
+ * - Accuracy: the model's hot spots against a double precision reference
+ *   of the same thermal network (RK4 at 100 us, phase resistance evaluated
+ *   continuously)
+ * - Limits: hot spots stay below the winding insulation and junction
+ *   limits with derating; the same cycles without derating are reported
+ *   for comparison
+ * - Speed: simulated seconds per wall second and ns per model update
+ *
+ * Exits non-zero if a check fails.
+ *
+ * Usage: eps_thermal_bench [simulated_seconds]
+ *
+ * Requirements Traceability:
+ * - EPS-ER-027: Motor current limit
+ */
+
+#define _XOPEN_SOURCE 600
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "eps_thermal.h"
+
+/* Validation Configuration */
+#define BENCH_SAMPLE_TIME_S         (EPS_SYSTEM_CYCLE_TIME_MS / 1000.0f)
+#define BENCH_DEFAULT_SECONDS       7200    /* 2 h of parking */
+#define BENCH_AMBIENT_C             40.0
+#define BENCH_REFERENCE_SUBSTEPS    10
+#define BENCH_ELECTRICAL_HZ         20.0    /* Motor turning during the manoeuvre */
+
+/* Parking Manoeuvre (20 s, repeated): q-axis current demand in A */
+#define BENCH_CYCLE_S               20.0
+#define BENCH_LOCK_CURRENT_A        80.0    /* Turning towards lock at standstill */
+#define BENCH_END_STOP_CURRENT_A    100.0   /* Held against the end stop */
+#define BENCH_RETURN_CURRENT_A      40.0
+#define BENCH_IDLE_CURRENT_A        5.0
+
+/* Plant: motor housing and ECU board above ambient */
+#define BENCH_HOUSING_R_K_PER_W     0.4
+#define BENCH_HOUSING_TAU_S         1200.0
+#define BENCH_BOARD_R_K_PER_W       1.0
+#define BENCH_BOARD_TAU_S           600.0
+
+/* Check Limits */
+#define BENCH_MAX_MODEL_ERROR_K     0.5
+#define BENCH_WINDING_LIMIT_C       180.0   /* Insulation class H */
+#define BENCH_JUNCTION_LIMIT_C      175.0
+
+#define BENCH_PI                    3.14159265358979
+
+/* Double Precision Reference of the Thermal Network */
+typedef struct {
+    double winding_rise_k[EPS_THERMAL_NODES];
+    double junction_rise_k[EPS_THERMAL_NODES];
+    double housing_c;
+    double board_c;
+} bench_plant_t;
+
+/* Run Results */
+typedef struct {
+    double max_winding_c;
+    double max_junction_c;
+    double max_winding_error_k;
+    double max_junction_error_k;
+    double min_current_limit_a;
+    double derated_s;               /* Time below full current */
+    double wall_s;
+} bench_run_t;
+
+/* Function Prototypes */
+static double bench_now_s(void);
+static double bench_demand_a(double t_s);
+static void bench_sensed_step(bench_plant_t* plant, double copper_loss_w, double switch_loss_w, double dt_s);
+static void bench_reference_step(bench_plant_t* plant, const eps_thermal_config_t* config, double current_squared);
+static void bench_run(const eps_thermal_config_t* config, uint32_t steps, bool derate, bool reference,
+                      bench_run_t* run);
+
+/**
+ * @brief Validation entry point
+ * @param argc Argument count
+ * @param argv Arguments (optional simulated seconds)
+ */
+int main(int argc, char* argv[])
+{
+    eps_thermal_config_t config;
+    uint32_t seconds = BENCH_DEFAULT_SECONDS;
+    uint32_t steps;
+    bench_run_t derated;
+    bench_run_t no_derating;
+    bench_run_t timed;
+    bool passed;
+
+    if (argc > 1) {
+        seconds = (uint32_t)strtoul(argv[1], NULL, 10);
+        if (seconds < 60) {
+            fprintf(stderr, "usage: %s [simulated_seconds >= 60]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    steps = seconds * (1000U / EPS_SYSTEM_CYCLE_TIME_MS);
+    eps_thermal_default_config(&config, BENCH_SAMPLE_TIME_S);
+
+    printf("=== EPS Thermal Model Validation ===\n");
+    printf("%u s of %.0f s parking manoeuvres at %.0f degC ambient, %u updates\n\n",
+           seconds, BENCH_CYCLE_S, BENCH_AMBIENT_C, steps);
+
+    bench_run(&config, steps, true, true, &derated);
+    bench_run(&config, steps, false, false, &no_derating);
+    bench_run(&config, steps, true, false, &timed);
+
+    passed = (derated.max_winding_error_k <= BENCH_MAX_MODEL_ERROR_K) &&
+             (derated.max_junction_error_k <= BENCH_MAX_MODEL_ERROR_K) &&
+             (derated.max_winding_c < BENCH_WINDING_LIMIT_C) &&
+             (derated.max_junction_c < BENCH_JUNCTION_LIMIT_C);
+
+    printf("Checks:\n");
+    printf("  Winding model error (max):   %.3f K (limit %.1f K)\n", derated.max_winding_error_k, BENCH_MAX_MODEL_ERROR_K);
+    printf("  Junction model error (max):  %.3f K (limit %.1f K)\n", derated.max_junction_error_k, BENCH_MAX_MODEL_ERROR_K);
+    printf("  Winding hot spot (max):      %.1f degC (limit %.0f degC)\n", derated.max_winding_c, BENCH_WINDING_LIMIT_C);
+    printf("  Junction hot spot (max):     %.1f degC (limit %.0f degC)\n\n", derated.max_junction_c, BENCH_JUNCTION_LIMIT_C);
+
+    printf("Derating:\n");
+    printf("  Minimum current limit:       %.1f A\n", derated.min_current_limit_a);
+    printf("  Time derated:                %.0f s (%.1f%%)\n", derated.derated_s, derated.derated_s / seconds * 100.0);
+    printf("  Without derating (max):      winding %.1f degC, junction %.1f degC\n\n",
+           no_derating.max_winding_c, no_derating.max_junction_c);
+
+    printf("Speed (model and plant, no reference):\n");
+    printf("  %.0f simulated s in %.3f s wall (%.0fx real time, %.1f ns per update)\n",
+           (double)seconds, timed.wall_s, seconds / timed.wall_s, timed.wall_s * 1e9 / steps);
+
+    printf("\n%s\n", passed ? "✓ Thermal checks passed" : "✗ Thermal checks failed");
+
+    return passed ? 0 : 1;
+}
+
+/**
+ * @brief Monotonic time
+ * @return double Time in seconds
+ */
+static double bench_now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Current demand of the parking manoeuvre
+ * @param t_s Time since start
+ * @return double q-axis current demand in A
+ */
+static double bench_demand_a(double t_s)
+{
+    double t = fmod(t_s, BENCH_CYCLE_S);
+
+    if (t < 3.0) {
+        return BENCH_LOCK_CURRENT_A * t / 3.0;          /* Towards lock */
+    } else if (t < 5.0) {
+        return BENCH_END_STOP_CURRENT_A;                /* End stop */
+    } else if (t < 8.0) {
+        return BENCH_LOCK_CURRENT_A;                    /* Across to the other lock */
+    } else if (t < 10.0) {
+        return BENCH_END_STOP_CURRENT_A;
+    } else if (t < 13.0) {
+        return BENCH_RETURN_CURRENT_A;                  /* Back to center */
+    }
+
+    return BENCH_IDLE_CURRENT_A;
+}
+
+/**
+ * @brief Advance the sensed nodes (motor housing, ECU board)
+ * @param plant Plant state
+ * @param copper_loss_w Copper loss
+ * @param switch_loss_w Power stage loss
+ * @param dt_s Step
+ */
+static void bench_sensed_step(bench_plant_t* plant, double copper_loss_w, double switch_loss_w, double dt_s)
+{
+    plant->housing_c += dt_s / BENCH_HOUSING_TAU_S *
+                        (BENCH_AMBIENT_C + BENCH_HOUSING_R_K_PER_W * copper_loss_w - plant->housing_c);
+    plant->board_c += dt_s / BENCH_BOARD_TAU_S *
+                      (BENCH_AMBIENT_C + BENCH_BOARD_R_K_PER_W * switch_loss_w - plant->board_c);
+}
+
+/**
+ * @brief Advance the reference network and the sensed nodes by one sample
+ * @param plant Reference and plant state
+ * @param config Thermal model configuration
+ * @param current_squared Sum of the squared phase currents over the sample
+ */
+static void bench_reference_step(bench_plant_t* plant, const eps_thermal_config_t* config, double current_squared)
+{
+    static const double weight[4] = { 0.0, 0.5, 0.5, 1.0 };
+    const double dt = (double)config->sample_time_s / BENCH_REFERENCE_SUBSTEPS;
+    const double switch_loss_w = current_squared * config->switch_resistance_ohm;
+
+    for (uint32_t i = 0; i < BENCH_REFERENCE_SUBSTEPS; i++) {
+        double k[4][EPS_THERMAL_NODES];
+        double copper_loss_w = 0.0;
+
+        /* Winding path: RK4, the loss depends on the winding temperature */
+        for (uint32_t stage = 0; stage < 4; stage++) {
+            double rise[EPS_THERMAL_NODES];
+            double winding_c = plant->housing_c;
+
+            for (uint32_t n = 0; n < EPS_THERMAL_NODES; n++) {
+                rise[n] = plant->winding_rise_k[n];
+                if (stage > 0) {
+                    rise[n] += weight[stage] * dt * k[stage - 1][n];
+                }
+                winding_c += rise[n];
+            }
+
+            copper_loss_w = current_squared * config->phase_resistance_ohm *
+                            (1.0 + config->copper_coeff_per_k * (winding_c - 20.0));
+            if (stage == 0) {
+                bench_sensed_step(plant, copper_loss_w, switch_loss_w, dt);
+            }
+
+            for (uint32_t n = 0; n < EPS_THERMAL_NODES; n++) {
+                k[stage][n] = (config->winding.resistance_k_per_w[n] * copper_loss_w - rise[n]) /
+                              config->winding.time_constant_s[n];
+            }
+        }
+
+        /* Junction path: constant loss, exact */
+        for (uint32_t n = 0; n < EPS_THERMAL_NODES; n++) {
+            double target = config->junction.resistance_k_per_w[n] * switch_loss_w;
+
+            plant->winding_rise_k[n] += dt / 6.0 * (k[0][n] + 2.0 * k[1][n] + 2.0 * k[2][n] + k[3][n]);
+            plant->junction_rise_k[n] = target + (plant->junction_rise_k[n] - target) *
+                                        exp(-dt / config->junction.time_constant_s[n]);
+        }
+    }
+}
+
+/**
+ * @brief Run the manoeuvres in closed loop
+ * @param config Thermal model configuration
+ * @param steps Number of control cycles
+ * @param derate Cap the current at the model's limit
+ * @param reference Compare against the reference network (slower)
+ * @param run Results
+ */
+static void bench_run(const eps_thermal_config_t* config, uint32_t steps, bool derate, bool reference,
+                      bench_run_t* run)
+{
+    eps_thermal_model_t model;
+    bench_plant_t plant;
+    double start_s;
+    float current_limit_a;
+
+    (void)eps_thermal_init(&model, config);
+    memset(&plant, 0, sizeof(plant));
+    memset(run, 0, sizeof(bench_run_t));
+    plant.housing_c = BENCH_AMBIENT_C;
+    plant.board_c = BENCH_AMBIENT_C;
+    current_limit_a = model.current_limit_a;
+    run->min_current_limit_a = current_limit_a;
+
+    start_s = bench_now_s();
+
+    for (uint32_t step = 0; step < steps; step++) {
+        double t_s = step * (double)config->sample_time_s;
+        double demand_a = bench_demand_a(t_s);
+        double theta = 2.0 * BENCH_PI * BENCH_ELECTRICAL_HZ * t_s;
+        float phase_current_a[3];
+        double current_squared;
+
+        if (derate && (demand_a > current_limit_a)) {
+            demand_a = current_limit_a;
+        }
+
+        phase_current_a[0] = (float)(demand_a * cos(theta));
+        phase_current_a[1] = (float)(demand_a * cos(theta - 2.0 * BENCH_PI / 3.0));
+        phase_current_a[2] = (float)(demand_a * cos(theta + 2.0 * BENCH_PI / 3.0));
+        current_squared = (double)phase_current_a[0] * phase_current_a[0] +
+                          (double)phase_current_a[1] * phase_current_a[1] +
+                          (double)phase_current_a[2] * phase_current_a[2];
+
+        /* Sensors as read at the start of the cycle */
+        current_limit_a = eps_thermal_update(&model, phase_current_a,
+                                             (float)plant.housing_c, (float)plant.board_c);
+
+        if (reference) {
+            double winding_error_k = 0.0;
+            double junction_error_k = 0.0;
+
+            bench_reference_step(&plant, config, current_squared);
+
+            /* Rises above the sensors (the model saw the sensors one sample earlier) */
+            for (uint32_t n = 0; n < EPS_THERMAL_NODES; n++) {
+                winding_error_k += model.winding_rise_k[n] - plant.winding_rise_k[n];
+                junction_error_k += model.junction_rise_k[n] - plant.junction_rise_k[n];
+            }
+
+            if (fabs(winding_error_k) > run->max_winding_error_k) {
+                run->max_winding_error_k = fabs(winding_error_k);
+            }
+            if (fabs(junction_error_k) > run->max_junction_error_k) {
+                run->max_junction_error_k = fabs(junction_error_k);
+            }
+        } else {
+            bench_sensed_step(&plant,
+                              current_squared * config->phase_resistance_ohm *
+                              (1.0 + config->copper_coeff_per_k * (model.winding_c - 20.0)),
+                              current_squared * config->switch_resistance_ohm,
+                              config->sample_time_s);
+        }
+
+        if (model.winding_c > run->max_winding_c) {
+            run->max_winding_c = model.winding_c;
+        }
+        if (model.junction_c > run->max_junction_c) {
+            run->max_junction_c = model.junction_c;
+        }
+        if (current_limit_a < run->min_current_limit_a) {
+            run->min_current_limit_a = current_limit_a;
+        }
+        if (current_limit_a < model.winding_derating.first_a) {
+            run->derated_s += config->sample_time_s;
+        }
+    }
+
+    run->wall_s = bench_now_s() - start_s;
+}